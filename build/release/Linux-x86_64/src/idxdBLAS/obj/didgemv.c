@@ -0,0 +1,196 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/*[[[cog
+import cog
+import generate
+import dataTypes
+from src.common import blockSize
+from scripts import terminal
+
+rounded_cache = 2**(int(terminal.get_cache()).bit_length() - 1)
+xy_block = rounded_cache//dataTypes.Double.byte_size
+y_block = max(xy_block//256, 1)
+
+cog.out(generate.generate(blockSize.BlockSize("didgemv", "Y_BLOCK", 1, y_block, y_block, ["bench_rdgemv_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("didgemv", "XY_BLOCK", y_block, xy_block, xy_block, ["bench_rdgemv_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("didgemv", "YT_BLOCK", 1, y_block, y_block, ["bench_rdgemv_fold_TransA_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("didgemv", "XYT_BLOCK", y_block, xy_block, xy_block, ["bench_rdgemv_fold_TransA_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+cog.out(generate.generate(blockSize.BlockSize("didgemv", "T_BLOCK", 1, 32, 32, ["bench_rdgemv_TransA_fold_{}".format(terminal.get_didefaultfold())]), cog.inFile, args, params, mode))
+]]]*/
+#define Y_BLOCK 8
+#define XY_BLOCK 32768
+#define YT_BLOCK 128
+#define XYT_BLOCK 32768
+#define T_BLOCK 8
+//[[[end]]]
+#define X_BLOCK (XY_BLOCK/Y_BLOCK)
+#define XT_BLOCK (XYT_BLOCK/YT_BLOCK)
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of double precision matrix A and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @author Peter Ahrens
+ * @date   18 Jan 2016
+ */
+void idxdBLAS_didgemv(const int fold, const char Order,
+                      const char TransA, const int M, const int N,
+                      const double alpha, const double *A, const int lda,
+                      const double *X, const int incX,
+                      double_indexed *Y, const int incY){
+  idxdBLAS_didgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of double precision matrix A and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * Same as #idxdBLAS_didgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didgemv_64(const int fold, const char Order,
+                         const char TransA, const int64_t M, const int64_t N,
+                         const double alpha, const double *A, const int64_t lda,
+                         const double *X, const int64_t incX,
+                         double_indexed *Y, const int64_t incY){
+  int64_t i;
+  int64_t ii;
+  int64_t iii;
+  int64_t j;
+  int64_t jj;
+  int64_t jjj;
+  double *bufX;
+  int64_t incbufX;
+  double *bufA;
+
+  if(M == 0 || N == 0 || alpha == 0.0){
+    return;
+  }
+
+  switch(Order){
+
+    //row major
+    case 'r':
+    case 'R':
+      switch(TransA){
+
+        //row major A not transposed
+        case 'n':
+        case 'N':
+          if(alpha == 1.0){
+            bufX = (double*)X;
+            incbufX = incX;
+          }else{
+            bufX = (double*)malloc(N * sizeof(double));
+            for(j = 0; j < N; j++){
+              bufX[j] = X[j * incX] * alpha;
+            }
+            incbufX = 1;
+          }
+          for(i = 0; i < M; i += Y_BLOCK){
+            for(j = 0; j < N; j += X_BLOCK){
+              for(ii = i; ii < M && ii < i + Y_BLOCK; ii++){
+                idxdBLAS_diddot_64(fold, MIN(X_BLOCK, N - j), A + ii * lda + j, 1, bufX + j * incbufX, incbufX, Y + ii * incY * idxd_dinum(fold));
+              }
+            }
+          }
+          if(alpha != 1.0){
+            free(bufX);
+          }
+          break;
+
+        //row major A transposed
+        default:
+          if(alpha == 1.0){
+            bufX = (double*)X;
+            incbufX = incX;
+          }else{
+            bufX = (double*)malloc(M * sizeof(double));
+            for(j = 0; j < M; j++){
+              bufX[j] = X[j * incX] * alpha;
+            }
+            incbufX = 1;
+          }
+          bufA = (double*)malloc(XT_BLOCK * YT_BLOCK * sizeof(double));
+          for(i = 0; i < N; i += YT_BLOCK){
+            for(j = 0; j < M; j += XT_BLOCK){
+              for(jj = j; jj < M && jj < j + XT_BLOCK; jj += T_BLOCK){
+                for(ii = i; ii < N && ii < i + YT_BLOCK; ii+= T_BLOCK){
+                  for(jjj = jj; jjj < M && jjj < jj + MIN(T_BLOCK, XT_BLOCK); jjj++){
+                    for(iii = ii; iii < N && iii < ii + MIN(T_BLOCK, YT_BLOCK); iii++){
+                      bufA[(iii - i) * XT_BLOCK + (jjj - j)] = A[jjj * lda + iii];
+                    }
+                  }
+                }
+              }
+              for(ii = i; ii < N && ii < i + YT_BLOCK; ii++){
+                idxdBLAS_diddot_64(fold, MIN(XT_BLOCK, M - j), bufA + (ii - i) * XT_BLOCK, 1, bufX + j * incbufX, incbufX, Y + ii * incY * idxd_dinum(fold));
+              }
+            }
+          }
+          free(bufA);
+          if(alpha != 1.0){
+            free(bufX);
+          }
+          break;
+      }
+      break;
+
+    //column major
+    default:
+      switch(TransA){
+
+        //column major A not transposed
+        case 'n':
+        case 'N':
+          idxdBLAS_didgemv_64(fold, 'r', 't', N, M, alpha, A, lda, X, incX, Y, incY);
+          break;
+
+        //column major A transposed
+        default:
+          idxdBLAS_didgemv_64(fold, 'r', 'n', N, M, alpha, A, lda, X, incX, Y, incY);
+          break;
+      }
+      break;
+  }
+}
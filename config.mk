@@ -18,9 +18,18 @@ CC = cc
 #CC = craycc
 #CC = clang
 
+# select C++ compiler (only used to build the checks of the C++ interface)
+CXX = c++
+#CXX = g++
+#CXX = icpc
+#CXX = clang++
+
 # add CFLAGS
 CFLAGS += -Wall -std=c99 -pedantic
 
+# add CXXFLAGS
+CXXFLAGS += -Wall -std=c++11 -pedantic
+
 # add CPPFLAGS
 CPPFLAGS +=
 
@@ -42,6 +51,14 @@ BUILD_MPI = false
 #MPICFLAGS = $(shell mpicc -link_info)
 #MPICFLAGS =
 
+# select OpenMP compiler flags (comment all to build without OpenMP, in which case the OpenMP checks and benchmarks won't build)
+OMPFLAGS = -fopenmp
+#OMPFLAGS = -qopenmp
+#OMPFLAGS = -mp
+
+# select POSIX threads flags (comment all to build without POSIX threads, in which case the idxdPool thread pools run all tasks on the calling thread)
+PTHREADFLAGS = -pthread
+
 # select python (comment all for auto)
 #PYTHON = python
 #PYTHON = python3
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <omp.h>
+#include <idxd.h>
+#include <idxdOMP.h>
+
+int main(int argc, char** argv){
+  int n = 10000000;
+  double *x = malloc(n * sizeof(double));
+  double sum;
+  double elapsed_time;
+  int max_threads = omp_get_max_threads();
+
+  printf("Sum of sin(2* M_PI * (i / (double)n - 0.5)).  n = %d.\n\n", n);
+
+  // Set x to be a sine wave
+  for(int i = 0; i < n; i++){
+    x[i] = sin(2 * M_PI * (i / (double)n - 0.5));
+  }
+
+  // Make a header
+  printf("%15s : %7s : Time (s) : Sum\n", "Sum Method", "Threads");
+
+  // First, we sum x using the builtin OpenMP reduction. The result depends
+  // on the number of threads.
+  for(int threads = 1; threads <= max_threads; threads *= 2){
+    omp_set_num_threads(threads);
+    elapsed_time = omp_get_wtime();
+    sum = 0;
+    #pragma omp parallel for reduction(+:sum)
+    for(int i = 0; i < n; i++){
+      sum += x[i];
+    }
+    elapsed_time = omp_get_wtime() - elapsed_time;
+
+    printf("%15s : %7d : %-8g : %.17e\n", "double", threads, elapsed_time, sum);
+  }
+
+  // Next, we sum x using an indexed reduction variable. The result does not
+  // depend on the number of threads or on the schedule.
+  idxdOMP_double_indexed isum;
+  for(int threads = 1; threads <= max_threads; threads *= 2){
+    omp_set_num_threads(threads);
+    elapsed_time = omp_get_wtime();
+    idxdOMP_disetzero(3, &isum);
+    #pragma omp parallel for schedule(dynamic, 1024) reduction(+:isum)
+    for(int i = 0; i < n; i++){
+      idxdOMP_didadd(x[i], &isum);
+    }
+    sum = idxdOMP_ddiconv(&isum);
+    elapsed_time = omp_get_wtime() - elapsed_time;
+
+    printf("%15s : %7d : %-8g : %.17e\n", "idxdOMP", threads, elapsed_time, sum);
+  }
+
+  free(x);
+}
@@ -1,4 +1,4 @@
 TARGETS :=
 SUBDIRS :=
 
-INSTALL_INC += idxd.h idxdBLAS.h idxdMPI.h reproBLAS.h
+INSTALL_INC += idxd.h idxdBLAS.h idxdIO.h idxdInline.h idxdMPI.h idxdOMP.h idxdPool.h idxdShard.h reproBLAS.h reproBLAS.hpp
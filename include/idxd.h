@@ -36,6 +36,10 @@
 #include <stdlib.h>
 #include <float.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief The indexed double datatype
  *
@@ -376,4 +380,8 @@ float idxd_sisiaddsq(const int fold, const float scaleX, const float_indexed *X,
 
 double idxd_ufp(const double X);
 float idxd_ufpf(const float X);
+#ifdef __cplusplus
+}
+#endif
+
 #endif
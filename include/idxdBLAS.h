@@ -26,14 +26,117 @@
  *
  * The parameter @c fold describes how many accumulators are used in the indexed types supplied to a subroutine (an indexed type with @c k accumulators  is @c k-fold). The default value for this parameter can be set in config.h. If you are unsure of what value to use for @c fold, we recommend 3. Note that the @c fold of indexed types must be the same for all indexed types that interact with each other. Operations on more than one indexed type assume all indexed types being operated upon have the same @c fold. Note that the @c fold of an indexed type may not be changed once the type has been allocated. A common use case would be to set the value of @c fold as a global macro in your code and supply it to all indexed functions that you use.
  *
+ * Each routine has a variant suffixed by @c _64 in which vector lengths, strides, matrix dimensions and leading dimensions are 64-bit integers (@c int64_t), for inputs with more than 2^31 - 1 elements. The variants are reproducible with the corresponding 32-bit routines. Since indexed single precision types can only sum #idxd_SICAPACITY elements, the single precision variants set their indexed output to NaN if given more, so that the NaN propagates to everything it is added to and to its conversion. The check is made on the elements of each call, not on those already accumulated in the output, so a caller adding many chunks to the same indexed type must itself keep their total within #idxd_SICAPACITY. The capacity of indexed double precision types, #idxd_DICAPACITY, is too large to be reached by 64-bit lengths.
+ *
+ * Routines such as idxdBLAS_dissum() accumulate single precision inputs in indexed double precision types. Their inputs are converted exactly to double precision in blocks, which lets them renormalize less often and reach greater accuracy than the single precision indexed routines. Results rounded to single precision remain reproducible. idxdBLAS_disgemv() and idxdBLAS_disgemm() likewise convert tiles of their single precision matrices to double precision one at a time.
+ *
+ * Routines such as idxdBLAS_dihsum() and idxdBLAS_dibsum() accumulate IEEE half precision (binary16) and bfloat16 inputs in indexed double precision types in the same way. These inputs are given as @c uint16_t bit patterns and are converted with F16C or AVX-512 instructions when available.
+ *
+ * Dot products suffixed by @c _fma, such as idxdBLAS_diddot_fma(), split each product into its rounded value and rounding error with fused multiply-add and deposit both, so that only the accumulation of the exact products is inexact. They reach greater accuracy than the plain dot products at the same fold, and so can often use a smaller one.
+ *
+ * idxdBLAS_zizgemv_planar() and idxdBLAS_zizgemm_planar() take complex matrices and vectors in planar layout, as separate arrays of real and imaginary parts, which idxdBLAS_zdeinterleave() packs from interleaved data. They deposit into indexed complex types with the real indexed kernels and give the same results as idxdBLAS_zizgemv() and idxdBLAS_zizgemm().
+ *
+ * idxdBLAS_didsyrk(), idxdBLAS_sissyrk() and idxdBLAS_zizherk() update only the upper or lower triangle of an indexed matrix with a symmetric (or hermitian) rank-k product. Each element of the triangle is the same as that of the corresponding matrix-matrix product routine.
+ *
+ * idxdBLAS_didcsrmv() and idxdBLAS_siscsrmv() multiply sparse matrices in compressed sparse row format. Each element of the output is updated once with the largest absolute value of its products. For matrices that are multiplied repeatedly, idxdBLAS_dcsramax() and idxdBLAS_scsramax() compute the largest absolute values of the rows ahead of time, and their bound on the products of a row replaces a pass over the row whenever it lies in the same bin.
+ *
+ * idxdBLAS_didgesum(), idxdBLAS_didgeasum() and idxdBLAS_didgessq() (and their single precision counterparts) reduce every row or every column of a matrix into a vector of indexed types in one sweep of the matrix in its storage order. Each element of the output is the same as that of the corresponding vector routine applied to its row or column.
+ *
+ * idxdBLAS_didmoments() and idxdBLAS_sismoments() sum the first few powers of the (shifted) elements of a vector into several indexed types while reading the vector once.
+ *
+ * idxdBLAS_didsegsum() and idxdBLAS_didkeysum() (and their single precision counterparts) sum the segments of a vector, or its elements grouped by key, into a vector of indexed types. Each element of the output is the same as that of idxdBLAS_didsum() applied to its segment or key, whatever the order of the elements and the number of threads.
+ *
+ * idxdBLAS_didscan() and idxdBLAS_didexscan() (and their single precision counterparts) compute the inclusive and exclusive prefix sums of a vector starting from an indexed scalar, to which the vector is added. Each prefix sum is the conversion of the indexed sum of its prefix, whatever the number of threads.
+ *
+ * idxdBLAS_didgemvdot() and idxdBLAS_sisgemvdot() add a matrix-vector product to a vector of indexed types and add the dot product of a given vector with the (converted) result to an indexed scalar, reading the matrix once and converting each block of the output while it is in cache.
+ *
+ * idxdBLAS_didaxpbydot() and idxdBLAS_didaxpbyssq() (and their single precision and complex counterparts) update a vector with a scaled vector, as in an axpy, and add the dot product of a given vector with the updated vector, or its sum of squares, to an indexed scalar in the same sweep, so that the updated vector is read once.
+ *
+ * idxdBLAS_didmdot() and idxdBLAS_sismdot() add the dot products of several requested pairs among k vectors to a vector of indexed types, reading the vectors a block at a time so that each is loaded once per block however many pairs it appears in.
+ *
+ * A matrix that is multiplied many times can be packed once with idxdBLAS_dpack() or idxdBLAS_spack(), which store it by rows along with the largest absolute value of each panel of each row. idxdBLAS_didgemv_packed(), idxdBLAS_didgemm_packed() and their single precision counterparts then read the packed rows directly, and use the stored values to bound the products of each panel. When the bound shows which bin the largest product falls in, the products are deposited without computing their largest absolute value. The results are the same as those of idxdBLAS_didgemv() and idxdBLAS_didgemm() on the unpacked matrix.
+ *
+ * idxdBLAS_didsum_bounded(), idxdBLAS_didasum_bounded() and idxdBLAS_diddot_bounded() (and their single precision counterparts) take a bound on the absolute values of their inputs or products, such as one known from the computation that produced them, and update the indexed type with it instead of computing the largest absolute value, so that the inputs are read once. The results are the same as those of the routines without the bound if the bound is at least the largest absolute value and falls in the same bin. idxdBLAS_set_check_bounds() turns on a check of the bounds, which computes the largest absolute value anyway and reports invalid bounds.
+ *
  * @internal
  * Power users of the library may find themselves wanting to manually specify the underlying primary and carry vectors of an indexed type themselves. If you do not know what these are, don't worry about the manually specified indexed types.
  */
 #ifndef IDXDBLAS_H_
 #define IDXDBLAS_H_
+#include <stdint.h>
 #include "idxd.h"
 #include "reproBLAS.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @internal
+ * @brief The largest number of elements passed at once by a 64-bit routine to the corresponding 32-bit routine
+ */
+#define idxdBLAS_CHUNK_64 (1 << 30)
+
+/**
+ * @internal
+ * @brief The largest offset (in magnitude) of an element from the start of a chunk passed by a 64-bit routine to the corresponding 32-bit routine, as the product of its index and the stride
+ *
+ * Twice this offset, the offset in the real and imaginary parts of a complex vector, still fits an @c int.
+ */
+#define idxdBLAS_MAXOFFSET_64 ((1 << 30) - 1)
+
+/**
+ * @internal
+ * @brief The number of double precision values to which single, half or bfloat16 precision inputs are converted at once before being accumulated in indexed double precision types
+ */
+#define idxdBLAS_WIDEN_BLOCK 2048
+
+/**
+ * @internal
+ * @brief The number of columns in each panel of a packed matrix
+ */
+#define idxdBLAS_PACKED_PANEL 1024
+
+/**
+ * @internal
+ * @brief The alignment (in bytes) of the rows of a packed matrix
+ */
+#define idxdBLAS_PACKED_ALIGN 64
+
+/**
+ * @brief A double precision matrix packed for repeated products
+ *
+ * To create an #idxdBLAS_dpacked, call idxdBLAS_dpack(). To free it, call idxdBLAS_dpacked_free().
+ *
+ * The rows of op(A) are stored contiguously, each starting on an #idxdBLAS_PACKED_ALIGN byte boundary, and are split into panels of #idxdBLAS_PACKED_PANEL columns. The largest absolute value in each panel of each row is stored along with its position in the panel.
+ */
+typedef struct idxdBLAS_dpacked_ {
+  int64_t M; /**< number of rows of op(A) */
+  int64_t N; /**< number of columns of op(A) */
+  int64_t ldA; /**< distance between the rows of @c A */
+  int64_t npanels; /**< number of panels in each row */
+  double *A; /**< the rows of op(A) */
+  double *amax; /**< @c amax[i * npanels + p] is the largest absolute value in panel @c p of row @c i (NaN if the panel holds a NaN) */
+  int *iamax; /**< @c iamax[i * npanels + p] is the position of @c amax[i * npanels + p] in its panel */
+} idxdBLAS_dpacked;
+
+/**
+ * @brief A single precision matrix packed for repeated products
+ *
+ * To create an #idxdBLAS_spacked, call idxdBLAS_spack(). To free it, call idxdBLAS_spacked_free().
+ *
+ * The layout is that of #idxdBLAS_dpacked.
+ */
+typedef struct idxdBLAS_spacked_ {
+  int64_t M; /**< number of rows of op(A) */
+  int64_t N; /**< number of columns of op(A) */
+  int64_t ldA; /**< distance between the rows of @c A */
+  int64_t npanels; /**< number of panels in each row */
+  float *A; /**< the rows of op(A) */
+  float *amax; /**< @c amax[i * npanels + p] is the largest absolute value in panel @c p of row @c i (NaN if the panel holds a NaN) */
+  int *iamax; /**< @c iamax[i * npanels + p] is the position of @c amax[i * npanels + p] in its panel */
+} idxdBLAS_spacked;
+
 float idxdBLAS_samax(const int N, const float *X, const int incX);
 double idxdBLAS_damax(const int N, const double *X, const int incX);
 void idxdBLAS_camax_sub(const int N, const void *X, const int incX, void *amax);
@@ -46,12 +149,15 @@ void idxdBLAS_zamaxm_sub(const int N, const void *X, const int incX, const void
 
 void idxdBLAS_didsum(const int fold, const int N, const double *X, const int incX, double_indexed *Y);
 void idxdBLAS_dmdsum(const int fold, const int N, const double *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dmdsum_bounded(const int fold, const int N, const double *X, const int incX, const double bound, double *priY, const int incpriY, double *carY, const int inccarY);
 void idxdBLAS_didasum(const int fold, const int N, const double *X, const int incX, double_indexed *Y);
 void idxdBLAS_dmdasum(const int fold, const int N, const double *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dmdasum_bounded(const int fold, const int N, const double *X, const int incX, const double bound, double *priY, const int incpriY, double *carY, const int inccarY);
 double idxdBLAS_didssq(const int fold, const int N, const double *X, const int incX, const double scaleY, double_indexed *Y);
 double idxdBLAS_dmdssq(const int fold, const int N, const double *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
 void idxdBLAS_diddot(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double_indexed *Z);
 void idxdBLAS_dmddot(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_dmddot_bounded(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, const double bound, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
 
 void idxdBLAS_zizsum(const int fold, const int N, const void *X, const int incX, double_indexed *Y);
 void idxdBLAS_zmzsum(const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
@@ -64,14 +170,65 @@ void idxdBLAS_zmzdotu(const int fold, const int N, const void *X, const int incX
 void idxdBLAS_zizdotc(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_indexed *Z);
 void idxdBLAS_zmzdotc(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
 
+void idxdBLAS_dissum(const int fold, const int N, const float *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmssum(const int fold, const int N, const float *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_disasum(const int fold, const int N, const float *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmsasum(const int fold, const int N, const float *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_disssq(const int fold, const int N, const float *X, const int incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmsssq(const int fold, const int N, const float *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_disdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, double_indexed *Z);
+void idxdBLAS_dmsdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_zicsum(const int fold, const int N, const void *X, const int incX, double_complex_indexed *Y);
+void idxdBLAS_zmcsum(const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dicasum(const int fold, const int N, const void *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmcasum(const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dicssq(const int fold, const int N, const void *X, const int incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmcssq(const int fold, const int N, const void *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_zicdotu(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_complex_indexed *Z);
+void idxdBLAS_zmcdotu(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_zicdotc(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_complex_indexed *Z);
+void idxdBLAS_zmcdotc(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_dihsum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmhsum(const int fold, const int N, const uint16_t *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dihasum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmhasum(const int fold, const int N, const uint16_t *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dihssq(const int fold, const int N, const uint16_t *X, const int incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmhssq(const int fold, const int N, const uint16_t *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dihdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double_indexed *Z);
+void idxdBLAS_dmhdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_dibsum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmbsum(const int fold, const int N, const uint16_t *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dibasum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y);
+void idxdBLAS_dmbasum(const int fold, const int N, const uint16_t *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dibssq(const int fold, const int N, const uint16_t *X, const int incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmbssq(const int fold, const int N, const uint16_t *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dibdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double_indexed *Z);
+void idxdBLAS_dmbdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+
+void idxdBLAS_diddot_fma(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double_indexed *Z);
+void idxdBLAS_dmddot_fma(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_sisdot_fma(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float_indexed *Z);
+void idxdBLAS_smsdot_fma(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_zizdotu_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_indexed *Z);
+void idxdBLAS_zmzdotu_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_zizdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_indexed *Z);
+void idxdBLAS_zmzdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_cicdotu_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float_indexed *Z);
+void idxdBLAS_cmcdotu_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_cicdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float_indexed *Z);
+void idxdBLAS_cmcdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+
 void idxdBLAS_sissum(const int fold, const int N, const float *X, const int incX, float_indexed *Y);
 void idxdBLAS_smssum(const int fold, const int N, const float *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_smssum_bounded(const int fold, const int N, const float *X, const int incX, const float bound, float *priY, const int incpriY, float *carY, const int inccarY);
 void idxdBLAS_sisasum(const int fold, const int N, const float *X, const int incX, float_indexed *Y);
 void idxdBLAS_smsasum(const int fold, const int N, const float *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_smsasum_bounded(const int fold, const int N, const float *X, const int incX, const float bound, float *priY, const int incpriY, float *carY, const int inccarY);
 float idxdBLAS_sisssq(const int fold, const int N, const float *X, const int incX, const float scaleY, float_indexed *Y);
 float idxdBLAS_smsssq(const int fold, const int N, const float *X, const int incX, const float scaleY, float *priY, const int incpriY, float *carY, const int inccarY);
 void idxdBLAS_sisdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float_indexed *Z);
 void idxdBLAS_smsdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_smsdot_bounded(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, const float bound, float *priZ, const int incpriZ, float *carZ, const int inccarZ);
 
 void idxdBLAS_cicsum(const int fold, const int N, const void *X, const int incX, float_indexed *Y);
 void idxdBLAS_cmcsum(const int fold, const int N, const void *X, const int incX, float *priY, const int incpriY, float *carY, const int inccarY);
@@ -132,4 +289,494 @@ void idxdBLAS_cicgemm(const int fold, const char Order,
              const void *B, const int ldb,
              float_complex_indexed *C, const int ldc);
 
+void idxdBLAS_disgemv(const int fold, const char Order, const char TransA,
+             const int M, const int N,
+             const double alpha, const float *A, const int lda,
+             const float *X, const int incX,
+             double_indexed *Y, const int incY);
+void idxdBLAS_disgemm(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const double alpha, const float *A, const int lda,
+             const float *B, const int ldb,
+             double_indexed *C, const int ldc);
+
+void idxdBLAS_zizgemv_planar(const int fold, const char Order, const char TransA,
+             const int M, const int N,
+             const void *alpha, const double *AR, const double *AI, const int lda,
+             const double *XR, const double *XI, const int incX,
+             double_complex_indexed *Y, const int incY);
+void idxdBLAS_zizgemm_planar(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int M, const int N, const int K,
+             const void *alpha, const double *AR, const double *AI, const int lda,
+             const double *BR, const double *BI, const int ldb,
+             double_complex_indexed *C, const int ldc);
+void idxdBLAS_zdeinterleave(const int N, const void *X, const int incX, double *XR, double *XI);
+
+void idxdBLAS_didsyrk(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int N, const int K,
+             const double alpha, const double *A, const int lda,
+             double_indexed *C, const int ldc);
+void idxdBLAS_sissyrk(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int N, const int K,
+             const float alpha, const float *A, const int lda,
+             float_indexed *C, const int ldc);
+void idxdBLAS_zizherk(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int N, const int K,
+             const double alpha, const void *A, const int lda,
+             double_complex_indexed *C, const int ldc);
+
+void idxdBLAS_dcsramax(const int M, const double *val, const int *rowptr, double *rowmax);
+void idxdBLAS_didcsrmv(const int fold, const char TransA,
+             const int M, const int N,
+             const double alpha, const double *val, const int *rowptr, const int *colind,
+             const double *rowmax, const double *X, const int incX,
+             double_indexed *Y, const int incY);
+void idxdBLAS_scsramax(const int M, const float *val, const int *rowptr, float *rowmax);
+void idxdBLAS_siscsrmv(const int fold, const char TransA,
+             const int M, const int N,
+             const float alpha, const float *val, const int *rowptr, const int *colind,
+             const float *rowmax, const float *X, const int incX,
+             float_indexed *Y, const int incY);
+
+void idxdBLAS_didgesum(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const double *A, const int lda,
+             double_indexed *Y, const int incY);
+void idxdBLAS_didgeasum(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const double *A, const int lda,
+             double_indexed *Y, const int incY);
+void idxdBLAS_didgessq(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const double *A, const int lda,
+             double *scaleY, double_indexed *Y, const int incY);
+void idxdBLAS_sisgesum(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const float *A, const int lda,
+             float_indexed *Y, const int incY);
+void idxdBLAS_sisgeasum(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const float *A, const int lda,
+             float_indexed *Y, const int incY);
+void idxdBLAS_sisgessq(const int fold, const char Order, const char Dim,
+             const int M, const int N,
+             const float *A, const int lda,
+             float *scaleY, float_indexed *Y, const int incY);
+
+void idxdBLAS_didmoments(const int fold, const int order, const int N, const double *X, const int incX, const double shift, double_indexed *Y);
+void idxdBLAS_sismoments(const int fold, const int order, const int N, const float *X, const int incX, const float shift, float_indexed *Y);
+
+void idxdBLAS_didsegsum(const int fold, const int nseg, const int *segptr,
+             const double *X, const int incX,
+             double_indexed *Y, const int incY);
+void idxdBLAS_sissegsum(const int fold, const int nseg, const int *segptr,
+             const float *X, const int incX,
+             float_indexed *Y, const int incY);
+void idxdBLAS_didkeysum(const int fold, const int N, const int *keys,
+             const double *X, const int incX, const int nkeys,
+             double_indexed *Y, const int incY);
+void idxdBLAS_siskeysum(const int fold, const int N, const int *keys,
+             const float *X, const int incX, const int nkeys,
+             float_indexed *Y, const int incY);
+
+void idxdBLAS_didscan(const int fold, const int N, const double *X, const int incX, double_indexed *S, double *Y, const int incY);
+void idxdBLAS_didexscan(const int fold, const int N, const double *X, const int incX, double_indexed *S, double *Y, const int incY);
+void idxdBLAS_sisscan(const int fold, const int N, const float *X, const int incX, float_indexed *S, float *Y, const int incY);
+void idxdBLAS_sisexscan(const int fold, const int N, const float *X, const int incX, float_indexed *S, float *Y, const int incY);
+
+void idxdBLAS_didgemvdot(const int fold, const char Order, const char TransA,
+             const int M, const int N,
+             const double alpha, const double *A, const int lda,
+             const double *X, const int incX,
+             double_indexed *Y, const int incY,
+             const double *W, const int incW,
+             double_indexed *D);
+void idxdBLAS_sisgemvdot(const int fold, const char Order, const char TransA,
+             const int M, const int N,
+             const float alpha, const float *A, const int lda,
+             const float *X, const int incX,
+             float_indexed *Y, const int incY,
+             const float *W, const int incW,
+             float_indexed *D);
+
+void idxdBLAS_didaxpbydot(const int fold, const int N, const double alpha, const double *X, const int incX,
+             const double beta, double *Y, const int incY, const double *W, const int incW,
+             double_indexed *Z);
+void idxdBLAS_sisaxpbydot(const int fold, const int N, const float alpha, const float *X, const int incX,
+             const float beta, float *Y, const int incY, const float *W, const int incW,
+             float_indexed *Z);
+void idxdBLAS_zizaxpbydotc(const int fold, const int N, const void *alpha, const void *X, const int incX,
+             const void *beta, void *Y, const int incY, const void *W, const int incW,
+             double_complex_indexed *Z);
+void idxdBLAS_cicaxpbydotc(const int fold, const int N, const void *alpha, const void *X, const int incX,
+             const void *beta, void *Y, const int incY, const void *W, const int incW,
+             float_complex_indexed *Z);
+double idxdBLAS_didaxpbyssq(const int fold, const int N, const double alpha, const double *X, const int incX,
+             const double beta, double *Y, const int incY, const double scaleZ, double_indexed *Z);
+float idxdBLAS_sisaxpbyssq(const int fold, const int N, const float alpha, const float *X, const int incX,
+             const float beta, float *Y, const int incY, const float scaleZ, float_indexed *Z);
+double idxdBLAS_dizaxpbyssq(const int fold, const int N, const void *alpha, const void *X, const int incX,
+             const void *beta, void *Y, const int incY, const double scaleZ, double_indexed *Z);
+float idxdBLAS_sicaxpbyssq(const int fold, const int N, const void *alpha, const void *X, const int incX,
+             const void *beta, void *Y, const int incY, const float scaleZ, float_indexed *Z);
+void idxdBLAS_didmdot(const int fold, const int N, const int k, const double *X, const int ldX, const int incX,
+             const int npairs, const int *pairs, double_indexed *Z);
+void idxdBLAS_sismdot(const int fold, const int N, const int k, const float *X, const int ldX, const int incX,
+             const int npairs, const int *pairs, float_indexed *Z);
+
+idxdBLAS_dpacked *idxdBLAS_dpack(const char Order, const char TransA, const int M, const int N, const double *A, const int lda);
+idxdBLAS_spacked *idxdBLAS_spack(const char Order, const char TransA, const int M, const int N, const float *A, const int lda);
+void idxdBLAS_dpacked_free(idxdBLAS_dpacked *A);
+void idxdBLAS_spacked_free(idxdBLAS_spacked *A);
+double idxdBLAS_dpacked_amax(const int N, const double *X, int *iamax);
+float idxdBLAS_spacked_amax(const int N, const float *X, int *iamax);
+void idxdBLAS_didpacked_dot(const int fold, const int N, const double *X, const double amaxX, const int iamaxX,
+             const double *Y, const double amaxY, const int iamaxY, double_indexed *Z);
+void idxdBLAS_sispacked_dot(const int fold, const int N, const float *X, const float amaxX, const int iamaxX,
+             const float *Y, const float amaxY, const int iamaxY, float_indexed *Z);
+void idxdBLAS_didgemv_packed(const int fold, const double alpha, const idxdBLAS_dpacked *A,
+             const double *X, const int incX, double_indexed *Y, const int incY);
+void idxdBLAS_sisgemv_packed(const int fold, const float alpha, const idxdBLAS_spacked *A,
+             const float *X, const int incX, float_indexed *Y, const int incY);
+void idxdBLAS_didgemm_packed(const int fold, const char Order, const char TransB, const int N, const double alpha,
+             const idxdBLAS_dpacked *A, const double *B, const int ldb, double_indexed *C, const int ldc);
+void idxdBLAS_sisgemm_packed(const int fold, const char Order, const char TransB, const int N, const float alpha,
+             const idxdBLAS_spacked *A, const float *B, const int ldb, float_indexed *C, const int ldc);
+
+void idxdBLAS_set_check_bounds(const int check);
+int idxdBLAS_get_check_bounds(void);
+void idxdBLAS_didsum_bounded(const int fold, const int N, const double *X, const int incX, const double bound, double_indexed *Y);
+void idxdBLAS_didasum_bounded(const int fold, const int N, const double *X, const int incX, const double bound, double_indexed *Y);
+void idxdBLAS_diddot_bounded(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, const double bound, double_indexed *Z);
+void idxdBLAS_sissum_bounded(const int fold, const int N, const float *X, const int incX, const float bound, float_indexed *Y);
+void idxdBLAS_sisasum_bounded(const int fold, const int N, const float *X, const int incX, const float bound, float_indexed *Y);
+void idxdBLAS_sisdot_bounded(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, const float bound, float_indexed *Z);
+
+float idxdBLAS_samax_64(const int64_t N, const float *X, const int64_t incX);
+double idxdBLAS_damax_64(const int64_t N, const double *X, const int64_t incX);
+void idxdBLAS_camax_sub_64(const int64_t N, const void *X, const int64_t incX, void *amax);
+void idxdBLAS_zamax_sub_64(const int64_t N, const void *X, const int64_t incX, void *amax);
+
+float idxdBLAS_samaxm_64(const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY);
+double idxdBLAS_damaxm_64(const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY);
+void idxdBLAS_camaxm_sub_64(const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, void *amaxm);
+void idxdBLAS_zamaxm_sub_64(const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, void *amaxm);
+
+void idxdBLAS_didsum_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmdsum_64(const int fold, const int64_t N, const double *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_didasum_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmdasum_64(const int fold, const int64_t N, const double *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_didssq_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmdssq_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_diddot_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_dmddot_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+
+void idxdBLAS_zizsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_zmzsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dizasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmzasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dizssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmzssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_zizdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_zmzdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_zizdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_zmzdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+
+void idxdBLAS_dissum_64(const int fold, const int64_t N, const float *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmssum_64(const int fold, const int64_t N, const float *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_disasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmsasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_disssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmsssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_disdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_dmsdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_zicsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_complex_indexed *Y);
+void idxdBLAS_zmcsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dicasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmcasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dicssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmcssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_zicdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_complex_indexed *Z);
+void idxdBLAS_zmcdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_zicdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_complex_indexed *Z);
+void idxdBLAS_zmcdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_dihsum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmhsum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dihasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmhasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dihssq_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmhssq_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dihdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_dmhdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+void idxdBLAS_dibsum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmbsum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dibasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y);
+void idxdBLAS_dmbasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY);
+double idxdBLAS_dibssq_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const double scaleY, double_indexed *Y);
+double idxdBLAS_dmbssq_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY);
+void idxdBLAS_dibdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_dmbdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ);
+
+void idxdBLAS_diddot_fma_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_dmddot_fma_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_sisdot_fma_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_smsdot_fma_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_zizdotu_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_zmzdotu_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_zizdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_indexed *Z);
+void idxdBLAS_zmzdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double *manZ, const int incmanZ, double *carZ, const int inccarZ);
+void idxdBLAS_cicdotu_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_cmcdotu_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_cicdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_cmcdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+
+void idxdBLAS_sissum_64(const int fold, const int64_t N, const float *X, const int64_t incX, float_indexed *Y);
+void idxdBLAS_smssum_64(const int fold, const int64_t N, const float *X, const int64_t incX, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_sisasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, float_indexed *Y);
+void idxdBLAS_smsasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, float *priY, const int incpriY, float *carY, const int inccarY);
+float idxdBLAS_sisssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float scaleY, float_indexed *Y);
+float idxdBLAS_smsssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float scaleY, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_sisdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_smsdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+
+void idxdBLAS_cicsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float_indexed *Y);
+void idxdBLAS_cmcsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_sicasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float_indexed *Y);
+void idxdBLAS_smcasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float *priY, const int incpriY, float *carY, const int inccarY);
+float idxdBLAS_sicssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const float scaleY, float_indexed *Y);
+float idxdBLAS_smcssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const float scaleY, float *priY, const int incpriY, float *carY, const int inccarY);
+void idxdBLAS_cicdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_cmcdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+void idxdBLAS_cicdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float_indexed *Z);
+void idxdBLAS_cmcdotc_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float *manZ, const int incmanZ, float *carZ, const int inccarZ);
+
+void idxdBLAS_didgemv_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const double alpha, const double *A, const int64_t lda,
+             const double *X, const int64_t incX,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_didgemm_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const double alpha, const double *A, const int64_t lda,
+             const double *B, const int64_t ldb,
+             double_indexed *C, const int64_t ldc);
+
+void idxdBLAS_sisgemv_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const float alpha, const float *A, const int64_t lda,
+             const float *X, const int64_t incX,
+             float_indexed *Y, const int64_t incY);
+void idxdBLAS_sisgemm_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const float alpha, const float *A, const int64_t lda,
+             const float *B, const int64_t ldb,
+             float_indexed *C, const int64_t ldc);
+
+void idxdBLAS_zizgemv_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const void *alpha, const void *A, const int64_t lda,
+             const void *X, const int64_t incX,
+             double_complex_indexed *Y, const int64_t incY);
+void idxdBLAS_zizgemm_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const void *alpha, const void *A, const int64_t lda,
+             const void *B, const int64_t ldb,
+             double_complex_indexed *C, const int64_t ldc);
+
+void idxdBLAS_cicgemv_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const void *alpha, const void *A, const int64_t lda,
+             const void *X, const int64_t incX,
+             float_complex_indexed *Y, const int64_t incY);
+void idxdBLAS_cicgemm_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const void *alpha, const void *A, const int64_t lda,
+             const void *B, const int64_t ldb,
+             float_complex_indexed *C, const int64_t ldc);
+
+void idxdBLAS_disgemv_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const double alpha, const float *A, const int64_t lda,
+             const float *X, const int64_t incX,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_disgemm_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const double alpha, const float *A, const int64_t lda,
+             const float *B, const int64_t ldb,
+             double_indexed *C, const int64_t ldc);
+
+void idxdBLAS_zizgemv_planar_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const void *alpha, const double *AR, const double *AI, const int64_t lda,
+             const double *XR, const double *XI, const int64_t incX,
+             double_complex_indexed *Y, const int64_t incY);
+void idxdBLAS_zizgemm_planar_64(const int fold, const char Order,
+             const char TransA, const char TransB,
+             const int64_t M, const int64_t N, const int64_t K,
+             const void *alpha, const double *AR, const double *AI, const int64_t lda,
+             const double *BR, const double *BI, const int64_t ldb,
+             double_complex_indexed *C, const int64_t ldc);
+void idxdBLAS_zdeinterleave_64(const int64_t N, const void *X, const int64_t incX, double *XR, double *XI);
+
+void idxdBLAS_didsyrk_64(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int64_t N, const int64_t K,
+             const double alpha, const double *A, const int64_t lda,
+             double_indexed *C, const int64_t ldc);
+void idxdBLAS_sissyrk_64(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int64_t N, const int64_t K,
+             const float alpha, const float *A, const int64_t lda,
+             float_indexed *C, const int64_t ldc);
+void idxdBLAS_zizherk_64(const int fold, const char Order,
+             const char Uplo, const char Trans,
+             const int64_t N, const int64_t K,
+             const double alpha, const void *A, const int64_t lda,
+             double_complex_indexed *C, const int64_t ldc);
+
+void idxdBLAS_dcsramax_64(const int64_t M, const double *val, const int64_t *rowptr, double *rowmax);
+void idxdBLAS_didcsrmv_64(const int fold, const char TransA,
+             const int64_t M, const int64_t N,
+             const double alpha, const double *val, const int64_t *rowptr, const int64_t *colind,
+             const double *rowmax, const double *X, const int64_t incX,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_scsramax_64(const int64_t M, const float *val, const int64_t *rowptr, float *rowmax);
+void idxdBLAS_siscsrmv_64(const int fold, const char TransA,
+             const int64_t M, const int64_t N,
+             const float alpha, const float *val, const int64_t *rowptr, const int64_t *colind,
+             const float *rowmax, const float *X, const int64_t incX,
+             float_indexed *Y, const int64_t incY);
+
+void idxdBLAS_didgesum_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const double *A, const int64_t lda,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_didgeasum_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const double *A, const int64_t lda,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_didgessq_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const double *A, const int64_t lda,
+             double *scaleY, double_indexed *Y, const int64_t incY);
+void idxdBLAS_sisgesum_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const float *A, const int64_t lda,
+             float_indexed *Y, const int64_t incY);
+void idxdBLAS_sisgeasum_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const float *A, const int64_t lda,
+             float_indexed *Y, const int64_t incY);
+void idxdBLAS_sisgessq_64(const int fold, const char Order, const char Dim,
+             const int64_t M, const int64_t N,
+             const float *A, const int64_t lda,
+             float *scaleY, float_indexed *Y, const int64_t incY);
+
+void idxdBLAS_didmoments_64(const int fold, const int order, const int64_t N, const double *X, const int64_t incX, const double shift, double_indexed *Y);
+void idxdBLAS_sismoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float_indexed *Y);
+
+void idxdBLAS_didsegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+             const double *X, const int64_t incX,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_sissegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+             const float *X, const int64_t incX,
+             float_indexed *Y, const int64_t incY);
+void idxdBLAS_didkeysum_64(const int fold, const int64_t N, const int64_t *keys,
+             const double *X, const int64_t incX, const int64_t nkeys,
+             double_indexed *Y, const int64_t incY);
+void idxdBLAS_siskeysum_64(const int fold, const int64_t N, const int64_t *keys,
+             const float *X, const int64_t incX, const int64_t nkeys,
+             float_indexed *Y, const int64_t incY);
+
+void idxdBLAS_didscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY);
+void idxdBLAS_didexscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY);
+void idxdBLAS_sisscan_64(const int fold, const int64_t N, const float *X, const int64_t incX, float_indexed *S, float *Y, const int64_t incY);
+void idxdBLAS_sisexscan_64(const int fold, const int64_t N, const float *X, const int64_t incX, float_indexed *S, float *Y, const int64_t incY);
+
+void idxdBLAS_didgemvdot_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const double alpha, const double *A, const int64_t lda,
+             const double *X, const int64_t incX,
+             double_indexed *Y, const int64_t incY,
+             const double *W, const int64_t incW,
+             double_indexed *D);
+void idxdBLAS_sisgemvdot_64(const int fold, const char Order, const char TransA,
+             const int64_t M, const int64_t N,
+             const float alpha, const float *A, const int64_t lda,
+             const float *X, const int64_t incX,
+             float_indexed *Y, const int64_t incY,
+             const float *W, const int64_t incW,
+             float_indexed *D);
+
+void idxdBLAS_didaxpbydot_64(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX,
+             const double beta, double *Y, const int64_t incY, const double *W, const int64_t incW,
+             double_indexed *Z);
+void idxdBLAS_sisaxpbydot_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+             const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW,
+             float_indexed *Z);
+void idxdBLAS_zizaxpbydotc_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+             const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW,
+             double_complex_indexed *Z);
+void idxdBLAS_cicaxpbydotc_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+             const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW,
+             float_complex_indexed *Z);
+double idxdBLAS_didaxpbyssq_64(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX,
+             const double beta, double *Y, const int64_t incY, const double scaleZ, double_indexed *Z);
+float idxdBLAS_sisaxpbyssq_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+             const float beta, float *Y, const int64_t incY, const float scaleZ, float_indexed *Z);
+double idxdBLAS_dizaxpbyssq_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+             const void *beta, void *Y, const int64_t incY, const double scaleZ, double_indexed *Z);
+float idxdBLAS_sicaxpbyssq_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+             const void *beta, void *Y, const int64_t incY, const float scaleZ, float_indexed *Z);
+void idxdBLAS_didmdot_64(const int fold, const int64_t N, const int k, const double *X, const int64_t ldX, const int64_t incX,
+             const int npairs, const int *pairs, double_indexed *Z);
+void idxdBLAS_sismdot_64(const int fold, const int64_t N, const int k, const float *X, const int64_t ldX, const int64_t incX,
+             const int npairs, const int *pairs, float_indexed *Z);
+
+idxdBLAS_dpacked *idxdBLAS_dpack_64(const char Order, const char TransA, const int64_t M, const int64_t N, const double *A, const int64_t lda);
+idxdBLAS_spacked *idxdBLAS_spack_64(const char Order, const char TransA, const int64_t M, const int64_t N, const float *A, const int64_t lda);
+void idxdBLAS_didgemv_packed_64(const int fold, const double alpha, const idxdBLAS_dpacked *A,
+             const double *X, const int64_t incX, double_indexed *Y, const int64_t incY);
+void idxdBLAS_sisgemv_packed_64(const int fold, const float alpha, const idxdBLAS_spacked *A,
+             const float *X, const int64_t incX, float_indexed *Y, const int64_t incY);
+void idxdBLAS_didgemm_packed_64(const int fold, const char Order, const char TransB, const int64_t N, const double alpha,
+             const idxdBLAS_dpacked *A, const double *B, const int64_t ldb, double_indexed *C, const int64_t ldc);
+void idxdBLAS_sisgemm_packed_64(const int fold, const char Order, const char TransB, const int64_t N, const float alpha,
+             const idxdBLAS_spacked *A, const float *B, const int64_t ldb, float_indexed *C, const int64_t ldc);
+
+void idxdBLAS_didsum_bounded_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double bound, double_indexed *Y);
+void idxdBLAS_didasum_bounded_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double bound, double_indexed *Y);
+void idxdBLAS_diddot_bounded_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, const double bound, double_indexed *Z);
+void idxdBLAS_sissum_bounded_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float bound, float_indexed *Y);
+void idxdBLAS_sisasum_bounded_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float bound, float_indexed *Y);
+void idxdBLAS_sisdot_bounded_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, const float bound, float_indexed *Z);
+
+int idxdBLAS_chunk_64(const int64_t N, const int64_t incX, const int64_t incY);
+int idxdBLAS_capacity_64(const int64_t N, const double capacity);
+int idxdBLAS_dcheck_bound(const double bound, const double amax);
+int idxdBLAS_scheck_bound(const float bound, const float amax);
+void idxdBLAS_dswiden(const int N, const float *X, const int64_t incX, double *Y);
+void idxdBLAS_zcwiden(const int N, const void *X, const int64_t incX, void *Y);
+void idxdBLAS_dhwiden(const int N, const uint16_t *X, const int64_t incX, double *Y);
+void idxdBLAS_dbwiden(const int N, const uint16_t *X, const int64_t incX, double *Y);
+void idxdBLAS_dtwoprod(const int N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double *W);
+void idxdBLAS_stwoprod(const int N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float *W);
+void idxdBLAS_ztwoprod(const int N, const void *X, const int64_t incX, const void *Y, const int64_t incY, const int conj, void *W);
+void idxdBLAS_ctwoprod(const int N, const void *X, const int64_t incX, const void *Y, const int64_t incY, const int conj, void *W);
+void idxdBLAS_zizdot_planar(const int fold, const int N, const double *XR, const double *XI, const double *Y0, const double *Y1, const double *Y2, const double *Y3, double_complex_indexed *Z);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,97 @@
+/**
+ * @file  idxdIO.h
+ * @brief idxdIO.h defines a portable binary format for storing indexed types in files.
+ *
+ * A file (or any other buffer) in this format starts with an #idxdIO_header of #idxdIO_HEADER_SIZE bytes, which records the format version, the byte order of the writer, the bin parameters of the library that wrote it, the indexed type, its fold, and the number of indexed values stored. The values follow the header at offset #idxdIO_HEADER_SIZE, one after the other, each laid out exactly as in memory: the primary vector followed by the carry vector (real and imaginary parts interleaved for complex types), preceded by the scaling factor for scaled types. A single accumulator is stored as an array of one value.
+ *
+ * Since the payload is the in-memory representation, idxdIO_write() writes it with one call to @c fwrite() and idxdIO_read() reads it with one call to @c fread(). A file can also be mapped into memory (with @c mmap() for example) and used in place through idxdIO_map(), which only has to touch the payload if the file was written on a machine of the other byte order. The payload starts on a 64 byte boundary of the file, so it is suitably aligned in any mapping.
+ *
+ * The byte order is detected when a file is read, so files can be exchanged between machines of either byte order, independently of the ENDIAN setting the library was built with. Floating point values are assumed to be IEEE 754 on all machines.
+ *
+ * The bins an indexed value refers to depend on the bin widths #DIWIDTH and #SIWIDTH the library was built with, so a file is only read by a library built with the same bin parameters as the one that wrote it.
+ *
+ * Functions return 0 on success and nonzero on failure, leaving @c errno as set by the standard library where applicable.
+ */
+#ifndef IDXDIO_H_
+#define IDXDIO_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The first 8 bytes of a file in the format
+ */
+#define idxdIO_MAGIC "ReproIDX"
+
+/**
+ * @brief The version of the format written by this library
+ *
+ * Files of a higher version are rejected.
+ */
+#define idxdIO_VERSION 1
+
+/**
+ * @brief The value of the @c endian field of a header, as written on the current machine
+ *
+ * A header whose @c endian field reads as the byte reversal of this value was written on a machine of the other byte order.
+ */
+#define idxdIO_ENDIAN 0x01020304u
+
+/**
+ * @brief The size (in bytes) of a header, and the offset of the payload in a file
+ */
+#define idxdIO_HEADER_SIZE 64
+
+/**
+ * @brief The indexed types that can be stored
+ *
+ * The scaled types are a scaling factor followed by an indexed type of the same precision, as used for sums of squares (see idxdMPI_DOUBLE_INDEXED_SCALED()).
+ */
+typedef enum {
+  idxdIO_DOUBLE_INDEXED = 1,
+  idxdIO_DOUBLE_COMPLEX_INDEXED = 2,
+  idxdIO_FLOAT_INDEXED = 3,
+  idxdIO_FLOAT_COMPLEX_INDEXED = 4,
+  idxdIO_DOUBLE_INDEXED_SCALED = 5,
+  idxdIO_FLOAT_INDEXED_SCALED = 6
+} idxdIO_type;
+
+/**
+ * @brief The header of a file in the format
+ *
+ * All fields are stored in the byte order of the writer.
+ */
+typedef struct {
+  char magic[8];      /**< #idxdIO_MAGIC (without the terminating zero) */
+  uint32_t endian;    /**< #idxdIO_ENDIAN in the byte order of the writer */
+  uint32_t version;   /**< the version of the format */
+  uint32_t type;      /**< the #idxdIO_type of the values */
+  uint32_t fold;      /**< the fold of the values */
+  uint64_t count;     /**< the number of values */
+  uint64_t size;      /**< the size (in bytes) of each value */
+  uint64_t offset;    /**< the offset (in bytes) of the first value from the start of the header */
+  uint32_t diwidth;   /**< #DIWIDTH of the writer */
+  uint32_t siwidth;   /**< #SIWIDTH of the writer */
+  uint32_t dimaxindex; /**< #idxd_DIMAXINDEX of the writer */
+  uint32_t simaxindex; /**< #idxd_SIMAXINDEX of the writer */
+} idxdIO_header;
+
+size_t idxdIO_size(const idxdIO_type type, const int fold);
+int idxdIO_header_init(idxdIO_header *header, const idxdIO_type type, const int fold, const size_t count);
+int idxdIO_header_check(idxdIO_header *header);
+int idxdIO_write(FILE *stream, const idxdIO_type type, const int fold, const size_t count, const void *X);
+int idxdIO_read_header(FILE *stream, idxdIO_header *header);
+int idxdIO_read(FILE *stream, const idxdIO_header *header, void *X);
+void *idxdIO_map(void *buffer, const size_t length, idxdIO_header *header);
+
+void idxdIO_swap(const idxdIO_type type, const size_t n, void *X);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1486 @@
+/**
+ * @file  idxdInline.h
+ * @brief idxdInline.h defines static inline versions of the core indexed type primitives.
+ *
+ * The functions in this header perform exactly the same operations as their counterparts in idxd.h (for example, idxdInline_dmddeposit() corresponds to idxd_dmddeposit()) and produce bitwise identical results. They are defined in the header so that the compiler may inline them into the loops of user-written reproducible kernels. No function in this header requires linking against libidxd.
+ *
+ * When the @c fold argument is a compile time constant, the compiler can resolve the fold dispatch and unroll all loops over the accumulators. Explicitly unrolled versions of the deposit and renormalization are provided for folds 2, 3, and 4 (for example, idxdInline_dmddeposit3()).
+ *
+ * A typical use of this header to add the elements of some computation to an indexed type Y is as follows:
+ *
+ *     idxdInline_didupdate(fold, bound_on_max_abs_value, Y);
+ *     for(i = 0; i < N; i++){
+ *       if(i % idxd_DIENDURANCE == 0 && i != 0){
+ *         idxdInline_direnorm(fold, Y);
+ *       }
+ *       idxdInline_diddeposit(fold, compute(i), Y);
+ *     }
+ *     idxdInline_direnorm(fold, Y);
+ *
+ * As with idxd_dmddeposit(), at most #idxd_DIENDURANCE (or #idxd_SIENDURANCE) deposits may be performed between renormalizations, and all deposited values must have absolute value at most the value Y was last updated with.
+ *
+ * The naming of the functions follows the conventions of idxd.h
+ */
+#ifndef IDXDINLINE_H_
+#define IDXDINLINE_H_
+#include <stdint.h>
+#include <math.h>
+#include "idxd.h"
+
+typedef union idxdInline_long_double_ {
+  double   d;
+  uint64_t l;
+} idxdInline_long_double;
+
+typedef union idxdInline_int_float_ {
+  float    f;
+  uint32_t i;
+} idxdInline_int_float;
+
+/**
+ * @internal
+ * @brief Get the biased exponent of double precision X
+ *
+ * @param X scalar X
+ * @return the biased exponent of X
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_dexp(const double X){
+  idxdInline_long_double tmp;
+  tmp.d = X;
+  return (int)((tmp.l >> (DBL_MANT_DIG - 1)) & (2 * DBL_MAX_EXP - 1));
+}
+
+/**
+ * @internal
+ * @brief Get the biased exponent of single precision X
+ *
+ * @param X scalar X
+ * @return the biased exponent of X
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_sexp(const float X){
+  idxdInline_int_float tmp;
+  tmp.f = X;
+  return (int)((tmp.i >> (FLT_MANT_DIG - 1)) & (2 * FLT_MAX_EXP - 1));
+}
+
+/**
+ * @internal
+ * @brief Check if double precision X is NaN or Inf
+ *
+ * @param X scalar X
+ * @return nonzero if X is NaN or Inf
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_disnaninf(const double X){
+  return idxdInline_dexp(X) == 2 * DBL_MAX_EXP - 1;
+}
+
+/**
+ * @internal
+ * @brief Check if single precision X is NaN or Inf
+ *
+ * @param X scalar X
+ * @return nonzero if X is NaN or Inf
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_sisnaninf(const float X){
+  return idxdInline_sexp(X) == 2 * FLT_MAX_EXP - 1;
+}
+
+/**
+ * @internal
+ * @brief Get index of double precision (see idxd_dindex())
+ *
+ * @param X scalar X
+ * @return X's index
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_dindex(const double X){
+  int exp = idxdInline_dexp(X);
+  int index;
+  if(exp == 0){
+    if(X == 0.0){
+      return idxd_DIMAXINDEX;
+    }
+    frexp(X, &exp);
+    index = (DBL_MAX_EXP - exp)/DIWIDTH;
+    return index < idxd_DIMAXINDEX ? index : idxd_DIMAXINDEX;
+  }
+  return ((2 * DBL_MAX_EXP - 2) - exp)/DIWIDTH;
+}
+
+/**
+ * @internal
+ * @brief Get index of single precision (see idxd_sindex())
+ *
+ * @param X scalar X
+ * @return X's index
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_sindex(const float X){
+  int exp = idxdInline_sexp(X);
+  int index;
+  if(exp == 0){
+    if(X == 0.0){
+      return idxd_SIMAXINDEX;
+    }
+    frexpf(X, &exp);
+    index = (FLT_MAX_EXP - exp)/SIWIDTH;
+    return index < idxd_SIMAXINDEX ? index : idxd_SIMAXINDEX;
+  }
+  return ((2 * FLT_MAX_EXP - 2) - exp)/SIWIDTH;
+}
+
+/**
+ * @internal
+ * @brief Get index of manually specified indexed double precision (see idxd_dmindex())
+ *
+ * @param priX X's primary vector
+ * @return X's index
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_dmindex(const double *priX){
+  return ((DBL_MAX_EXP + DBL_MANT_DIG - DIWIDTH + 1 + (DBL_MAX_EXP - 2)) - idxdInline_dexp(priX[0]))/DIWIDTH;
+}
+
+/**
+ * @internal
+ * @brief Get index of manually specified indexed single precision (see idxd_smindex())
+ *
+ * @param priX X's primary vector
+ * @return X's index
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_smindex(const float *priX){
+  return ((FLT_MAX_EXP + FLT_MANT_DIG - SIWIDTH + 1 + (FLT_MAX_EXP - 2)) - idxdInline_sexp(priX[0]))/SIWIDTH;
+}
+
+/**
+ * @internal
+ * @brief Check if index of manually specified indexed double precision is 0 (see idxd_dmindex0())
+ *
+ * @param priX X's primary vector
+ * @return nonzero if X has index 0
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_dmindex0(const double *priX){
+  return idxdInline_dexp(priX[0]) == DBL_MAX_EXP + (DBL_MAX_EXP - 2);
+}
+
+/**
+ * @internal
+ * @brief Check if index of manually specified indexed single precision is 0 (see idxd_smindex0())
+ *
+ * @param priX X's primary vector
+ * @return nonzero if X has index 0
+ *
+ * @date   18 Oct 2026
+ */
+static inline int idxdInline_smindex0(const float *priX){
+  return idxdInline_sexp(priX[0]) == FLT_MAX_EXP + (FLT_MAX_EXP - 2);
+}
+
+/**
+ * @internal
+ * @brief Get the value of a double precision bin (see idxd_dmbins())
+ *
+ * The value is constructed directly from its bit representation, so no lookup table is needed.
+ *
+ * @param X bin index (indices larger than #idxd_DIMAXINDEX refer to the last bin)
+ * @return the value of bin X
+ *
+ * @date   18 Oct 2026
+ */
+static inline double idxdInline_dmbin(const int X){
+  idxdInline_long_double tmp;
+  int exp;
+  if(X == 0){
+    exp = DBL_MAX_EXP - 1;
+  }else{
+    exp = DBL_MAX_EXP + DBL_MANT_DIG - DIWIDTH - (X < idxd_DIMAXINDEX ? X : idxd_DIMAXINDEX) * DIWIDTH;
+  }
+  tmp.l = ((uint64_t)(exp + DBL_MAX_EXP - 1) << (DBL_MANT_DIG - 1)) | (1ull << (DBL_MANT_DIG - 2));
+  return tmp.d;
+}
+
+/**
+ * @internal
+ * @brief Get the value of a single precision bin (see idxd_smbins())
+ *
+ * The value is constructed directly from its bit representation, so no lookup table is needed.
+ *
+ * @param X bin index (indices larger than #idxd_SIMAXINDEX refer to the last bin)
+ * @return the value of bin X
+ *
+ * @date   18 Oct 2026
+ */
+static inline float idxdInline_smbin(const int X){
+  idxdInline_int_float tmp;
+  int exp;
+  if(X == 0){
+    exp = FLT_MAX_EXP - 1;
+  }else{
+    exp = FLT_MAX_EXP + FLT_MANT_DIG - SIWIDTH - (X < idxd_SIMAXINDEX ? X : idxd_SIMAXINDEX) * SIWIDTH;
+  }
+  tmp.i = ((uint32_t)(exp + FLT_MAX_EXP - 1) << (FLT_MANT_DIG - 1)) | (1ul << (FLT_MANT_DIG - 2));
+  return tmp.f;
+}
+
+/**
+ * @internal
+ * @brief Deposit one double precision slice into a primary accumulator
+ *
+ * @param x pointer to the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit_step(double *x, double *priY){
+  idxdInline_long_double q;
+  double M = priY[0];
+  q.d = *x;
+  q.l |= 1;
+  q.d += M;
+  priY[0] = q.d;
+  M -= q.d;
+  *x += M;
+}
+
+/**
+ * @internal
+ * @brief Deposit one single precision slice into a primary accumulator
+ *
+ * @param x pointer to the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit_step(float *x, float *priY){
+  idxdInline_int_float q;
+  float M = priY[0];
+  q.f = *x;
+  q.i |= 1;
+  q.f += M;
+  priY[0] = q.f;
+  M -= q.f;
+  *x += M;
+}
+
+/**
+ * @internal
+ * @brief Deposit the top double precision slice into a primary accumulator of index 0
+ *
+ * @param x pointer to the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit_step0(double *x, double *priY){
+  idxdInline_long_double q;
+  double M = priY[0];
+  q.d = *x * idxd_DMCOMPRESSION;
+  q.l |= 1;
+  q.d += M;
+  priY[0] = q.d;
+  M -= q.d;
+  M *= idxd_DMEXPANSION * 0.5;
+  *x += M;
+  *x += M;
+}
+
+/**
+ * @internal
+ * @brief Deposit the top single precision slice into a primary accumulator of index 0
+ *
+ * @param x pointer to the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit_step0(float *x, float *priY){
+  idxdInline_int_float q;
+  float M = priY[0];
+  q.f = *x * idxd_SMCOMPRESSION;
+  q.i |= 1;
+  q.f += M;
+  priY[0] = q.f;
+  M -= q.f;
+  M *= (idxd_SMEXPANSION * 0.5);
+  *x += M;
+  *x += M;
+}
+
+/**
+ * @internal
+ * @brief Deposit the last double precision slice into a primary accumulator
+ *
+ * @param x the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit_last(double x, double *priY){
+  idxdInline_long_double q;
+  q.d = x;
+  q.l |= 1;
+  priY[0] += q.d;
+}
+
+/**
+ * @internal
+ * @brief Deposit the last single precision slice into a primary accumulator
+ *
+ * @param x the remaining part of the scalar being deposited
+ * @param priY the primary accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit_last(float x, float *priY){
+  idxdInline_int_float q;
+  q.f = x;
+  q.i |= 1;
+  priY[0] += q.f;
+}
+
+/**
+ * @internal
+ * @brief Add double precision to suitably indexed manually specified indexed double precision of fold 2 (Y += X)
+ *
+ * See idxdInline_dmddeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit2(const double X, double *priY, const int incpriY){
+  double x = X;
+  if(idxdInline_disnaninf(x) || idxdInline_disnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_dmindex0(priY)){
+    idxdInline_dmddeposit_step0(&x, priY);
+  }else{
+    idxdInline_dmddeposit_step(&x, priY);
+  }
+  idxdInline_dmddeposit_last(x, priY + incpriY);
+}
+
+/**
+ * @internal
+ * @brief Add double precision to suitably indexed manually specified indexed double precision of fold 3 (Y += X)
+ *
+ * See idxdInline_dmddeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit3(const double X, double *priY, const int incpriY){
+  double x = X;
+  if(idxdInline_disnaninf(x) || idxdInline_disnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_dmindex0(priY)){
+    idxdInline_dmddeposit_step0(&x, priY);
+  }else{
+    idxdInline_dmddeposit_step(&x, priY);
+  }
+  idxdInline_dmddeposit_step(&x, priY + incpriY);
+  idxdInline_dmddeposit_last(x, priY + 2 * incpriY);
+}
+
+/**
+ * @internal
+ * @brief Add double precision to suitably indexed manually specified indexed double precision of fold 4 (Y += X)
+ *
+ * See idxdInline_dmddeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit4(const double X, double *priY, const int incpriY){
+  double x = X;
+  if(idxdInline_disnaninf(x) || idxdInline_disnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_dmindex0(priY)){
+    idxdInline_dmddeposit_step0(&x, priY);
+  }else{
+    idxdInline_dmddeposit_step(&x, priY);
+  }
+  idxdInline_dmddeposit_step(&x, priY + incpriY);
+  idxdInline_dmddeposit_step(&x, priY + 2 * incpriY);
+  idxdInline_dmddeposit_last(x, priY + 3 * incpriY);
+}
+
+/**
+ * @internal
+ * @brief  Add double precision to suitably indexed manually specified indexed double precision (Y += X)
+ *
+ * Inline version of idxd_dmddeposit(). Folds 2, 3, and 4 are dispatched to the unrolled versions idxdInline_dmddeposit2(), idxdInline_dmddeposit3(), and idxdInline_dmddeposit4().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmddeposit(const int fold, const double X, double *priY, const int incpriY){
+  double x = X;
+  int i;
+
+  switch(fold){
+    case 2:
+      idxdInline_dmddeposit2(X, priY, incpriY);
+      return;
+    case 3:
+      idxdInline_dmddeposit3(X, priY, incpriY);
+      return;
+    case 4:
+      idxdInline_dmddeposit4(X, priY, incpriY);
+      return;
+  }
+
+  if(idxdInline_disnaninf(x) || idxdInline_disnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_dmindex0(priY)){
+    idxdInline_dmddeposit_step0(&x, priY);
+  }else{
+    idxdInline_dmddeposit_step(&x, priY);
+  }
+  for(i = 1; i < fold - 1; i++){
+    idxdInline_dmddeposit_step(&x, priY + i * incpriY);
+  }
+  idxdInline_dmddeposit_last(x, priY + (fold - 1) * incpriY);
+}
+
+/**
+ * @internal
+ * @brief Add single precision to suitably indexed manually specified indexed single precision of fold 2 (Y += X)
+ *
+ * See idxdInline_smsdeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit2(const float X, float *priY, const int incpriY){
+  float x = X;
+  if(idxdInline_sisnaninf(x) || idxdInline_sisnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_smindex0(priY)){
+    idxdInline_smsdeposit_step0(&x, priY);
+  }else{
+    idxdInline_smsdeposit_step(&x, priY);
+  }
+  idxdInline_smsdeposit_last(x, priY + incpriY);
+}
+
+/**
+ * @internal
+ * @brief Add single precision to suitably indexed manually specified indexed single precision of fold 3 (Y += X)
+ *
+ * See idxdInline_smsdeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit3(const float X, float *priY, const int incpriY){
+  float x = X;
+  if(idxdInline_sisnaninf(x) || idxdInline_sisnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_smindex0(priY)){
+    idxdInline_smsdeposit_step0(&x, priY);
+  }else{
+    idxdInline_smsdeposit_step(&x, priY);
+  }
+  idxdInline_smsdeposit_step(&x, priY + incpriY);
+  idxdInline_smsdeposit_last(x, priY + 2 * incpriY);
+}
+
+/**
+ * @internal
+ * @brief Add single precision to suitably indexed manually specified indexed single precision of fold 4 (Y += X)
+ *
+ * See idxdInline_smsdeposit()
+ *
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit4(const float X, float *priY, const int incpriY){
+  float x = X;
+  if(idxdInline_sisnaninf(x) || idxdInline_sisnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_smindex0(priY)){
+    idxdInline_smsdeposit_step0(&x, priY);
+  }else{
+    idxdInline_smsdeposit_step(&x, priY);
+  }
+  idxdInline_smsdeposit_step(&x, priY + incpriY);
+  idxdInline_smsdeposit_step(&x, priY + 2 * incpriY);
+  idxdInline_smsdeposit_last(x, priY + 3 * incpriY);
+}
+
+/**
+ * @internal
+ * @brief  Add single precision to suitably indexed manually specified indexed single precision (Y += X)
+ *
+ * Inline version of idxd_smsdeposit(). Folds 2, 3, and 4 are dispatched to the unrolled versions idxdInline_smsdeposit2(), idxdInline_smsdeposit3(), and idxdInline_smsdeposit4().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsdeposit(const int fold, const float X, float *priY, const int incpriY){
+  float x = X;
+  int i;
+
+  switch(fold){
+    case 2:
+      idxdInline_smsdeposit2(X, priY, incpriY);
+      return;
+    case 3:
+      idxdInline_smsdeposit3(X, priY, incpriY);
+      return;
+    case 4:
+      idxdInline_smsdeposit4(X, priY, incpriY);
+      return;
+  }
+
+  if(idxdInline_sisnaninf(x) || idxdInline_sisnaninf(priY[0])){
+    priY[0] += x;
+    return;
+  }
+  if(idxdInline_smindex0(priY)){
+    idxdInline_smsdeposit_step0(&x, priY);
+  }else{
+    idxdInline_smsdeposit_step(&x, priY);
+  }
+  for(i = 1; i < fold - 1; i++){
+    idxdInline_smsdeposit_step(&x, priY + i * incpriY);
+  }
+  idxdInline_smsdeposit_last(x, priY + (fold - 1) * incpriY);
+}
+
+/**
+ * @internal
+ * @brief Renormalize one accumulator of manually specified indexed double precision
+ *
+ * @param priX the primary accumulator
+ * @param carX the carry accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmrenorm_step(double *priX, double *carX){
+  idxdInline_long_double tmp_renorm;
+  tmp_renorm.d = priX[0];
+  carX[0] += (int)((tmp_renorm.l >> (DBL_MANT_DIG - 3)) & 3) - 2;
+  tmp_renorm.l &= ~(1ull << (DBL_MANT_DIG - 3));
+  tmp_renorm.l |= 1ull << (DBL_MANT_DIG - 2);
+  priX[0] = tmp_renorm.d;
+}
+
+/**
+ * @internal
+ * @brief Renormalize one accumulator of manually specified indexed single precision
+ *
+ * @param priX the primary accumulator
+ * @param carX the carry accumulator
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smrenorm_step(float *priX, float *carX){
+  idxdInline_int_float tmp_renorm;
+  tmp_renorm.f = priX[0];
+  carX[0] += (int)((tmp_renorm.i >> (FLT_MANT_DIG - 3)) & 3) - 2;
+  tmp_renorm.i &= ~(1ul << (FLT_MANT_DIG - 3));
+  tmp_renorm.i |= 1ul << (FLT_MANT_DIG - 2);
+  priX[0] = tmp_renorm.f;
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed double precision of fold 2
+ *
+ * See idxdInline_dmrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmrenorm2(double *priX, const int incpriX, double *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_disnaninf(priX[0])){
+    return;
+  }
+  idxdInline_dmrenorm_step(priX, carX);
+  idxdInline_dmrenorm_step(priX + incpriX, carX + inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed double precision of fold 3
+ *
+ * See idxdInline_dmrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmrenorm3(double *priX, const int incpriX, double *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_disnaninf(priX[0])){
+    return;
+  }
+  idxdInline_dmrenorm_step(priX, carX);
+  idxdInline_dmrenorm_step(priX + incpriX, carX + inccarX);
+  idxdInline_dmrenorm_step(priX + 2 * incpriX, carX + 2 * inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed double precision of fold 4
+ *
+ * See idxdInline_dmrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmrenorm4(double *priX, const int incpriX, double *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_disnaninf(priX[0])){
+    return;
+  }
+  idxdInline_dmrenorm_step(priX, carX);
+  idxdInline_dmrenorm_step(priX + incpriX, carX + inccarX);
+  idxdInline_dmrenorm_step(priX + 2 * incpriX, carX + 2 * inccarX);
+  idxdInline_dmrenorm_step(priX + 3 * incpriX, carX + 3 * inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed double precision
+ *
+ * Inline version of idxd_dmrenorm(). Folds 2, 3, and 4 are dispatched to the unrolled versions idxdInline_dmrenorm2(), idxdInline_dmrenorm3(), and idxdInline_dmrenorm4().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmrenorm(const int fold, double *priX, const int incpriX, double *carX, const int inccarX){
+  int i;
+
+  switch(fold){
+    case 2:
+      idxdInline_dmrenorm2(priX, incpriX, carX, inccarX);
+      return;
+    case 3:
+      idxdInline_dmrenorm3(priX, incpriX, carX, inccarX);
+      return;
+    case 4:
+      idxdInline_dmrenorm4(priX, incpriX, carX, inccarX);
+      return;
+  }
+
+  if(priX[0] == 0.0 || idxdInline_disnaninf(priX[0])){
+    return;
+  }
+  for(i = 0; i < fold; i++){
+    idxdInline_dmrenorm_step(priX + i * incpriX, carX + i * inccarX);
+  }
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed single precision of fold 2
+ *
+ * See idxdInline_smrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smrenorm2(float *priX, const int incpriX, float *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_sisnaninf(priX[0])){
+    return;
+  }
+  idxdInline_smrenorm_step(priX, carX);
+  idxdInline_smrenorm_step(priX + incpriX, carX + inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed single precision of fold 3
+ *
+ * See idxdInline_smrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smrenorm3(float *priX, const int incpriX, float *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_sisnaninf(priX[0])){
+    return;
+  }
+  idxdInline_smrenorm_step(priX, carX);
+  idxdInline_smrenorm_step(priX + incpriX, carX + inccarX);
+  idxdInline_smrenorm_step(priX + 2 * incpriX, carX + 2 * inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed single precision of fold 4
+ *
+ * See idxdInline_smrenorm()
+ *
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smrenorm4(float *priX, const int incpriX, float *carX, const int inccarX){
+  if(priX[0] == 0.0 || idxdInline_sisnaninf(priX[0])){
+    return;
+  }
+  idxdInline_smrenorm_step(priX, carX);
+  idxdInline_smrenorm_step(priX + incpriX, carX + inccarX);
+  idxdInline_smrenorm_step(priX + 2 * incpriX, carX + 2 * inccarX);
+  idxdInline_smrenorm_step(priX + 3 * incpriX, carX + 3 * inccarX);
+}
+
+/**
+ * @internal
+ * @brief Renormalize manually specified indexed single precision
+ *
+ * Inline version of idxd_smrenorm(). Folds 2, 3, and 4 are dispatched to the unrolled versions idxdInline_smrenorm2(), idxdInline_smrenorm3(), and idxdInline_smrenorm4().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smrenorm(const int fold, float *priX, const int incpriX, float *carX, const int inccarX){
+  int i;
+
+  switch(fold){
+    case 2:
+      idxdInline_smrenorm2(priX, incpriX, carX, inccarX);
+      return;
+    case 3:
+      idxdInline_smrenorm3(priX, incpriX, carX, inccarX);
+      return;
+    case 4:
+      idxdInline_smrenorm4(priX, incpriX, carX, inccarX);
+      return;
+  }
+
+  if(priX[0] == 0.0 || idxdInline_sisnaninf(priX[0])){
+    return;
+  }
+  for(i = 0; i < fold; i++){
+    idxdInline_smrenorm_step(priX + i * incpriX, carX + i * inccarX);
+  }
+}
+
+/**
+ * @internal
+ * @brief Update manually specified indexed double precision with double precision (X -> Y)
+ *
+ * Inline version of idxd_dmdupdate(). This method updates Y to an index suitable for adding numbers with absolute value less than X
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmdupdate(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
+  int i;
+  int j;
+  int X_index;
+  int shift;
+
+  if(idxdInline_disnaninf(priY[0])){
+    return;
+  }
+
+  X_index = idxdInline_dindex(X);
+  if(priY[0] == 0.0){
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = idxdInline_dmbin(X_index + i);
+      carY[i * inccarY] = 0.0;
+    }
+  }else{
+    shift = idxdInline_dmindex(priY) - X_index;
+    if(shift > 0){
+      for(i = fold - 1; i >= shift; i--){
+        priY[i * incpriY] = priY[(i - shift) * incpriY];
+        carY[i * inccarY] = carY[(i - shift) * inccarY];
+      }
+      for(j = 0; j < i + 1; j++){
+        priY[j * incpriY] = idxdInline_dmbin(X_index + j);
+        carY[j * inccarY] = 0.0;
+      }
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Update manually specified indexed single precision with single precision (X -> Y)
+ *
+ * Inline version of idxd_smsupdate(). This method updates Y to an index suitable for adding numbers with absolute value less than X
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsupdate(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
+  int i;
+  int j;
+  int X_index;
+  int shift;
+
+  if(idxdInline_sisnaninf(priY[0])){
+    return;
+  }
+
+  X_index = idxdInline_sindex(X);
+  if(priY[0] == 0.0){
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = idxdInline_smbin(X_index + i);
+      carY[i * inccarY] = 0.0;
+    }
+  }else{
+    shift = idxdInline_smindex(priY) - X_index;
+    if(shift > 0){
+      for(i = fold - 1; i >= shift; i--){
+        priY[i * incpriY] = priY[(i - shift) * incpriY];
+        carY[i * inccarY] = carY[(i - shift) * inccarY];
+      }
+      for(j = 0; j < i + 1; j++){
+        priY[j * incpriY] = idxdInline_smbin(X_index + j);
+        carY[j * inccarY] = 0.0;
+      }
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief  Add double precision to manually specified indexed double precision (Y += X)
+ *
+ * Inline version of idxd_dmdadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmdadd(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
+  idxdInline_dmdupdate(fold, X, priY, incpriY, carY, inccarY);
+  idxdInline_dmddeposit(fold, X, priY, incpriY);
+  idxdInline_dmrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief  Add single precision to manually specified indexed single precision (Y += X)
+ *
+ * Inline version of idxd_smsadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsadd(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
+  idxdInline_smsupdate(fold, X, priY, incpriY, carY, inccarY);
+  idxdInline_smsdeposit(fold, X, priY, incpriY);
+  idxdInline_smrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief Convert double precision to manually specified indexed double precision (X -> Y)
+ *
+ * Inline version of idxd_dmdconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmdconv(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
+  int i;
+  for(i = 0; i < fold; i++){
+    priY[i * incpriY] = 0.0;
+    carY[i * inccarY] = 0.0;
+  }
+  idxdInline_dmdadd(fold, X, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief Convert single precision to manually specified indexed single precision (X -> Y)
+ *
+ * Inline version of idxd_smsconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsconv(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
+  int i;
+  for(i = 0; i < fold; i++){
+    priY[i * incpriY] = 0.0;
+    carY[i * inccarY] = 0.0;
+  }
+  idxdInline_smsadd(fold, X, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief  Add manually specified indexed double precision (Y += X)
+ *
+ * Inline version of idxd_dmdmadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_dmdmadd(const int fold, const double *priX, const int incpriX, const double *carX, const int inccarX, double *priY, const int incpriY, double *carY, const int inccarY){
+  int i;
+  int shift;
+  int X_index;
+  int Y_index;
+
+  if(priX[0] == 0.0){
+    return;
+  }
+
+  if(priY[0] == 0.0){
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = priX[i * incpriX];
+      carY[i * inccarY] = carX[i * inccarX];
+    }
+    return;
+  }
+
+  if(idxdInline_disnaninf(priX[0]) || idxdInline_disnaninf(priY[0])){
+    priY[0] += priX[0];
+    return;
+  }
+
+  X_index = idxdInline_dmindex(priX);
+  Y_index = idxdInline_dmindex(priY);
+  shift = Y_index - X_index;
+  if(shift > 0){
+    for(i = fold - 1; i >= shift; i--){
+      priY[i * incpriY] = priX[i * incpriX] + (priY[(i - shift) * incpriY] - idxdInline_dmbin(Y_index + i - shift));
+      carY[i * inccarY] = carX[i * inccarX] + carY[(i - shift) * inccarY];
+    }
+    for(i = 0; i < shift && i < fold; i++){
+      priY[i * incpriY] = priX[i * incpriX];
+      carY[i * inccarY] = carX[i * inccarX];
+    }
+  }else{
+    for(i = 0 - shift; i < fold; i++){
+      priY[i * incpriY] += priX[(i + shift) * incpriX] - idxdInline_dmbin(X_index + i + shift);
+      carY[i * inccarY] += carX[(i + shift) * inccarX];
+    }
+  }
+
+  idxdInline_dmrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief  Add manually specified indexed single precision (Y += X)
+ *
+ * Inline version of idxd_smsmadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_smsmadd(const int fold, const float *priX, const int incpriX, const float *carX, const int inccarX, float *priY, const int incpriY, float *carY, const int inccarY){
+  int i;
+  int shift;
+  int X_index;
+  int Y_index;
+
+  if(priX[0] == 0.0){
+    return;
+  }
+
+  if(priY[0] == 0.0){
+    for(i = 0; i < fold; i++){
+      priY[i * incpriY] = priX[i * incpriX];
+      carY[i * inccarY] = carX[i * inccarX];
+    }
+    return;
+  }
+
+  if(idxdInline_sisnaninf(priX[0]) || idxdInline_sisnaninf(priY[0])){
+    priY[0] += priX[0];
+    return;
+  }
+
+  X_index = idxdInline_smindex(priX);
+  Y_index = idxdInline_smindex(priY);
+  shift = Y_index - X_index;
+  if(shift > 0){
+    for(i = fold - 1; i >= shift; i--){
+      priY[i * incpriY] = priX[i * incpriX] + (priY[(i - shift) * incpriY] - idxdInline_smbin(Y_index + i - shift));
+      carY[i * inccarY] = carX[i * inccarX] + carY[(i - shift) * inccarY];
+    }
+    for(i = 0; i < shift && i < fold; i++){
+      priY[i * incpriY] = priX[i * incpriX];
+      carY[i * inccarY] = carX[i * inccarX];
+    }
+  }else{
+    for(i = 0 - shift; i < fold; i++){
+      priY[i * incpriY] += priX[(i + shift) * incpriX] - idxdInline_smbin(X_index + i + shift);
+      carY[i * inccarY] += carX[(i + shift) * inccarX];
+    }
+  }
+
+  idxdInline_smrenorm(fold, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief Convert manually specified indexed double precision to double precision (X -> Y)
+ *
+ * Inline version of idxd_ddmconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline double idxdInline_ddmconv(const int fold, const double *priX, const int incpriX, const double *carX, const int inccarX){
+  int i = 0;
+  int X_index;
+  double Y = 0.0;
+  double scale_down;
+  double scale_up;
+  int scaled;
+
+  if(idxdInline_disnaninf(priX[0])){
+    return priX[0];
+  }
+
+  if(priX[0] == 0.0){
+    return 0.0;
+  }
+
+  X_index = idxdInline_dmindex(priX);
+  if(X_index <= (3 * DBL_MANT_DIG)/DIWIDTH){
+    scale_down = ldexp(0.5, 1 - (2 * DBL_MANT_DIG - DIWIDTH));
+    scale_up = ldexp(0.5, 1 + (2 * DBL_MANT_DIG - DIWIDTH));
+    scaled = (3 * DBL_MANT_DIG)/DIWIDTH - X_index;
+    scaled = scaled < fold ? scaled : fold;
+    scaled = scaled > 0 ? scaled : 0;
+    if(X_index == 0){
+      Y += carX[0] * ((idxdInline_dmbin(X_index)/6.0) * scale_down * idxd_DMEXPANSION);
+      Y += carX[inccarX] * ((idxdInline_dmbin(X_index + 1)/6.0) * scale_down);
+      Y += (priX[0] - idxdInline_dmbin(X_index)) * scale_down * idxd_DMEXPANSION;
+      i = 2;
+    }else{
+      Y += carX[0] * ((idxdInline_dmbin(X_index)/6.0) * scale_down);
+      i = 1;
+    }
+    for(; i < scaled; i++){
+      Y += carX[i * inccarX] * ((idxdInline_dmbin(X_index + i)/6.0) * scale_down);
+      Y += (priX[(i - 1) * incpriX] - idxdInline_dmbin(X_index + i - 1)) * scale_down;
+    }
+    if(i == fold){
+      Y += (priX[(fold - 1) * incpriX] - idxdInline_dmbin(X_index + fold - 1)) * scale_down;
+      return Y * scale_up;
+    }
+    if(isinf(Y * scale_up)){
+      return Y * scale_up;
+    }
+    Y *= scale_up;
+    for(; i < fold; i++){
+      Y += carX[i * inccarX] * (idxdInline_dmbin(X_index + i)/6.0);
+      Y += priX[(i - 1) * incpriX] - idxdInline_dmbin(X_index + i - 1);
+    }
+    Y += priX[(fold - 1) * incpriX] - idxdInline_dmbin(X_index + fold - 1);
+  }else{
+    Y += carX[0] * (idxdInline_dmbin(X_index)/6.0);
+    for(i = 1; i < fold; i++){
+      Y += carX[i * inccarX] * (idxdInline_dmbin(X_index + i)/6.0);
+      Y += (priX[(i - 1) * incpriX] - idxdInline_dmbin(X_index + i - 1));
+    }
+    Y += (priX[(fold - 1) * incpriX] - idxdInline_dmbin(X_index + fold - 1));
+  }
+  return Y;
+}
+
+/**
+ * @internal
+ * @brief Convert manually specified indexed single precision to single precision (X -> Y)
+ *
+ * Inline version of idxd_ssmconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param priX X's primary vector
+ * @param incpriX stride within X's primary vector (use every incpriX'th element)
+ * @param carX X's carry vector
+ * @param inccarX stride within X's carry vector (use every inccarX'th element)
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline float idxdInline_ssmconv(const int fold, const float *priX, const int incpriX, const float *carX, const int inccarX){
+  int i = 0;
+  double Y = 0.0;
+  int X_index;
+
+  if(idxdInline_sisnaninf(priX[0])){
+    return priX[0];
+  }
+
+  if(priX[0] == 0.0){
+    return 0.0;
+  }
+
+  X_index = idxdInline_smindex(priX);
+  if(X_index == 0){
+    Y += (double)carX[0] * (double)(idxdInline_smbin(X_index)/6.0) * (double)idxd_SMEXPANSION;
+    Y += (double)carX[inccarX] * (double)(idxdInline_smbin(X_index + 1)/6.0);
+    Y += (double)(priX[0] - idxdInline_smbin(X_index)) * (double)idxd_SMEXPANSION;
+    i = 2;
+  }else{
+    Y += (double)carX[0] * (double)(idxdInline_smbin(X_index)/6.0);
+    i = 1;
+  }
+  for(; i < fold; i++){
+    Y += (double)carX[i * inccarX] * (double)(idxdInline_smbin(X_index + i)/6.0);
+    Y += (double)(priX[(i - 1) * incpriX] - idxdInline_smbin(X_index + i - 1));
+  }
+  Y += (double)(priX[(fold - 1) * incpriX] - idxdInline_smbin(X_index + fold - 1));
+
+  return (float)Y;
+}
+
+/**
+ * @brief Add double precision to suitably indexed indexed double precision (Y += X)
+ *
+ * Inline version of idxd_diddeposit(). See idxdInline_dmddeposit().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_diddeposit(const int fold, const double X, double_indexed *Y){
+  idxdInline_dmddeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Add single precision to suitably indexed indexed single precision (Y += X)
+ *
+ * Inline version of idxd_sisdeposit(). See idxdInline_smsdeposit().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sisdeposit(const int fold, const float X, float_indexed *Y){
+  idxdInline_smsdeposit(fold, X, Y, 1);
+}
+
+/**
+ * @brief Update indexed double precision with double precision (X -> Y)
+ *
+ * Inline version of idxd_didupdate().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_didupdate(const int fold, const double X, double_indexed *Y){
+  idxdInline_dmdupdate(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Update indexed single precision with single precision (X -> Y)
+ *
+ * Inline version of idxd_sisupdate().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sisupdate(const int fold, const float X, float_indexed *Y){
+  idxdInline_smsupdate(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Renormalize indexed double precision
+ *
+ * Inline version of idxd_direnorm().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_direnorm(const int fold, double_indexed *X){
+  idxdInline_dmrenorm(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Renormalize indexed single precision
+ *
+ * Inline version of idxd_sirenorm().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sirenorm(const int fold, float_indexed *X){
+  idxdInline_smrenorm(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Add double precision to indexed double precision (Y += X)
+ *
+ * Inline version of idxd_didadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_didadd(const int fold, const double X, double_indexed *Y){
+  idxdInline_dmdadd(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Add single precision to indexed single precision (Y += X)
+ *
+ * Inline version of idxd_sisadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sisadd(const int fold, const float X, float_indexed *Y){
+  idxdInline_smsadd(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Add indexed double precision (Y += X)
+ *
+ * Inline version of idxd_didiadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_didiadd(const int fold, const double_indexed *X, double_indexed *Y){
+  idxdInline_dmdmadd(fold, X, 1, X + fold, 1, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Add indexed single precision (Y += X)
+ *
+ * Inline version of idxd_sisiadd().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sisiadd(const int fold, const float_indexed *X, float_indexed *Y){
+  idxdInline_smsmadd(fold, X, 1, X + fold, 1, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Convert double precision to indexed double precision (X -> Y)
+ *
+ * Inline version of idxd_didconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_didconv(const int fold, const double X, double_indexed *Y){
+  idxdInline_dmdconv(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Convert single precision to indexed single precision (X -> Y)
+ *
+ * Inline version of idxd_sisconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdInline_sisconv(const int fold, const float X, float_indexed *Y){
+  idxdInline_smsconv(fold, X, Y, 1, Y + fold, 1);
+}
+
+/**
+ * @brief Convert indexed double precision to double precision (X -> Y)
+ *
+ * Inline version of idxd_ddiconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline double idxdInline_ddiconv(const int fold, const double_indexed *X){
+  return idxdInline_ddmconv(fold, X, 1, X + fold, 1);
+}
+
+/**
+ * @brief Convert indexed single precision to single precision (X -> Y)
+ *
+ * Inline version of idxd_ssiconv().
+ *
+ * @param fold the fold of the indexed types
+ * @param X indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline float idxdInline_ssiconv(const int fold, const float_indexed *X){
+  return idxdInline_ssmconv(fold, X, 1, X + fold, 1);
+}
+
+#endif
@@ -27,6 +27,10 @@
 #include <mpi.h>
 #include "idxd.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 MPI_Op idxdMPI_DIDIADD(const int fold);
 MPI_Op idxdMPI_ZIZIADD(const int fold);
 MPI_Op idxdMPI_SISIADD(const int fold);
@@ -43,4 +47,8 @@ MPI_Datatype idxdMPI_FLOAT_COMPLEX_INDEXED(const int fold);
 MPI_Datatype idxdMPI_DOUBLE_INDEXED_SCALED(const int fold);
 MPI_Datatype idxdMPI_FLOAT_INDEXED_SCALED(const int fold);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,363 @@
+/**
+ * @file  idxdOMP.h
+ * @brief idxdOMP.h defines OpenMP user-defined reductions for indexed types.
+ *
+ * The indexed types in idxd.h are arrays whose length depends on the fold, so they cannot appear in an OpenMP @c reduction clause. This header defines fixed size structures (#idxdOMP_double_indexed, #idxdOMP_double_complex_indexed, #idxdOMP_float_indexed, and #idxdOMP_float_complex_indexed) that carry their fold along with enough storage for any fold, and declares the @c + reduction on each of them. Private copies are initialized to zero with the fold of the original, and are combined with idxd_didiadd() (or the corresponding function for the other types).
+ *
+ * Since indexed addition is associative, the result of a reduction is independent of the number of threads and of the loop schedule. A typical use of this header is as follows:
+ *
+ *     idxdOMP_double_indexed Y;
+ *     idxdOMP_disetzero(fold, &Y);
+ *     #pragma omp parallel for reduction(+:Y)
+ *     for(i = 0; i < N; i++){
+ *       idxdOMP_didadd(compute(i), &Y);
+ *     }
+ *     result = idxdOMP_ddiconv(&Y);
+ *
+ * The reductions are only declared when the header is compiled with OpenMP enabled (when @c _OPENMP is defined). The remaining functions may be used without OpenMP. Elements are added with the inline functions of idxdInline.h, and reduction results are combined with the functions of idxd.h, so code using this header must be linked against libidxd.
+ *
+ * The naming of the functions follows the conventions of idxd.h
+ */
+#ifndef IDXDOMP_H_
+#define IDXDOMP_H_
+#include "idxd.h"
+#include "idxdInline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The indexed double datatype for OpenMP reductions
+ *
+ * The indexed double precision value is stored in the first idxd_dinum(fold) elements of X.
+ */
+typedef struct idxdOMP_double_indexed_ {
+  int fold;
+  double_indexed X[2 * idxd_DIMAXFOLD];
+} idxdOMP_double_indexed;
+
+/**
+ * @brief The indexed complex double datatype for OpenMP reductions
+ *
+ * The indexed complex double precision value is stored in the first idxd_zinum(fold) elements of X.
+ */
+typedef struct idxdOMP_double_complex_indexed_ {
+  int fold;
+  double_complex_indexed X[4 * idxd_DIMAXFOLD];
+} idxdOMP_double_complex_indexed;
+
+/**
+ * @brief The indexed float datatype for OpenMP reductions
+ *
+ * The indexed single precision value is stored in the first idxd_sinum(fold) elements of X.
+ */
+typedef struct idxdOMP_float_indexed_ {
+  int fold;
+  float_indexed X[2 * idxd_SIMAXFOLD];
+} idxdOMP_float_indexed;
+
+/**
+ * @brief The indexed complex float datatype for OpenMP reductions
+ *
+ * The indexed complex single precision value is stored in the first idxd_cinum(fold) elements of X.
+ */
+typedef struct idxdOMP_float_complex_indexed_ {
+  int fold;
+  float_complex_indexed X[4 * idxd_SIMAXFOLD];
+} idxdOMP_float_complex_indexed;
+
+/**
+ * @brief Set indexed double precision to 0 (X = 0)
+ *
+ * Sets the fold of X and performs the operation X = 0
+ *
+ * @param fold the fold of the indexed type
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_disetzero(const int fold, idxdOMP_double_indexed *X){
+  X->fold = fold;
+  idxd_disetzero(fold, X->X);
+}
+
+/**
+ * @brief Set indexed complex double precision to 0 (X = 0)
+ *
+ * Sets the fold of X and performs the operation X = 0
+ *
+ * @param fold the fold of the indexed type
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_zisetzero(const int fold, idxdOMP_double_complex_indexed *X){
+  X->fold = fold;
+  idxd_zisetzero(fold, X->X);
+}
+
+/**
+ * @brief Set indexed single precision to 0 (X = 0)
+ *
+ * Sets the fold of X and performs the operation X = 0
+ *
+ * @param fold the fold of the indexed type
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_sisetzero(const int fold, idxdOMP_float_indexed *X){
+  X->fold = fold;
+  idxd_sisetzero(fold, X->X);
+}
+
+/**
+ * @brief Set indexed complex single precision to 0 (X = 0)
+ *
+ * Sets the fold of X and performs the operation X = 0
+ *
+ * @param fold the fold of the indexed type
+ * @param X indexed scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_cisetzero(const int fold, idxdOMP_float_complex_indexed *X){
+  X->fold = fold;
+  idxd_cisetzero(fold, X->X);
+}
+
+/**
+ * @internal
+ * @brief Initialize a private copy of an indexed double precision reduction variable
+ *
+ * Sets the fold of Y to that of X and performs the operation Y = 0
+ *
+ * @param X indexed scalar X (the original reduction variable)
+ * @param Y indexed scalar Y (the private copy)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_diinit(const idxdOMP_double_indexed *X, idxdOMP_double_indexed *Y){
+  idxdOMP_disetzero(X->fold, Y);
+}
+
+/**
+ * @internal
+ * @brief Initialize a private copy of an indexed complex double precision reduction variable
+ *
+ * Sets the fold of Y to that of X and performs the operation Y = 0
+ *
+ * @param X indexed scalar X (the original reduction variable)
+ * @param Y indexed scalar Y (the private copy)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_ziinit(const idxdOMP_double_complex_indexed *X, idxdOMP_double_complex_indexed *Y){
+  idxdOMP_zisetzero(X->fold, Y);
+}
+
+/**
+ * @internal
+ * @brief Initialize a private copy of an indexed single precision reduction variable
+ *
+ * Sets the fold of Y to that of X and performs the operation Y = 0
+ *
+ * @param X indexed scalar X (the original reduction variable)
+ * @param Y indexed scalar Y (the private copy)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_siinit(const idxdOMP_float_indexed *X, idxdOMP_float_indexed *Y){
+  idxdOMP_sisetzero(X->fold, Y);
+}
+
+/**
+ * @internal
+ * @brief Initialize a private copy of an indexed complex single precision reduction variable
+ *
+ * Sets the fold of Y to that of X and performs the operation Y = 0
+ *
+ * @param X indexed scalar X (the original reduction variable)
+ * @param Y indexed scalar Y (the private copy)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_ciinit(const idxdOMP_float_complex_indexed *X, idxdOMP_float_complex_indexed *Y){
+  idxdOMP_cisetzero(X->fold, Y);
+}
+
+/**
+ * @brief Add double precision to indexed double precision (Y += X)
+ *
+ * Performs the operation Y += X on an indexed type Y
+ *
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_didadd(const double X, idxdOMP_double_indexed *Y){
+  idxdInline_didadd(Y->fold, X, Y->X);
+}
+
+/**
+ * @brief Add complex double precision to indexed complex double precision (Y += X)
+ *
+ * Performs the operation Y += X on an indexed type Y
+ *
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_zizadd(const void *X, idxdOMP_double_complex_indexed *Y){
+  idxdInline_dmdadd(Y->fold, ((double*)X)[0], Y->X, 2, Y->X + 2 * Y->fold, 2);
+  idxdInline_dmdadd(Y->fold, ((double*)X)[1], Y->X + 1, 2, Y->X + 2 * Y->fold + 1, 2);
+}
+
+/**
+ * @brief Add single precision to indexed single precision (Y += X)
+ *
+ * Performs the operation Y += X on an indexed type Y
+ *
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_sisadd(const float X, idxdOMP_float_indexed *Y){
+  idxdInline_sisadd(Y->fold, X, Y->X);
+}
+
+/**
+ * @brief Add complex single precision to indexed complex single precision (Y += X)
+ *
+ * Performs the operation Y += X on an indexed type Y
+ *
+ * @param X scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_cicadd(const void *X, idxdOMP_float_complex_indexed *Y){
+  idxdInline_smsadd(Y->fold, ((float*)X)[0], Y->X, 2, Y->X + 2 * Y->fold, 2);
+  idxdInline_smsadd(Y->fold, ((float*)X)[1], Y->X + 1, 2, Y->X + 2 * Y->fold + 1, 2);
+}
+
+/**
+ * @brief Add indexed double precision (Y += X)
+ *
+ * Performs the operation Y += X. X and Y must have the same fold.
+ *
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_didiadd(const idxdOMP_double_indexed *X, idxdOMP_double_indexed *Y){
+  idxd_didiadd(Y->fold, X->X, Y->X);
+}
+
+/**
+ * @brief Add indexed complex double precision (Y += X)
+ *
+ * Performs the operation Y += X. X and Y must have the same fold.
+ *
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_ziziadd(const idxdOMP_double_complex_indexed *X, idxdOMP_double_complex_indexed *Y){
+  idxd_ziziadd(Y->fold, X->X, Y->X);
+}
+
+/**
+ * @brief Add indexed single precision (Y += X)
+ *
+ * Performs the operation Y += X. X and Y must have the same fold.
+ *
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_sisiadd(const idxdOMP_float_indexed *X, idxdOMP_float_indexed *Y){
+  idxd_sisiadd(Y->fold, X->X, Y->X);
+}
+
+/**
+ * @brief Add indexed complex single precision (Y += X)
+ *
+ * Performs the operation Y += X. X and Y must have the same fold.
+ *
+ * @param X indexed scalar X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_ciciadd(const idxdOMP_float_complex_indexed *X, idxdOMP_float_complex_indexed *Y){
+  idxd_ciciadd(Y->fold, X->X, Y->X);
+}
+
+/**
+ * @brief Convert indexed double precision to double precision (X -> Y)
+ *
+ * @param X indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline double idxdOMP_ddiconv(const idxdOMP_double_indexed *X){
+  return idxd_ddiconv(X->fold, X->X);
+}
+
+/**
+ * @brief Convert indexed complex double precision to complex double precision (X -> Y)
+ *
+ * @param X indexed scalar X
+ * @param conv scalar return
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_zziconv_sub(const idxdOMP_double_complex_indexed *X, void *conv){
+  idxd_zziconv_sub(X->fold, X->X, conv);
+}
+
+/**
+ * @brief Convert indexed single precision to single precision (X -> Y)
+ *
+ * @param X indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline float idxdOMP_ssiconv(const idxdOMP_float_indexed *X){
+  return idxd_ssiconv(X->fold, X->X);
+}
+
+/**
+ * @brief Convert indexed complex single precision to complex single precision (X -> Y)
+ *
+ * @param X indexed scalar X
+ * @param conv scalar return
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdOMP_cciconv_sub(const idxdOMP_float_complex_indexed *X, void *conv){
+  idxd_cciconv_sub(X->fold, X->X, conv);
+}
+
+#ifdef _OPENMP
+#pragma omp declare reduction(+ : idxdOMP_double_indexed : idxdOMP_didiadd(&omp_in, &omp_out)) initializer(idxdOMP_diinit(&omp_orig, &omp_priv))
+#pragma omp declare reduction(+ : idxdOMP_double_complex_indexed : idxdOMP_ziziadd(&omp_in, &omp_out)) initializer(idxdOMP_ziinit(&omp_orig, &omp_priv))
+#pragma omp declare reduction(+ : idxdOMP_float_indexed : idxdOMP_sisiadd(&omp_in, &omp_out)) initializer(idxdOMP_siinit(&omp_orig, &omp_priv))
+#pragma omp declare reduction(+ : idxdOMP_float_complex_indexed : idxdOMP_ciciadd(&omp_in, &omp_out)) initializer(idxdOMP_ciinit(&omp_orig, &omp_priv))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file  idxdPool.h
+ * @brief idxdPool.h defines the persistent thread pool used to run reproBLAS and idxdBLAS routines on several threads.
+ *
+ * A pool owns a fixed set of worker threads that sleep between calls, so a threaded routine costs a wake-up rather than a thread creation. The thread that calls idxdPool_run() works alongside the workers. The tasks of a call start out split evenly between the threads, and a thread that runs out of tasks steals half of the remaining tasks of another thread.
+ *
+ * The library keeps a pool of its own, which idxdBLAS and reproBLAS routines use once their input is at least as large as the threshold set with idxdPool_set_threshold(). Smaller inputs are handled on the calling thread. The library pool is single-threaded until idxdPool_set_num_threads() is called or the environment variable @c REPROBLAS_NUM_THREADS is set. Instead of the library pool, routines can run on a pool created by the caller (see idxdPool_share()), or on any other thread pool the caller already has (see idxdPool_set_executor()).
+ *
+ * Threaded routines split their input into chunks whose boundaries depend only on the size of the input. Each chunk is summed into its own indexed partial sum, and the partial sums are added together in order. Since indexed summation is reproducible, the results are identical to those computed on one thread, whatever the number of threads or the assignment of chunks to threads.
+ *
+ * On machines with several NUMA nodes, idxdPool_bind_numa() binds the workers of a pool to the nodes, and idxdPool_numa_alloc() allocates vectors whose parts are placed on the nodes in turn. A bound pool runs each chunk of a threaded reduction on a thread of the node that holds the chunk, adds the partial sums of each node into a per-node indexed sum, and adds the per-node sums together in order of node. Since the chunk boundaries do not depend on the topology, the results are again identical to those computed on one thread. The topology is read from @c /sys/devices/system/node, or from the directory named by the environment variable @c REPROBLAS_SYSFS_NODE.
+ *
+ * Routines called from within a task of a pool always run on the calling thread. Apart from the number of threads, which idxdPool_set_num_threads() may change at any time, the settings of the library pool must not be changed while another thread is calling a library routine.
+ *
+ * If ReproBLAS is built without POSIX threads (with @c PTHREADFLAGS empty in config.mk), pools have no workers and all tasks run on the calling thread.
+ */
+#ifndef IDXDPOOL_H_
+#define IDXDPOOL_H_
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default value of the threshold set by idxdPool_set_threshold()
+ */
+#define idxdPool_DEFAULT_THRESHOLD 65536
+
+/**
+ * @internal
+ * @brief The smallest number of elements in a chunk of a threaded reduction
+ */
+#define idxdPool_MINCHUNK 4096
+
+/**
+ * @internal
+ * @brief The largest number of chunks in a threaded reduction
+ */
+#define idxdPool_MAXCHUNKS 1024
+
+/**
+ * @internal
+ * @brief The largest number of elements in a chunk of a threaded reduction
+ *
+ * Reductions of more than #idxdPool_MAXCHUNKS times this many elements use more than #idxdPool_MAXCHUNKS chunks.
+ */
+#define idxdPool_MAXCHUNK (1 << 30)
+
+/**
+ * @brief The thread pool datatype
+ *
+ * To create an #idxdPool, call idxdPool_create()
+ */
+typedef struct idxdPool_ idxdPool;
+
+/**
+ * @brief A task run by a pool
+ *
+ * A task is called once with each index from 0 to @c ntasks - 1, in no particular order and possibly at the same time on different threads.
+ */
+typedef void (*idxdPool_task)(void *arg, const int task);
+
+/**
+ * @brief A function that runs tasks on a thread pool owned by the caller
+ *
+ * An executor must call @c task(arg, t) once for each @c t from 0 to @c ntasks - 1 and must not return before all of the calls have returned.
+ */
+typedef void (*idxdPool_executor)(void *ctx, const int ntasks, idxdPool_task task, void *arg);
+
+idxdPool *idxdPool_create(const int nthreads);
+void idxdPool_free(idxdPool *pool);
+int idxdPool_num_threads(const idxdPool *pool);
+int idxdPool_set_affinity(idxdPool *pool, const int *cpus, const int ncpus);
+int idxdPool_bind_numa(idxdPool *pool);
+void idxdPool_run(idxdPool *pool, const int ntasks, idxdPool_task task, void *arg);
+
+int idxdPool_numa_num_nodes(void);
+void idxdPool_numa_nodes_of(const int n, const void **addrs, int *nodes);
+void *idxdPool_numa_alloc(const size_t size);
+void idxdPool_numa_free(void *mem);
+
+void idxdPool_set_num_threads(const int nthreads);
+int idxdPool_get_num_threads(void);
+void idxdPool_share(idxdPool *pool);
+void idxdPool_set_executor(idxdPool_executor executor, void *ctx);
+void idxdPool_set_threshold(const int N);
+int idxdPool_get_threshold(void);
+
+idxdPool *idxdPool_library(void);
+int idxdPool_in_task(void);
+int idxdPool_set_in_task(const int in_task);
+int idxdPool_parallel(const double work);
+int idxdPool_num_tasks(const double work, const double size, const double budget);
+void idxdPool_dispatch(const int ntasks, idxdPool_task task, void *arg);
+int idxdPool_num_nodes(const idxdPool *pool);
+int idxdPool_numa_bind(void *thread, const int node);
+void idxdPool_run_nodes(idxdPool *pool, const int ntasks, idxdPool_task task, void *arg, const int *task_nodes);
+int idxdPool_dispatch_num_nodes(void);
+void idxdPool_dispatch_nodes(const int ntasks, idxdPool_task task, void *arg, const int *task_nodes);
+void idxdPool_reduce(const int64_t N, const size_t size, void (*kernel)(void *arg, const int64_t i, const int n, void *partial), void (*combine)(void *arg, void *partial, void *Y), void *arg, const void *X, const ptrdiff_t incX, void *Y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,570 @@
+/**
+ * @file  idxdShard.h
+ * @brief idxdShard.h defines sharded indexed accumulators for concurrent accumulation into one reproducible sum.
+ *
+ * A sharded accumulator holds one indexed value (a shard) per thread, each on its own cache lines, together with a count of the deposits made into it since it was last renormalized. Any number of threads may add to the same accumulator at the same time without locking, provided that no two threads use the same shard at once (a thread would typically use the shard given by its thread number). The shards are summed with idxd_didiadd() (or the corresponding function for the other types) when the accumulator is read. Since indexed summation is reproducible, the value read does not depend on which shard each element was added to.
+ *
+ * A typical use of this header is as follows:
+ *
+ *     idxdShard_double_indexed *Y = idxdShard_dialloc(fold, omp_get_max_threads());
+ *     #pragma omp parallel
+ *     #pragma omp single
+ *     for(i = 0; i < N; i++){
+ *       #pragma omp task
+ *       idxdShard_didadd(Y, omp_get_thread_num(), compute(i));
+ *     }
+ *     result = idxdShard_ddiconv(Y);
+ *     idxdShard_free(Y);
+ *
+ * Reading an accumulator (with idxdShard_dimerge() or idxdShard_ddiconv() for example) must not happen at the same time as an addition to it. Code using this header must be linked against libidxd.
+ *
+ * The naming of the functions follows the conventions of idxd.h
+ */
+#ifndef IDXDSHARD_H_
+#define IDXDSHARD_H_
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "idxd.h"
+#include "idxdInline.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The assumed size (in bytes) of a cache line
+ *
+ * Each shard starts on a boundary of this many bytes and occupies a multiple of this many bytes, so that no two shards share a cache line. May be defined before including this header.
+ */
+#ifndef idxdShard_CACHELINE
+#define idxdShard_CACHELINE 64
+#endif
+
+/**
+ * @internal
+ * @brief The layout of a sharded accumulator
+ *
+ * Shard i starts at shards + i * stride. It holds an indexed value of size bytes, followed by two @c int deposit counts (one for each component of a complex type).
+ */
+struct idxdShard_ {
+  int fold;
+  int nshards;
+  size_t size;
+  size_t stride;
+  char *shards;
+  void *mem;
+};
+
+/**
+ * @brief The sharded indexed double datatype
+ *
+ * To allocate a #idxdShard_double_indexed, call idxdShard_dialloc()
+ */
+typedef struct idxdShard_ idxdShard_double_indexed;
+
+/**
+ * @brief The sharded indexed complex double datatype
+ *
+ * To allocate a #idxdShard_double_complex_indexed, call idxdShard_zialloc()
+ */
+typedef struct idxdShard_ idxdShard_double_complex_indexed;
+
+/**
+ * @brief The sharded indexed float datatype
+ *
+ * To allocate a #idxdShard_float_indexed, call idxdShard_sialloc()
+ */
+typedef struct idxdShard_ idxdShard_float_indexed;
+
+/**
+ * @brief The sharded indexed complex float datatype
+ *
+ * To allocate a #idxdShard_float_complex_indexed, call idxdShard_cialloc()
+ */
+typedef struct idxdShard_ idxdShard_float_complex_indexed;
+
+/**
+ * @internal
+ * @brief Get a shard of a sharded accumulator
+ *
+ * @param X sharded accumulator X
+ * @param shard the index of the shard
+ * @return a pointer to the indexed value of the shard
+ *
+ * @date   18 Oct 2026
+ */
+static inline char *idxdShard_shard(const struct idxdShard_ *X, const int shard){
+  return X->shards + (size_t)shard * X->stride;
+}
+
+/**
+ * @internal
+ * @brief Get the deposit counts of a shard of a sharded accumulator
+ *
+ * @param X sharded accumulator X
+ * @param shard the index of the shard
+ * @return a pointer to the deposit counts of the shard
+ *
+ * @date   18 Oct 2026
+ */
+static inline int *idxdShard_count(const struct idxdShard_ *X, const int shard){
+  return (int*)(idxdShard_shard(X, shard) + X->size);
+}
+
+/**
+ * @internal
+ * @brief Allocate a sharded accumulator
+ *
+ * @param fold the fold of the indexed types
+ * @param nshards the number of shards
+ * @param size the size (in bytes) of the indexed type of each shard
+ * @return a sharded accumulator set to 0 (or NULL if allocation fails)
+ *
+ * @date   18 Oct 2026
+ */
+static inline struct idxdShard_ *idxdShard_alloc(const int fold, const int nshards, const size_t size){
+  struct idxdShard_ *X = (struct idxdShard_*)malloc(sizeof(struct idxdShard_));
+  if(X == NULL){
+    return NULL;
+  }
+  X->fold = fold;
+  X->nshards = nshards;
+  X->size = size;
+  X->stride = (size + 2 * sizeof(int) + idxdShard_CACHELINE - 1) / idxdShard_CACHELINE * idxdShard_CACHELINE;
+  X->mem = malloc(nshards * X->stride + idxdShard_CACHELINE);
+  if(X->mem == NULL){
+    free(X);
+    return NULL;
+  }
+  X->shards = (char*)X->mem + (idxdShard_CACHELINE - (uintptr_t)X->mem % idxdShard_CACHELINE) % idxdShard_CACHELINE;
+  memset(X->shards, 0, nshards * X->stride);
+  return X;
+}
+
+/**
+ * @brief Allocate sharded indexed double precision
+ *
+ * @param fold the fold of the indexed types
+ * @param nshards the number of shards (the number of threads that may add to the accumulator at once)
+ * @return a sharded indexed double precision set to 0 (or NULL if allocation fails)
+ *
+ * @date   18 Oct 2026
+ */
+static inline idxdShard_double_indexed *idxdShard_dialloc(const int fold, const int nshards){
+  return idxdShard_alloc(fold, nshards, idxd_disize(fold));
+}
+
+/**
+ * @brief Allocate sharded indexed complex double precision
+ *
+ * @param fold the fold of the indexed types
+ * @param nshards the number of shards (the number of threads that may add to the accumulator at once)
+ * @return a sharded indexed complex double precision set to 0 (or NULL if allocation fails)
+ *
+ * @date   18 Oct 2026
+ */
+static inline idxdShard_double_complex_indexed *idxdShard_zialloc(const int fold, const int nshards){
+  return idxdShard_alloc(fold, nshards, idxd_zisize(fold));
+}
+
+/**
+ * @brief Allocate sharded indexed single precision
+ *
+ * @param fold the fold of the indexed types
+ * @param nshards the number of shards (the number of threads that may add to the accumulator at once)
+ * @return a sharded indexed single precision set to 0 (or NULL if allocation fails)
+ *
+ * @date   18 Oct 2026
+ */
+static inline idxdShard_float_indexed *idxdShard_sialloc(const int fold, const int nshards){
+  return idxdShard_alloc(fold, nshards, idxd_sisize(fold));
+}
+
+/**
+ * @brief Allocate sharded indexed complex single precision
+ *
+ * @param fold the fold of the indexed types
+ * @param nshards the number of shards (the number of threads that may add to the accumulator at once)
+ * @return a sharded indexed complex single precision set to 0 (or NULL if allocation fails)
+ *
+ * @date   18 Oct 2026
+ */
+static inline idxdShard_float_complex_indexed *idxdShard_cialloc(const int fold, const int nshards){
+  return idxdShard_alloc(fold, nshards, idxd_cisize(fold));
+}
+
+/**
+ * @brief Free a sharded accumulator of any type
+ *
+ * @param X sharded accumulator X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_free(struct idxdShard_ *X){
+  if(X != NULL){
+    free(X->mem);
+    free(X);
+  }
+}
+
+/**
+ * @brief Set a sharded accumulator of any type to 0 (X = 0)
+ *
+ * @param X sharded accumulator X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_setzero(struct idxdShard_ *X){
+  memset(X->shards, 0, X->nshards * X->stride);
+}
+
+/**
+ * @internal
+ * @brief Add double precision to manually specified indexed double precision with deposit count (Y += X)
+ *
+ * Performs the operation Y += X, renormalizing Y only when it has seen #idxd_DIENDURANCE deposits or when it must be updated to a larger index.
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ * @param count the number of deposits into Y since it was last renormalized
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_dmdadd(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY, int *count){
+  if(*count > 0 && idxdInline_dindex(X) < idxdInline_dmindex(priY)){
+    idxdInline_dmrenorm(fold, priY, incpriY, carY, inccarY);
+    *count = 0;
+  }
+  idxdInline_dmdupdate(fold, X, priY, incpriY, carY, inccarY);
+  idxdInline_dmddeposit(fold, X, priY, incpriY);
+  if(++*count == idxd_DIENDURANCE){
+    idxdInline_dmrenorm(fold, priY, incpriY, carY, inccarY);
+    *count = 0;
+  }
+}
+
+/**
+ * @internal
+ * @brief Add single precision to manually specified indexed single precision with deposit count (Y += X)
+ *
+ * Performs the operation Y += X, renormalizing Y only when it has seen #idxd_SIENDURANCE deposits or when it must be updated to a larger index.
+ *
+ * @param fold the fold of the indexed types
+ * @param X scalar X
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ * @param count the number of deposits into Y since it was last renormalized
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_smsadd(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY, int *count){
+  if(*count > 0 && idxdInline_sindex(X) < idxdInline_smindex(priY)){
+    idxdInline_smrenorm(fold, priY, incpriY, carY, inccarY);
+    *count = 0;
+  }
+  idxdInline_smsupdate(fold, X, priY, incpriY, carY, inccarY);
+  idxdInline_smsdeposit(fold, X, priY, incpriY);
+  if(++*count == idxd_SIENDURANCE){
+    idxdInline_smrenorm(fold, priY, incpriY, carY, inccarY);
+    *count = 0;
+  }
+}
+
+/**
+ * @brief Add double precision to a shard of sharded indexed double precision (Y += X)
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_didadd(idxdShard_double_indexed *Y, const int shard, const double X){
+  double *y = (double*)idxdShard_shard(Y, shard);
+  idxdShard_dmdadd(Y->fold, X, y, 1, y + Y->fold, 1, idxdShard_count(Y, shard));
+}
+
+/**
+ * @brief Add complex double precision to a shard of sharded indexed complex double precision (Y += X)
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_zizadd(idxdShard_double_complex_indexed *Y, const int shard, const void *X){
+  double *y = (double*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  idxdShard_dmdadd(Y->fold, ((double*)X)[0], y, 2, y + 2 * Y->fold, 2, count);
+  idxdShard_dmdadd(Y->fold, ((double*)X)[1], y + 1, 2, y + 2 * Y->fold + 1, 2, count + 1);
+}
+
+/**
+ * @brief Add single precision to a shard of sharded indexed single precision (Y += X)
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_sisadd(idxdShard_float_indexed *Y, const int shard, const float X){
+  float *y = (float*)idxdShard_shard(Y, shard);
+  idxdShard_smsadd(Y->fold, X, y, 1, y + Y->fold, 1, idxdShard_count(Y, shard));
+}
+
+/**
+ * @brief Add complex single precision to a shard of sharded indexed complex single precision (Y += X)
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X scalar X
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_cicadd(idxdShard_float_complex_indexed *Y, const int shard, const void *X){
+  float *y = (float*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  idxdShard_smsadd(Y->fold, ((float*)X)[0], y, 2, y + 2 * Y->fold, 2, count);
+  idxdShard_smsadd(Y->fold, ((float*)X)[1], y + 1, 2, y + 2 * Y->fold + 1, 2, count + 1);
+}
+
+/**
+ * @brief Add indexed double precision to a shard of sharded indexed double precision (Y += X)
+ *
+ * This can be used to add a partial result (computed with idxdBLAS_didsum() for example) to the accumulator.
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X indexed scalar X (with the same fold as Y)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_didiadd(idxdShard_double_indexed *Y, const int shard, const double_indexed *X){
+  double *y = (double*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  if(count[0] > 0){
+    idxd_direnorm(Y->fold, y);
+    count[0] = 0;
+  }
+  idxd_didiadd(Y->fold, X, y);
+}
+
+/**
+ * @brief Add indexed complex double precision to a shard of sharded indexed complex double precision (Y += X)
+ *
+ * This can be used to add a partial result (computed with idxdBLAS_zizsum() for example) to the accumulator.
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X indexed scalar X (with the same fold as Y)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_ziziadd(idxdShard_double_complex_indexed *Y, const int shard, const double_complex_indexed *X){
+  double *y = (double*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  if(count[0] > 0 || count[1] > 0){
+    idxd_zirenorm(Y->fold, y);
+    count[0] = 0;
+    count[1] = 0;
+  }
+  idxd_ziziadd(Y->fold, X, y);
+}
+
+/**
+ * @brief Add indexed single precision to a shard of sharded indexed single precision (Y += X)
+ *
+ * This can be used to add a partial result (computed with idxdBLAS_sissum() for example) to the accumulator.
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X indexed scalar X (with the same fold as Y)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_sisiadd(idxdShard_float_indexed *Y, const int shard, const float_indexed *X){
+  float *y = (float*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  if(count[0] > 0){
+    idxd_sirenorm(Y->fold, y);
+    count[0] = 0;
+  }
+  idxd_sisiadd(Y->fold, X, y);
+}
+
+/**
+ * @brief Add indexed complex single precision to a shard of sharded indexed complex single precision (Y += X)
+ *
+ * This can be used to add a partial result (computed with idxdBLAS_cicsum() for example) to the accumulator.
+ *
+ * @param Y sharded indexed scalar Y
+ * @param shard the shard of Y to add to (no other thread may use this shard at the same time)
+ * @param X indexed scalar X (with the same fold as Y)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_ciciadd(idxdShard_float_complex_indexed *Y, const int shard, const float_complex_indexed *X){
+  float *y = (float*)idxdShard_shard(Y, shard);
+  int *count = idxdShard_count(Y, shard);
+  if(count[0] > 0 || count[1] > 0){
+    idxd_cirenorm(Y->fold, y);
+    count[0] = 0;
+    count[1] = 0;
+  }
+  idxd_ciciadd(Y->fold, X, y);
+}
+
+/**
+ * @brief Add the shards of sharded indexed double precision to indexed double precision (Y += X)
+ *
+ * X is not modified.
+ *
+ * @param X sharded indexed scalar X
+ * @param Y indexed scalar Y (with the same fold as X)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_dimerge(const idxdShard_double_indexed *X, double_indexed *Y){
+  double_indexed tmp[2 * idxd_DIMAXFOLD];
+  int i;
+  for(i = 0; i < X->nshards; i++){
+    memcpy(tmp, idxdShard_shard(X, i), X->size);
+    idxd_direnorm(X->fold, tmp);
+    idxd_didiadd(X->fold, tmp, Y);
+  }
+}
+
+/**
+ * @brief Add the shards of sharded indexed complex double precision to indexed complex double precision (Y += X)
+ *
+ * X is not modified.
+ *
+ * @param X sharded indexed scalar X
+ * @param Y indexed scalar Y (with the same fold as X)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_zimerge(const idxdShard_double_complex_indexed *X, double_complex_indexed *Y){
+  double_complex_indexed tmp[4 * idxd_DIMAXFOLD];
+  int i;
+  for(i = 0; i < X->nshards; i++){
+    memcpy(tmp, idxdShard_shard(X, i), X->size);
+    idxd_zirenorm(X->fold, tmp);
+    idxd_ziziadd(X->fold, tmp, Y);
+  }
+}
+
+/**
+ * @brief Add the shards of sharded indexed single precision to indexed single precision (Y += X)
+ *
+ * X is not modified.
+ *
+ * @param X sharded indexed scalar X
+ * @param Y indexed scalar Y (with the same fold as X)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_simerge(const idxdShard_float_indexed *X, float_indexed *Y){
+  float_indexed tmp[2 * idxd_SIMAXFOLD];
+  int i;
+  for(i = 0; i < X->nshards; i++){
+    memcpy(tmp, idxdShard_shard(X, i), X->size);
+    idxd_sirenorm(X->fold, tmp);
+    idxd_sisiadd(X->fold, tmp, Y);
+  }
+}
+
+/**
+ * @brief Add the shards of sharded indexed complex single precision to indexed complex single precision (Y += X)
+ *
+ * X is not modified.
+ *
+ * @param X sharded indexed scalar X
+ * @param Y indexed scalar Y (with the same fold as X)
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_cimerge(const idxdShard_float_complex_indexed *X, float_complex_indexed *Y){
+  float_complex_indexed tmp[4 * idxd_SIMAXFOLD];
+  int i;
+  for(i = 0; i < X->nshards; i++){
+    memcpy(tmp, idxdShard_shard(X, i), X->size);
+    idxd_cirenorm(X->fold, tmp);
+    idxd_ciciadd(X->fold, tmp, Y);
+  }
+}
+
+/**
+ * @brief Convert sharded indexed double precision to double precision (X -> Y)
+ *
+ * @param X sharded indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline double idxdShard_ddiconv(const idxdShard_double_indexed *X){
+  double_indexed Y[2 * idxd_DIMAXFOLD];
+  idxd_disetzero(X->fold, Y);
+  idxdShard_dimerge(X, Y);
+  return idxd_ddiconv(X->fold, Y);
+}
+
+/**
+ * @brief Convert sharded indexed complex double precision to complex double precision (X -> Y)
+ *
+ * @param X sharded indexed scalar X
+ * @param conv scalar return
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_zziconv_sub(const idxdShard_double_complex_indexed *X, void *conv){
+  double_complex_indexed Y[4 * idxd_DIMAXFOLD];
+  idxd_zisetzero(X->fold, Y);
+  idxdShard_zimerge(X, Y);
+  idxd_zziconv_sub(X->fold, Y, conv);
+}
+
+/**
+ * @brief Convert sharded indexed single precision to single precision (X -> Y)
+ *
+ * @param X sharded indexed scalar X
+ * @return scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+static inline float idxdShard_ssiconv(const idxdShard_float_indexed *X){
+  float_indexed Y[2 * idxd_SIMAXFOLD];
+  idxd_sisetzero(X->fold, Y);
+  idxdShard_simerge(X, Y);
+  return idxd_ssiconv(X->fold, Y);
+}
+
+/**
+ * @brief Convert sharded indexed complex single precision to complex single precision (X -> Y)
+ *
+ * @param X sharded indexed scalar X
+ * @param conv scalar return
+ *
+ * @date   18 Oct 2026
+ */
+static inline void idxdShard_cciconv_sub(const idxdShard_float_complex_indexed *X, void *conv){
+  float_complex_indexed Y[4 * idxd_SIMAXFOLD];
+  idxd_cisetzero(X->fold, Y);
+  idxdShard_cimerge(X, Y);
+  idxd_cciconv_sub(X->fold, Y, conv);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
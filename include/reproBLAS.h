@@ -11,6 +11,8 @@
  * - z - complex double (@c *void)
  * - s - float (@c float)
  * - c - complex float (@c *void)
+ * - h - half precision float (IEEE binary16 bit pattern, @c uint16_t)
+ * - b - bfloat16 (upper 16 bits of a @c float bit pattern, @c uint16_t)
  *
  * Throughout the library, complex types are specified via @c *void pointers. These routines will sometimes be suffixed by sub, to represent that a function has been made into a subroutine. This allows programmers to use whatever complex types they are already using, as long as the memory pointed to is of the form of two adjacent floating point types, the first and second representing real and imaginary components of the complex number.
  *
@@ -19,10 +21,49 @@
  * The parameter @c fold describes how many accumulators are used in the indexed types supplied to a subroutine (an indexed type with @c k accumulators  is @c k-fold). The default value for this parameter can be set in config.h. If you are unsure of what value to use for @c fold, we recommend 3. Note that the @c fold of indexed types must be the same for all indexed types that interact with each other. Operations on more than one indexed type assume all indexed types being operated upon have the same @c fold. Note that the @c fold of an indexed type may not be changed once the type has been allocated. A common use case would be to set the value of @c fold as a global macro in your code and supply it to all indexed functions that you use.
  *
  * In reproBLAS, two copies of the BLAS are provided. The functions that share the same name as their BLAS counterparts perform reproducible versions of their corresponding operations using the default fold value specified in config.h. The functions that are prefixed by the character 'r' allow the user to specify their own fold for the underlying indexed types.
+ *
+ * Functions whose input character set is prefixed by d, such as @c sdsdot (modeled after the BLAS function of the same name) or @c scdcnrm2, accumulate single precision inputs in indexed double precision types and round the result to single precision. They are more accurate than the corresponding functions with indexed single precision types and are faster than the corresponding functions at a fold with the same error bound, though slower at the same fold.
+ *
+ * Functions such as @c sdhsum and @c sdbdot likewise accumulate half precision and bfloat16 inputs in indexed double precision types and round the result to single precision.
+ *
+ * Dot products suffixed by @c _fma, such as @c ddot_fma or @c zdotc_fma_sub, form each product exactly as the sum of its rounded value and rounding error using fused multiply-add. Only the accumulation is inexact, so they are more accurate than the plain dot products at the same fold and a smaller fold can often be used in their place.
+ *
+ * Likewise, @c dsgemv and @c dsgemm multiply single precision matrices and vectors, accumulating the products in indexed double precision types, and add the result to double precision outputs. Their results are the same as those of @c dgemv and @c dgemm on the inputs converted to double precision.
+ *
+ * Functions suffixed by @c _planar, such as @c zgemv_planar and @c zgemm_planar, take complex matrices and vectors in planar layout, as separate arrays of their real and imaginary parts, and accumulate with the real indexed kernels. Their results are the same as those of the corresponding functions on the interleaved data.
+ *
+ * The symmetric and hermitian rank-k updates @c dsyrk, @c ssyrk and @c zherk, which also compute Gram matrices, compute and convert to indexed types only one triangle of their output. Each element of the triangle is the same as that of the corresponding matrix-matrix product. Passing 'a' or 'A' as @c Uplo computes the lower triangle and copies it (or its conjugate) to the upper triangle.
+ *
+ * The triangular solves @c dtrsv and @c dtrsm accumulate each element of the solution and the products of the elements already computed in a single indexed type, rounding once before the division by the diagonal element. The solution does not depend on the blocking or on the number of threads.
+ *
+ * The sparse matrix-vector products @c dcsrmv and @c scsrmv take matrices in compressed sparse row format, along with optional bounds on the absolute values of their rows (see idxdBLAS_dcsramax() and idxdBLAS_scsramax()) that can be computed once for matrices that are multiplied repeatedly.
+ *
+ * The reductions @c dgesum, @c dgeasum and @c dgenrm2 (and their single precision counterparts) compute the sum, absolute sum or Euclidian norm of every row or every column of a matrix in one sweep of the matrix in its storage order, and each result is the same as that of the corresponding vector function on its row or column. The matrix norms @c dlange and @c slange compute the max, 1-, infinity or Frobenius norm of a matrix from these reductions.
+ *
+ * The moments @c dmoments and @c smoments compute the means of the first few powers of the elements of a vector, shifted by a given point, in one pass over the vector. @c dcmoments and @c scmoments compute the mean in a first pass and the central moments (such as the variance) about it in a second.
+ *
+ * The segmented sums @c dsegsum and @c ssegsum sum consecutive segments of a vector given by their offsets, and the keyed sums @c dkeysum and @c skeysum sum the elements of a vector grouped by an integer key in one pass over the vector. Each result is the same as that of @c dsum or @c ssum on the elements of its segment or key, in any order.
+ *
+ * The scans @c dscan and @c sscan compute the inclusive prefix sums of a vector, and @c dexscan and @c sexscan the exclusive ones. Each prefix sum is the same as that of @c dsum or @c ssum on its prefix, even when the scan is split among threads.
+ *
+ * The fused functions @c dgemvdot and @c sgemvdot compute a matrix-vector product, as @c dgemv and @c sgemv do, and return the dot product of a given vector with the result, reading the matrix once. The dot product is the same as that of @c ddot or @c sdot on the updated output vector.
+ *
+ * The fused functions @c daxpbydot and @c daxpbynrm2 (and their single precision and complex counterparts) update a vector y := alpha*x + beta*y and return the dot product of a given vector with the updated y, or its Euclidian norm, reading y once. The results are the same as those of @c ddot or @c dnrm2 on the updated vector.
+ *
+ * The functions @c dmdot and @c smdot return the dot products of several requested pairs among k vectors stored at a fixed distance from each other, loading each vector once per block however many pairs it appears in. Each result is the same as that of @c ddot or @c sdot on its pair.
+ *
+ * Functions suffixed by @c _bounded, such as @c dsum_bounded, @c dasum_bounded and @c ddot_bounded (and their single precision counterparts), take a bound on the absolute values of the elements (or of the pairwise products) of their inputs, such as one known from the computation that produced them, and read their inputs once instead of first computing their largest absolute value. If the bound is at least the largest absolute value and falls in the same bin, the result is the same as that of the function without the bound. Bounds can be checked with idxdBLAS_set_check_bounds() while debugging.
+ *
+ * Each function has a variant suffixed by @c _64 in which vector lengths, strides, matrix dimensions and leading dimensions are 64-bit integers (@c int64_t), so that a single call can handle more than 2^31 - 1 elements. The results are identical to those of the 32-bit functions on the same inputs. Since indexed single precision types can only sum #idxd_SICAPACITY (about 2^32) elements, the single precision variants return NaN (or set their outputs to NaN) if given more.
  */
 #ifndef REPROBLAS_H_
 #define REPROBLAS_H_
 #include <complex.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 double reproBLAS_rdsum(const int fold, const int N, const double* X, const int incX);
 double reproBLAS_rdasum(const int fold, const int N, const double* X, const int incX);
@@ -46,6 +87,31 @@ float reproBLAS_rscnrm2(const int fold, const int N, const void* X, const int in
 void reproBLAS_rcdotc_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
 void reproBLAS_rcdotu_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
 
+float reproBLAS_rsdssum(const int fold, const int N, const float* X, const int incX);
+float reproBLAS_rsdsasum(const int fold, const int N, const float* X, const int incX);
+float reproBLAS_rsdsnrm2(const int fold, const int N, const float* X, const int incX);
+float reproBLAS_rsdsdot(const int fold, const int N, const float* X, const int incX, const float* Y, const int incY);
+void reproBLAS_rcdcsum_sub(const int fold, const int N, const void* X, const int incX, void *sum);
+float reproBLAS_rscdcasum(const int fold, const int N, const void* X, const int incX);
+float reproBLAS_rscdcnrm2(const int fold, const int N, const void* X, const int incX);
+void reproBLAS_rcdcdotu_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotu);
+void reproBLAS_rcdcdotc_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc);
+float reproBLAS_rsdhsum(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdhasum(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdhnrm2(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdhdot(const int fold, const int N, const uint16_t* X, const int incX, const uint16_t* Y, const int incY);
+float reproBLAS_rsdbsum(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdbasum(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdbnrm2(const int fold, const int N, const uint16_t* X, const int incX);
+float reproBLAS_rsdbdot(const int fold, const int N, const uint16_t* X, const int incX, const uint16_t* Y, const int incY);
+
+double reproBLAS_rddot_fma(const int fold, const int N, const double* X, const int incX, const double* Y, const int incY);
+float reproBLAS_rsdot_fma(const int fold, const int N, const float* X, const int incX, const float* Y, const int incY);
+void reproBLAS_rzdotu_fma_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+void reproBLAS_rzdotc_fma_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void reproBLAS_rcdotu_fma_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+void reproBLAS_rcdotc_fma_sub(const int fold, const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+
 void reproBLAS_rdgemv(const int fold, const char Order, const char TransA,
             const int M, const int N,
             const double alpha, const double *A, const int lda,
@@ -94,6 +160,158 @@ void reproBLAS_rcgemm(const int fold, const char Order,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
 
+void reproBLAS_rdsgemv(const int fold, const char Order, const char TransA,
+            const int M, const int N,
+            const double alpha, const float *A, const int lda,
+            const float *X, const int incX,
+            const double beta, double *Y, const int incY);
+void reproBLAS_rdsgemm(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const float *A, const int lda,
+            const float *B, const int ldb,
+            const double beta, double *C, const int ldc);
+
+void reproBLAS_rzgemv_planar(const int fold, const char Order, const char TransA,
+            const int M, const int N,
+            const void *alpha, const double *AR, const double *AI, const int lda,
+            const double *XR, const double *XI, const int incX,
+            const void *beta, double *YR, double *YI, const int incY);
+void reproBLAS_rzgemm_planar(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const double *AR, const double *AI, const int lda,
+            const double *BR, const double *BI, const int ldb,
+            const void *beta, double *CR, double *CI, const int ldc);
+
+void reproBLAS_rdsyrk(const int fold, const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const double alpha, const double *A, const int lda,
+            const double beta, double *C, const int ldc);
+void reproBLAS_rssyrk(const int fold, const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const float alpha, const float *A, const int lda,
+            const float beta, float *C, const int ldc);
+void reproBLAS_rzherk(const int fold, const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const double alpha, const void *A, const int lda,
+            const double beta, void *C, const int ldc);
+
+void reproBLAS_rdtrsm(const int fold, const char Order, const char Side, const char Uplo,
+            const char TransA, const char Diag,
+            const int M, const int N,
+            const double alpha, const double *A, const int lda,
+            double *B, const int ldb);
+void reproBLAS_rdtrsv(const int fold, const char Order, const char Uplo,
+            const char TransA, const char Diag,
+            const int N, const double *A, const int lda,
+            double *X, const int incX);
+
+void reproBLAS_rdcsrmv(const int fold, const char TransA,
+            const int M, const int N,
+            const double alpha, const double *val, const int *rowptr, const int *colind,
+            const double *rowmax, const double *X, const int incX,
+            const double beta, double *Y, const int incY);
+void reproBLAS_rscsrmv(const int fold, const char TransA,
+            const int M, const int N,
+            const float alpha, const float *val, const int *rowptr, const int *colind,
+            const float *rowmax, const float *X, const int incX,
+            const float beta, float *Y, const int incY);
+
+void reproBLAS_rdgesum(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+void reproBLAS_rdgeasum(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+void reproBLAS_rdgenrm2(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+double reproBLAS_rdlange(const int fold, const char Norm, const char Order,
+            const int M, const int N,
+            const double *A, const int lda);
+void reproBLAS_rsgesum(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+void reproBLAS_rsgeasum(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+void reproBLAS_rsgenrm2(const int fold, const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+float reproBLAS_rslange(const int fold, const char Norm, const char Order,
+            const int M, const int N,
+            const float *A, const int lda);
+
+void reproBLAS_rdmoments(const int fold, const int order, const int N, const double *X, const int incX, const double shift, double *M);
+void reproBLAS_rdcmoments(const int fold, const int order, const int N, const double *X, const int incX, double *M);
+void reproBLAS_rsmoments(const int fold, const int order, const int N, const float *X, const int incX, const float shift, float *M);
+void reproBLAS_rscmoments(const int fold, const int order, const int N, const float *X, const int incX, float *M);
+
+void reproBLAS_rdsegsum(const int fold, const int nseg, const int *segptr,
+            const double *X, const int incX,
+            double *Y, const int incY);
+void reproBLAS_rssegsum(const int fold, const int nseg, const int *segptr,
+            const float *X, const int incX,
+            float *Y, const int incY);
+void reproBLAS_rdkeysum(const int fold, const int N, const int *keys,
+            const double *X, const int incX, const int nkeys,
+            double *Y, const int incY);
+void reproBLAS_rskeysum(const int fold, const int N, const int *keys,
+            const float *X, const int incX, const int nkeys,
+            float *Y, const int incY);
+
+void reproBLAS_rdscan(const int fold, const int N, const double *X, const int incX, double *Y, const int incY);
+void reproBLAS_rdexscan(const int fold, const int N, const double *X, const int incX, double *Y, const int incY);
+void reproBLAS_rsscan(const int fold, const int N, const float *X, const int incX, float *Y, const int incY);
+void reproBLAS_rsexscan(const int fold, const int N, const float *X, const int incX, float *Y, const int incY);
+
+double reproBLAS_rdgemvdot(const int fold, const char Order, const char TransA,
+            const int M, const int N,
+            const double alpha, const double *A, const int lda,
+            const double *X, const int incX,
+            const double beta, double *Y, const int incY,
+            const double *W, const int incW);
+float reproBLAS_rsgemvdot(const int fold, const char Order, const char TransA,
+            const int M, const int N,
+            const float alpha, const float *A, const int lda,
+            const float *X, const int incX,
+            const float beta, float *Y, const int incY,
+            const float *W, const int incW);
+
+double reproBLAS_rdaxpbydot(const int fold, const int N, const double alpha, const double *X, const int incX,
+            const double beta, double *Y, const int incY, const double *W, const int incW);
+float reproBLAS_rsaxpbydot(const int fold, const int N, const float alpha, const float *X, const int incX,
+            const float beta, float *Y, const int incY, const float *W, const int incW);
+void reproBLAS_rzaxpbydotc_sub(const int fold, const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc);
+void reproBLAS_rcaxpbydotc_sub(const int fold, const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc);
+double reproBLAS_rdaxpbynrm2(const int fold, const int N, const double alpha, const double *X, const int incX,
+            const double beta, double *Y, const int incY);
+float reproBLAS_rsaxpbynrm2(const int fold, const int N, const float alpha, const float *X, const int incX,
+            const float beta, float *Y, const int incY);
+double reproBLAS_rdzaxpbynrm2(const int fold, const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY);
+float reproBLAS_rscaxpbynrm2(const int fold, const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY);
+void reproBLAS_rdmdot(const int fold, const int N, const int k, const double *X, const int ldX, const int incX,
+            const int npairs, const int *pairs, double *dots);
+void reproBLAS_rsmdot(const int fold, const int N, const int k, const float *X, const int ldX, const int incX,
+            const int npairs, const int *pairs, float *dots);
+double reproBLAS_rdsum_bounded(const int fold, const int N, const double* X, const int incX, const double bound);
+double reproBLAS_rdasum_bounded(const int fold, const int N, const double* X, const int incX, const double bound);
+double reproBLAS_rddot_bounded(const int fold, const int N, const double* X, const int incX, const double* Y, const int incY, const double bound);
+float reproBLAS_rssum_bounded(const int fold, const int N, const float* X, const int incX, const float bound);
+float reproBLAS_rsasum_bounded(const int fold, const int N, const float* X, const int incX, const float bound);
+float reproBLAS_rsdot_bounded(const int fold, const int N, const float* X, const int incX, const float* Y, const int incY, const float bound);
+
 double reproBLAS_dsum(const int N, const double* X, const int incX);
 double reproBLAS_dasum(const int N, const double* X, const int incX);
 double reproBLAS_dnrm2(const int N, const double* X, const int incX);
@@ -116,6 +334,31 @@ float reproBLAS_scnrm2(const int N, const void* X, const int incX);
 void reproBLAS_cdotc_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
 void reproBLAS_cdotu_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
 
+float reproBLAS_sdssum(const int N, const float* X, const int incX);
+float reproBLAS_sdsasum(const int N, const float* X, const int incX);
+float reproBLAS_sdsnrm2(const int N, const float* X, const int incX);
+float reproBLAS_sdsdot(const int N, const float* X, const int incX, const float* Y, const int incY);
+void reproBLAS_cdcsum_sub(const int N, const void* X, const int incX, void *sum);
+float reproBLAS_scdcasum(const int N, const void* X, const int incX);
+float reproBLAS_scdcnrm2(const int N, const void* X, const int incX);
+void reproBLAS_cdcdotu_sub(const int N, const void* X, const int incX, const void *Y, const int incY, void *dotu);
+void reproBLAS_cdcdotc_sub(const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc);
+float reproBLAS_sdhsum(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdhasum(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdhnrm2(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdhdot(const int N, const uint16_t* X, const int incX, const uint16_t* Y, const int incY);
+float reproBLAS_sdbsum(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdbasum(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdbnrm2(const int N, const uint16_t* X, const int incX);
+float reproBLAS_sdbdot(const int N, const uint16_t* X, const int incX, const uint16_t* Y, const int incY);
+
+double reproBLAS_ddot_fma(const int N, const double* X, const int incX, const double* Y, const int incY);
+float reproBLAS_sdot_fma(const int N, const float* X, const int incX, const float* Y, const int incY);
+void reproBLAS_zdotu_fma_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+void reproBLAS_zdotc_fma_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+void reproBLAS_cdotu_fma_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotu);
+void reproBLAS_cdotc_fma_sub(const int N, const void* X, const int incX, const void* Y, const int incY, void *dotc);
+
 void reproBLAS_dgemv(const char Order, const char TransA,
             const int M, const int N,
             const double alpha, const double *A, const int lda,
@@ -160,4 +403,646 @@ void reproBLAS_cgemm(const char Order, const char TransA, const char TransB,
             const void *B, const int ldb,
             const void *beta, void *C, const int ldc);
 
+void reproBLAS_dsgemv(const char Order, const char TransA,
+            const int M, const int N,
+            const double alpha, const float *A, const int lda,
+            const float *X, const int incX,
+            const double beta, double *Y, const int incY);
+void reproBLAS_dsgemm(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const double alpha, const float *A, const int lda,
+            const float *B, const int ldb,
+            const double beta, double *C, const int ldc);
+
+void reproBLAS_zgemv_planar(const char Order, const char TransA,
+            const int M, const int N,
+            const void *alpha, const double *AR, const double *AI, const int lda,
+            const double *XR, const double *XI, const int incX,
+            const void *beta, double *YR, double *YI, const int incY);
+void reproBLAS_zgemm_planar(const char Order, const char TransA, const char TransB,
+            const int M, const int N, const int K,
+            const void *alpha, const double *AR, const double *AI, const int lda,
+            const double *BR, const double *BI, const int ldb,
+            const void *beta, double *CR, double *CI, const int ldc);
+
+void reproBLAS_dsyrk(const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const double alpha, const double *A, const int lda,
+            const double beta, double *C, const int ldc);
+void reproBLAS_ssyrk(const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const float alpha, const float *A, const int lda,
+            const float beta, float *C, const int ldc);
+void reproBLAS_zherk(const char Order, const char Uplo, const char Trans,
+            const int N, const int K,
+            const double alpha, const void *A, const int lda,
+            const double beta, void *C, const int ldc);
+
+void reproBLAS_dtrsm(const char Order, const char Side, const char Uplo,
+            const char TransA, const char Diag,
+            const int M, const int N,
+            const double alpha, const double *A, const int lda,
+            double *B, const int ldb);
+void reproBLAS_dtrsv(const char Order, const char Uplo,
+            const char TransA, const char Diag,
+            const int N, const double *A, const int lda,
+            double *X, const int incX);
+
+void reproBLAS_dcsrmv(const char TransA,
+            const int M, const int N,
+            const double alpha, const double *val, const int *rowptr, const int *colind,
+            const double *rowmax, const double *X, const int incX,
+            const double beta, double *Y, const int incY);
+void reproBLAS_scsrmv(const char TransA,
+            const int M, const int N,
+            const float alpha, const float *val, const int *rowptr, const int *colind,
+            const float *rowmax, const float *X, const int incX,
+            const float beta, float *Y, const int incY);
+
+void reproBLAS_dgesum(const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+void reproBLAS_dgeasum(const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+void reproBLAS_dgenrm2(const char Order, const char Dim,
+            const int M, const int N,
+            const double *A, const int lda,
+            double *Y, const int incY);
+double reproBLAS_dlange(const char Norm, const char Order,
+            const int M, const int N,
+            const double *A, const int lda);
+void reproBLAS_sgesum(const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+void reproBLAS_sgeasum(const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+void reproBLAS_sgenrm2(const char Order, const char Dim,
+            const int M, const int N,
+            const float *A, const int lda,
+            float *Y, const int incY);
+float reproBLAS_slange(const char Norm, const char Order,
+            const int M, const int N,
+            const float *A, const int lda);
+
+void reproBLAS_dmoments(const int order, const int N, const double *X, const int incX, const double shift, double *M);
+void reproBLAS_dcmoments(const int order, const int N, const double *X, const int incX, double *M);
+void reproBLAS_smoments(const int order, const int N, const float *X, const int incX, const float shift, float *M);
+void reproBLAS_scmoments(const int order, const int N, const float *X, const int incX, float *M);
+
+void reproBLAS_dsegsum(const int nseg, const int *segptr,
+            const double *X, const int incX,
+            double *Y, const int incY);
+void reproBLAS_ssegsum(const int nseg, const int *segptr,
+            const float *X, const int incX,
+            float *Y, const int incY);
+void reproBLAS_dkeysum(const int N, const int *keys,
+            const double *X, const int incX, const int nkeys,
+            double *Y, const int incY);
+void reproBLAS_skeysum(const int N, const int *keys,
+            const float *X, const int incX, const int nkeys,
+            float *Y, const int incY);
+
+void reproBLAS_dscan(const int N, const double *X, const int incX, double *Y, const int incY);
+void reproBLAS_dexscan(const int N, const double *X, const int incX, double *Y, const int incY);
+void reproBLAS_sscan(const int N, const float *X, const int incX, float *Y, const int incY);
+void reproBLAS_sexscan(const int N, const float *X, const int incX, float *Y, const int incY);
+
+double reproBLAS_dgemvdot(const char Order, const char TransA,
+            const int M, const int N,
+            const double alpha, const double *A, const int lda,
+            const double *X, const int incX,
+            const double beta, double *Y, const int incY,
+            const double *W, const int incW);
+float reproBLAS_sgemvdot(const char Order, const char TransA,
+            const int M, const int N,
+            const float alpha, const float *A, const int lda,
+            const float *X, const int incX,
+            const float beta, float *Y, const int incY,
+            const float *W, const int incW);
+
+double reproBLAS_daxpbydot(const int N, const double alpha, const double *X, const int incX,
+            const double beta, double *Y, const int incY, const double *W, const int incW);
+float reproBLAS_saxpbydot(const int N, const float alpha, const float *X, const int incX,
+            const float beta, float *Y, const int incY, const float *W, const int incW);
+void reproBLAS_zaxpbydotc_sub(const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc);
+void reproBLAS_caxpbydotc_sub(const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc);
+double reproBLAS_daxpbynrm2(const int N, const double alpha, const double *X, const int incX,
+            const double beta, double *Y, const int incY);
+float reproBLAS_saxpbynrm2(const int N, const float alpha, const float *X, const int incX,
+            const float beta, float *Y, const int incY);
+double reproBLAS_dzaxpbynrm2(const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY);
+float reproBLAS_scaxpbynrm2(const int N, const void *alpha, const void *X, const int incX,
+            const void *beta, void *Y, const int incY);
+void reproBLAS_dmdot(const int N, const int k, const double *X, const int ldX, const int incX,
+            const int npairs, const int *pairs, double *dots);
+void reproBLAS_smdot(const int N, const int k, const float *X, const int ldX, const int incX,
+            const int npairs, const int *pairs, float *dots);
+double reproBLAS_dsum_bounded(const int N, const double* X, const int incX, const double bound);
+double reproBLAS_dasum_bounded(const int N, const double* X, const int incX, const double bound);
+double reproBLAS_ddot_bounded(const int N, const double* X, const int incX, const double* Y, const int incY, const double bound);
+float reproBLAS_ssum_bounded(const int N, const float* X, const int incX, const float bound);
+float reproBLAS_sasum_bounded(const int N, const float* X, const int incX, const float bound);
+float reproBLAS_sdot_bounded(const int N, const float* X, const int incX, const float* Y, const int incY, const float bound);
+
+double reproBLAS_rdsum_64(const int fold, const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_rdasum_64(const int fold, const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_rdnrm2_64(const int fold, const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_rddot_64(const int fold, const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY);
+
+float reproBLAS_rsdot_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+float reproBLAS_rsasum_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_rssum_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_rsnrm2_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+
+void reproBLAS_rzsum_sub_64(const int fold, const int64_t N, const void* X, int64_t incX, void *sum);
+double reproBLAS_rdzasum_64(const int fold, const int64_t N, const void* X, const int64_t incX);
+double reproBLAS_rdznrm2_64(const int fold, const int64_t N, const void* X, int64_t incX);
+void reproBLAS_rzdotc_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_rzdotu_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+
+void reproBLAS_rcsum_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, void *sum);
+float reproBLAS_rscasum_64(const int fold, const int64_t N, const void* X, const int64_t incX);
+float reproBLAS_rscnrm2_64(const int fold, const int64_t N, const void* X, const int64_t incX);
+void reproBLAS_rcdotc_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_rcdotu_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+
+float reproBLAS_rsdssum_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_rsdsasum_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_rsdsnrm2_64(const int fold, const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_rsdsdot_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+void reproBLAS_rcdcsum_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, void *sum);
+float reproBLAS_rscdcasum_64(const int fold, const int64_t N, const void* X, const int64_t incX);
+float reproBLAS_rscdcnrm2_64(const int fold, const int64_t N, const void* X, const int64_t incX);
+void reproBLAS_rcdcdotu_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotu);
+void reproBLAS_rcdcdotc_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotc);
+float reproBLAS_rsdhsum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdhasum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdhnrm2_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdhdot_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t* Y, const int64_t incY);
+float reproBLAS_rsdbsum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdbasum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdbnrm2_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_rsdbdot_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t* Y, const int64_t incY);
+
+double reproBLAS_rddot_fma_64(const int fold, const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY);
+float reproBLAS_rsdot_fma_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+void reproBLAS_rzdotu_fma_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+void reproBLAS_rzdotc_fma_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_rcdotu_fma_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+void reproBLAS_rcdotc_fma_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+
+void reproBLAS_rdgemv_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_rdgemm_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const double alpha, const double *A, const int64_t lda,
+            const double *B, const int64_t ldb,
+            const double beta, double *C, const int64_t ldc);
+
+void reproBLAS_rsgemv_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+void reproBLAS_rsgemm_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const float alpha, const float *A, const int64_t lda,
+            const float *B, const int64_t ldb,
+            const float beta, float *C, const int64_t ldc);
+
+void reproBLAS_rzgemv_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_rzgemm_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *B, const int64_t ldb,
+            const void *beta, void *C, const int64_t ldc);
+
+void reproBLAS_rcgemv_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_rcgemm_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *B, const int64_t ldb,
+            const void *beta, void *C, const int64_t ldc);
+
+void reproBLAS_rdsgemv_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_rdsgemm_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const double alpha, const float *A, const int64_t lda,
+            const float *B, const int64_t ldb,
+            const double beta, double *C, const int64_t ldc);
+
+void reproBLAS_rzgemv_planar_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const double *AR, const double *AI, const int64_t lda,
+            const double *XR, const double *XI, const int64_t incX,
+            const void *beta, double *YR, double *YI, const int64_t incY);
+void reproBLAS_rzgemm_planar_64(const int fold, const char Order,
+            const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const double *AR, const double *AI, const int64_t lda,
+            const double *BR, const double *BI, const int64_t ldb,
+            const void *beta, double *CR, double *CI, const int64_t ldc);
+
+void reproBLAS_rdsyrk_64(const int fold, const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const double alpha, const double *A, const int64_t lda,
+            const double beta, double *C, const int64_t ldc);
+void reproBLAS_rssyrk_64(const int fold, const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const float alpha, const float *A, const int64_t lda,
+            const float beta, float *C, const int64_t ldc);
+void reproBLAS_rzherk_64(const int fold, const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const double alpha, const void *A, const int64_t lda,
+            const double beta, void *C, const int64_t ldc);
+
+void reproBLAS_rdtrsm_64(const int fold, const char Order, const char Side, const char Uplo,
+            const char TransA, const char Diag,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            double *B, const int64_t ldb);
+void reproBLAS_rdtrsv_64(const int fold, const char Order, const char Uplo,
+            const char TransA, const char Diag,
+            const int64_t N, const double *A, const int64_t lda,
+            double *X, const int64_t incX);
+
+void reproBLAS_rdcsrmv_64(const int fold, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *val, const int64_t *rowptr, const int64_t *colind,
+            const double *rowmax, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_rscsrmv_64(const int fold, const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *val, const int64_t *rowptr, const int64_t *colind,
+            const float *rowmax, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+
+void reproBLAS_rdgesum_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+void reproBLAS_rdgeasum_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+void reproBLAS_rdgenrm2_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+double reproBLAS_rdlange_64(const int fold, const char Norm, const char Order,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda);
+void reproBLAS_rsgesum_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+void reproBLAS_rsgeasum_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+void reproBLAS_rsgenrm2_64(const int fold, const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+float reproBLAS_rslange_64(const int fold, const char Norm, const char Order,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda);
+
+void reproBLAS_rdmoments_64(const int fold, const int order, const int64_t N, const double *X, const int64_t incX, const double shift, double *M);
+void reproBLAS_rdcmoments_64(const int fold, const int order, const int64_t N, const double *X, const int64_t incX, double *M);
+void reproBLAS_rsmoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float *M);
+void reproBLAS_rscmoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, float *M);
+
+void reproBLAS_rdsegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+            const double *X, const int64_t incX,
+            double *Y, const int64_t incY);
+void reproBLAS_rssegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+            const float *X, const int64_t incX,
+            float *Y, const int64_t incY);
+void reproBLAS_rdkeysum_64(const int fold, const int64_t N, const int64_t *keys,
+            const double *X, const int64_t incX, const int64_t nkeys,
+            double *Y, const int64_t incY);
+void reproBLAS_rskeysum_64(const int fold, const int64_t N, const int64_t *keys,
+            const float *X, const int64_t incX, const int64_t nkeys,
+            float *Y, const int64_t incY);
+
+void reproBLAS_rdscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double *Y, const int64_t incY);
+void reproBLAS_rdexscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double *Y, const int64_t incY);
+void reproBLAS_rsscan_64(const int fold, const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY);
+void reproBLAS_rsexscan_64(const int fold, const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY);
+
+double reproBLAS_rdgemvdot_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY,
+            const double *W, const int64_t incW);
+float reproBLAS_rsgemvdot_64(const int fold, const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY,
+            const float *W, const int64_t incW);
+
+double reproBLAS_rdaxpbydot_64(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY, const double *W, const int64_t incW);
+float reproBLAS_rsaxpbydot_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW);
+void reproBLAS_rzaxpbydotc_sub_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc);
+void reproBLAS_rcaxpbydotc_sub_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc);
+double reproBLAS_rdaxpbynrm2_64(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+float reproBLAS_rsaxpbynrm2_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+double reproBLAS_rdzaxpbynrm2_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+float reproBLAS_rscaxpbynrm2_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_rdmdot_64(const int fold, const int64_t N, const int k, const double *X, const int64_t ldX, const int64_t incX,
+            const int npairs, const int *pairs, double *dots);
+void reproBLAS_rsmdot_64(const int fold, const int64_t N, const int k, const float *X, const int64_t ldX, const int64_t incX,
+            const int npairs, const int *pairs, float *dots);
+double reproBLAS_rdsum_bounded_64(const int fold, const int64_t N, const double* X, const int64_t incX, const double bound);
+double reproBLAS_rdasum_bounded_64(const int fold, const int64_t N, const double* X, const int64_t incX, const double bound);
+double reproBLAS_rddot_bounded_64(const int fold, const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY, const double bound);
+float reproBLAS_rssum_bounded_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float bound);
+float reproBLAS_rsasum_bounded_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float bound);
+float reproBLAS_rsdot_bounded_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY, const float bound);
+
+double reproBLAS_dsum_64(const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_dasum_64(const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_dnrm2_64(const int64_t N, const double* X, const int64_t incX);
+double reproBLAS_ddot_64(const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY);
+
+float reproBLAS_sdot_64(const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+float reproBLAS_sasum_64(const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_ssum_64(const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_snrm2_64(const int64_t N, const float* X, const int64_t incX);
+
+void reproBLAS_zsum_sub_64(const int64_t N, const void* X, int64_t incX, void *sum);
+double reproBLAS_dzasum_64(const int64_t N, const void* X, const int64_t incX);
+double reproBLAS_dznrm2_64(const int64_t N, const void* X, int64_t incX);
+void reproBLAS_zdotc_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_zdotu_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+
+void reproBLAS_csum_sub_64(const int64_t N, const void* X, const int64_t incX, void *sum);
+float reproBLAS_scasum_64(const int64_t N, const void* X, const int64_t incX);
+float reproBLAS_scnrm2_64(const int64_t N, const void* X, const int64_t incX);
+void reproBLAS_cdotc_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_cdotu_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+
+float reproBLAS_sdssum_64(const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_sdsasum_64(const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_sdsnrm2_64(const int64_t N, const float* X, const int64_t incX);
+float reproBLAS_sdsdot_64(const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+void reproBLAS_cdcsum_sub_64(const int64_t N, const void* X, const int64_t incX, void *sum);
+float reproBLAS_scdcasum_64(const int64_t N, const void* X, const int64_t incX);
+float reproBLAS_scdcnrm2_64(const int64_t N, const void* X, const int64_t incX);
+void reproBLAS_cdcdotu_sub_64(const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotu);
+void reproBLAS_cdcdotc_sub_64(const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotc);
+float reproBLAS_sdhsum_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdhasum_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdhnrm2_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdhdot_64(const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t* Y, const int64_t incY);
+float reproBLAS_sdbsum_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdbasum_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdbnrm2_64(const int64_t N, const uint16_t* X, const int64_t incX);
+float reproBLAS_sdbdot_64(const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t* Y, const int64_t incY);
+
+double reproBLAS_ddot_fma_64(const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY);
+float reproBLAS_sdot_fma_64(const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY);
+void reproBLAS_zdotu_fma_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+void reproBLAS_zdotc_fma_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+void reproBLAS_cdotu_fma_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotu);
+void reproBLAS_cdotc_fma_sub_64(const int64_t N, const void* X, const int64_t incX, const void* Y, const int64_t incY, void *dotc);
+
+void reproBLAS_dgemv_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_dgemm_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const double alpha, const double *A, const int64_t lda,
+            const double *B, const int64_t ldb,
+            const double beta, double *C, const int64_t ldc);
+
+void reproBLAS_sgemv_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+void reproBLAS_sgemm_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const float alpha, const float *A, const int64_t lda,
+            const float *B, const int64_t ldb,
+            const float beta, float *C, const int64_t ldc);
+
+void reproBLAS_zgemv_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_zgemm_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *B, const int64_t ldb,
+            const void *beta, void *C, const int64_t ldc);
+
+void reproBLAS_cgemv_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_cgemm_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const void *A, const int64_t lda,
+            const void *B, const int64_t ldb,
+            const void *beta, void *C, const int64_t ldc);
+
+void reproBLAS_dsgemv_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_dsgemm_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const double alpha, const float *A, const int64_t lda,
+            const float *B, const int64_t ldb,
+            const double beta, double *C, const int64_t ldc);
+
+void reproBLAS_zgemv_planar_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const void *alpha, const double *AR, const double *AI, const int64_t lda,
+            const double *XR, const double *XI, const int64_t incX,
+            const void *beta, double *YR, double *YI, const int64_t incY);
+void reproBLAS_zgemm_planar_64(const char Order, const char TransA, const char TransB,
+            const int64_t M, const int64_t N, const int64_t K,
+            const void *alpha, const double *AR, const double *AI, const int64_t lda,
+            const double *BR, const double *BI, const int64_t ldb,
+            const void *beta, double *CR, double *CI, const int64_t ldc);
+
+void reproBLAS_dsyrk_64(const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const double alpha, const double *A, const int64_t lda,
+            const double beta, double *C, const int64_t ldc);
+void reproBLAS_ssyrk_64(const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const float alpha, const float *A, const int64_t lda,
+            const float beta, float *C, const int64_t ldc);
+void reproBLAS_zherk_64(const char Order, const char Uplo, const char Trans,
+            const int64_t N, const int64_t K,
+            const double alpha, const void *A, const int64_t lda,
+            const double beta, void *C, const int64_t ldc);
+
+void reproBLAS_dtrsm_64(const char Order, const char Side, const char Uplo,
+            const char TransA, const char Diag,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            double *B, const int64_t ldb);
+void reproBLAS_dtrsv_64(const char Order, const char Uplo,
+            const char TransA, const char Diag,
+            const int64_t N, const double *A, const int64_t lda,
+            double *X, const int64_t incX);
+
+void reproBLAS_dcsrmv_64(const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *val, const int64_t *rowptr, const int64_t *colind,
+            const double *rowmax, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+void reproBLAS_scsrmv_64(const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *val, const int64_t *rowptr, const int64_t *colind,
+            const float *rowmax, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+
+void reproBLAS_dgesum_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+void reproBLAS_dgeasum_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+void reproBLAS_dgenrm2_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda,
+            double *Y, const int64_t incY);
+double reproBLAS_dlange_64(const char Norm, const char Order,
+            const int64_t M, const int64_t N,
+            const double *A, const int64_t lda);
+void reproBLAS_sgesum_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+void reproBLAS_sgeasum_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+void reproBLAS_sgenrm2_64(const char Order, const char Dim,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda,
+            float *Y, const int64_t incY);
+float reproBLAS_slange_64(const char Norm, const char Order,
+            const int64_t M, const int64_t N,
+            const float *A, const int64_t lda);
+
+void reproBLAS_dmoments_64(const int order, const int64_t N, const double *X, const int64_t incX, const double shift, double *M);
+void reproBLAS_dcmoments_64(const int order, const int64_t N, const double *X, const int64_t incX, double *M);
+void reproBLAS_smoments_64(const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float *M);
+void reproBLAS_scmoments_64(const int order, const int64_t N, const float *X, const int64_t incX, float *M);
+
+void reproBLAS_dsegsum_64(const int64_t nseg, const int64_t *segptr,
+            const double *X, const int64_t incX,
+            double *Y, const int64_t incY);
+void reproBLAS_ssegsum_64(const int64_t nseg, const int64_t *segptr,
+            const float *X, const int64_t incX,
+            float *Y, const int64_t incY);
+void reproBLAS_dkeysum_64(const int64_t N, const int64_t *keys,
+            const double *X, const int64_t incX, const int64_t nkeys,
+            double *Y, const int64_t incY);
+void reproBLAS_skeysum_64(const int64_t N, const int64_t *keys,
+            const float *X, const int64_t incX, const int64_t nkeys,
+            float *Y, const int64_t incY);
+
+void reproBLAS_dscan_64(const int64_t N, const double *X, const int64_t incX, double *Y, const int64_t incY);
+void reproBLAS_dexscan_64(const int64_t N, const double *X, const int64_t incX, double *Y, const int64_t incY);
+void reproBLAS_sscan_64(const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY);
+void reproBLAS_sexscan_64(const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY);
+
+double reproBLAS_dgemvdot_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const double alpha, const double *A, const int64_t lda,
+            const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY,
+            const double *W, const int64_t incW);
+float reproBLAS_sgemvdot_64(const char Order, const char TransA,
+            const int64_t M, const int64_t N,
+            const float alpha, const float *A, const int64_t lda,
+            const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY,
+            const float *W, const int64_t incW);
+
+double reproBLAS_daxpbydot_64(const int64_t N, const double alpha, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY, const double *W, const int64_t incW);
+float reproBLAS_saxpbydot_64(const int64_t N, const float alpha, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW);
+void reproBLAS_zaxpbydotc_sub_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc);
+void reproBLAS_caxpbydotc_sub_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc);
+double reproBLAS_daxpbynrm2_64(const int64_t N, const double alpha, const double *X, const int64_t incX,
+            const double beta, double *Y, const int64_t incY);
+float reproBLAS_saxpbynrm2_64(const int64_t N, const float alpha, const float *X, const int64_t incX,
+            const float beta, float *Y, const int64_t incY);
+double reproBLAS_dzaxpbynrm2_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+float reproBLAS_scaxpbynrm2_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+            const void *beta, void *Y, const int64_t incY);
+void reproBLAS_dmdot_64(const int64_t N, const int k, const double *X, const int64_t ldX, const int64_t incX,
+            const int npairs, const int *pairs, double *dots);
+void reproBLAS_smdot_64(const int64_t N, const int k, const float *X, const int64_t ldX, const int64_t incX,
+            const int npairs, const int *pairs, float *dots);
+double reproBLAS_dsum_bounded_64(const int64_t N, const double* X, const int64_t incX, const double bound);
+double reproBLAS_dasum_bounded_64(const int64_t N, const double* X, const int64_t incX, const double bound);
+double reproBLAS_ddot_bounded_64(const int64_t N, const double* X, const int64_t incX, const double* Y, const int64_t incY, const double bound);
+float reproBLAS_ssum_bounded_64(const int64_t N, const float* X, const int64_t incX, const float bound);
+float reproBLAS_sasum_bounded_64(const int64_t N, const float* X, const int64_t incX, const float bound);
+float reproBLAS_sdot_bounded_64(const int64_t N, const float* X, const int64_t incX, const float* Y, const int64_t incY, const float bound);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,686 @@
+/**
+ * @file  reproBLAS.hpp
+ * @brief reproBLAS.hpp defines a C++ interface to the indexed types and reproducible BLAS routines in which the fold and data type are fixed at compile time.
+ *
+ * The class template reproBLAS::indexed<T, Fold> is an indexed type with value semantics for @c T in @c double, @c float, @c std::complex<double> and @c std::complex<float>. The accumulators are stored inside the object, so no heap allocation is needed for an indexed scalar, and their layout is identical to the corresponding C type (#double_indexed, #float_indexed, #double_complex_indexed or #float_complex_indexed) of the same fold. indexed::data() may therefore be passed to any routine in idxd.h or idxdBLAS.h.
+ *
+ * The function templates reproBLAS::sum(), reproBLAS::dot(), reproBLAS::dotc() and reproBLAS::gemv() compute the same results as their counterparts in reproBLAS.h (for example, reproBLAS::sum<3>(N, X, incX) returns the same value as reproBLAS_rdsum(3, N, X, incX) when @c X is a @c double*).
+ *
+ * Everything in this header is built on the inline primitives of idxdInline.h. Because the fold is a template argument, the compiler can select the unrolled deposit and renormalization for folds 2, 3 and 4 and unroll the accumulator loops for other folds. This header does not require linking against the library.
+ *
+ * The header requires C++11.
+ */
+#ifndef REPROBLAS_HPP_
+#define REPROBLAS_HPP_
+#include <cmath>
+#include <complex>
+#include <vector>
+#include "idxdInline.h"
+
+namespace reproBLAS {
+
+namespace detail {
+
+template<typename T> struct traits;
+
+template<> struct traits<double> {
+  typedef double real_type;
+  enum { components = 1, max_fold = idxd_DIMAXFOLD, endurance = idxd_DIENDURANCE };
+};
+
+template<> struct traits<float> {
+  typedef float real_type;
+  enum { components = 1, max_fold = idxd_SIMAXFOLD, endurance = idxd_SIENDURANCE };
+};
+
+template<> struct traits<std::complex<double> > {
+  typedef double real_type;
+  enum { components = 2, max_fold = idxd_DIMAXFOLD, endurance = idxd_DIENDURANCE };
+};
+
+template<> struct traits<std::complex<float> > {
+  typedef float real_type;
+  enum { components = 2, max_fold = idxd_SIMAXFOLD, endurance = idxd_SIENDURANCE };
+};
+
+template<typename T> struct identity {
+  typedef T type;
+};
+
+inline void update(const int fold, const double X, double *priY, const int incpriY, double *carY, const int inccarY){
+  idxdInline_dmdupdate(fold, X, priY, incpriY, carY, inccarY);
+}
+
+inline void update(const int fold, const float X, float *priY, const int incpriY, float *carY, const int inccarY){
+  idxdInline_smsupdate(fold, X, priY, incpriY, carY, inccarY);
+}
+
+inline void deposit(const int fold, const double X, double *priY, const int incpriY){
+  idxdInline_dmddeposit(fold, X, priY, incpriY);
+}
+
+inline void deposit(const int fold, const float X, float *priY, const int incpriY){
+  idxdInline_smsdeposit(fold, X, priY, incpriY);
+}
+
+inline void renorm(const int fold, double *priX, const int incpriX, double *carX, const int inccarX){
+  idxdInline_dmrenorm(fold, priX, incpriX, carX, inccarX);
+}
+
+inline void renorm(const int fold, float *priX, const int incpriX, float *carX, const int inccarX){
+  idxdInline_smrenorm(fold, priX, incpriX, carX, inccarX);
+}
+
+inline void madd(const int fold, const double *priX, const int incpriX, const double *carX, const int inccarX, double *priY, const int incpriY, double *carY, const int inccarY){
+  idxdInline_dmdmadd(fold, priX, incpriX, carX, inccarX, priY, incpriY, carY, inccarY);
+}
+
+inline void madd(const int fold, const float *priX, const int incpriX, const float *carX, const int inccarX, float *priY, const int incpriY, float *carY, const int inccarY){
+  idxdInline_smsmadd(fold, priX, incpriX, carX, inccarX, priY, incpriY, carY, inccarY);
+}
+
+inline double conv(const int fold, const double *priX, const int incpriX, const double *carX, const int inccarX){
+  return idxdInline_ddmconv(fold, priX, incpriX, carX, inccarX);
+}
+
+inline float conv(const int fold, const float *priX, const int incpriX, const float *carX, const int inccarX){
+  return idxdInline_ssmconv(fold, priX, incpriX, carX, inccarX);
+}
+
+template<typename R> inline R part(const R &X, const int c){
+  (void)c;
+  return X;
+}
+
+template<typename R> inline R part(const std::complex<R> &X, const int c){
+  return c == 0 ? X.real() : X.imag();
+}
+
+template<typename R> inline R make(const R *parts, const R &like){
+  (void)like;
+  return parts[0];
+}
+
+template<typename R> inline std::complex<R> make(const R *parts, const std::complex<R> &like){
+  (void)like;
+  return std::complex<R>(parts[0], parts[1]);
+}
+
+//multiplication in the same order as the C library (which does not use the
+//C99 complex multiplication rules)
+template<typename R> inline R mul(const R &X, const R &Y){
+  return X * Y;
+}
+
+template<typename R> inline std::complex<R> mul(const std::complex<R> &X, const std::complex<R> &Y){
+  return std::complex<R>(X.real() * Y.real() - X.imag() * Y.imag(), X.real() * Y.imag() + X.imag() * Y.real());
+}
+
+template<typename R> inline bool is_zero(const R &X){
+  return X == R(0);
+}
+
+template<typename R> inline bool is_zero(const std::complex<R> &X){
+  return X.real() == R(0) && X.imag() == R(0);
+}
+
+template<typename R> inline bool is_one(const R &X){
+  return X == R(1);
+}
+
+template<typename R> inline bool is_one(const std::complex<R> &X){
+  return X.real() == R(1) && X.imag() == R(0);
+}
+
+/**
+ * @internal
+ * @brief The summands of a product X * Y (or conj(X) * Y)
+ *
+ * A real product is deposited as one summand. The real and imaginary parts of a complex product are each deposited as two summands, as in idxdBLAS_zmzdotu() and idxdBLAS_zmzdotc().
+ */
+template<typename T, bool Conj> struct product;
+
+template<bool Conj> struct product<double, Conj> {
+  enum { terms = 1 };
+  static void amaxm(const double &X, const double &Y, double *amaxm){
+    double P = std::fabs(X * Y);
+    amaxm[0] = P > amaxm[0] ? P : amaxm[0];
+  }
+  template<int Fold> static void deposit(const double &X, const double &Y, double *priZ){
+    detail::deposit(Fold, X * Y, priZ, 1);
+  }
+};
+
+template<bool Conj> struct product<float, Conj> {
+  enum { terms = 1 };
+  static void amaxm(const float &X, const float &Y, float *amaxm){
+    float P = std::fabs(X * Y);
+    amaxm[0] = P > amaxm[0] ? P : amaxm[0];
+  }
+  template<int Fold> static void deposit(const float &X, const float &Y, float *priZ){
+    detail::deposit(Fold, X * Y, priZ, 1);
+  }
+};
+
+template<typename R, bool Conj> struct product<std::complex<R>, Conj> {
+  enum { terms = 2 };
+  static void amaxm(const std::complex<R> &X, const std::complex<R> &Y, R *amaxm){
+    R P;
+    P = std::fabs(X.real() * Y.real());
+    amaxm[0] = P > amaxm[0] ? P : amaxm[0];
+    P = std::fabs(X.imag() * Y.imag());
+    amaxm[0] = P > amaxm[0] ? P : amaxm[0];
+    P = std::fabs(X.imag() * Y.real());
+    amaxm[1] = P > amaxm[1] ? P : amaxm[1];
+    P = std::fabs(X.real() * Y.imag());
+    amaxm[1] = P > amaxm[1] ? P : amaxm[1];
+  }
+  template<int Fold> static void deposit(const std::complex<R> &X, const std::complex<R> &Y, R *priZ){
+    detail::deposit(Fold, X.real() * Y.real(), priZ, 2);
+    detail::deposit(Fold, Conj ? X.imag() * Y.imag() : -(X.imag() * Y.imag()), priZ, 2);
+    detail::deposit(Fold, X.real() * Y.imag(), priZ + 1, 2);
+    detail::deposit(Fold, Conj ? -(X.imag() * Y.real()) : X.imag() * Y.real(), priZ + 1, 2);
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief An indexed type of compile time fold with value semantics
+ *
+ * indexed<T, Fold> stores the primary and carry vectors of an indexed @c T in place, in the same layout as the corresponding C indexed type.
+ *
+ * @tparam T the underlying data type (@c double, @c float, @c std::complex<double> or @c std::complex<float>)
+ * @tparam Fold the fold of the indexed type
+ */
+template<typename T, int Fold>
+class indexed {
+public:
+  typedef T value_type;
+  typedef typename detail::traits<T>::real_type real_type;
+
+  enum {
+    fold = Fold,
+    components = detail::traits<T>::components,
+    endurance = detail::traits<T>::endurance,
+    num = 2 * detail::traits<T>::components * Fold
+  };
+
+  static_assert(Fold >= 2 && Fold <= detail::traits<T>::max_fold, "ReproBLAS error: invalid fold");
+
+  /**
+   * @brief Construct an indexed zero
+   */
+  indexed(){
+    setzero();
+  }
+
+  /**
+   * @brief Construct the indexed conversion of X
+   *
+   * @param X scalar X
+   */
+  explicit indexed(const T &X){
+    setzero();
+    add(X);
+  }
+
+  /**
+   * @brief Set to zero
+   */
+  void setzero(){
+    int i;
+    for(i = 0; i < num; i++){
+      data_[i] = real_type(0);
+    }
+  }
+
+  /**
+   * @brief Update to an index suitable for depositing numbers with absolute value less than X (see idxd_didupdate())
+   *
+   * For complex types, the real and imaginary parts of X bound the real and imaginary parts of future deposits respectively.
+   *
+   * @param X scalar X
+   */
+  void update(const T &X){
+    int c;
+    for(c = 0; c < components; c++){
+      detail::update(Fold, detail::part(X, c), pri() + c, components, car() + c, components);
+    }
+  }
+
+  /**
+   * @brief Deposit X (see idxd_diddeposit())
+   *
+   * At most #endurance deposits may be made between calls to renorm().
+   *
+   * @param X scalar X
+   */
+  void deposit(const T &X){
+    int c;
+    for(c = 0; c < components; c++){
+      detail::deposit(Fold, detail::part(X, c), pri() + c, components);
+    }
+  }
+
+  /**
+   * @brief Renormalize (see idxd_direnorm())
+   */
+  void renorm(){
+    int c;
+    for(c = 0; c < components; c++){
+      detail::renorm(Fold, pri() + c, components, car() + c, components);
+    }
+  }
+
+  /**
+   * @brief Add scalar X (see idxd_didadd())
+   *
+   * @param X scalar X
+   */
+  void add(const T &X){
+    update(X);
+    deposit(X);
+    renorm();
+  }
+
+  /**
+   * @brief Add indexed X (see idxd_didiadd())
+   *
+   * @param X indexed X
+   */
+  void add(const indexed &X){
+    int c;
+    for(c = 0; c < components; c++){
+      detail::madd(Fold, X.pri() + c, components, X.car() + c, components, pri() + c, components, car() + c, components);
+    }
+  }
+
+  /**
+   * @brief Convert to T (see idxd_ddiconv())
+   *
+   * @return the value of the indexed type
+   */
+  T conv() const {
+    real_type parts[2];
+    int c;
+    for(c = 0; c < components; c++){
+      parts[c] = detail::conv(Fold, pri() + c, components, car() + c, components);
+    }
+    return detail::make(parts, T());
+  }
+
+  indexed &operator+=(const T &X){
+    add(X);
+    return *this;
+  }
+
+  indexed &operator+=(const indexed &X){
+    add(X);
+    return *this;
+  }
+
+  /**
+   * @brief The underlying array, laid out as the C indexed type of the same fold
+   */
+  real_type *data(){
+    return data_;
+  }
+
+  const real_type *data() const {
+    return data_;
+  }
+
+  /**
+   * @brief The primary vector (components are interleaved with stride #components)
+   */
+  real_type *pri(){
+    return data_;
+  }
+
+  const real_type *pri() const {
+    return data_;
+  }
+
+  /**
+   * @brief The carry vector (components are interleaved with stride #components)
+   */
+  real_type *car(){
+    return data_ + components * Fold;
+  }
+
+  const real_type *car() const {
+    return data_ + components * Fold;
+  }
+
+private:
+  real_type data_[num];
+};
+
+template<typename T, int Fold>
+inline indexed<T, Fold> operator+(indexed<T, Fold> X, const indexed<T, Fold> &Y){
+  X += Y;
+  return X;
+}
+
+template<typename T, int Fold>
+inline indexed<T, Fold> operator+(indexed<T, Fold> X, const T &Y){
+  X += Y;
+  return X;
+}
+
+/**
+ * @brief Add the sum of X to indexed Y (see idxdBLAS_didsum())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ */
+template<int Fold, typename T>
+void sum(const int N, const T *X, const int incX, indexed<T, Fold> &Y){
+  typedef typename indexed<T, Fold>::real_type R;
+  const int C = indexed<T, Fold>::components;
+  int i;
+  int j;
+  int c;
+  int N_block;
+  R amax[2];
+
+  for(i = 0; i < N; i += N_block){
+    N_block = N - i < indexed<T, Fold>::endurance ? N - i : indexed<T, Fold>::endurance;
+    amax[0] = amax[1] = R(0);
+    for(j = i; j < i + N_block; j++){
+      for(c = 0; c < C; c++){
+        R a = std::fabs(detail::part(X[j * incX], c));
+        amax[c] = a > amax[c] ? a : amax[c];
+      }
+    }
+    Y.update(detail::make(amax, T()));
+    for(j = i; j < i + N_block; j++){
+      Y.deposit(X[j * incX]);
+    }
+    Y.renorm();
+  }
+}
+
+/**
+ * @brief Reproducible sum of X (see reproBLAS_rdsum())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ */
+template<int Fold, typename T>
+T sum(const int N, const T *X, const int incX){
+  indexed<T, Fold> Y;
+  sum(N, X, incX, Y);
+  return Y.conv();
+}
+
+namespace detail {
+
+template<int Fold, bool Conj, typename T>
+void dot(const int N, const T *X, const int incX, const T *Y, const int incY, indexed<T, Fold> &Z){
+  typedef typename indexed<T, Fold>::real_type R;
+  const int N_block_MAX = indexed<T, Fold>::endurance / product<T, Conj>::terms;
+  int i;
+  int j;
+  int N_block;
+  R amaxm[2];
+
+  for(i = 0; i < N; i += N_block){
+    N_block = N - i < N_block_MAX ? N - i : N_block_MAX;
+    amaxm[0] = amaxm[1] = R(0);
+    for(j = i; j < i + N_block; j++){
+      product<T, Conj>::amaxm(X[j * incX], Y[j * incY], amaxm);
+    }
+    Z.update(make(amaxm, T()));
+    for(j = i; j < i + N_block; j++){
+      product<T, Conj>::template deposit<Fold>(X[j * incX], Y[j * incY], Z.pri());
+    }
+    Z.renorm();
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Add the dot product of X and Y to indexed Z (see idxdBLAS_diddot() and idxdBLAS_zizdotu())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ */
+template<int Fold, typename T>
+void dot(const int N, const T *X, const int incX, const T *Y, const int incY, indexed<T, Fold> &Z){
+  detail::dot<Fold, false>(N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Reproducible dot product of X and Y (see reproBLAS_rddot() and reproBLAS_rzdotu_sub())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ * @return X.Y
+ */
+template<int Fold, typename T>
+T dot(const int N, const T *X, const int incX, const T *Y, const int incY){
+  indexed<T, Fold> Z;
+  detail::dot<Fold, false>(N, X, incX, Y, incY, Z);
+  return Z.conv();
+}
+
+/**
+ * @brief Add the conjugated dot product of X and Y to indexed Z (see idxdBLAS_zizdotc())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ */
+template<int Fold, typename R>
+void dotc(const int N, const std::complex<R> *X, const int incX, const std::complex<R> *Y, const int incY, indexed<std::complex<R>, Fold> &Z){
+  detail::dot<Fold, true>(N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Reproducible conjugated dot product of X and Y (see reproBLAS_rzdotc_sub())
+ *
+ * @param N vector length
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ * @return conj(X).Y
+ */
+template<int Fold, typename R>
+std::complex<R> dotc(const int N, const std::complex<R> *X, const int incX, const std::complex<R> *Y, const int incY){
+  indexed<std::complex<R>, Fold> Z;
+  detail::dot<Fold, true>(N, X, incX, Y, incY, Z);
+  return Z.conv();
+}
+
+namespace detail {
+
+enum { GEMV_I_BLOCK = 256, GEMV_J_BLOCK = 64 };
+
+//Y[i] += sum_j op(A)[i, j] * X[j] where op(A)[i, j] = A[i + j * lda] is
+//contiguous in i. Panels of op(A) are streamed column by column so that A is
+//read with unit stride.
+template<int Fold, bool Conj, typename T>
+void gemv_panel(const int M, const int N, const T *A, const int lda, const T *X, indexed<T, Fold> *Y, const int incY){
+  typedef typename indexed<T, Fold>::real_type R;
+  const int C = indexed<T, Fold>::components;
+  const int N_block_MAX = GEMV_J_BLOCK < indexed<T, Fold>::endurance / product<T, Conj>::terms ? (int)GEMV_J_BLOCK : indexed<T, Fold>::endurance / product<T, Conj>::terms;
+  std::vector<R> amaxm(GEMV_I_BLOCK * C);
+  int i;
+  int ii;
+  int j;
+  int jj;
+  int M_block;
+  int N_block;
+
+  for(i = 0; i < M; i += M_block){
+    M_block = M - i < GEMV_I_BLOCK ? M - i : (int)GEMV_I_BLOCK;
+    for(j = 0; j < N; j += N_block){
+      N_block = N - j < N_block_MAX ? N - j : N_block_MAX;
+      for(ii = 0; ii < M_block * C; ii++){
+        amaxm[ii] = R(0);
+      }
+      for(jj = j; jj < j + N_block; jj++){
+        for(ii = i; ii < i + M_block; ii++){
+          product<T, Conj>::amaxm(A[ii + jj * (size_t)lda], X[jj], &amaxm[(ii - i) * C]);
+        }
+      }
+      for(ii = i; ii < i + M_block; ii++){
+        Y[ii * incY].update(make(&amaxm[(ii - i) * C], T()));
+      }
+      for(jj = j; jj < j + N_block; jj++){
+        for(ii = i; ii < i + M_block; ii++){
+          product<T, Conj>::template deposit<Fold>(A[ii + jj * (size_t)lda], X[jj], Y[ii * incY].pri());
+        }
+      }
+      for(ii = i; ii < i + M_block; ii++){
+        Y[ii * incY].renorm();
+      }
+    }
+  }
+}
+
+//Y[i] += sum_j op(A)[i, j] * X[j] where op(A)[i, j] = A[i * lda + j] is
+//contiguous in j.
+template<int Fold, bool Conj, typename T>
+void gemv_rows(const int M, const int N, const T *A, const int lda, const T *X, indexed<T, Fold> *Y, const int incY){
+  int i;
+  for(i = 0; i < M; i++){
+    dot<Fold, Conj>(N, A + i * (size_t)lda, 1, X, 1, Y[i * incY]);
+  }
+}
+
+template<typename R> inline bool is_conj(const char TransA, const R &like){
+  (void)TransA;
+  (void)like;
+  return false;
+}
+
+template<typename R> inline bool is_conj(const char TransA, const std::complex<R> &like){
+  (void)like;
+  return TransA == 'c' || TransA == 'C';
+}
+
+} // namespace detail
+
+/**
+ * @brief Add matrix-vector product to indexed vector (see idxdBLAS_didgemv())
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y or   y := alpha*A**T*x + y or   y := alpha*A**H*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A matrix A
+ * @param lda leading dimension of A
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ */
+template<int Fold, typename T>
+void gemv(const char Order, const char TransA, const int M, const int N,
+          const typename detail::identity<T>::type alpha, const T *A, const int lda,
+          const T *X, const int incX,
+          indexed<T, Fold> *Y, const int incY){
+  bool trans = !(TransA == 'n' || TransA == 'N');
+  bool rows = (Order == 'r' || Order == 'R') != trans;
+  int opM = trans ? N : M;
+  int opN = trans ? M : N;
+  int j;
+
+  if(M == 0 || N == 0 || detail::is_zero(alpha)){
+    return;
+  }
+
+  std::vector<T> bufX(opN);
+  for(j = 0; j < opN; j++){
+    bufX[j] = detail::is_one(alpha) ? X[j * incX] : detail::mul(X[j * incX], alpha);
+  }
+  if(detail::is_conj(TransA, alpha)){
+    if(rows){
+      detail::gemv_rows<Fold, true>(opM, opN, A, lda, bufX.data(), Y, incY);
+    }else{
+      detail::gemv_panel<Fold, true>(opM, opN, A, lda, bufX.data(), Y, incY);
+    }
+  }else{
+    if(rows){
+      detail::gemv_rows<Fold, false>(opM, opN, A, lda, bufX.data(), Y, incY);
+    }else{
+      detail::gemv_panel<Fold, false>(opM, opN, A, lda, bufX.data(), Y, incY);
+    }
+  }
+}
+
+/**
+ * @brief Reproducible matrix-vector product (see reproBLAS_rdgemv())
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y or   y := alpha*A**T*x + beta*y or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A matrix A
+ * @param lda leading dimension of A
+ * @param X vector X
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y vector Y
+ * @param incY Y vector stride (use every incY'th element)
+ */
+template<int Fold, typename T>
+void gemv(const char Order, const char TransA, const int M, const int N,
+          const typename detail::identity<T>::type alpha, const T *A, const int lda,
+          const T *X, const int incX,
+          const typename detail::identity<T>::type beta, T *Y, const int incY){
+  int opM = (TransA == 'n' || TransA == 'N') ? M : N;
+  int i;
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  std::vector<indexed<T, Fold> > YI(opM);
+  if(!detail::is_zero(beta)){
+    for(i = 0; i < opM; i++){
+      YI[i] = indexed<T, Fold>(detail::is_one(beta) ? Y[i * incY] : detail::mul(Y[i * incY], beta));
+    }
+  }
+  gemv<Fold>(Order, TransA, M, N, alpha, A, lda, X, incX, YI.data(), 1);
+  for(i = 0; i < opM; i++){
+    Y[i * incY] = YI[i].conv();
+  }
+}
+
+} // namespace reproBLAS
+
+#endif
@@ -90,6 +90,14 @@ ifeq ($(MPILDFLAGS),)
   endif
 endif
 
+# Use POSIX threads for the idxdPool thread pools if PTHREADFLAGS has been set
+ifeq ($(PTHREADFLAGS),)
+  CPPFLAGS += -DreproBLAS_no_pthread
+else
+  CFLAGS += $(PTHREADFLAGS)
+  CXXFLAGS += $(PTHREADFLAGS)
+endif
+
 # Detect python in the following order if PYTHON hasn't been set
 ifeq ($(PYTHON),)
   ifeq ($(shell test -x "$(shell which python3 2>$(DEVNULL))"; echo $$?), 0)
@@ -112,8 +120,10 @@ endif
 
 ifeq ($(MTARGET_ARCH),)
   CFLAGS += -march=native
+  CXXFLAGS += -march=native
 else
   CFLAGS += -march=$(strip $(MTARGET_ARCH))
+  CXXFLAGS += -march=$(strip $(MTARGET_ARCH))
 endif
 
 CALL_PYTHON = PYTHONPATH=$(TOP) $(PYTHON)
@@ -217,6 +217,7 @@ MAKECMD.a = $(call echo_cmd,AR $@) \
 
 MAKECMD.$(SOEXT) = $(LINK.cc) $(DEP_OBJS) $(DEP_ARCH) $(DEP_LIBS) $(LIBS_$(@)) $(LDLIBS) -shared -o $@
 DEFAULT_MAKECMD = $(LINK.cc) $(DEP_OBJS) $(DEP_ARCH) $(DEP_LIBS) $(LIBS_$(@)) $(LDLIBS) -o $@
+CXX_MAKECMD = $(LINK.cpp) $(DEP_OBJS) $(DEP_ARCH) $(DEP_LIBS) $(LIBS_$(@)) $(LDLIBS) -o $@
 
 ########################################################################
 # Below is a "Blood sugar sex^H^H^Hmake magik" :) - don't touch it     #
@@ -1,4 +1,4 @@
 TARGETS :=
-SUBDIRS := idxd idxdBLAS reproBLAS idxdMPI
+SUBDIRS := idxd idxdPool idxdBLAS reproBLAS idxdMPI idxdIO
 
 INCLUDES += $(d)/gen
@@ -31,7 +31,7 @@ PRECIOUS = damax.c damaxm.c                                \
 
 LIBIDXDBLAS := $(OBJPATH)/libidxdblas.a
 
-libidxdblas.a_DEPS = $$(LIBIDXD)                                     \
+libidxdblas.a_DEPS = $$(LIBIDXD) $$(LIBIDXDPOOL) ilp64.o widen.o twoprod.o \
                      damax.o damaxm.o                                \
                      zamax_sub.o zamaxm_sub.o                        \
                      samax.o samaxm.o                                \
@@ -44,10 +44,45 @@ libidxdblas.a_DEPS = $$(LIBIDXD)                                     \
                      zizsum.o dizasum.o dizssq.o zizdotu.o zizdotc.o \
                      sissum.o sisasum.o sisssq.o sisdot.o            \
                      cicsum.o sicasum.o sicssq.o cicdotu.o cicdotc.o \
+                     dmssum.o dmsasum.o dmsssq.o dmsdot.o            \
+                     zmcsum.o dmcasum.o dmcssq.o zmcdotu.o zmcdotc.o \
+                     dissum.o disasum.o disssq.o disdot.o            \
+                     zicsum.o dicasum.o dicssq.o zicdotu.o zicdotc.o \
+                     dmhsum.o dmhasum.o dmhssq.o dmhdot.o            \
+                     dihsum.o dihasum.o dihssq.o dihdot.o            \
+                     dmbsum.o dmbasum.o dmbssq.o dmbdot.o            \
+                     dibsum.o dibasum.o dibssq.o dibdot.o            \
+                     dmddot_fma.o diddot_fma.o                       \
+                     smsdot_fma.o sisdot_fma.o                       \
+                     zmzdotu_fma.o zizdotu_fma.o                     \
+                     zmzdotc_fma.o zizdotc_fma.o                     \
+                     cmcdotu_fma.o cicdotu_fma.o                     \
+                     cmcdotc_fma.o cicdotc_fma.o                     \
                      didgemv.o didgemm.o                             \
                      zizgemv.o zizgemm.o                             \
                      sisgemv.o sisgemm.o                             \
-                     cicgemv.o cicgemm.o
+                     cicgemv.o cicgemm.o                             \
+                     disgemv.o disgemm.o                             \
+                     zizgemv_planar.o zizgemm_planar.o planar.o      \
+                     didsyrk.o sissyrk.o zizherk.o                   \
+                     didcsrmv.o siscsrmv.o                           \
+                     didgesum.o sisgesum.o                           \
+                     didmoments.o sismoments.o                       \
+                     didsegsum.o sissegsum.o didkeysum.o siskeysum.o \
+                     didscan.o sisscan.o                             \
+                     didgemvdot.o sisgemvdot.o                       \
+                     didaxpbydot.o sisaxpbydot.o                     \
+                     zizaxpbydotc.o cicaxpbydotc.o                   \
+                     didaxpbyssq.o sisaxpbyssq.o                     \
+                     dizaxpbyssq.o sicaxpbyssq.o                     \
+                     didmdot.o sismdot.o                             \
+                     dpack.o spack.o                                 \
+                     didgemv_packed.o sisgemv_packed.o               \
+                     didgemm_packed.o sisgemm_packed.o               \
+                     didsum_bounded.o sissum_bounded.o               \
+                     didasum_bounded.o sisasum_bounded.o             \
+                     diddot_bounded.o sisdot_bounded.o               \
+                     bounds.o
 
 camax_sub.c_DEPS = camax_sub.ccog
 camaxm_sub.c_DEPS = camaxm_sub.ccog
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "idxdBLAS.h"
+
+static int idxdBLAS_check_bounds = -1;
+
+/**
+ * @brief Set whether the routines that take a bound check it
+ *
+ * If @c check is nonzero, routines such as #idxdBLAS_didsum_bounded() compute the largest absolute value of their inputs and check that the bound they are given is valid, at the cost of the pass over the inputs the bound is meant to save. An invalid bound is reported as an error and the inputs are then summed as if no bound had been given. Checking is off by default, unless the environment variable @c REPROBLAS_CHECK_BOUNDS is set to a nonzero integer.
+ *
+ * @param check nonzero to check bounds, zero not to
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_set_check_bounds(const int check){
+  idxdBLAS_check_bounds = check != 0;
+}
+
+/**
+ * @brief Get whether the routines that take a bound check it
+ *
+ * @return nonzero if bounds are checked (see #idxdBLAS_set_check_bounds()), zero otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdBLAS_get_check_bounds(void){
+  const char *env;
+
+  if(idxdBLAS_check_bounds < 0){
+    env = getenv("REPROBLAS_CHECK_BOUNDS");
+    idxdBLAS_check_bounds = env != NULL && atoi(env) != 0;
+  }
+  return idxdBLAS_check_bounds;
+}
+
+/**
+ * @internal
+ * @brief Check that a double precision bound can replace the largest absolute value of some inputs
+ *
+ * A bound gives the same indexed sum as the largest absolute value of the inputs it bounds if it is at least that value and #idxd_dindex() gives the same index for both. Reports an error otherwise.
+ *
+ * @param bound the bound
+ * @param amax the largest absolute value of the inputs
+ * @return 0 if the bound is valid, nonzero otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdBLAS_dcheck_bound(const double bound, const double amax){
+  if(!(bound >= amax) || idxd_dindex(bound) != idxd_dindex(amax)){
+    fprintf(stderr, "[%s.%d] ReproBLAS error: %g is not a valid bound for a largest absolute value of %g\n", __FILE__, __LINE__, bound, amax);
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @internal
+ * @brief Check that a single precision bound can replace the largest absolute value of some inputs
+ *
+ * A bound gives the same indexed sum as the largest absolute value of the inputs it bounds if it is at least that value and #idxd_sindex() gives the same index for both. Reports an error otherwise.
+ *
+ * @param bound the bound
+ * @param amax the largest absolute value of the inputs
+ * @return 0 if the bound is valid, nonzero otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdBLAS_scheck_bound(const float bound, const float amax){
+  if(!(bound >= amax) || idxd_sindex(bound) != idxd_sindex(amax)){
+    fprintf(stderr, "[%s.%d] ReproBLAS error: %g is not a valid bound for a largest absolute value of %g\n", __FILE__, __LINE__, (double)bound, (double)amax);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,154 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  float alpha[2];
+  const float *X;
+  int64_t incX;
+  float beta[2];
+  float *Y;
+  int64_t incY;
+  const float *W;
+  int64_t incW;
+} cicaxpbydotc_args;
+
+//set Y := alpha * X + beta * Y and add to Z the conjugated dot product of W and the updated Y, a block at a time, so that each block of Y is summed while it is still in cache
+static void cicaxpbydotc_blocks(const int fold, const int64_t N, const float *alpha, const float *X, const int64_t incX, const float *beta, float *Y, const int64_t incY, const float *W, const int64_t incW, float_complex_indexed *Z){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+  float re;
+  float im;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    if(beta[0] == 0.0 && beta[1] == 0.0){
+      for(j = i; j < i + n; j++){
+        re = alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1];
+        im = alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX];
+        Y[2 * j * incY] = re;
+        Y[2 * j * incY + 1] = im;
+      }
+    }else if(beta[0] == 1.0 && beta[1] == 0.0){
+      for(j = i; j < i + n; j++){
+        re = alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1];
+        im = alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX];
+        Y[2 * j * incY] = re + Y[2 * j * incY];
+        Y[2 * j * incY + 1] = im + Y[2 * j * incY + 1];
+      }
+    }else{
+      for(j = i; j < i + n; j++){
+        re = (alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1]) + (beta[0] * Y[2 * j * incY] - beta[1] * Y[2 * j * incY + 1]);
+        im = (alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX]) + (beta[0] * Y[2 * j * incY + 1] + beta[1] * Y[2 * j * incY]);
+        Y[2 * j * incY] = re;
+        Y[2 * j * incY + 1] = im;
+      }
+    }
+    idxdBLAS_cmcdotc_64(fold, n, W + 2 * i * incW, incW, Y + 2 * i * incY, incY, (float*)Z, 1, (float*)Z + 2 * fold, 1);
+  }
+}
+
+static void cicaxpbydotc_kernel(void *args_, const int64_t i, const int n, void *Z){
+  cicaxpbydotc_args *args = (cicaxpbydotc_args*)args_;
+  cicaxpbydotc_blocks(args->fold, n, args->alpha, args->X + 2 * i * args->incX, args->incX, args->beta, args->Y + 2 * i * args->incY, args->incY, args->W + 2 * i * args->incW, args->incW, (float_complex_indexed*)Z);
+}
+
+static void cicaxpbydotc_combine(void *args_, void *partial, void *Z){
+  cicaxpbydotc_args *args = (cicaxpbydotc_args*)args_;
+  idxd_ciciadd(args->fold, (float_complex_indexed*)partial, (float_complex_indexed*)Z);
+}
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and add the conjugated dot product of complex single precision vector W and the updated Y to indexed complex single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z is the same as that of #idxdBLAS_cicdotc() applied to W and the updated Y, and does not depend on the number of threads. W may be Y itself, in which case the real part of Z is the sum of squares of the absolute values of the updated Y.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_cicaxpbydotc(const int fold, const int N, const void *alpha, const void *X, const int incX,
+                           const void *beta, void *Y, const int incY, const void *W, const int incW,
+                           float_complex_indexed *Z){
+  idxdBLAS_cicaxpbydotc_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW, Z);
+}
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and add the conjugated dot product of complex single precision vector W and the updated Y to indexed complex single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z is the same as that of #idxdBLAS_cicdotc_64() applied to W and the updated Y, and does not depend on the number of threads. W may be Y itself, in which case the real part of Z is the sum of squares of the absolute values of the updated Y.
+ *
+ * Same as #idxdBLAS_cicaxpbydotc(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is left unchanged and Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_cicaxpbydotc_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                              const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW,
+                              float_complex_indexed *Z){
+  cicaxpbydotc_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    const float invalid[2] = {NAN, NAN};
+    idxd_cicadd(fold, invalid, Z);
+    return;
+  }
+  args.fold = fold;
+  args.alpha[0] = ((const float*)alpha)[0];
+  args.alpha[1] = ((const float*)alpha)[1];
+  args.X = (const float*)X;
+  args.incX = incX;
+  args.beta[0] = ((const float*)beta)[0];
+  args.beta[1] = ((const float*)beta)[1];
+  args.Y = (float*)Y;
+  args.incY = incY;
+  args.W = (const float*)W;
+  args.incW = incW;
+  if(!idxdPool_parallel(N)){
+    cicaxpbydotc_blocks(fold, N, args.alpha, args.X, incX, args.beta, args.Y, incY, args.W, incW, Z);
+    return;
+  }
+  idxdPool_reduce(N, idxd_cisize(fold), cicaxpbydotc_kernel, cicaxpbydotc_combine, &args, Y, 2 * incY * (ptrdiff_t)sizeof(float), Z);
+}
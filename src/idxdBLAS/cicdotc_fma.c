@@ -0,0 +1,82 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  const float *Y;
+  int64_t incY;
+} cicdotc_fma_args;
+
+static void cicdotc_fma_kernel(void *args_, const int64_t i, const int n, void *Z){
+  cicdotc_fma_args *args = (cicdotc_fma_args*)args_;
+  idxdBLAS_cmcdotc_fma_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, args->Y + 2 * i * args->incY, args->incY, (float*)Z, 1, (float*)Z + 2 * args->fold, 1);
+}
+
+static void cicdotc_fma_combine(void *args_, void *partial, void *Z){
+  cicdotc_fma_args *args = (cicdotc_fma_args*)args_;
+  idxd_ciciadd(args->fold, (float_complex_indexed*)partial, (float_complex_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed complex single precision Z the conjugated dot product of complex single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and conjugated Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_cicdotc() of the same fold at the cost of depositing four times as many values.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_cicdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, float_complex_indexed *Z){
+  idxdBLAS_cicdotc_fma_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed complex single precision Z the conjugated dot product of complex single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and conjugated Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_cicdotc() of the same fold at the cost of depositing four times as many values.
+ *
+ * Same as #idxdBLAS_cicdotc_fma(), except that the vector length and strides are 64-bit integers. If @c 4 * N is greater than #idxd_SICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_cicdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, float_complex_indexed *Z){
+  cicdotc_fma_args args;
+
+  if(idxdBLAS_capacity_64(4 * N, idxd_SICAPACITY)){
+    const float invalid[2] = {NAN, NAN};
+    idxd_cicadd(fold, invalid, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_cmcdotc_fma_64(fold, N, X, incX, Y, incY, Z, 1, Z + 2 * fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  args.Y = (const float*)Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_cisize(fold), cicdotc_fma_kernel, cicdotc_fma_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Z);
+}
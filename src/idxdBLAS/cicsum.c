@@ -1,4 +1,23 @@
+#include <math.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} cicsum_args;
+
+static void cicsum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  cicsum_args *args = (cicsum_args*)args_;
+  idxdBLAS_cmcsum_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, (float*)Y, 1, (float*)Y + 2 * args->fold, 1);
+}
+
+static void cicsum_combine(void *args_, void *partial, void *Y){
+  cicsum_args *args = (cicsum_args*)args_;
+  idxd_ciciadd(args->fold, (float_complex_indexed*)partial, (float_complex_indexed*)Y);
+}
 
 /**
  * @brief Add to indexed complex single precision Y the sum of complex single precision vector X
@@ -15,5 +34,38 @@
  * @date   15 Jan 2016
  */
 void idxdBLAS_cicsum(const int fold, const int N, const void *X, const int incX, float_complex_indexed *Y){
-  idxdBLAS_cmcsum(fold, N, X, incX, Y, 1, Y + 2 * fold, 1);
+  idxdBLAS_cicsum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed complex single precision Y the sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of X.
+ *
+ * Same as #idxdBLAS_cicsum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_cicsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float_complex_indexed *Y){
+  cicsum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    const float invalid[2] = {NAN, NAN};
+    idxd_cicadd(fold, invalid, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_cmcsum_64(fold, N, X, incX, Y, 1, Y + 2 * fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_cisize(fold), cicsum_kernel, cicsum_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Y);
 }
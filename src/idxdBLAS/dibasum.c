@@ -0,0 +1,71 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const uint16_t *X;
+  int64_t incX;
+} dibasum_args;
+
+static void dibasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  dibasum_args *args = (dibasum_args*)args_;
+  idxdBLAS_dmbasum_64(args->fold, n, args->X + i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void dibasum_combine(void *args_, void *partial, void *Y){
+  dibasum_args *args = (dibasum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of bfloat16 vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dibasum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y){
+  idxdBLAS_dibasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of bfloat16 vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * Same as #idxdBLAS_dibasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dibasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y){
+  dibasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmbasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), dibasum_kernel, dibasum_combine, &args, X, incX * (ptrdiff_t)sizeof(uint16_t), Y);
+}
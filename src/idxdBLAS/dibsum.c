@@ -0,0 +1,73 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const uint16_t *X;
+  int64_t incX;
+} dibsum_args;
+
+static void dibsum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  dibsum_args *args = (dibsum_args*)args_;
+  idxdBLAS_dmbsum_64(args->fold, n, args->X + i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void dibsum_combine(void *args_, void *partial, void *Y){
+  dibsum_args *args = (dibsum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the sum of bfloat16 vector X
+ *
+ * Add to Y the indexed sum of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dibsum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y){
+  idxdBLAS_dibsum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the sum of bfloat16 vector X
+ *
+ * Add to Y the indexed sum of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * Same as #idxdBLAS_dibsum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dibsum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y){
+  dibsum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmbsum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), dibsum_kernel, dibsum_combine, &args, X, incX * (ptrdiff_t)sizeof(uint16_t), Y);
+}
@@ -0,0 +1,73 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} dicasum_args;
+
+static void dicasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  dicasum_args *args = (dicasum_args*)args_;
+  idxdBLAS_dmcasum_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void dicasum_combine(void *args_, void *partial, void *Y){
+  dicasum_args *args = (dicasum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sicasum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dicasum(const int fold, const int N, const void *X, const int incX, double_indexed *Y){
+  idxdBLAS_dicasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sicasum().
+ *
+ * Same as #idxdBLAS_dicasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dicasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_indexed *Y){
+  dicasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmcasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), dicasum_kernel, dicasum_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Y);
+}
@@ -0,0 +1,147 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  double alpha;
+  const double *X;
+  int64_t incX;
+  double beta;
+  double *Y;
+  int64_t incY;
+} didaxpbyssq_args;
+
+//set Y := alpha * X + beta * Y and add to scaled Z the scaled sum of squares of the updated Y, a block at a time, so that each block of Y is summed while it is still in cache. Returns the new scaling factor of Z.
+static double didaxpbyssq_blocks(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX, const double beta, double *Y, const int64_t incY, double scaleZ, double_indexed *Z){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    if(beta == 0.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX];
+      }
+    }else if(beta == 1.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + Y[j * incY];
+      }
+    }else{
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + beta * Y[j * incY];
+      }
+    }
+    scaleZ = idxdBLAS_dmdssq_64(fold, n, Y + i * incY, incY, scaleZ, Z, 1, Z + fold, 1);
+  }
+  return scaleZ;
+}
+
+static void didaxpbyssq_kernel(void *args_, const int64_t i, const int n, void *Z){
+  didaxpbyssq_args *args = (didaxpbyssq_args*)args_;
+  double *scaleZ = (double*)Z;
+  *scaleZ = didaxpbyssq_blocks(args->fold, n, args->alpha, args->X + i * args->incX, args->incX, args->beta, args->Y + i * args->incY, args->incY, 0.0, (double_indexed*)(scaleZ + 1));
+}
+
+static void didaxpbyssq_combine(void *args_, void *partial, void *Z){
+  didaxpbyssq_args *args = (didaxpbyssq_args*)args_;
+  double *scaleX = (double*)partial;
+  double *scaleZ = (double*)Z;
+  *scaleZ = idxd_didiaddsq(args->fold, *scaleX, (double_indexed*)(scaleX + 1), *scaleZ, (double_indexed*)(scaleZ + 1));
+}
+
+/**
+ * @brief Update double precision vector Y with a scaled double precision vector X and add the scaled sum of squares of the updated Y to scaled indexed double precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_didssq() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_didaxpbyssq(const int fold, const int N, const double alpha, const double *X, const int incX,
+                            const double beta, double *Y, const int incY, const double scaleZ, double_indexed *Z){
+  return idxdBLAS_didaxpbyssq_64(fold, N, alpha, X, incX, beta, Y, incY, scaleZ, Z);
+}
+
+/**
+ * @brief Update double precision vector Y with a scaled double precision vector X and add the scaled sum of squares of the updated Y to scaled indexed double precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_didssq_64() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_didaxpbyssq(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is left unchanged and Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_didaxpbyssq_64(const int fold, const int64_t N, const double alpha, const double *X, const int64_t incX,
+                               const double beta, double *Y, const int64_t incY, const double scaleZ, double_indexed *Z){
+  didaxpbyssq_args args;
+  double *scaleT;
+  double scale;
+
+  if(N <= 0){
+    return scaleZ;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return scaleZ;
+  }
+  if(!idxdPool_parallel(N)){
+    return didaxpbyssq_blocks(fold, N, alpha, X, incX, beta, Y, incY, scaleZ, Z);
+  }
+  args.fold = fold;
+  args.alpha = alpha;
+  args.X = X;
+  args.incX = incX;
+  args.beta = beta;
+  args.Y = Y;
+  args.incY = incY;
+  scaleT = (double*)malloc(sizeof(double) + idxd_disize(fold));
+  *scaleT = scaleZ;
+  idxd_didiset(fold, Z, scaleT + 1);
+  idxdPool_reduce(N, sizeof(double) + idxd_disize(fold), didaxpbyssq_kernel, didaxpbyssq_combine, &args, Y, incY * (ptrdiff_t)sizeof(double), scaleT);
+  idxd_didiset(fold, scaleT + 1, Z);
+  scale = *scaleT;
+  free(scaleT);
+  return scale;
+}
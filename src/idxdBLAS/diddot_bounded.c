@@ -0,0 +1,104 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+  const double *Y;
+  int64_t incY;
+  double bound;
+} diddot_bounded_args;
+
+//add to Z the dot product of X and Y, updating Z with bound instead of the largest product of each block
+static void diddot_bounded_chunks(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, const double bound, double_indexed *Z){
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = idxdBLAS_chunk_64(N - i, incX, incY);
+    idxdBLAS_dmddot_bounded(fold, n, X + i * incX, n > 1 ? (int)incX : 1, Y + i * incY, n > 1 ? (int)incY : 1, bound, Z, 1, Z + fold, 1);
+  }
+}
+
+static void diddot_bounded_kernel(void *args_, const int64_t i, const int n, void *Z){
+  diddot_bounded_args *args = (diddot_bounded_args*)args_;
+  diddot_bounded_chunks(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, args->bound, (double_indexed*)Z);
+}
+
+static void diddot_bounded_combine(void *args_, void *partial, void *Z){
+  diddot_bounded_args *args = (diddot_bounded_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of double precision vectors X and Y, given a bound on their products
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y, updating Z with @c bound instead of computing the largest absolute value of the products, so that X and Y are read once.
+ *
+ * If @c bound is at least the absolute value of every pairwise product of X and Y and #idxd_dindex() gives the same index for @c bound and the largest of them, Z is the same as that of #idxdBLAS_diddot(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_diddot() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_diddot_bounded(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, const double bound, double_indexed *Z){
+  idxdBLAS_diddot_bounded_64(fold, N, X, incX, Y, incY, bound, Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of double precision vectors X and Y, given a bound on their products
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y, updating Z with @c bound instead of computing the largest absolute value of the products, so that X and Y are read once.
+ *
+ * If @c bound is at least the absolute value of every pairwise product of X and Y and #idxd_dindex() gives the same index for @c bound and the largest of them, Z is the same as that of #idxdBLAS_diddot_64(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_diddot_64() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * Same as #idxdBLAS_diddot_bounded(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_diddot_bounded_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, const double bound, double_indexed *Z){
+  diddot_bounded_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return;
+  }
+  if(ISNANINF(bound) || (idxdBLAS_get_check_bounds() && idxdBLAS_dcheck_bound(bound, idxdBLAS_damaxm_64(N, X, incX, Y, incY)))){
+    idxdBLAS_diddot_64(fold, N, X, incX, Y, incY, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    diddot_bounded_chunks(fold, N, X, incX, Y, incY, bound, Z);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  args.bound = bound;
+  idxdPool_reduce(N, idxd_disize(fold), diddot_bounded_kernel, diddot_bounded_combine, &args, X, incX * (ptrdiff_t)sizeof(double), Z);
+}
@@ -0,0 +1,81 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+  const double *Y;
+  int64_t incY;
+} diddot_fma_args;
+
+static void diddot_fma_kernel(void *args_, const int64_t i, const int n, void *Z){
+  diddot_fma_args *args = (diddot_fma_args*)args_;
+  idxdBLAS_dmddot_fma_64(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, (double*)Z, 1, (double*)Z + args->fold, 1);
+}
+
+static void diddot_fma_combine(void *args_, void *partial, void *Z){
+  diddot_fma_args *args = (diddot_fma_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_diddot() of the same fold at the cost of depositing twice as many values.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_diddot_fma(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double_indexed *Z){
+  idxdBLAS_diddot_fma_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_diddot() of the same fold at the cost of depositing twice as many values.
+ *
+ * Same as #idxdBLAS_diddot_fma(), except that the vector length and strides are 64-bit integers. If @c 2 * N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_diddot_fma_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double_indexed *Z){
+  diddot_fma_args args;
+
+  if(idxdBLAS_capacity_64(2 * N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmddot_fma_64(fold, N, X, incX, Y, incY, Z, 1, Z + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_disize(fold), diddot_fma_kernel, diddot_fma_combine, &args, X, incX * (ptrdiff_t)sizeof(double), Z);
+}
@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define J_BLOCK 32
+
+/**
+ * @brief Add to indexed double precision matrix C the matrix-matrix product of packed double precision matrix A and double precision matrix B
+ *
+ * Performs the matrix-matrix operation
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(B) is one of
+ *
+ *   op(B) = B   or   op(B) = B**T,
+ *
+ * alpha is a scalar, op(A) is the M by K matrix packed by idxdBLAS_dpack(), op(B) is a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. C is the same as that of #idxdBLAS_didgemm() on the matrix that was packed, with the same TransA and with Order applying to A, B and C.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the ordering of B and C ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param alpha scalar alpha
+ * @param A packed double precision matrix
+ * @param B double precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didgemm_packed(const int fold, const char Order, const char TransB,
+                             const int N, const double alpha, const idxdBLAS_dpacked *A,
+                             const double *B, const int ldb,
+                             double_indexed *C, const int ldc){
+  idxdBLAS_didgemm_packed_64(fold, Order, TransB, N, alpha, A, B, ldb, C, ldc);
+}
+
+/**
+ * @brief Add to indexed double precision matrix C the matrix-matrix product of packed double precision matrix A and double precision matrix B
+ *
+ * Performs the matrix-matrix operation
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(B) is one of
+ *
+ *   op(B) = B   or   op(B) = B**T,
+ *
+ * alpha is a scalar, op(A) is the M by K matrix packed by idxdBLAS_dpack(), op(B) is a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. C is the same as that of #idxdBLAS_didgemm_64() on the matrix that was packed, with the same TransA and with Order applying to A, B and C.
+ *
+ * Same as #idxdBLAS_didgemm_packed(), except that the dimension and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the ordering of B and C ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param alpha scalar alpha
+ * @param A packed double precision matrix
+ * @param B double precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didgemm_packed_64(const int fold, const char Order, const char TransB,
+                                const int64_t N, const double alpha, const idxdBLAS_dpacked *A,
+                                const double *B, const int64_t ldb,
+                                double_indexed *C, const int64_t ldc){
+  int64_t i;
+  int64_t j;
+  int64_t jj;
+  int64_t k;
+  int64_t kk;
+  int64_t p;
+  int n;
+  int rowC;
+  int colsB;
+  const double *a;
+  double amaxA;
+  double *bufA;
+  double *bufB;
+  const double *colB[J_BLOCK];
+  double amaxB[J_BLOCK];
+  int iamaxB[J_BLOCK];
+
+  if(A->M == 0 || A->N == 0 || N == 0 || alpha == 0.0){
+    return;
+  }
+
+  //the columns of op(B) are contiguous in B if B is row major and transposed or column major and not transposed
+  switch(Order){
+    case 'r':
+    case 'R':
+      rowC = 1;
+      colsB = TransB != 'n' && TransB != 'N';
+      break;
+    default:
+      rowC = 0;
+      colsB = TransB == 'n' || TransB == 'N';
+      break;
+  }
+
+  bufA = (double*)malloc(idxdBLAS_PACKED_PANEL * sizeof(double));
+  bufB = (double*)malloc(J_BLOCK * idxdBLAS_PACKED_PANEL * sizeof(double));
+  for(p = 0; p < A->npanels; p++){
+    k = p * idxdBLAS_PACKED_PANEL;
+    n = (int)MIN(idxdBLAS_PACKED_PANEL, A->N - k);
+    for(j = 0; j < N; j += J_BLOCK){
+      if(colsB){
+        for(jj = j; jj < N && jj < j + J_BLOCK; jj++){
+          colB[jj - j] = B + jj * ldb + k;
+        }
+      }else{
+        for(kk = 0; kk < n; kk++){
+          for(jj = j; jj < N && jj < j + J_BLOCK; jj++){
+            bufB[(jj - j) * idxdBLAS_PACKED_PANEL + kk] = B[(k + kk) * ldb + jj];
+          }
+        }
+        for(jj = j; jj < N && jj < j + J_BLOCK; jj++){
+          colB[jj - j] = bufB + (jj - j) * idxdBLAS_PACKED_PANEL;
+        }
+      }
+      for(jj = j; jj < N && jj < j + J_BLOCK; jj++){
+        amaxB[jj - j] = idxdBLAS_dpacked_amax(n, colB[jj - j], iamaxB + (jj - j));
+      }
+      for(i = 0; i < A->M; i++){
+        //A is scaled as in idxdBLAS_didgemm(), so that the products are the same
+        a = A->A + i * A->ldA + k;
+        amaxA = A->amax[i * A->npanels + p];
+        if(alpha != 1.0){
+          for(kk = 0; kk < n; kk++){
+            bufA[kk] = a[kk] * alpha;
+          }
+          a = bufA;
+          amaxA = amaxA * fabs(alpha);
+        }
+        for(jj = j; jj < N && jj < j + J_BLOCK; jj++){
+          idxdBLAS_didpacked_dot(fold, n, a, amaxA, A->iamax[i * A->npanels + p], colB[jj - j], amaxB[jj - j], iamaxB[jj - j], C + (rowC ? i * ldc + jj : jj * ldc + i) * idxd_dinum(fold));
+        }
+      }
+    }
+  }
+  free(bufA);
+  free(bufB);
+}
@@ -0,0 +1,93 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of packed double precision matrix A and double precision vector X
+ *
+ * Performs the matrix-vector operation
+ *
+ *   y := alpha*op(A)*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and op(A) is the M by N matrix packed by idxdBLAS_dpack().
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. Y is the same as that of #idxdBLAS_didgemv() on the matrix that was packed, with the same Order and TransA.
+ *
+ * @param fold the fold of the indexed types
+ * @param alpha scalar alpha
+ * @param A packed double precision matrix
+ * @param X double precision vector of at least size N
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didgemv_packed(const int fold, const double alpha, const idxdBLAS_dpacked *A,
+                             const double *X, const int incX,
+                             double_indexed *Y, const int incY){
+  idxdBLAS_didgemv_packed_64(fold, alpha, A, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of packed double precision matrix A and double precision vector X
+ *
+ * Performs the matrix-vector operation
+ *
+ *   y := alpha*op(A)*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and op(A) is the M by N matrix packed by idxdBLAS_dpack().
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. Y is the same as that of #idxdBLAS_didgemv_64() on the matrix that was packed, with the same Order and TransA.
+ *
+ * Same as #idxdBLAS_didgemv_packed(), except that the strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param alpha scalar alpha
+ * @param A packed double precision matrix
+ * @param X double precision vector of at least size N
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didgemv_packed_64(const int fold, const double alpha, const idxdBLAS_dpacked *A,
+                                const double *X, const int64_t incX,
+                                double_indexed *Y, const int64_t incY){
+  int64_t i;
+  int64_t j;
+  int64_t p;
+  int n;
+  double *bufX;
+  double *amaxX;
+  int *iamaxX;
+
+  if(A->M == 0 || A->N == 0 || alpha == 0.0){
+    return;
+  }
+
+  //X is scaled as in idxdBLAS_didgemv(), so that the products are the same
+  bufX = (double*)malloc(A->N * sizeof(double));
+  amaxX = (double*)malloc(A->npanels * sizeof(double));
+  iamaxX = (int*)malloc(A->npanels * sizeof(int));
+  for(j = 0; j < A->N; j++){
+    bufX[j] = X[j * incX] * alpha;
+  }
+  for(p = 0; p < A->npanels; p++){
+    n = (int)MIN(idxdBLAS_PACKED_PANEL, A->N - p * idxdBLAS_PACKED_PANEL);
+    amaxX[p] = idxdBLAS_dpacked_amax(n, bufX + p * idxdBLAS_PACKED_PANEL, iamaxX + p);
+  }
+
+  for(p = 0; p < A->npanels; p++){
+    n = (int)MIN(idxdBLAS_PACKED_PANEL, A->N - p * idxdBLAS_PACKED_PANEL);
+    for(i = 0; i < A->M; i++){
+      idxdBLAS_didpacked_dot(fold, n, A->A + i * A->ldA + p * idxdBLAS_PACKED_PANEL, A->amax[i * A->npanels + p], A->iamax[i * A->npanels + p], bufX + p * idxdBLAS_PACKED_PANEL, amaxX[p], iamaxX[p], Y + i * incY * idxd_dinum(fold));
+    }
+  }
+
+  free(bufX);
+  free(amaxX);
+  free(iamaxX);
+}
@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK MIN(1024, idxd_DIENDURANCE)
+
+//key of element i given either as int or as int64_t
+#define KEY(keys, keys_64, i) ((keys_64) != NULL ? (keys_64)[i] : (int64_t)(keys)[i])
+
+typedef struct {
+  int fold;
+  const int *keys;
+  const int64_t *keys_64;
+  const double *X;
+  int64_t incX;
+  int64_t nkeys;
+  int64_t N;
+  int ntasks;
+  double_indexed **partials;
+  int64_t **touched;
+  int64_t *ntouched;
+} didkeysum_args;
+
+//add to Y[k * incY] the elements i0 <= i < i1 of X with key k, a block at a time, and return the number of keys seen, which are stored in touched. Keys seen in a block get a single update with the largest absolute value of their elements in the block, and are renormalized only when their next block could exceed the endurance of their accumulators.
+static int64_t didkeysum_blocks(const didkeysum_args *args, const int64_t i0, const int64_t i1, double_indexed *Y, const int64_t incY, int64_t *touched){
+  int fold = args->fold;
+  int64_t i;
+  int64_t j;
+  int64_t n;
+  int64_t k;
+  int64_t nseen;
+  int64_t ntouched = 0;
+  int64_t *seen = (int64_t*)malloc(N_BLOCK * sizeof(int64_t));
+  int64_t *count = (int64_t*)calloc(args->nkeys, sizeof(int64_t));
+  double *bound = (double*)malloc(args->nkeys * sizeof(double));
+  double *amax = (double*)calloc(args->nkeys, sizeof(double));
+  double x;
+
+  //every key is updated the first time it is seen, even if its elements are zero
+  for(k = 0; k < args->nkeys; k++){
+    bound[k] = -1.0;
+  }
+
+  for(i = i0; i < i1; i += N_BLOCK){
+    n = MIN(N_BLOCK, i1 - i);
+    nseen = 0;
+    for(j = i; j < i + n; j++){
+      k = KEY(args->keys, args->keys_64, j);
+      if(k < 0 || k >= args->nkeys){
+        continue;
+      }
+      if(count[k] >= 0){
+        //mark the key as seen in this block
+        seen[nseen++] = k;
+        count[k] = -count[k] - 1;
+      }
+      x = fabs(args->X[j * args->incX]);
+      amax[k] = x > amax[k] ? x : amax[k];
+    }
+    for(j = 0; j < nseen; j++){
+      k = seen[j];
+      if(bound[k] < 0.0){
+        touched[ntouched++] = k;
+      }
+      if(amax[k] > bound[k]){
+        idxd_didupdate(fold, amax[k], Y + k * incY * idxd_dinum(fold));
+        bound[k] = amax[k];
+      }
+      amax[k] = 0.0;
+    }
+    for(j = i; j < i + n; j++){
+      k = KEY(args->keys, args->keys_64, j);
+      if(k < 0 || k >= args->nkeys){
+        continue;
+      }
+      idxd_diddeposit(fold, args->X[j * args->incX], Y + k * incY * idxd_dinum(fold));
+      count[k]--;
+    }
+    for(j = 0; j < nseen; j++){
+      k = seen[j];
+      count[k] = -count[k] - 1;
+      if(count[k] > idxd_DIENDURANCE - N_BLOCK){
+        idxd_direnorm(fold, Y + k * incY * idxd_dinum(fold));
+        count[k] = 0;
+      }
+    }
+  }
+  for(j = 0; j < ntouched; j++){
+    k = touched[j];
+    if(count[k] > 0){
+      idxd_direnorm(fold, Y + k * incY * idxd_dinum(fold));
+    }
+  }
+  free(seen);
+  free(count);
+  free(bound);
+  free(amax);
+  return ntouched;
+}
+
+//the first element of task t
+static int64_t didkeysum_split(const didkeysum_args *args, const int t){
+  return (args->N / args->ntasks) * t + MIN(t, args->N % args->ntasks);
+}
+
+static void didkeysum_task(void *args_, const int t){
+  didkeysum_args *args = (didkeysum_args*)args_;
+  int64_t i0 = didkeysum_split(args, t);
+  int64_t i1 = didkeysum_split(args, t + 1);
+
+  args->partials[t] = (double_indexed*)calloc(args->nkeys, idxd_disize(args->fold));
+  args->touched[t] = (int64_t*)malloc(MIN(args->nkeys, i1 - i0) * sizeof(int64_t));
+  args->ntouched[t] = didkeysum_blocks(args, i0, i1, args->partials[t], 1, args->touched[t]);
+}
+
+static void didkeysum(const int fold, const int64_t N, const int *keys, const int64_t *keys_64,
+                      const double *X, const int64_t incX, const int64_t nkeys,
+                      double_indexed *Y, const int64_t incY){
+  didkeysum_args args;
+  int64_t *touched;
+  int64_t j;
+  int64_t k;
+  int t;
+
+  if(N <= 0 || nkeys <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    for(k = 0; k < nkeys; k++){
+      idxd_didadd(fold, NAN, Y + k * incY * idxd_dinum(fold));
+    }
+    return;
+  }
+  args.fold = fold;
+  args.keys = keys;
+  args.keys_64 = keys_64;
+  args.X = X;
+  args.incX = incX;
+  args.nkeys = nkeys;
+  args.N = N;
+  //each task sums a contiguous part of X into an indexed vector of size nkeys of its own (along with the state of its keys), so there are only as many tasks as fit in the memory taken by X and the keys
+  args.ntasks = idxdPool_num_tasks((double)N, (double)nkeys * (idxd_disize(fold) + sizeof(int64_t) + 2 * sizeof(double)), (double)N * (sizeof(double) + (keys_64 != NULL ? sizeof(int64_t) : sizeof(int))));
+  if(args.ntasks > 1 && args.ntasks > N / idxdPool_MINCHUNK){
+    args.ntasks = (int)(N / idxdPool_MINCHUNK);
+  }
+  if(args.ntasks <= 1){
+    touched = (int64_t*)malloc(MIN(nkeys, N) * sizeof(int64_t));
+    didkeysum_blocks(&args, 0, N, Y, incY, touched);
+    free(touched);
+    return;
+  }
+  args.partials = (double_indexed**)malloc(args.ntasks * sizeof(double_indexed*));
+  args.touched = (int64_t**)malloc(args.ntasks * sizeof(int64_t*));
+  args.ntouched = (int64_t*)malloc(args.ntasks * sizeof(int64_t));
+  idxdPool_dispatch(args.ntasks, didkeysum_task, &args);
+  //only the keys seen by a task are added to Y
+  for(t = 0; t < args.ntasks; t++){
+    for(j = 0; j < args.ntouched[t]; j++){
+      k = args.touched[t][j];
+      idxd_didiadd(fold, args.partials[t] + k * idxd_dinum(fold), Y + k * incY * idxd_dinum(fold));
+    }
+    free(args.partials[t]);
+    free(args.touched[t]);
+  }
+  free(args.partials);
+  free(args.touched);
+  free(args.ntouched);
+}
+
+/**
+ * @brief Add to indexed double precision vector Y the sums of the elements of double precision vector X with each key
+ *
+ * Performs the operation
+ *
+ *   y_k := y_k + sum_{i : keys_i = k} x_i,
+ *
+ * for k = 0, ..., nkeys - 1, where y is an indexed vector. Elements with keys outside of this range are ignored.
+ *
+ * X is read once, a block at a time. The accumulator of each key seen in a block is updated once with the largest absolute value of its elements in the block before they are deposited, and is renormalized only when needed. Each element of y is the same as that of #idxdBLAS_didsum() applied to the elements with its key, whatever their order, and does not depend on the number of threads. Each thread sums a part of X into an indexed vector of size nkeys of its own, so fewer threads are used when these would take more memory than X and the keys.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y indexed double precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didkeysum(const int fold, const int N, const int *keys,
+                        const double *X, const int incX, const int nkeys,
+                        double_indexed *Y, const int incY){
+  didkeysum(fold, N, keys, NULL, X, incX, nkeys, Y, incY);
+}
+
+/**
+ * @brief Add to indexed double precision vector Y the sums of the elements of double precision vector X with each key
+ *
+ * Performs the operation
+ *
+ *   y_k := y_k + sum_{i : keys_i = k} x_i,
+ *
+ * for k = 0, ..., nkeys - 1, where y is an indexed vector. Elements with keys outside of this range are ignored.
+ *
+ * X is read once, a block at a time. The accumulator of each key seen in a block is updated once with the largest absolute value of its elements in the block before they are deposited, and is renormalized only when needed. Each element of y is the same as that of #idxdBLAS_didsum_64() applied to the elements with its key, whatever their order, and does not depend on the number of threads. Each thread sums a part of X into an indexed vector of size nkeys of its own, so fewer threads are used when these would take more memory than X and the keys.
+ *
+ * Same as #idxdBLAS_didkeysum(), except that the vector length, keys, number of keys and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y indexed double precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didkeysum_64(const int fold, const int64_t N, const int64_t *keys,
+                           const double *X, const int64_t incX, const int64_t nkeys,
+                           double_indexed *Y, const int64_t incY){
+  didkeysum(fold, N, NULL, keys, X, incX, nkeys, Y, incY);
+}
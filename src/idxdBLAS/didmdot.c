@@ -0,0 +1,127 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 256
+
+typedef struct {
+  int fold;
+  int k;
+  const double *X;
+  int64_t ldX;
+  int64_t incX;
+  int npairs;
+  const int *pairs;
+} didmdot_args;
+
+//add to Z[p] the dot product of the vectors in the p'th valid pair, a block of N_BLOCK elements at a time, so that each vector is loaded from memory once per block and shared by all of its pairs while it is in cache
+static void didmdot_blocks(const didmdot_args *args, const int64_t i0, const int64_t i1, double_indexed *Z){
+  int fold = args->fold;
+  int64_t i;
+  int64_t n;
+  int p;
+  int a;
+  int b;
+
+  for(i = i0; i < i1; i += N_BLOCK){
+    n = MIN(N_BLOCK, i1 - i);
+    for(p = 0; p < args->npairs; p++){
+      a = args->pairs[2 * p];
+      b = args->pairs[2 * p + 1];
+      if(a < 0 || a >= args->k || b < 0 || b >= args->k){
+        continue;
+      }
+      idxdBLAS_dmddot_64(fold, n, args->X + a * args->ldX + i * args->incX, args->incX, args->X + b * args->ldX + i * args->incX, args->incX, Z + p * idxd_dinum(fold), 1, Z + p * idxd_dinum(fold) + fold, 1);
+    }
+  }
+}
+
+static void didmdot_kernel(void *args_, const int64_t i, const int n, void *Z){
+  didmdot_blocks((didmdot_args*)args_, i, i + n, (double_indexed*)Z);
+}
+
+static void didmdot_combine(void *args_, void *partial, void *Z){
+  didmdot_args *args = (didmdot_args*)args_;
+  int p;
+
+  for(p = 0; p < args->npairs; p++){
+    idxd_didiadd(args->fold, (double_indexed*)partial + p * idxd_dinum(args->fold), (double_indexed*)Z + p * idxd_dinum(args->fold));
+  }
+}
+
+/**
+ * @brief Add to indexed double precision vector Z the dot products of several pairs of double precision vectors
+ *
+ * The j'th of the k vectors starts at X + j * ldX and has stride incX. For p = 0, ..., npairs - 1, adds to the p'th element of Z the indexed sum of the pairwise products of the vectors pairs[2 * p] and pairs[2 * p + 1]. Elements of Z whose pair names a vector outside of 0, ..., k - 1 are left unchanged.
+ *
+ * The vectors are read a block at a time, and each block is deposited into the accumulators of all of its pairs while it is in cache. The p'th element of Z is the same as that of #idxdBLAS_diddot() applied to its pair, and does not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param k number of vectors
+ * @param X double precision vectors
+ * @param ldX distance between the first elements of consecutive vectors
+ * @param incX X vector stride (use every incX'th element)
+ * @param npairs number of pairs
+ * @param pairs the indices of the two vectors of each pair (size 2 * npairs)
+ * @param Z indexed double precision vector of size npairs (stored contiguously)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didmdot(const int fold, const int N, const int k,
+                      const double *X, const int ldX, const int incX,
+                      const int npairs, const int *pairs, double_indexed *Z){
+  idxdBLAS_didmdot_64(fold, N, k, X, ldX, incX, npairs, pairs, Z);
+}
+
+/**
+ * @brief Add to indexed double precision vector Z the dot products of several pairs of double precision vectors
+ *
+ * The j'th of the k vectors starts at X + j * ldX and has stride incX. For p = 0, ..., npairs - 1, adds to the p'th element of Z the indexed sum of the pairwise products of the vectors pairs[2 * p] and pairs[2 * p + 1]. Elements of Z whose pair names a vector outside of 0, ..., k - 1 are left unchanged.
+ *
+ * The vectors are read a block at a time, and each block is deposited into the accumulators of all of its pairs while it is in cache. The p'th element of Z is the same as that of #idxdBLAS_diddot_64() applied to its pair, and does not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_didmdot(), except that the vector length, distance between vectors and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, every element of Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param k number of vectors
+ * @param X double precision vectors
+ * @param ldX distance between the first elements of consecutive vectors
+ * @param incX X vector stride (use every incX'th element)
+ * @param npairs number of pairs
+ * @param pairs the indices of the two vectors of each pair (size 2 * npairs)
+ * @param Z indexed double precision vector of size npairs (stored contiguously)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didmdot_64(const int fold, const int64_t N, const int k,
+                         const double *X, const int64_t ldX, const int64_t incX,
+                         const int npairs, const int *pairs, double_indexed *Z){
+  didmdot_args args;
+  int q;
+
+  if(N <= 0 || npairs <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    for(q = 0; q < npairs; q++){
+      idxd_didadd(fold, NAN, Z + q * idxd_dinum(fold));
+    }
+    return;
+  }
+  args.fold = fold;
+  args.k = k;
+  args.X = X;
+  args.ldX = ldX;
+  args.incX = incX;
+  args.npairs = npairs;
+  args.pairs = pairs;
+  if(!idxdPool_parallel((double)N * npairs)){
+    didmdot_blocks(&args, 0, N, Z);
+    return;
+  }
+  idxdPool_reduce(N, npairs * idxd_disize(fold), didmdot_kernel, didmdot_combine, &args, X, incX * (ptrdiff_t)sizeof(double), Z);
+}
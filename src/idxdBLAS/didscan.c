@@ -0,0 +1,206 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  int exclusive;
+  int64_t N;
+  const double *X;
+  int64_t incX;
+  double_indexed *S;
+  double *Y;
+  int64_t incY;
+  int ntasks;
+} didscan_args;
+
+//add elements i0 through i1 - 1 of X to S, setting Y[i * incY] to S after (or, if exclusive, before) adding x_i. S is renormalized after each element so that its conversion is that of the sum of its elements.
+static void didscan_range(const int fold, const int exclusive, const int64_t i0, const int64_t i1, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY){
+  int64_t i;
+  double x;
+
+  for(i = i0; i < i1; i++){
+    x = X[i * incX];
+    if(exclusive){
+      Y[i * incY] = idxd_ddiconv(fold, S);
+    }
+    idxd_didadd(fold, x, S);
+    if(!exclusive){
+      Y[i * incY] = idxd_ddiconv(fold, S);
+    }
+  }
+}
+
+//the first element of chunk t
+static int64_t didscan_split(const didscan_args *args, const int t){
+  return (int64_t)(((double)args->N * t) / args->ntasks);
+}
+
+//sum chunk t of X into the (t + 1)'th indexed scalar of S
+static void didscan_task_sum(void *args_, const int t){
+  didscan_args *args = (didscan_args*)args_;
+  int64_t i0 = didscan_split(args, t);
+
+  idxdBLAS_didsum_64(args->fold, didscan_split(args, t + 1) - i0, args->X + i0 * args->incX, args->incX, args->S + (t + 1) * idxd_dinum(args->fold));
+}
+
+//scan chunk t of X starting from the t'th indexed scalar of S, the sum of the preceding chunks
+static void didscan_task_scan(void *args_, const int t){
+  didscan_args *args = (didscan_args*)args_;
+
+  didscan_range(args->fold, args->exclusive, didscan_split(args, t), didscan_split(args, t + 1), args->X, args->incX, args->S + t * idxd_dinum(args->fold), args->Y, args->incY);
+}
+
+static void didscan(const int fold, const int exclusive, const int64_t N, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY){
+  didscan_args args;
+  int64_t i;
+  int t;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, S);
+    for(i = 0; i < N; i++){
+      Y[i * incY] = NAN;
+    }
+    return;
+  }
+
+  args.ntasks = 1;
+  if(idxdPool_parallel((double)N)){
+    args.ntasks = idxdPool_get_num_threads() > 1 ? idxdPool_get_num_threads() : 2;
+    if(N / args.ntasks < idxdPool_MINCHUNK){
+      args.ntasks = (int)MAX(N / idxdPool_MINCHUNK, 1);
+    }
+  }
+  if(args.ntasks < 2){
+    didscan_range(fold, exclusive, 0, N, X, incX, S, Y, incY);
+    return;
+  }
+
+  //the chunks are summed in parallel, their sums are scanned serially to give the carry into each chunk, and the chunks are scanned in parallel from their carries
+  args.fold = fold;
+  args.exclusive = exclusive;
+  args.N = N;
+  args.X = X;
+  args.incX = incX;
+  args.S = (double_indexed*)calloc(args.ntasks + 1, idxd_disize(fold));
+  args.Y = Y;
+  args.incY = incY;
+  idxd_didiadd(fold, S, args.S);
+  idxdPool_dispatch(args.ntasks - 1, didscan_task_sum, &args);
+  for(t = 1; t <= args.ntasks - 1; t++){
+    idxd_didiadd(fold, args.S + (t - 1) * idxd_dinum(fold), args.S + t * idxd_dinum(fold));
+  }
+  idxdPool_dispatch(args.ntasks, didscan_task_scan, &args);
+  idxd_didiset(fold, args.S + (args.ntasks - 1) * idxd_dinum(fold), S);
+  free(args.S);
+}
+
+/**
+ * @brief Compute the inclusive scan of double precision vector X, adding X to indexed double precision scalar S
+ *
+ * Performs the operation
+ *
+ *   y_i := s + sum_{j <= i} x_j,
+ *
+ * for i = 0, ..., N - 1 and then s := s + sum_j x_j, where s is an indexed scalar. Passing the same S to consecutive calls scans a vector given in pieces.
+ *
+ * Each element of y is the conversion of the indexed sum of its prefix, so with S set to 0 it is the same as #idxdBLAS_didsum() of x_0 through x_i converted to double precision. With several threads, X is split into chunks that are summed in parallel, the sums of the chunks are added in order to give the indexed sum before each chunk, and the chunks are then scanned in parallel from these sums, so the result does not depend on the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param S indexed scalar S
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didscan(const int fold, const int N, const double *X, const int incX, double_indexed *S, double *Y, const int incY){
+  didscan(fold, 0, N, X, incX, S, Y, incY);
+}
+
+/**
+ * @brief Compute the exclusive scan of double precision vector X, adding X to indexed double precision scalar S
+ *
+ * Performs the operation
+ *
+ *   y_i := s + sum_{j < i} x_j,
+ *
+ * for i = 0, ..., N - 1 and then s := s + sum_j x_j, where s is an indexed scalar. Passing the same S to consecutive calls scans a vector given in pieces.
+ *
+ * Each element of y is the conversion of the indexed sum of its prefix, so with S set to 0 it is the same as #idxdBLAS_didsum() of x_0 through x_{i - 1} converted to double precision (and y_0 is 0). The result does not depend on the number of threads (see #idxdBLAS_didscan()). X and Y may be the same vector if incX = incY.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param S indexed scalar S
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didexscan(const int fold, const int N, const double *X, const int incX, double_indexed *S, double *Y, const int incY){
+  didscan(fold, 1, N, X, incX, S, Y, incY);
+}
+
+/**
+ * @brief Compute the inclusive scan of double precision vector X, adding X to indexed double precision scalar S
+ *
+ * Performs the operation
+ *
+ *   y_i := s + sum_{j <= i} x_j,
+ *
+ * for i = 0, ..., N - 1 and then s := s + sum_j x_j, where s is an indexed scalar. Passing the same S to consecutive calls scans a vector given in pieces.
+ *
+ * Each element of y is the conversion of the indexed sum of its prefix, so with S set to 0 it is the same as #idxdBLAS_didsum_64() of x_0 through x_i converted to double precision. With several threads, X is split into chunks that are summed in parallel, the sums of the chunks are added in order to give the indexed sum before each chunk, and the chunks are then scanned in parallel from these sums, so the result does not depend on the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * Same as #idxdBLAS_didscan(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, S and every element of Y are set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param S indexed scalar S
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY){
+  didscan(fold, 0, N, X, incX, S, Y, incY);
+}
+
+/**
+ * @brief Compute the exclusive scan of double precision vector X, adding X to indexed double precision scalar S
+ *
+ * Performs the operation
+ *
+ *   y_i := s + sum_{j < i} x_j,
+ *
+ * for i = 0, ..., N - 1 and then s := s + sum_j x_j, where s is an indexed scalar. Passing the same S to consecutive calls scans a vector given in pieces.
+ *
+ * Each element of y is the conversion of the indexed sum of its prefix, so with S set to 0 it is the same as #idxdBLAS_didsum_64() of x_0 through x_{i - 1} converted to double precision (and y_0 is 0). The result does not depend on the number of threads (see #idxdBLAS_didscan_64()). X and Y may be the same vector if incX = incY.
+ *
+ * Same as #idxdBLAS_didexscan(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, S and every element of Y are set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param S indexed scalar S
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didexscan_64(const int fold, const int64_t N, const double *X, const int64_t incX, double_indexed *S, double *Y, const int64_t incY){
+  didscan(fold, 1, N, X, incX, S, Y, incY);
+}
@@ -1,4 +1,27 @@
+#include <math.h>
+#include <stdlib.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+} didssq_args;
+
+static void didssq_kernel(void *args_, const int64_t i, const int n, void *Y){
+  didssq_args *args = (didssq_args*)args_;
+  double *scaleY = (double*)Y;
+  *scaleY = idxdBLAS_dmdssq_64(args->fold, n, args->X + i * args->incX, args->incX, 0.0, scaleY + 1, 1, scaleY + 1 + args->fold, 1);
+}
+
+static void didssq_combine(void *args_, void *partial, void *Y){
+  didssq_args *args = (didssq_args*)args_;
+  double *scaleX = (double*)partial;
+  double *scaleY = (double*)Y;
+  *scaleY = idxd_didiaddsq(args->fold, *scaleX, (double_indexed*)(scaleX + 1), *scaleY, (double_indexed*)(scaleY + 1));
+}
 
 /**
  * @brief Add to scaled indexed double precision Y the scaled sum of squares of elements of double precision vector X
@@ -17,5 +40,47 @@
  * @date   18 Jan 2016
  */
 double idxdBLAS_didssq(const int fold, const int N, const double *X, const int incX, const double scaleY, double_indexed *Y){
-  return idxdBLAS_dmdssq(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  return idxdBLAS_didssq_64(fold, N, X, incX, scaleY, Y);
+}
+
+/**
+ * @brief Add to scaled indexed double precision Y the scaled sum of squares of elements of double precision vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_dscale()
+ *
+ * Same as #idxdBLAS_didssq(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param Y indexed scalar Y
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_didssq_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double scaleY, double_indexed *Y){
+  didssq_args args;
+  double *scaleZ;
+  double scale;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return scaleY;
+  }
+  if(!idxdPool_parallel(N)){
+    return idxdBLAS_dmdssq_64(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  scaleZ = (double*)malloc(sizeof(double) + idxd_disize(fold));
+  *scaleZ = scaleY;
+  idxd_didiset(fold, Y, scaleZ + 1);
+  idxdPool_reduce(N, sizeof(double) + idxd_disize(fold), didssq_kernel, didssq_combine, &args, X, incX * (ptrdiff_t)sizeof(double), scaleZ);
+  idxd_didiset(fold, scaleZ + 1, Y);
+  scale = *scaleZ;
+  free(scaleZ);
+  return scale;
 }
@@ -0,0 +1,96 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+  double bound;
+} didsum_bounded_args;
+
+//add to Y the sum of X, updating Y with bound instead of the largest absolute value of each block
+static void didsum_bounded_chunks(const int fold, const int64_t N, const double *X, const int64_t incX, const double bound, double_indexed *Y){
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = idxdBLAS_chunk_64(N - i, incX, 1);
+    idxdBLAS_dmdsum_bounded(fold, n, X + i * incX, n > 1 ? (int)incX : 1, bound, Y, 1, Y + fold, 1);
+  }
+}
+
+static void didsum_bounded_kernel(void *args_, const int64_t i, const int n, void *Y){
+  didsum_bounded_args *args = (didsum_bounded_args*)args_;
+  didsum_bounded_chunks(args->fold, n, args->X + i * args->incX, args->incX, args->bound, (double_indexed*)Y);
+}
+
+static void didsum_bounded_combine(void *args_, void *partial, void *Y){
+  didsum_bounded_args *args = (didsum_bounded_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the sum of double precision vector X, given a bound on its elements
+ *
+ * Add to Y the indexed sum of X, updating Y with @c bound instead of computing the largest absolute value of X, so that X is read once.
+ *
+ * If @c bound is at least the absolute value of every element of X and #idxd_dindex() gives the same index for @c bound and the largest of them, Y is the same as that of #idxdBLAS_didsum(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_didsum() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didsum_bounded(const int fold, const int N, const double *X, const int incX, const double bound, double_indexed *Y){
+  idxdBLAS_didsum_bounded_64(fold, N, X, incX, bound, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the sum of double precision vector X, given a bound on its elements
+ *
+ * Add to Y the indexed sum of X, updating Y with @c bound instead of computing the largest absolute value of X, so that X is read once.
+ *
+ * If @c bound is at least the absolute value of every element of X and #idxd_dindex() gives the same index for @c bound and the largest of them, Y is the same as that of #idxdBLAS_didsum_64(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_didsum_64() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * Same as #idxdBLAS_didsum_bounded(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_didsum_bounded_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double bound, double_indexed *Y){
+  didsum_bounded_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(ISNANINF(bound) || (idxdBLAS_get_check_bounds() && idxdBLAS_dcheck_bound(bound, idxdBLAS_damax_64(N, X, incX)))){
+    idxdBLAS_didsum_64(fold, N, X, incX, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    didsum_bounded_chunks(fold, N, X, incX, bound, Y);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.bound = bound;
+  idxdPool_reduce(N, idxd_disize(fold), didsum_bounded_kernel, didsum_bounded_combine, &args, X, incX * (ptrdiff_t)sizeof(double), Y);
+}
@@ -0,0 +1,71 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const uint16_t *X;
+  int64_t incX;
+} dihasum_args;
+
+static void dihasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  dihasum_args *args = (dihasum_args*)args_;
+  idxdBLAS_dmhasum_64(args->fold, n, args->X + i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void dihasum_combine(void *args_, void *partial, void *Y){
+  dihasum_args *args = (dihasum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of half precision vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dihasum(const int fold, const int N, const uint16_t *X, const int incX, double_indexed *Y){
+  idxdBLAS_dihasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of half precision vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision.
+ *
+ * Same as #idxdBLAS_dihasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dihasum_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, double_indexed *Y){
+  dihasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmhasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), dihasum_kernel, dihasum_combine, &args, X, incX * (ptrdiff_t)sizeof(uint16_t), Y);
+}
@@ -0,0 +1,81 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const uint16_t *X;
+  int64_t incX;
+  const uint16_t *Y;
+  int64_t incY;
+} dihdot_args;
+
+static void dihdot_kernel(void *args_, const int64_t i, const int n, void *Z){
+  dihdot_args *args = (dihdot_args*)args_;
+  idxdBLAS_dmhdot_64(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, (double*)Z, 1, (double*)Z + args->fold, 1);
+}
+
+static void dihdot_combine(void *args_, void *partial, void *Z){
+  dihdot_args *args = (dihdot_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of half precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y half precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dihdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double_indexed *Z){
+  idxdBLAS_dihdot_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of half precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision.
+ *
+ * Same as #idxdBLAS_dihdot(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y half precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dihdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double_indexed *Z){
+  dihdot_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmhdot_64(fold, N, X, incX, Y, incY, Z, 1, Z + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_disize(fold), dihdot_kernel, dihdot_combine, &args, X, incX * (ptrdiff_t)sizeof(uint16_t), Z);
+}
@@ -0,0 +1,71 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} disasum_args;
+
+static void disasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  disasum_args *args = (disasum_args*)args_;
+  idxdBLAS_dmsasum_64(args->fold, n, args->X + i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void disasum_combine(void *args_, void *partial, void *Y){
+  disasum_args *args = (disasum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of single precision vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisasum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disasum(const int fold, const int N, const float *X, const int incX, double_indexed *Y){
+  idxdBLAS_disasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of single precision vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisasum().
+ *
+ * Same as #idxdBLAS_disasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, double_indexed *Y){
+  disasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmsasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), disasum_kernel, disasum_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Y);
+}
@@ -0,0 +1,81 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  const float *Y;
+  int64_t incY;
+} disdot_args;
+
+static void disdot_kernel(void *args_, const int64_t i, const int n, void *Z){
+  disdot_args *args = (disdot_args*)args_;
+  idxdBLAS_dmsdot_64(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, (double*)Z, 1, (double*)Z + args->fold, 1);
+}
+
+static void disdot_combine(void *args_, void *partial, void *Z){
+  disdot_args *args = (disdot_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisdot().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, double_indexed *Z){
+  idxdBLAS_disdot_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed double precision Z the dot product of single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisdot().
+ *
+ * Same as #idxdBLAS_disdot(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, double_indexed *Z){
+  disdot_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmsdot_64(fold, N, X, incX, Y, incY, Z, 1, Z + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_disize(fold), disdot_kernel, disdot_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Z);
+}
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define M_BLOCK 32
+#define N_BLOCK 32
+#define K_BLOCK 1024
+
+/**
+ * @brief Add to indexed double precision matrix C the matrix-matrix product of single precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha is a scalar, A and B are matrices with op(A) an M by K matrix and op(B) a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * Blocks of op(A) and op(B) are converted to double precision and accumulated with #idxdBLAS_didgemm(), so that the result is the same as that of #idxdBLAS_didgemm() on the converted A and B without converting all of A and B at once.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disgemm(const int fold, const char Order,
+                      const char TransA, const char TransB,
+                      const int M, const int N, const int K,
+                      const double alpha, const float *A, const int lda,
+                      const float *B, const int ldb,
+                      double_indexed *C, const int ldc){
+  idxdBLAS_disgemm_64(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, C, ldc);
+}
+
+//set the M by N matrix bufA (in ordering Order, not transposed) to the block of op(A) at row i and column j
+static void disgemm_widen(const char Order, const char TransA, const int64_t i, const int64_t j, const int64_t M, const int64_t N, const float *A, const int64_t lda, double *bufA){
+  int64_t ii;
+  int64_t jj;
+  int row = (Order == 'r' || Order == 'R');
+  int trans = !(TransA == 'n' || TransA == 'N');
+
+  if(row != trans){
+    //rows of op(A) are contiguous
+    for(ii = 0; ii < M; ii++){
+      for(jj = 0; jj < N; jj++){
+        bufA[row ? ii * N + jj : jj * M + ii] = A[(i + ii) * lda + j + jj];
+      }
+    }
+  }else{
+    //columns of op(A) are contiguous
+    for(jj = 0; jj < N; jj++){
+      for(ii = 0; ii < M; ii++){
+        bufA[row ? ii * N + jj : jj * M + ii] = A[(j + jj) * lda + i + ii];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Add to indexed double precision matrix C the matrix-matrix product of single precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha is a scalar, A and B are matrices with op(A) an M by K matrix and op(B) a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * Blocks of op(A) and op(B) are converted to double precision and accumulated with #idxdBLAS_didgemm(), so that the result is the same as that of #idxdBLAS_didgemm() on the converted A and B without converting all of A and B at once.
+ *
+ * Same as #idxdBLAS_disgemm(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disgemm_64(const int fold, const char Order,
+                         const char TransA, const char TransB,
+                         const int64_t M, const int64_t N, const int64_t K,
+                         const double alpha, const float *A, const int64_t lda,
+                         const float *B, const int64_t ldb,
+                         double_indexed *C, const int64_t ldc){
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  int64_t m;
+  int64_t n;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+  double *bufA;
+  double *bufB;
+
+  if(M == 0 || N == 0 || K == 0 || alpha == 0.0){
+    return;
+  }
+
+  bufA = (double*)malloc(M_BLOCK * K_BLOCK * sizeof(double));
+  bufB = (double*)malloc(K_BLOCK * N_BLOCK * sizeof(double));
+  for(k = 0; k < K; k += K_BLOCK){
+    l = MIN(K_BLOCK, K - k);
+    for(j = 0; j < N; j += N_BLOCK){
+      n = MIN(N_BLOCK, N - j);
+      disgemm_widen(Order, TransB, k, j, l, n, B, ldb, bufB);
+      for(i = 0; i < M; i += M_BLOCK){
+        m = MIN(M_BLOCK, M - i);
+        disgemm_widen(Order, TransA, i, k, m, l, A, lda, bufA);
+        idxdBLAS_didgemm_64(fold, Order, 'n', 'n', m, n, l, alpha, bufA, row ? l : m, bufB, row ? n : l, C + (row ? i * ldc + j : j * ldc + i) * idxd_dinum(fold), ldc);
+      }
+    }
+  }
+  free(bufA);
+  free(bufB);
+}
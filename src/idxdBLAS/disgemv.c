@@ -0,0 +1,137 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define A_BLOCK 32768
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * A and X are converted to double precision in blocks and accumulated with #idxdBLAS_didgemv(), so that the result is the same as that of #idxdBLAS_didgemv() on the converted A and X without converting all of A at once.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disgemv(const int fold, const char Order,
+                      const char TransA, const int M, const int N,
+                      const double alpha, const float *A, const int lda,
+                      const float *X, const int incX,
+                      double_indexed *Y, const int incY){
+  idxdBLAS_disgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed double precision vector Y the matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * A and X are converted to double precision in blocks and accumulated with #idxdBLAS_didgemv(), so that the result is the same as that of #idxdBLAS_didgemv() on the converted A and X without converting all of A at once.
+ *
+ * Same as #idxdBLAS_disgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_disgemv_64(const int fold, const char Order,
+                         const char TransA, const int64_t M, const int64_t N,
+                         const double alpha, const float *A, const int64_t lda,
+                         const float *X, const int64_t incX,
+                         double_indexed *Y, const int64_t incY){
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t opM;
+  int64_t opN;
+  int64_t m;
+  int64_t n;
+  int64_t mb;
+  int64_t nb;
+  int rows;
+  double *bufX;
+  double *bufA;
+
+  if(M == 0 || N == 0 || alpha == 0.0){
+    return;
+  }
+
+  //op(A) is opM by opN, and its rows are contiguous in A if rows is set
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opM = M;
+      opN = N;
+      rows = (Order == 'r' || Order == 'R');
+      break;
+    default:
+      opM = N;
+      opN = M;
+      rows = !(Order == 'r' || Order == 'R');
+      break;
+  }
+
+  bufX = (double*)malloc(opN * sizeof(double));
+  for(j = 0; j < opN; j++){
+    bufX[j] = X[j * incX];
+  }
+  nb = MIN(opN, A_BLOCK);
+  mb = MIN(opM, A_BLOCK / nb);
+  bufA = (double*)malloc(mb * nb * sizeof(double));
+  for(i = 0; i < opM; i += mb){
+    m = MIN(mb, opM - i);
+    for(j = 0; j < opN; j += nb){
+      n = MIN(nb, opN - j);
+      if(rows){
+        for(ii = 0; ii < m; ii++){
+          for(jj = 0; jj < n; jj++){
+            bufA[ii * n + jj] = A[(i + ii) * lda + j + jj];
+          }
+        }
+      }else{
+        for(jj = 0; jj < n; jj++){
+          for(ii = 0; ii < m; ii++){
+            bufA[ii * n + jj] = A[(j + jj) * lda + i + ii];
+          }
+        }
+      }
+      idxdBLAS_didgemv_64(fold, 'r', 'n', m, n, alpha, bufA, n, bufX + j, 1, Y + i * incY * idxd_dinum(fold), incY);
+    }
+  }
+  free(bufA);
+  free(bufX);
+}
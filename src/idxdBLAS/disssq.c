@@ -0,0 +1,89 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} disssq_args;
+
+static void disssq_kernel(void *args_, const int64_t i, const int n, void *Y){
+  disssq_args *args = (disssq_args*)args_;
+  double *scaleY = (double*)Y;
+  *scaleY = idxdBLAS_dmsssq_64(args->fold, n, args->X + i * args->incX, args->incX, 0.0, scaleY + 1, 1, scaleY + 1 + args->fold, 1);
+}
+
+static void disssq_combine(void *args_, void *partial, void *Y){
+  disssq_args *args = (disssq_args*)args_;
+  double *scaleX = (double*)partial;
+  double *scaleY = (double*)Y;
+  *scaleY = idxd_didiaddsq(args->fold, *scaleX, (double_indexed*)(scaleX + 1), *scaleY, (double_indexed*)(scaleY + 1));
+}
+
+/**
+ * @brief Add to scaled indexed double precision Y the scaled sum of squares of elements of single precision vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_dscale()
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisssq().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param Y indexed scalar Y
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_disssq(const int fold, const int N, const float *X, const int incX, const double scaleY, double_indexed *Y){
+  return idxdBLAS_disssq_64(fold, N, X, incX, scaleY, Y);
+}
+
+/**
+ * @brief Add to scaled indexed double precision Y the scaled sum of squares of elements of single precision vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_dscale()
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_sisssq().
+ *
+ * Same as #idxdBLAS_disssq(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param Y indexed scalar Y
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_disssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const double scaleY, double_indexed *Y){
+  disssq_args args;
+  double *scaleZ;
+  double scale;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return scaleY;
+  }
+  if(!idxdPool_parallel(N)){
+    return idxdBLAS_dmsssq_64(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  scaleZ = (double*)malloc(sizeof(double) + idxd_disize(fold));
+  *scaleZ = scaleY;
+  idxd_didiset(fold, Y, scaleZ + 1);
+  idxdPool_reduce(N, sizeof(double) + idxd_disize(fold), disssq_kernel, disssq_combine, &args, X, incX * (ptrdiff_t)sizeof(float), scaleZ);
+  idxd_didiset(fold, scaleZ + 1, Y);
+  scale = *scaleZ;
+  free(scaleZ);
+  return scale;
+}
@@ -1,4 +1,23 @@
+#include <math.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+} dizasum_args;
+
+static void dizasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  dizasum_args *args = (dizasum_args*)args_;
+  idxdBLAS_dmzasum_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, (double*)Y, 1, (double*)Y + args->fold, 1);
+}
+
+static void dizasum_combine(void *args_, void *partial, void *Y){
+  dizasum_args *args = (dizasum_args*)args_;
+  idxd_didiadd(args->fold, (double_indexed*)partial, (double_indexed*)Y);
+}
 
 /**
  * @brief Add to indexed double precision Y the absolute sum of complex double precision vector X
@@ -15,5 +34,37 @@
  * @date   15 Jan 2016
  */
 void idxdBLAS_dizasum(const int fold, const int N, const void *X, const int incX, double_indexed *Y){
-  idxdBLAS_dmzasum(fold, N, X, incX, Y, 1, Y + fold, 1);
+  idxdBLAS_dizasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed double precision Y the absolute sum of complex double precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * Same as #idxdBLAS_dizasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dizasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_indexed *Y){
+  dizasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_dmzasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const double*)X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_disize(fold), dizasum_kernel, dizasum_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(double), Y);
 }
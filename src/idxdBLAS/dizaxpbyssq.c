@@ -0,0 +1,160 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  double alpha[2];
+  const double *X;
+  int64_t incX;
+  double beta[2];
+  double *Y;
+  int64_t incY;
+} dizaxpbyssq_args;
+
+//set Y := alpha * X + beta * Y and add to scaled Z the scaled sum of squares of the updated Y, a block at a time, so that each block of Y is summed while it is still in cache. Returns the new scaling factor of Z.
+static double dizaxpbyssq_blocks(const int fold, const int64_t N, const double *alpha, const double *X, const int64_t incX, const double *beta, double *Y, const int64_t incY, double scaleZ, double_indexed *Z){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+  double re;
+  double im;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    if(beta[0] == 0.0 && beta[1] == 0.0){
+      for(j = i; j < i + n; j++){
+        re = alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1];
+        im = alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX];
+        Y[2 * j * incY] = re;
+        Y[2 * j * incY + 1] = im;
+      }
+    }else if(beta[0] == 1.0 && beta[1] == 0.0){
+      for(j = i; j < i + n; j++){
+        re = alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1];
+        im = alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX];
+        Y[2 * j * incY] = re + Y[2 * j * incY];
+        Y[2 * j * incY + 1] = im + Y[2 * j * incY + 1];
+      }
+    }else{
+      for(j = i; j < i + n; j++){
+        re = (alpha[0] * X[2 * j * incX] - alpha[1] * X[2 * j * incX + 1]) + (beta[0] * Y[2 * j * incY] - beta[1] * Y[2 * j * incY + 1]);
+        im = (alpha[0] * X[2 * j * incX + 1] + alpha[1] * X[2 * j * incX]) + (beta[0] * Y[2 * j * incY + 1] + beta[1] * Y[2 * j * incY]);
+        Y[2 * j * incY] = re;
+        Y[2 * j * incY + 1] = im;
+      }
+    }
+    scaleZ = idxdBLAS_dmzssq_64(fold, n, Y + 2 * i * incY, incY, scaleZ, Z, 1, Z + fold, 1);
+  }
+  return scaleZ;
+}
+
+static void dizaxpbyssq_kernel(void *args_, const int64_t i, const int n, void *Z){
+  dizaxpbyssq_args *args = (dizaxpbyssq_args*)args_;
+  double *scaleZ = (double*)Z;
+  *scaleZ = dizaxpbyssq_blocks(args->fold, n, args->alpha, args->X + 2 * i * args->incX, args->incX, args->beta, args->Y + 2 * i * args->incY, args->incY, 0.0, (double_indexed*)(scaleZ + 1));
+}
+
+static void dizaxpbyssq_combine(void *args_, void *partial, void *Z){
+  dizaxpbyssq_args *args = (dizaxpbyssq_args*)args_;
+  double *scaleX = (double*)partial;
+  double *scaleZ = (double*)Z;
+  *scaleZ = idxd_didiaddsq(args->fold, *scaleX, (double_indexed*)(scaleX + 1), *scaleZ, (double_indexed*)(scaleZ + 1));
+}
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and add the scaled sum of squares of the updated Y to scaled indexed double precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of the real and imaginary parts of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_dizssq() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_dizaxpbyssq(const int fold, const int N, const void *alpha, const void *X, const int incX,
+                            const void *beta, void *Y, const int incY, const double scaleZ, double_indexed *Z){
+  return idxdBLAS_dizaxpbyssq_64(fold, N, alpha, X, incX, beta, Y, incY, scaleZ, Z);
+}
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and add the scaled sum of squares of the updated Y to scaled indexed double precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of the real and imaginary parts of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_dizssq_64() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_dizaxpbyssq(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is left unchanged and Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_dizaxpbyssq_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                               const void *beta, void *Y, const int64_t incY, const double scaleZ, double_indexed *Z){
+  dizaxpbyssq_args args;
+  double *scaleT;
+  double scale;
+
+  if(N <= 0){
+    return scaleZ;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    idxd_didadd(fold, NAN, Z);
+    return scaleZ;
+  }
+  args.fold = fold;
+  args.alpha[0] = ((const double*)alpha)[0];
+  args.alpha[1] = ((const double*)alpha)[1];
+  args.X = (const double*)X;
+  args.incX = incX;
+  args.beta[0] = ((const double*)beta)[0];
+  args.beta[1] = ((const double*)beta)[1];
+  args.Y = (double*)Y;
+  args.incY = incY;
+  if(!idxdPool_parallel(N)){
+    return dizaxpbyssq_blocks(fold, N, args.alpha, args.X, incX, args.beta, args.Y, incY, scaleZ, Z);
+  }
+  scaleT = (double*)malloc(sizeof(double) + idxd_disize(fold));
+  *scaleT = scaleZ;
+  idxd_didiset(fold, Z, scaleT + 1);
+  idxdPool_reduce(N, sizeof(double) + idxd_disize(fold), dizaxpbyssq_kernel, dizaxpbyssq_combine, &args, Y, 2 * incY * (ptrdiff_t)sizeof(double), scaleT);
+  idxd_didiset(fold, scaleT + 1, Z);
+  scale = *scaleT;
+  free(scaleT);
+  return scale;
+}
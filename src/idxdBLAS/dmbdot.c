@@ -0,0 +1,64 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Z the dot product of bfloat16 vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmddot().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y bfloat16 vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param priZ Z's primary vector
+ * @param incpriZ stride within Z's primary vector (use every incpriZ'th element)
+ * @param carZ Z's carry vector
+ * @param inccarZ stride within Z's carry vector (use every inccarZ'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmbdot(const int fold, const int N, const uint16_t *X, const int incX, const uint16_t *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ){
+  idxdBLAS_dmbdot_64(fold, N, X, incX, Y, incY, priZ, incpriZ, carZ, inccarZ);
+}
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Z the dot product of bfloat16 vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmddot().
+ *
+ * Same as #idxdBLAS_dmbdot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y bfloat16 vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param priZ Z's primary vector
+ * @param incpriZ stride within Z's primary vector (use every incpriZ'th element)
+ * @param carZ Z's carry vector
+ * @param inccarZ stride within Z's carry vector (use every inccarZ'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmbdot_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const uint16_t *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ){
+  double W[idxdBLAS_WIDEN_BLOCK];
+  double V[idxdBLAS_WIDEN_BLOCK];
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = (int)MIN(N - i, idxdBLAS_WIDEN_BLOCK);
+    idxdBLAS_dbwiden(n, X + i * incX, incX, W);
+    idxdBLAS_dbwiden(n, Y + i * incY, incY, V);
+    idxdBLAS_dmddot(fold, n, W, 1, V, 1, priZ, incpriZ, carZ, inccarZ);
+  }
+}
@@ -0,0 +1,64 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @internal
+ * @brief Add to scaled manually specified indexed double precision Y the scaled sum of squares of elements of bfloat16 vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_dscale()
+ *
+ * X is converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmdssq().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_dmbssq(const int fold, const int N, const uint16_t *X, const int incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY){
+  return idxdBLAS_dmbssq_64(fold, N, X, incX, scaleY, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief Add to scaled manually specified indexed double precision Y the scaled sum of squares of elements of bfloat16 vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_dscale()
+ *
+ * X is converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmdssq().
+ *
+ * Same as #idxdBLAS_dmbssq(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+double idxdBLAS_dmbssq_64(const int fold, const int64_t N, const uint16_t *X, const int64_t incX, const double scaleY, double *priY, const int incpriY, double *carY, const int inccarY){
+  double W[idxdBLAS_WIDEN_BLOCK];
+  double scale = scaleY;
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = (int)MIN(N - i, idxdBLAS_WIDEN_BLOCK);
+    idxdBLAS_dbwiden(n, X + i * incX, incX, W);
+    scale = idxdBLAS_dmdssq(fold, n, W, 1, scale, priY, incpriY, carY, inccarY);
+  }
+  return scale;
+}
@@ -0,0 +1,58 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Y the absolute sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * X is converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmzasum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmcasum(const int fold, const int N, const void *X, const int incX, double *priY, const int incpriY, double *carY, const int inccarY){
+  idxdBLAS_dmcasum_64(fold, N, X, incX, priY, incpriY, carY, inccarY);
+}
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Y the absolute sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * X is converted to double precision in blocks of #idxdBLAS_WIDEN_BLOCK values, each of which is deposited with #idxdBLAS_dmzasum().
+ *
+ * Same as #idxdBLAS_dmcasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param priY Y's primary vector
+ * @param incpriY stride within Y's primary vector (use every incpriY'th element)
+ * @param carY Y's carry vector
+ * @param inccarY stride within Y's carry vector (use every inccarY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmcasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double *priY, const int incpriY, double *carY, const int inccarY){
+  double W[idxdBLAS_WIDEN_BLOCK];
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = (int)MIN(N - i, idxdBLAS_WIDEN_BLOCK / 2);
+    idxdBLAS_zcwiden(n, (const float*)X + 2 * i * incX, incX, W);
+    idxdBLAS_dmzasum(fold, n, W, 1, priY, incpriY, carY, inccarY);
+  }
+}
@@ -0,0 +1,62 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Z the dot product of double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * The products are split with #idxdBLAS_dtwoprod() into their rounded values and rounding errors, all of which are deposited with #idxdBLAS_dmdsum(). Z therefore receives the indexed sum of the exact products, unless they underflow.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param priZ Z's primary vector
+ * @param incpriZ stride within Z's primary vector (use every incpriZ'th element)
+ * @param carZ Z's carry vector
+ * @param inccarZ stride within Z's carry vector (use every inccarZ'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmddot_fma(const int fold, const int N, const double *X, const int incX, const double *Y, const int incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ){
+  idxdBLAS_dmddot_fma_64(fold, N, X, incX, Y, incY, priZ, incpriZ, carZ, inccarZ);
+}
+
+/**
+ * @internal
+ * @brief Add to manually specified indexed double precision Z the dot product of double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * The products are split with #idxdBLAS_dtwoprod() into their rounded values and rounding errors, all of which are deposited with #idxdBLAS_dmdsum(). Z therefore receives the indexed sum of the exact products, unless they underflow.
+ *
+ * Same as #idxdBLAS_dmddot_fma(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param priZ Z's primary vector
+ * @param incpriZ stride within Z's primary vector (use every incpriZ'th element)
+ * @param carZ Z's carry vector
+ * @param inccarZ stride within Z's carry vector (use every inccarZ'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dmddot_fma_64(const int fold, const int64_t N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double *priZ, const int incpriZ, double *carZ, const int inccarZ){
+  double W[idxdBLAS_WIDEN_BLOCK];
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = (int)MIN(N - i, idxdBLAS_WIDEN_BLOCK / 2);
+    idxdBLAS_dtwoprod(n, X + i * incX, incX, Y + i * incY, incY, W);
+    idxdBLAS_dmdsum(fold, 2 * n, W, 1, priZ, incpriZ, carZ, inccarZ);
+  }
+}
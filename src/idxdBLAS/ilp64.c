@@ -0,0 +1,41 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @internal
+ * @brief Get the number of elements that a 64-bit routine passes to the corresponding 32-bit routine at once
+ *
+ * The 64-bit routines run the 32-bit routines on consecutive chunks of their vectors. Chunks hold at most #idxdBLAS_CHUNK_64 elements, and at most as many as keep the offset of every element (its index times the larger stride in magnitude) within #idxdBLAS_MAXOFFSET_64, so that no index or offset in the 32-bit routines overflows an @c int. Only a stride larger in magnitude than #idxdBLAS_MAXOFFSET_64 gives chunks of one element, which are passed with stride 1.
+ *
+ * @param N the number of remaining elements (positive)
+ * @param incX the stride of the first vector
+ * @param incY the stride of the second vector (1 if there is none)
+ * @return the number of elements in the next chunk
+ *
+ * @date   18 Oct 2026
+ */
+int idxdBLAS_chunk_64(const int64_t N, const int64_t incX, const int64_t incY){
+  int64_t inc = MAX(incX < 0 ? -incX : incX, incY < 0 ? -incY : incY);
+  int64_t n = N < idxdBLAS_CHUNK_64 ? N : idxdBLAS_CHUNK_64;
+
+  if(inc > 0 && n > idxdBLAS_MAXOFFSET_64 / inc){
+    n = idxdBLAS_MAXOFFSET_64 / inc;
+  }
+  return n > 1 ? (int)n : 1;
+}
+
+/**
+ * @internal
+ * @brief Check that a 64-bit number of elements can be summed with an indexed type
+ *
+ * Checks @c N against @c capacity (#idxd_DICAPACITY or #idxd_SICAPACITY), the number of elements that can be summed with the indexed type before its carries lose precision. Such a sum would no longer be accurate or reproducible, so callers set their indexed outputs to NaN instead. Only the elements of the current call are counted, not those already accumulated in the output.
+ *
+ * @param N the number of elements
+ * @param capacity the capacity of the indexed type
+ * @return 0 if @c N elements can be summed, nonzero otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdBLAS_capacity_64(const int64_t N, const double capacity){
+  return (double)N > capacity;
+}
@@ -0,0 +1,96 @@
+#include "../config.h"
+#include "idxdBLAS.h"
+
+#if (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#endif
+
+/**
+ * @brief Split complex double precision vector X into contiguous vectors of its real and imaginary parts
+ *
+ * Packs interleaved complex data into the planar layout taken by idxdBLAS_zizgemv_planar() and idxdBLAS_zizgemm_planar(). Contiguous vectors are split with AVX or SSE2 when available.
+ *
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param XR double precision vector (output, with room for N elements)
+ * @param XI double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zdeinterleave(const int N, const void *X, const int incX, double *XR, double *XI){
+  idxdBLAS_zdeinterleave_64(N, X, incX, XR, XI);
+}
+
+/**
+ * @brief Split complex double precision vector X into contiguous vectors of its real and imaginary parts
+ *
+ * Packs interleaved complex data into the planar layout taken by idxdBLAS_zizgemv_planar() and idxdBLAS_zizgemm_planar(). Contiguous vectors are split with AVX or SSE2 when available.
+ *
+ * Same as #idxdBLAS_zdeinterleave(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param XR double precision vector (output, with room for N elements)
+ * @param XI double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zdeinterleave_64(const int64_t N, const void *X, const int64_t incX, double *XR, double *XI){
+  const double *x = (const double*)X;
+  int64_t i = 0;
+
+  if(incX == 1){
+    #if (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+      for(; i + 4 <= N; i += 4){
+        __m256d x_0 = _mm256_loadu_pd(x + 2 * i);
+        __m256d x_1 = _mm256_loadu_pd(x + 2 * i + 4);
+        __m256d lo = _mm256_permute2f128_pd(x_0, x_1, 0x20);
+        __m256d hi = _mm256_permute2f128_pd(x_0, x_1, 0x31);
+        _mm256_storeu_pd(XR + i, _mm256_unpacklo_pd(lo, hi));
+        _mm256_storeu_pd(XI + i, _mm256_unpackhi_pd(lo, hi));
+      }
+    #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+      for(; i + 2 <= N; i += 2){
+        __m128d x_0 = _mm_loadu_pd(x + 2 * i);
+        __m128d x_1 = _mm_loadu_pd(x + 2 * i + 2);
+        _mm_storeu_pd(XR + i, _mm_unpacklo_pd(x_0, x_1));
+        _mm_storeu_pd(XI + i, _mm_unpackhi_pd(x_0, x_1));
+      }
+    #endif
+  }
+  for(; i < N; i++){
+    XR[i] = x[2 * i * incX];
+    XI[i] = x[2 * i * incX + 1];
+  }
+}
+
+/**
+ * @internal
+ * @brief Add to indexed complex double precision Z the sums of two pairs of real dot products
+ *
+ * Adds XR.Y0 + XI.Y1 to the real part of Z and XR.Y2 + XI.Y3 to its imaginary part, where all vectors are contiguous. Each real and imaginary part of an indexed complex type is an indexed real type with stride 2, so the products are deposited with idxdBLAS_dmddot(). Given planes holding the real and imaginary parts of x and y (with signs set as needed for negation and conjugation), the result is the same as that of idxdBLAS_zizdotu() or idxdBLAS_zizdotc() on the interleaved vectors.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param XR double precision vector
+ * @param XI double precision vector
+ * @param Y0 double precision vector
+ * @param Y1 double precision vector
+ * @param Y2 double precision vector
+ * @param Y3 double precision vector
+ * @param Z indexed complex double precision scalar
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizdot_planar(const int fold, const int N, const double *XR, const double *XI, const double *Y0, const double *Y1, const double *Y2, const double *Y3, double_complex_indexed *Z){
+  idxdBLAS_dmddot(fold, N, XR, 1, Y0, 1, Z, 2, Z + 2 * fold, 2);
+  idxdBLAS_dmddot(fold, N, XI, 1, Y1, 1, Z, 2, Z + 2 * fold, 2);
+  idxdBLAS_dmddot(fold, N, XR, 1, Y2, 1, Z + 1, 2, Z + 2 * fold + 1, 2);
+  idxdBLAS_dmddot(fold, N, XI, 1, Y3, 1, Z + 1, 2, Z + 2 * fold + 1, 2);
+}
@@ -1,4 +1,23 @@
+#include <math.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} sicasum_args;
+
+static void sicasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sicasum_args *args = (sicasum_args*)args_;
+  idxdBLAS_smcasum_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, (float*)Y, 1, (float*)Y + args->fold, 1);
+}
+
+static void sicasum_combine(void *args_, void *partial, void *Y){
+  sicasum_args *args = (sicasum_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Y);
+}
 
 /**
  * @brief Add to indexed single precision Y the absolute sum of complex single precision vector X
@@ -15,5 +34,37 @@
  * @date   15 Jan 2016
  */
 void idxdBLAS_sicasum(const int fold, const int N, const void *X, const int incX, float_indexed *Y){
-  idxdBLAS_smcasum(fold, N, X, incX, Y, 1, Y + fold, 1);
+  idxdBLAS_sicasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed single precision Y the absolute sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of magnitudes of elements of X.
+ *
+ * Same as #idxdBLAS_sicasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sicasum_64(const int fold, const int64_t N, const void *X, const int64_t incX, float_indexed *Y){
+  sicasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_smcasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_sisize(fold), sicasum_kernel, sicasum_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Y);
 }
@@ -1,4 +1,27 @@
+#include <math.h>
+#include <stdlib.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} sicssq_args;
+
+static void sicssq_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sicssq_args *args = (sicssq_args*)args_;
+  float *scaleY = (float*)Y;
+  *scaleY = idxdBLAS_smcssq_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, 0.0, scaleY + 1, 1, scaleY + 1 + args->fold, 1);
+}
+
+static void sicssq_combine(void *args_, void *partial, void *Y){
+  sicssq_args *args = (sicssq_args*)args_;
+  float *scaleX = (float*)partial;
+  float *scaleY = (float*)Y;
+  *scaleY = idxd_sisiaddsq(args->fold, *scaleX, (float_indexed*)(scaleX + 1), *scaleY, (float_indexed*)(scaleY + 1));
+}
 
 /**
  * @brief Add to scaled indexed single precision Y the scaled sum of squares of elements of complex single precision vector X
@@ -17,5 +40,47 @@
  * @date   18 Jan 2016
  */
 float idxdBLAS_sicssq(const int fold, const int N, const void *X, const int incX, const float scaleY, float_indexed *Y){
-  return idxdBLAS_smcssq(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  return idxdBLAS_sicssq_64(fold, N, X, incX, scaleY, Y);
+}
+
+/**
+ * @brief Add to scaled indexed single precision Y the scaled sum of squares of elements of complex single precision vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_sscale()
+ *
+ * Same as #idxdBLAS_sicssq(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param Y indexed scalar Y
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+float idxdBLAS_sicssq_64(const int fold, const int64_t N, const void *X, const int64_t incX, const float scaleY, float_indexed *Y){
+  sicssq_args args;
+  float *scaleZ;
+  float scale;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Y);
+    return scaleY;
+  }
+  if(!idxdPool_parallel(N)){
+    return idxdBLAS_smcssq_64(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  scaleZ = (float*)malloc(sizeof(float) + idxd_sisize(fold));
+  *scaleZ = scaleY;
+  idxd_sisiset(fold, Y, scaleZ + 1);
+  idxdPool_reduce(N, sizeof(float) + idxd_sisize(fold), sicssq_kernel, sicssq_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), scaleZ);
+  idxd_sisiset(fold, scaleZ + 1, Y);
+  scale = *scaleZ;
+  free(scaleZ);
+  return scale;
 }
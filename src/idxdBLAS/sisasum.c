@@ -1,4 +1,23 @@
+#include <math.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} sisasum_args;
+
+static void sisasum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sisasum_args *args = (sisasum_args*)args_;
+  idxdBLAS_smsasum_64(args->fold, n, args->X + i * args->incX, args->incX, (float*)Y, 1, (float*)Y + args->fold, 1);
+}
+
+static void sisasum_combine(void *args_, void *partial, void *Y){
+  sisasum_args *args = (sisasum_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Y);
+}
 
 /**
  * @brief Add to indexed single precision Y the absolute sum of single precision vector X
@@ -14,5 +33,36 @@
  * @date   15 Jan 2016
  */
 void idxdBLAS_sisasum(const int fold, const int N, const float *X, const int incX, float_indexed *Y){
-  idxdBLAS_smsasum(fold, N, X, incX, Y, 1, Y + fold, 1);
+  idxdBLAS_sisasum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed single precision Y the absolute sum of single precision vector X
+ *
+ * Add to Y the indexed sum of absolute values of elements in X.
+ *
+ * Same as #idxdBLAS_sisasum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisasum_64(const int fold, const int64_t N, const float *X, const int64_t incX, float_indexed *Y){
+  sisasum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_smsasum_64(fold, N, X, incX, Y, 1, Y + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_sisize(fold), sisasum_kernel, sisasum_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Y);
 }
@@ -0,0 +1,96 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  float bound;
+} sisasum_bounded_args;
+
+//add to Y the absolute sum of X, updating Y with bound instead of the largest absolute value of each block
+static void sisasum_bounded_chunks(const int fold, const int64_t N, const float *X, const int64_t incX, const float bound, float_indexed *Y){
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = idxdBLAS_chunk_64(N - i, incX, 1);
+    idxdBLAS_smsasum_bounded(fold, n, X + i * incX, n > 1 ? (int)incX : 1, bound, Y, 1, Y + fold, 1);
+  }
+}
+
+static void sisasum_bounded_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sisasum_bounded_args *args = (sisasum_bounded_args*)args_;
+  sisasum_bounded_chunks(args->fold, n, args->X + i * args->incX, args->incX, args->bound, (float_indexed*)Y);
+}
+
+static void sisasum_bounded_combine(void *args_, void *partial, void *Y){
+  sisasum_bounded_args *args = (sisasum_bounded_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed single precision Y the absolute sum of single precision vector X, given a bound on its elements
+ *
+ * Add to Y the indexed sum of absolute values of elements in X, updating Y with @c bound instead of computing the largest absolute value of X, so that X is read once.
+ *
+ * If @c bound is at least the absolute value of every element of X and #idxd_sindex() gives the same index for @c bound and the largest of them, Y is the same as that of #idxdBLAS_sisasum(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_sisasum() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisasum_bounded(const int fold, const int N, const float *X, const int incX, const float bound, float_indexed *Y){
+  idxdBLAS_sisasum_bounded_64(fold, N, X, incX, bound, Y);
+}
+
+/**
+ * @brief Add to indexed single precision Y the absolute sum of single precision vector X, given a bound on its elements
+ *
+ * Add to Y the indexed sum of absolute values of elements in X, updating Y with @c bound instead of computing the largest absolute value of X, so that X is read once.
+ *
+ * If @c bound is at least the absolute value of every element of X and #idxd_sindex() gives the same index for @c bound and the largest of them, Y is the same as that of #idxdBLAS_sisasum_64(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_sisasum_64() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * Same as #idxdBLAS_sisasum_bounded(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisasum_bounded_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float bound, float_indexed *Y){
+  sisasum_bounded_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Y);
+    return;
+  }
+  if(ISNANINFF(bound) || (idxdBLAS_get_check_bounds() && idxdBLAS_scheck_bound(bound, idxdBLAS_samax_64(N, X, incX)))){
+    idxdBLAS_sisasum_64(fold, N, X, incX, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    sisasum_bounded_chunks(fold, N, X, incX, bound, Y);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.bound = bound;
+  idxdPool_reduce(N, idxd_sisize(fold), sisasum_bounded_kernel, sisasum_bounded_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Y);
+}
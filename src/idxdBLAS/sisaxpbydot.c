@@ -0,0 +1,140 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  float alpha;
+  const float *X;
+  int64_t incX;
+  float beta;
+  float *Y;
+  int64_t incY;
+  const float *W;
+  int64_t incW;
+} sisaxpbydot_args;
+
+//set Y := alpha * X + beta * Y and add to Z the dot product of W and the updated Y, a block at a time, so that each block of Y is summed while it is still in cache
+static void sisaxpbydot_blocks(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX, const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW, float_indexed *Z){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    if(beta == 0.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX];
+      }
+    }else if(beta == 1.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + Y[j * incY];
+      }
+    }else{
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + beta * Y[j * incY];
+      }
+    }
+    idxdBLAS_smsdot_64(fold, n, W + i * incW, incW, Y + i * incY, incY, Z, 1, Z + fold, 1);
+  }
+}
+
+static void sisaxpbydot_kernel(void *args_, const int64_t i, const int n, void *Z){
+  sisaxpbydot_args *args = (sisaxpbydot_args*)args_;
+  sisaxpbydot_blocks(args->fold, n, args->alpha, args->X + i * args->incX, args->incX, args->beta, args->Y + i * args->incY, args->incY, args->W + i * args->incW, args->incW, (float_indexed*)Z);
+}
+
+static void sisaxpbydot_combine(void *args_, void *partial, void *Z){
+  sisaxpbydot_args *args = (sisaxpbydot_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Z);
+}
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and add the dot product of single precision vector W and the updated Y to indexed single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the indexed sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z is the same as that of #idxdBLAS_sisdot() applied to W and the updated Y, and does not depend on the number of threads. W may be Y itself, in which case Z is the sum of squares of the updated Y.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisaxpbydot(const int fold, const int N, const float alpha, const float *X, const int incX,
+                          const float beta, float *Y, const int incY, const float *W, const int incW,
+                          float_indexed *Z){
+  idxdBLAS_sisaxpbydot_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW, Z);
+}
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and add the dot product of single precision vector W and the updated Y to indexed single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the indexed sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z is the same as that of #idxdBLAS_sisdot_64() applied to W and the updated Y, and does not depend on the number of threads. W may be Y itself, in which case Z is the sum of squares of the updated Y.
+ *
+ * Same as #idxdBLAS_sisaxpbydot(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is left unchanged and Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisaxpbydot_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+                             const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW,
+                             float_indexed *Z){
+  sisaxpbydot_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    sisaxpbydot_blocks(fold, N, alpha, X, incX, beta, Y, incY, W, incW, Z);
+    return;
+  }
+  args.fold = fold;
+  args.alpha = alpha;
+  args.X = X;
+  args.incX = incX;
+  args.beta = beta;
+  args.Y = Y;
+  args.incY = incY;
+  args.W = W;
+  args.incW = incW;
+  idxdPool_reduce(N, idxd_sisize(fold), sisaxpbydot_kernel, sisaxpbydot_combine, &args, Y, incY * (ptrdiff_t)sizeof(float), Z);
+}
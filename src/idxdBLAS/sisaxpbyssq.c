@@ -0,0 +1,147 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  float alpha;
+  const float *X;
+  int64_t incX;
+  float beta;
+  float *Y;
+  int64_t incY;
+} sisaxpbyssq_args;
+
+//set Y := alpha * X + beta * Y and add to scaled Z the scaled sum of squares of the updated Y, a block at a time, so that each block of Y is summed while it is still in cache. Returns the new scaling factor of Z.
+static float sisaxpbyssq_blocks(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX, const float beta, float *Y, const int64_t incY, float scaleZ, float_indexed *Z){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    if(beta == 0.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX];
+      }
+    }else if(beta == 1.0){
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + Y[j * incY];
+      }
+    }else{
+      for(j = i; j < i + n; j++){
+        Y[j * incY] = alpha * X[j * incX] + beta * Y[j * incY];
+      }
+    }
+    scaleZ = idxdBLAS_smsssq_64(fold, n, Y + i * incY, incY, scaleZ, Z, 1, Z + fold, 1);
+  }
+  return scaleZ;
+}
+
+static void sisaxpbyssq_kernel(void *args_, const int64_t i, const int n, void *Z){
+  sisaxpbyssq_args *args = (sisaxpbyssq_args*)args_;
+  float *scaleZ = (float*)Z;
+  *scaleZ = sisaxpbyssq_blocks(args->fold, n, args->alpha, args->X + i * args->incX, args->incX, args->beta, args->Y + i * args->incY, args->incY, 0.0, (float_indexed*)(scaleZ + 1));
+}
+
+static void sisaxpbyssq_combine(void *args_, void *partial, void *Z){
+  sisaxpbyssq_args *args = (sisaxpbyssq_args*)args_;
+  float *scaleX = (float*)partial;
+  float *scaleZ = (float*)Z;
+  *scaleZ = idxd_sisiaddsq(args->fold, *scaleX, (float_indexed*)(scaleX + 1), *scaleZ, (float_indexed*)(scaleZ + 1));
+}
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and add the scaled sum of squares of the updated Y to scaled indexed single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_sisssq() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+float idxdBLAS_sisaxpbyssq(const int fold, const int N, const float alpha, const float *X, const int incX,
+                            const float beta, float *Y, const int incY, const float scaleZ, float_indexed *Z){
+  return idxdBLAS_sisaxpbyssq_64(fold, N, alpha, X, incX, beta, Y, incY, scaleZ, Z);
+}
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and add the scaled sum of squares of the updated Y to scaled indexed single precision Z
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and adds to Z the scaled indexed sum of the squares of each element of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * Y is updated and summed a block at a time, so it is read once. Z and its scaling factor are the same as those of #idxdBLAS_sisssq_64() applied to the updated Y, and do not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_sisaxpbyssq(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is left unchanged and Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param scaleZ the scaling factor of Z
+ * @param Z indexed scalar Z
+ * @return the new scaling factor of Z
+ *
+ * @date   18 Oct 2026
+ */
+float idxdBLAS_sisaxpbyssq_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+                               const float beta, float *Y, const int64_t incY, const float scaleZ, float_indexed *Z){
+  sisaxpbyssq_args args;
+  float *scaleT;
+  float scale;
+
+  if(N <= 0){
+    return scaleZ;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Z);
+    return scaleZ;
+  }
+  if(!idxdPool_parallel(N)){
+    return sisaxpbyssq_blocks(fold, N, alpha, X, incX, beta, Y, incY, scaleZ, Z);
+  }
+  args.fold = fold;
+  args.alpha = alpha;
+  args.X = X;
+  args.incX = incX;
+  args.beta = beta;
+  args.Y = Y;
+  args.incY = incY;
+  scaleT = (float*)malloc(sizeof(float) + idxd_sisize(fold));
+  *scaleT = scaleZ;
+  idxd_sisiset(fold, Z, scaleT + 1);
+  idxdPool_reduce(N, sizeof(float) + idxd_sisize(fold), sisaxpbyssq_kernel, sisaxpbyssq_combine, &args, Y, incY * (ptrdiff_t)sizeof(float), scaleT);
+  idxd_sisiset(fold, scaleT + 1, Z);
+  scale = *scaleT;
+  free(scaleT);
+  return scale;
+}
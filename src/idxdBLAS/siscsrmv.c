@@ -0,0 +1,452 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+//element k of an index array given either as int or as int64_t
+#define CSR_INDEX(A, A_64, k) ((A_64) != NULL ? (A_64)[k] : (int64_t)(A)[k])
+
+typedef struct {
+  int fold;
+  int64_t M;
+  int64_t N;
+  const float *val;
+  const int *rowptr;
+  const int64_t *rowptr_64;
+  const int *colind;
+  const int64_t *colind_64;
+  const float *rowmax;
+  const float *X;
+  float amaxX;
+  float *colmax;
+  float_indexed *Y;
+  int64_t incY;
+  int64_t *count;
+  int64_t **touched;
+  int64_t *ntouched;
+  int ntasks;
+} siscsrmv_args;
+
+//the first row of task t, splitting the nonzeros evenly among the tasks
+static int64_t siscsrmv_split(const siscsrmv_args *args, const int t){
+  int64_t nz0 = CSR_INDEX(args->rowptr, args->rowptr_64, 0);
+  int64_t target = nz0 + (int64_t)(((double)(CSR_INDEX(args->rowptr, args->rowptr_64, args->M) - nz0) * t) / args->ntasks);
+  int64_t lo = 0;
+  int64_t hi = args->M;
+  int64_t mid;
+
+  if(t >= args->ntasks){
+    return args->M;
+  }
+  while(lo < hi){
+    mid = lo + (hi - lo) / 2;
+    if(CSR_INDEX(args->rowptr, args->rowptr_64, mid) < target){
+      lo = mid + 1;
+    }else{
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+//the largest absolute value of the products of elements k0 through k1 - 1 of val with their elements of X, or NaN if one of them is NaN
+static float siscsrmv_row_amax(const siscsrmv_args *args, const int64_t k0, const int64_t k1){
+  int64_t k;
+  float amax = 0.0f;
+  float a;
+
+  for(k = k0; k < k1; k++){
+    a = fabsf(args->val[k] * args->X[CSR_INDEX(args->colind, args->colind_64, k)]);
+    if(a > amax){
+      amax = a;
+    }else if(isnan(a)){
+      return a;
+    }
+  }
+  return amax;
+}
+
+//add to Y the products of elements k0 through k1 - 1 of val with their elements of X, updating Y with bound first, and return the largest absolute value of the products (bound itself if it is zero, infinite or invalid)
+static float siscsrmv_row_deposit(const siscsrmv_args *args, const int64_t k0, const int64_t k1, const float bound, float_indexed *Y){
+  int64_t k;
+  int64_t n;
+  float amax = 0.0f;
+  float p;
+
+  if(!(bound > 0.0f) || ISNANINFF(bound)){
+    //zero, infinite or invalid bounds are handled element by element
+    for(k = k0; k < k1; k++){
+      idxd_sisadd(args->fold, args->val[k] * args->X[CSR_INDEX(args->colind, args->colind_64, k)], Y);
+    }
+    return bound;
+  }
+  idxd_sisupdate(args->fold, bound, Y);
+  for(k = k0, n = 0; k < k1; k++){
+    p = args->val[k] * args->X[CSR_INDEX(args->colind, args->colind_64, k)];
+    if(fabsf(p) > amax){
+      amax = fabsf(p);
+    }
+    idxd_sisdeposit(args->fold, p, Y);
+    if(++n == idxd_SIENDURANCE){
+      idxd_sirenorm(args->fold, Y);
+      n = 0;
+    }
+  }
+  idxd_sirenorm(args->fold, Y);
+  return amax;
+}
+
+//add to Y[i * incY] the products of rows i0 through i1 - 1 with X, each row bounded by the largest absolute value of its products
+static void siscsrmv_rows(const siscsrmv_args *args, const int64_t i0, const int64_t i1){
+  int64_t i;
+  int64_t k0;
+  int64_t k1;
+  float bound;
+  float amax;
+  float_indexed *Y;
+  float_indexed *Ysave = idxd_sialloc(args->fold);
+
+  for(i = i0; i < i1; i++){
+    k0 = CSR_INDEX(args->rowptr, args->rowptr_64, i);
+    k1 = CSR_INDEX(args->rowptr, args->rowptr_64, i + 1);
+    if(k0 == k1){
+      continue;
+    }
+    Y = args->Y + i * args->incY * idxd_sinum(args->fold);
+    if(args->rowmax != NULL){
+      //rowmax[i] times the largest absolute value of alpha*x bounds the products of the row. As in idxdBLAS_sispacked_dot(), this bound is only kept if Y already holds a larger bin or if it lies in the same bin as the largest product, which the deposit returns. Otherwise, Y is restored and the row is deposited again with the largest product as the bound.
+      bound = args->rowmax[i] * args->amaxX;
+      if(bound > 0.0f && !ISNANINFF(bound)){
+        if(Y[0] != 0.0f && !ISNANINFF(Y[0]) && idxd_smindex(Y) <= idxd_sindex(bound)){
+          siscsrmv_row_deposit(args, k0, k1, bound, Y);
+          continue;
+        }
+        idxd_sisiset(args->fold, Y, Ysave);
+        amax = siscsrmv_row_deposit(args, k0, k1, bound, Y);
+        if(amax > 0.0f && idxd_sindex(amax) == idxd_sindex(bound)){
+          continue;
+        }
+        idxd_sisiset(args->fold, Ysave, Y);
+        siscsrmv_row_deposit(args, k0, k1, amax, Y);
+        continue;
+      }
+    }
+    siscsrmv_row_deposit(args, k0, k1, siscsrmv_row_amax(args, k0, k1), Y);
+  }
+  free(Ysave);
+}
+
+//set colmax[j] to the largest absolute value of the products of column j of the transpose of rows i0 through i1 - 1 with X, or NaN if one of them is NaN, and return the number of columns with products, which are stored in touched. colmax[j] is -1 for the other columns.
+static int64_t siscsrmv_colmax(const siscsrmv_args *args, const int64_t i0, const int64_t i1, float *colmax, int64_t *touched){
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  int64_t ntouched = 0;
+  float a;
+
+  for(j = 0; j < args->N; j++){
+    colmax[j] = -1.0f;
+  }
+  for(i = i0; i < i1; i++){
+    for(k = CSR_INDEX(args->rowptr, args->rowptr_64, i); k < CSR_INDEX(args->rowptr, args->rowptr_64, i + 1); k++){
+      j = CSR_INDEX(args->colind, args->colind_64, k);
+      a = fabsf(args->val[k] * args->X[i]);
+      if(colmax[j] < 0.0f){
+        touched[ntouched++] = j;
+      }
+      if(a > colmax[j] || isnan(a)){
+        colmax[j] = a;
+      }
+    }
+  }
+  return ntouched;
+}
+
+//add to Y[j * incY] the products of column j of the transpose of rows i0 through i1 - 1 with X, bounded by colmax[j]. count[j] holds the number of deposits into Y[j * incY] (0 if Y[j * incY] is not yet updated with the bound).
+static void siscsrmv_cols(const siscsrmv_args *args, const int64_t i0, const int64_t i1, float_indexed *Y, const int64_t incY, int64_t *count){
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  float_indexed *Yj;
+
+  for(i = i0; i < i1; i++){
+    for(k = CSR_INDEX(args->rowptr, args->rowptr_64, i); k < CSR_INDEX(args->rowptr, args->rowptr_64, i + 1); k++){
+      j = CSR_INDEX(args->colind, args->colind_64, k);
+      Yj = Y + j * incY * idxd_sinum(args->fold);
+      if(!(args->colmax[j] > 0.0f) || ISNANINFF(args->colmax[j])){
+        //zero, infinite or invalid bounds are handled element by element
+        idxd_sisadd(args->fold, args->val[k] * args->X[i], Yj);
+        continue;
+      }
+      if(count[j] == 0){
+        idxd_sisupdate(args->fold, args->colmax[j], Yj);
+      }
+      idxd_sisdeposit(args->fold, args->val[k] * args->X[i], Yj);
+      if(++count[j] % idxd_SIENDURANCE == 0){
+        idxd_sirenorm(args->fold, Yj);
+      }
+    }
+  }
+}
+
+static void siscsrmv_task(void *args_, const int t){
+  siscsrmv_args *args = (siscsrmv_args*)args_;
+  siscsrmv_rows(args, siscsrmv_split(args, t), siscsrmv_split(args, t + 1));
+}
+
+static void siscsrmv_task_colmax(void *args_, const int t){
+  siscsrmv_args *args = (siscsrmv_args*)args_;
+  int64_t i0 = siscsrmv_split(args, t);
+  int64_t i1 = siscsrmv_split(args, t + 1);
+  int64_t nnz = CSR_INDEX(args->rowptr, args->rowptr_64, i1) - CSR_INDEX(args->rowptr, args->rowptr_64, i0);
+
+  args->touched[t] = (int64_t*)malloc(MIN(args->N, nnz) * sizeof(int64_t));
+  args->ntouched[t] = siscsrmv_colmax(args, i0, i1, args->colmax + t * args->N, args->touched[t]);
+}
+
+static void siscsrmv_task_trans(void *args_, const int t){
+  siscsrmv_args *args = (siscsrmv_args*)args_;
+  siscsrmv_cols(args, siscsrmv_split(args, t), siscsrmv_split(args, t + 1), args->Y + t * args->N * idxd_sinum(args->fold), 1, args->count + t * args->N);
+}
+
+static void siscsrmv(const int fold, const char TransA, const int64_t M, const int64_t N,
+                     const float alpha, const float *val,
+                     const int *rowptr, const int64_t *rowptr_64, const int *colind, const int64_t *colind_64,
+                     const float *rowmax, const float *X, const int64_t incX,
+                     float_indexed *Y, const int64_t incY){
+  siscsrmv_args args;
+  float *AX;
+  float_indexed *partials;
+  float *colmax;
+  int64_t *count;
+  int64_t *touched;
+  int64_t ntouched;
+  int64_t nnz;
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  int64_t nx;
+  int t;
+  int trans = !(TransA == 'n' || TransA == 'N');
+
+  if(M == 0 || N == 0 || alpha == 0.0f){
+    return;
+  }
+  if(idxdBLAS_capacity_64(trans ? M : N, idxd_SICAPACITY)){
+    for(i = 0; i < (trans ? N : M); i++){
+      idxd_sisadd(fold, NAN, Y + i * incY * idxd_sinum(fold));
+    }
+    return;
+  }
+
+  //the products are taken with alpha*x, as in idxdBLAS_sisgemv()
+  nx = trans ? M : N;
+  AX = (float*)malloc(nx * sizeof(float));
+  for(i = 0; i < nx; i++){
+    AX[i] = alpha == 1.0f ? X[i * incX] : X[i * incX] * alpha;
+  }
+
+  args.fold = fold;
+  args.M = M;
+  args.N = N;
+  args.val = val;
+  args.rowptr = rowptr;
+  args.rowptr_64 = rowptr_64;
+  args.colind = colind;
+  args.colind_64 = colind_64;
+  args.rowmax = rowmax;
+  args.X = AX;
+  nnz = CSR_INDEX(rowptr, rowptr_64, M) - CSR_INDEX(rowptr, rowptr_64, 0);
+
+  if(!trans){
+    //each row is bounded by the largest absolute value of its products, or by rowmax[i] times the largest absolute value of alpha*x if that lies in the same bin
+    args.ntasks = idxdPool_num_tasks((double)nnz, 0.0, 0.0);
+    if(args.ntasks > M){
+      args.ntasks = (int)M;
+    }
+    if(rowmax != NULL){
+      args.amaxX = idxdBLAS_samax_64(N, AX, 1);
+    }
+    args.Y = Y;
+    args.incY = incY;
+    if(args.ntasks > 1){
+      idxdPool_dispatch(args.ntasks, siscsrmv_task, &args);
+    }else{
+      siscsrmv_rows(&args, 0, M);
+    }
+    free(AX);
+    return;
+  }
+
+  //each column of the transpose is bounded by the largest absolute value of its products, the largest of those of the tasks. Each task needs a bound, a count and an indexed partial result for every column, so there are only as many tasks as fit in the memory taken by the matrix.
+  args.ntasks = idxdPool_num_tasks((double)nnz, (double)N * (idxd_sisize(fold) + sizeof(float) + sizeof(int64_t)), (double)nnz * (sizeof(float) + (colind_64 != NULL ? sizeof(int64_t) : sizeof(int))));
+  if(args.ntasks > M){
+    args.ntasks = (int)M;
+  }
+  colmax = (float*)malloc(args.ntasks * N * sizeof(float));
+  count = (int64_t*)calloc(args.ntasks * N, sizeof(int64_t));
+  args.colmax = colmax;
+  if(args.ntasks > 1){
+    //only the columns with products in a task are merged
+    args.touched = (int64_t**)malloc(args.ntasks * sizeof(int64_t*));
+    args.ntouched = (int64_t*)malloc(args.ntasks * sizeof(int64_t));
+    idxdPool_dispatch(args.ntasks, siscsrmv_task_colmax, &args);
+    for(t = 1; t < args.ntasks; t++){
+      for(k = 0; k < args.ntouched[t]; k++){
+        j = args.touched[t][k];
+        if(colmax[t * N + j] > colmax[j] || isnan(colmax[t * N + j])){
+          colmax[j] = colmax[t * N + j];
+        }
+      }
+    }
+    partials = (float_indexed*)calloc(args.ntasks * N, idxd_sisize(fold));
+    args.Y = partials;
+    args.count = count;
+    idxdPool_dispatch(args.ntasks, siscsrmv_task_trans, &args);
+    for(t = 0; t < args.ntasks; t++){
+      for(k = 0; k < args.ntouched[t]; k++){
+        j = args.touched[t][k];
+        if(count[t * N + j] != 0){
+          idxd_sirenorm(fold, partials + (t * N + j) * idxd_sinum(fold));
+        }else if(colmax[j] > 0.0f && !ISNANINFF(colmax[j])){
+          continue;
+        }
+        idxd_sisiadd(fold, partials + (t * N + j) * idxd_sinum(fold), Y + j * incY * idxd_sinum(fold));
+      }
+      free(args.touched[t]);
+    }
+    free(args.touched);
+    free(args.ntouched);
+    free(partials);
+  }else{
+    touched = (int64_t*)malloc(MIN(N, nnz) * sizeof(int64_t));
+    ntouched = siscsrmv_colmax(&args, 0, M, colmax, touched);
+    siscsrmv_cols(&args, 0, M, Y, incY, count);
+    for(k = 0; k < ntouched; k++){
+      j = touched[k];
+      if(count[j] != 0){
+        idxd_sirenorm(fold, Y + j * incY * idxd_sinum(fold));
+      }
+    }
+    free(touched);
+  }
+  free(colmax);
+  free(count);
+  free(AX);
+}
+
+/**
+ * @brief Compute the largest absolute value of each row of a sparse single precision matrix in compressed sparse row format
+ *
+ * Sets rowmax[i] to the largest absolute value of the elements of row i of A, or 0 if the row is empty. The result can be given to #idxdBLAS_siscsrmv() to save a pass over each row on most products with A.
+ *
+ * @param M number of rows of matrix A
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param rowmax single precision vector of size M
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_scsramax(const int M, const float *val, const int *rowptr, float *rowmax){
+  int i;
+
+  for(i = 0; i < M; i++){
+    rowmax[i] = idxdBLAS_samax_64(rowptr[i + 1] - rowptr[i], val + rowptr[i], 1);
+  }
+}
+
+/**
+ * @brief Compute the largest absolute value of each row of a sparse single precision matrix in compressed sparse row format
+ *
+ * Sets rowmax[i] to the largest absolute value of the elements of row i of A, or 0 if the row is empty. The result can be given to #idxdBLAS_siscsrmv_64() to save a pass over each row on most products with A.
+ *
+ * Same as #idxdBLAS_scsramax(), except that the dimensions and indices are 64-bit integers.
+ *
+ * @param M number of rows of matrix A
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param rowmax single precision vector of size M
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_scsramax_64(const int64_t M, const float *val, const int64_t *rowptr, float *rowmax){
+  int64_t i;
+
+  for(i = 0; i < M; i++){
+    rowmax[i] = idxdBLAS_samax_64(rowptr[i + 1] - rowptr[i], val + rowptr[i], 1);
+  }
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of sparse single precision matrix A in compressed sparse row format and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * Each element of y is updated once with the largest absolute value of its products and the products are then deposited directly, so that y is the same as if each element were computed with #idxdBLAS_sisdot(). If rowmax is given, it must bound the absolute values of the elements of each row (see #idxdBLAS_scsramax()). rowmax[i] times the largest absolute value of alpha*x then bounds the products of row i and is used in place of their largest absolute value whenever the two lie in the same bin, which saves a pass over the row. rowmax is not used in the transposed product. The result depends only on the inputs and not on the order of the nonzeros within a row or on the number of threads: rows are split among the threads of the pool, and in the transposed case the partial results of the threads are added to y. Since each thread then keeps a partial result of size N, fewer threads are used when these would take more memory than A.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax single precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_siscsrmv(const int fold, const char TransA,
+                       const int M, const int N,
+                       const float alpha, const float *val, const int *rowptr, const int *colind,
+                       const float *rowmax, const float *X, const int incX,
+                       float_indexed *Y, const int incY){
+  siscsrmv(fold, TransA, M, N, alpha, val, rowptr, NULL, colind, NULL, rowmax, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of sparse single precision matrix A in compressed sparse row format and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * Each element of y is updated once with the largest absolute value of its products and the products are then deposited directly, so that y is the same as if each element were computed with #idxdBLAS_sisdot(). If rowmax is given, it must bound the absolute values of the elements of each row (see #idxdBLAS_scsramax_64()). rowmax[i] times the largest absolute value of alpha*x then bounds the products of row i and is used in place of their largest absolute value whenever the two lie in the same bin, which saves a pass over the row. rowmax is not used in the transposed product. The result depends only on the inputs and not on the order of the nonzeros within a row or on the number of threads: rows are split among the threads of the pool, and in the transposed case the partial results of the threads are added to y. Since each thread then keeps a partial result of size N, fewer threads are used when these would take more memory than A.
+ *
+ * Same as #idxdBLAS_siscsrmv(), except that the dimensions, indices and strides are 64-bit integers. If the number of columns (rows if transposed) of A is greater than #idxd_SICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax single precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_siscsrmv_64(const int fold, const char TransA,
+                          const int64_t M, const int64_t N,
+                          const float alpha, const float *val, const int64_t *rowptr, const int64_t *colind,
+                          const float *rowmax, const float *X, const int64_t incX,
+                          float_indexed *Y, const int64_t incY){
+  siscsrmv(fold, TransA, M, N, alpha, val, NULL, rowptr, NULL, colind, rowmax, X, incX, Y, incY);
+}
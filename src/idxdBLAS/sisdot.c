@@ -1,4 +1,25 @@
+#include <math.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  const float *Y;
+  int64_t incY;
+} sisdot_args;
+
+static void sisdot_kernel(void *args_, const int64_t i, const int n, void *Z){
+  sisdot_args *args = (sisdot_args*)args_;
+  idxdBLAS_smsdot_64(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, (float*)Z, 1, (float*)Z + args->fold, 1);
+}
+
+static void sisdot_combine(void *args_, void *partial, void *Z){
+  sisdot_args *args = (sisdot_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Z);
+}
 
 /**
  * @brief Add to indexed single precision Z the dot product of single precision vectors X and Y
@@ -17,5 +38,41 @@
  * @date   15 Jan 2016
  */
 void idxdBLAS_sisdot(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, float_indexed *Z){
-  idxdBLAS_smsdot(fold, N, X, incX, Y, incY, Z, 1, Z + fold, 1);
+  idxdBLAS_sisdot_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed single precision Z the dot product of single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * Same as #idxdBLAS_sisdot(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisdot_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float_indexed *Z){
+  sisdot_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_smsdot_64(fold, N, X, incX, Y, incY, Z, 1, Z + fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_sisize(fold), sisdot_kernel, sisdot_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Z);
 }
@@ -0,0 +1,104 @@
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  const float *Y;
+  int64_t incY;
+  float bound;
+} sisdot_bounded_args;
+
+//add to Z the dot product of X and Y, updating Z with bound instead of the largest product of each block
+static void sisdot_bounded_chunks(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, const float bound, float_indexed *Z){
+  int64_t i;
+  int n;
+
+  for(i = 0; i < N; i += n){
+    n = idxdBLAS_chunk_64(N - i, incX, incY);
+    idxdBLAS_smsdot_bounded(fold, n, X + i * incX, n > 1 ? (int)incX : 1, Y + i * incY, n > 1 ? (int)incY : 1, bound, Z, 1, Z + fold, 1);
+  }
+}
+
+static void sisdot_bounded_kernel(void *args_, const int64_t i, const int n, void *Z){
+  sisdot_bounded_args *args = (sisdot_bounded_args*)args_;
+  sisdot_bounded_chunks(args->fold, n, args->X + i * args->incX, args->incX, args->Y + i * args->incY, args->incY, args->bound, (float_indexed*)Z);
+}
+
+static void sisdot_bounded_combine(void *args_, void *partial, void *Z){
+  sisdot_bounded_args *args = (sisdot_bounded_args*)args_;
+  idxd_sisiadd(args->fold, (float_indexed*)partial, (float_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed single precision Z the dot product of single precision vectors X and Y, given a bound on their products
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y, updating Z with @c bound instead of computing the largest absolute value of the products, so that X and Y are read once.
+ *
+ * If @c bound is at least the absolute value of every pairwise product of X and Y and #idxd_sindex() gives the same index for @c bound and the largest of them, Z is the same as that of #idxdBLAS_sisdot(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_sisdot() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisdot_bounded(const int fold, const int N, const float *X, const int incX, const float *Y, const int incY, const float bound, float_indexed *Z){
+  idxdBLAS_sisdot_bounded_64(fold, N, X, incX, Y, incY, bound, Z);
+}
+
+/**
+ * @brief Add to indexed single precision Z the dot product of single precision vectors X and Y, given a bound on their products
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y, updating Z with @c bound instead of computing the largest absolute value of the products, so that X and Y are read once.
+ *
+ * If @c bound is at least the absolute value of every pairwise product of X and Y and #idxd_sindex() gives the same index for @c bound and the largest of them, Z is the same as that of #idxdBLAS_sisdot_64(). If @c bound is infinite or NaN, it is ignored and #idxdBLAS_sisdot_64() is used. Bounds are checked if #idxdBLAS_set_check_bounds() says so.
+ *
+ * Same as #idxdBLAS_sisdot_bounded(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisdot_bounded_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float *Y, const int64_t incY, const float bound, float_indexed *Z){
+  sisdot_bounded_args args;
+
+  if(N <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Z);
+    return;
+  }
+  if(ISNANINFF(bound) || (idxdBLAS_get_check_bounds() && idxdBLAS_scheck_bound(bound, idxdBLAS_samaxm_64(N, X, incX, Y, incY)))){
+    idxdBLAS_sisdot_64(fold, N, X, incX, Y, incY, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    sisdot_bounded_chunks(fold, N, X, incX, Y, incY, bound, Z);
+    return;
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  args.bound = bound;
+  idxdPool_reduce(N, idxd_sisize(fold), sisdot_bounded_kernel, sisdot_bounded_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Z);
+}
@@ -0,0 +1,93 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of packed single precision matrix A and single precision vector X
+ *
+ * Performs the matrix-vector operation
+ *
+ *   y := alpha*op(A)*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and op(A) is the M by N matrix packed by idxdBLAS_spack().
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. Y is the same as that of #idxdBLAS_sisgemv() on the matrix that was packed, with the same Order and TransA.
+ *
+ * @param fold the fold of the indexed types
+ * @param alpha scalar alpha
+ * @param A packed single precision matrix
+ * @param X single precision vector of at least size N
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgemv_packed(const int fold, const float alpha, const idxdBLAS_spacked *A,
+                             const float *X, const int incX,
+                             float_indexed *Y, const int incY){
+  idxdBLAS_sisgemv_packed_64(fold, alpha, A, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of packed single precision matrix A and single precision vector X
+ *
+ * Performs the matrix-vector operation
+ *
+ *   y := alpha*op(A)*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and op(A) is the M by N matrix packed by idxdBLAS_spack().
+ *
+ * The rows of op(A) are read from the packed matrix, and the stored largest absolute values of its panels usually spare computing the largest absolute values of the products. Y is the same as that of #idxdBLAS_sisgemv_64() on the matrix that was packed, with the same Order and TransA.
+ *
+ * Same as #idxdBLAS_sisgemv_packed(), except that the strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param alpha scalar alpha
+ * @param A packed single precision matrix
+ * @param X single precision vector of at least size N
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgemv_packed_64(const int fold, const float alpha, const idxdBLAS_spacked *A,
+                                const float *X, const int64_t incX,
+                                float_indexed *Y, const int64_t incY){
+  int64_t i;
+  int64_t j;
+  int64_t p;
+  int n;
+  float *bufX;
+  float *amaxX;
+  int *iamaxX;
+
+  if(A->M == 0 || A->N == 0 || alpha == 0.0){
+    return;
+  }
+
+  //X is scaled as in idxdBLAS_sisgemv(), so that the products are the same
+  bufX = (float*)malloc(A->N * sizeof(float));
+  amaxX = (float*)malloc(A->npanels * sizeof(float));
+  iamaxX = (int*)malloc(A->npanels * sizeof(int));
+  for(j = 0; j < A->N; j++){
+    bufX[j] = X[j * incX] * alpha;
+  }
+  for(p = 0; p < A->npanels; p++){
+    n = (int)MIN(idxdBLAS_PACKED_PANEL, A->N - p * idxdBLAS_PACKED_PANEL);
+    amaxX[p] = idxdBLAS_spacked_amax(n, bufX + p * idxdBLAS_PACKED_PANEL, iamaxX + p);
+  }
+
+  for(p = 0; p < A->npanels; p++){
+    n = (int)MIN(idxdBLAS_PACKED_PANEL, A->N - p * idxdBLAS_PACKED_PANEL);
+    for(i = 0; i < A->M; i++){
+      idxdBLAS_sispacked_dot(fold, n, A->A + i * A->ldA + p * idxdBLAS_PACKED_PANEL, A->amax[i * A->npanels + p], A->iamax[i * A->npanels + p], bufX + p * idxdBLAS_PACKED_PANEL, amaxX[p], iamaxX[p], Y + i * incY * idxd_sinum(fold));
+    }
+  }
+
+  free(bufX);
+  free(amaxX);
+  free(iamaxX);
+}
@@ -0,0 +1,121 @@
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define Y_BLOCK 256
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of single precision matrix A and single precision vector X, and add to indexed single precision scalar D the dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix, and then
+ *
+ *   d := d + w**T*y,
+ *
+ * where w is a vector, d is an indexed scalar, and each element of y is converted to single precision.
+ *
+ * The outputs are computed in blocks with #idxdBLAS_sisgemv(), and each block is converted and added to the dot product while it is in cache, so that A is read once and y is not read again. Y is the same as with #idxdBLAS_sisgemv(), and D is the same as with #idxdBLAS_sisdot() of W and the converted Y, however the outputs are split.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @param D indexed scalar D
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgemvdot(const int fold, const char Order,
+                         const char TransA, const int M, const int N,
+                         const float alpha, const float *A, const int lda,
+                         const float *X, const int incX,
+                         float_indexed *Y, const int incY,
+                         const float *W, const int incW,
+                         float_indexed *D){
+  idxdBLAS_sisgemvdot_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, Y, incY, W, incW, D);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the matrix-vector product of single precision matrix A and single precision vector X, and add to indexed single precision scalar D the dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix, and then
+ *
+ *   d := d + w**T*y,
+ *
+ * where w is a vector, d is an indexed scalar, and each element of y is converted to single precision.
+ *
+ * The outputs are computed in blocks with #idxdBLAS_sisgemv_64(), and each block is converted and added to the dot product while it is in cache, so that A is read once and y is not read again. Y is the same as with #idxdBLAS_sisgemv_64(), and D is the same as with #idxdBLAS_sisdot_64() of W and the converted Y, however the outputs are split.
+ *
+ * Same as #idxdBLAS_sisgemvdot(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @param D indexed scalar D
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgemvdot_64(const int fold, const char Order,
+                            const char TransA, const int64_t M, const int64_t N,
+                            const float alpha, const float *A, const int64_t lda,
+                            const float *X, const int64_t incX,
+                            float_indexed *Y, const int64_t incY,
+                            const float *W, const int64_t incW,
+                            float_indexed *D){
+  float bufY[Y_BLOCK];
+  int64_t i;
+  int64_t ii;
+  int64_t n;
+  int64_t L;
+  int strided;
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  //consecutive outputs come from lines of A that are lda apart if strided is set, and adjacent otherwise
+  strided = (Order == 'r' || Order == 'R') == (TransA == 'n' || TransA == 'N');
+  L = (TransA == 'n' || TransA == 'N') ? M : N;
+  for(i = 0; i < L; i += Y_BLOCK){
+    n = MIN(Y_BLOCK, L - i);
+    switch(TransA){
+      case 'n':
+      case 'N':
+        idxdBLAS_sisgemv_64(fold, Order, TransA, n, N, alpha, A + (strided ? i * lda : i), lda, X, incX, Y + i * incY * idxd_sinum(fold), incY);
+        break;
+      default:
+        idxdBLAS_sisgemv_64(fold, Order, TransA, M, n, alpha, A + (strided ? i * lda : i), lda, X, incX, Y + i * incY * idxd_sinum(fold), incY);
+        break;
+    }
+    for(ii = 0; ii < n; ii++){
+      bufY[ii] = idxd_ssiconv(fold, Y + (i + ii) * incY * idxd_sinum(fold));
+    }
+    idxdBLAS_sisdot_64(fold, n, W + i * incW, incW, bufY, 1, D);
+  }
+}
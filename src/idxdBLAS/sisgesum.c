@@ -0,0 +1,382 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define R_BLOCK 64
+#define C_BLOCK 64
+
+#define SISGE_SUM 0
+#define SISGE_ASUM 1
+#define SISGE_SSQ 2
+
+typedef struct {
+  int fold;
+  int op;
+  int64_t L;
+  int64_t K;
+  const float *A;
+  int64_t lda;
+  int contiguous;
+  float *scaleY;
+  float_indexed *Y;
+  int64_t incY;
+  int64_t chunk;
+} sisge_args;
+
+//reduce the elements A[l * lda + k] (k = 0, ..., K - 1) of each output l0 <= l < l1 with a call to the vector routine
+static void sisge_contiguous(const sisge_args *args, const int64_t l0, const int64_t l1){
+  int64_t l;
+  float_indexed *Y;
+
+  for(l = l0; l < l1; l++){
+    Y = args->Y + l * args->incY * idxd_sinum(args->fold);
+    switch(args->op){
+      case SISGE_SUM:
+        idxdBLAS_sissum_64(args->fold, args->K, args->A + l * args->lda, 1, Y);
+        break;
+      case SISGE_ASUM:
+        idxdBLAS_sisasum_64(args->fold, args->K, args->A + l * args->lda, 1, Y);
+        break;
+      default:
+        args->scaleY[l] = idxdBLAS_sisssq_64(args->fold, args->K, args->A + l * args->lda, 1, args->scaleY[l], Y);
+        break;
+    }
+  }
+}
+
+//reduce the elements A[k * lda + l] (k = 0, ..., K - 1) of each output l0 <= l < l1, sweeping a block of C_BLOCK outputs R_BLOCK rows of A at a time.
+//Each accumulator is updated with the largest absolute value of its elements in the block before they are deposited and renormalized after.
+static void sisge_strided(const sisge_args *args, const int64_t l0, const int64_t l1){
+  int fold = args->fold;
+  int64_t lda = args->lda;
+  int64_t j;
+  int64_t jj;
+  int64_t k;
+  int64_t kk;
+  int64_t n;
+  int64_t m;
+  float amax[C_BLOCK];
+  float scl[C_BLOCK];
+  float x;
+  const float *A;
+  float_indexed *Y;
+
+  for(j = l0; j < l1; j += C_BLOCK){
+    n = MIN(C_BLOCK, l1 - j);
+    for(k = 0; k < args->K; k += R_BLOCK){
+      m = MIN(R_BLOCK, args->K - k);
+      A = args->A + k * lda + j;
+      for(jj = 0; jj < n; jj++){
+        amax[jj] = 0.0f;
+      }
+      for(kk = 0; kk < m; kk++){
+        for(jj = 0; jj < n; jj++){
+          x = fabsf(A[kk * lda + jj]);
+          amax[jj] = (x > amax[jj] || x != x) ? x : amax[jj];
+        }
+      }
+      for(jj = 0; jj < n; jj++){
+        Y = args->Y + (j + jj) * args->incY * idxd_sinum(fold);
+        if(args->op == SISGE_SSQ){
+          if(ISNANINFF(amax[jj]) || ISNANINFF(Y[0])){
+            //infinite and invalid squares are accumulated in the first accumulator, as with idxdBLAS_sisssq()
+            for(kk = 0; kk < m; kk++){
+              Y[0] += fabsf(A[kk * lda + jj]);
+            }
+            amax[jj] = 0.0f;
+            continue;
+          }
+          scl[jj] = idxd_sscale(amax[jj]);
+          if(scl[jj] > args->scaleY[j + jj]){
+            if(args->scaleY[j + jj] > 0.0f){
+              idxd_smsrescale(fold, scl[jj], args->scaleY[j + jj], Y, 1, Y + fold, 1);
+            }
+            args->scaleY[j + jj] = scl[jj];
+          }
+          scl[jj] = 1.0f / args->scaleY[j + jj];
+          amax[jj] *= scl[jj];
+          amax[jj] *= amax[jj];
+        }
+        if(ISNANINFF(amax[jj])){
+          //infinite and invalid elements are added one at a time
+          for(kk = 0; kk < m; kk++){
+            idxd_sisadd(fold, args->op == SISGE_SUM ? A[kk * lda + jj] : fabsf(A[kk * lda + jj]), Y);
+          }
+          amax[jj] = 0.0f;
+        }else if(amax[jj] != 0.0f){
+          idxd_sisupdate(fold, amax[jj], Y);
+        }
+      }
+      for(kk = 0; kk < m; kk++){
+        for(jj = 0; jj < n; jj++){
+          if(amax[jj] != 0.0f){
+            x = A[kk * lda + jj];
+            switch(args->op){
+              case SISGE_SUM:
+                break;
+              case SISGE_ASUM:
+                x = fabsf(x);
+                break;
+              default:
+                x *= scl[jj];
+                x *= x;
+                break;
+            }
+            idxd_sisdeposit(fold, x, args->Y + (j + jj) * args->incY * idxd_sinum(fold));
+          }
+        }
+      }
+      for(jj = 0; jj < n; jj++){
+        if(amax[jj] != 0.0f){
+          idxd_sirenorm(fold, args->Y + (j + jj) * args->incY * idxd_sinum(fold));
+        }
+      }
+    }
+  }
+}
+
+static void sisge_task(void *args_, const int t){
+  sisge_args *args = (sisge_args*)args_;
+  int64_t l0 = t * args->chunk;
+  int64_t l1 = MIN(args->L, l0 + args->chunk);
+
+  if(args->contiguous){
+    sisge_contiguous(args, l0, l1);
+  }else{
+    sisge_strided(args, l0, l1);
+  }
+}
+
+static void sisge(const int fold, const int op, const char Order, const char Dim,
+                  const int64_t M, const int64_t N, const float *A, const int64_t lda,
+                  float *scaleY, float_indexed *Y, const int64_t incY){
+  sisge_args args;
+  int rows = (Dim == 'r' || Dim == 'R');
+  int64_t l;
+  int ntasks;
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  args.fold = fold;
+  args.op = op;
+  args.L = rows ? M : N;
+  args.K = rows ? N : M;
+  args.A = A;
+  args.lda = lda;
+  args.contiguous = (rows == (Order == 'r' || Order == 'R'));
+  args.scaleY = scaleY;
+  args.Y = Y;
+  args.incY = incY;
+  if(idxdBLAS_capacity_64(args.K, idxd_SICAPACITY)){
+    for(l = 0; l < args.L; l++){
+      idxd_sisadd(fold, NAN, Y + l * incY * idxd_sinum(fold));
+    }
+    return;
+  }
+
+  //the outputs are split among tasks, unless there are too few of them to keep the threads busy and each vector routine can split its own elements instead
+  if(args.L < 2 || !idxdPool_parallel((double)args.L * args.K) || (args.contiguous && args.L < idxdPool_get_num_threads())){
+    args.chunk = args.L;
+    sisge_task(&args, 0);
+    return;
+  }
+  args.chunk = (idxdPool_MINCHUNK + args.K - 1) / args.K;
+  if(args.chunk < (args.L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (args.L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((args.L + args.chunk - 1) / args.chunk);
+  idxdPool_dispatch(ntasks, sisge_task, &args);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j A_ij   or   y_j := y_j + sum_i A_ij,
+ *
+ * where A is an M by N matrix and y is an indexed vector.
+ *
+ * The matrix is swept once in its storage order. Sums along the leading dimension are computed with #idxdBLAS_sissum(), and sums across it deposit each row (or column) of A into a block of accumulators at a time. Each element of y is the same as that of #idxdBLAS_sissum() applied to the corresponding row or column, and does not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgesum(const int fold, const char Order, const char Dim,
+                       const int M, const int N,
+                       const float *A, const int lda,
+                       float_indexed *Y, const int incY){
+  sisge(fold, SISGE_SUM, Order, Dim, M, N, A, lda, NULL, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j A_ij   or   y_j := y_j + sum_i A_ij,
+ *
+ * where A is an M by N matrix and y is an indexed vector.
+ *
+ * The matrix is swept once in its storage order. Sums along the leading dimension are computed with #idxdBLAS_sissum_64(), and sums across it deposit each row (or column) of A into a block of accumulators at a time. Each element of y is the same as that of #idxdBLAS_sissum_64() applied to the corresponding row or column, and does not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_sisgesum(), except that the dimensions, leading dimension and stride are 64-bit integers. If the vectors summed are longer than #idxd_SICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgesum_64(const int fold, const char Order, const char Dim,
+                          const int64_t M, const int64_t N,
+                          const float *A, const int64_t lda,
+                          float_indexed *Y, const int64_t incY){
+  sisge(fold, SISGE_SUM, Order, Dim, M, N, A, lda, NULL, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the absolute values of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j |A_ij|   or   y_j := y_j + sum_i |A_ij|,
+ *
+ * where A is an M by N matrix and y is an indexed vector.
+ *
+ * The matrix is swept once in its storage order, as in #idxdBLAS_sisgesum(). Each element of y is the same as that of #idxdBLAS_sisasum() applied to the corresponding row or column, and does not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgeasum(const int fold, const char Order, const char Dim,
+                        const int M, const int N,
+                        const float *A, const int lda,
+                        float_indexed *Y, const int incY){
+  sisge(fold, SISGE_ASUM, Order, Dim, M, N, A, lda, NULL, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the absolute values of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j |A_ij|   or   y_j := y_j + sum_i |A_ij|,
+ *
+ * where A is an M by N matrix and y is an indexed vector.
+ *
+ * The matrix is swept once in its storage order, as in #idxdBLAS_sisgesum_64(). Each element of y is the same as that of #idxdBLAS_sisasum_64() applied to the corresponding row or column, and does not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_sisgeasum(), except that the dimensions, leading dimension and stride are 64-bit integers. If the vectors summed are longer than #idxd_SICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgeasum_64(const int fold, const char Order, const char Dim,
+                           const int64_t M, const int64_t N,
+                           const float *A, const int64_t lda,
+                           float_indexed *Y, const int64_t incY){
+  sisge(fold, SISGE_ASUM, Order, Dim, M, N, A, lda, NULL, Y, incY);
+}
+
+/**
+ * @brief Add to scaled indexed single precision vector Y the scaled sums of squares of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j A_ij**2   or   y_j := y_j + sum_i A_ij**2,
+ *
+ * where A is an M by N matrix and y is a scaled indexed vector. The scaling of each square is performed using #idxd_sscale(), and the scaling factors of y are updated in scaleY.
+ *
+ * The matrix is swept once in its storage order, as in #idxdBLAS_sisgesum(). Each element of y and its scaling factor are the same as those of #idxdBLAS_sisssq() applied to the corresponding row or column, and do not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param scaleY single precision vector of the same size as Y. scaleY[i] is the scaling factor of the i'th element of Y
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgessq(const int fold, const char Order, const char Dim,
+                       const int M, const int N,
+                       const float *A, const int lda,
+                       float *scaleY, float_indexed *Y, const int incY){
+  sisge(fold, SISGE_SSQ, Order, Dim, M, N, A, lda, scaleY, Y, incY);
+}
+
+/**
+ * @brief Add to scaled indexed single precision vector Y the scaled sums of squares of the rows or columns of single precision matrix A
+ *
+ * Performs one of the operations
+ *
+ *   y_i := y_i + sum_j A_ij**2   or   y_j := y_j + sum_i A_ij**2,
+ *
+ * where A is an M by N matrix and y is a scaled indexed vector. The scaling of each square is performed using #idxd_sscale(), and the scaling factors of y are updated in scaleY.
+ *
+ * The matrix is swept once in its storage order, as in #idxdBLAS_sisgesum_64(). Each element of y and its scaling factor are the same as those of #idxdBLAS_sisssq_64() applied to the corresponding row or column, and do not depend on the number of threads.
+ *
+ * Same as #idxdBLAS_sisgessq(), except that the dimensions, leading dimension and stride are 64-bit integers. If the vectors summed are longer than #idxd_SICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param scaleY single precision vector of the same size as Y. scaleY[i] is the scaling factor of the i'th element of Y
+ * @param Y indexed single precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sisgessq_64(const int fold, const char Order, const char Dim,
+                          const int64_t M, const int64_t N,
+                          const float *A, const int64_t lda,
+                          float *scaleY, float_indexed *Y, const int64_t incY){
+  sisge(fold, SISGE_SSQ, Order, Dim, M, N, A, lda, scaleY, Y, incY);
+}
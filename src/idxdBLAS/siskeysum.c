@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK MIN(1024, idxd_SIENDURANCE)
+
+//key of element i given either as int or as int64_t
+#define KEY(keys, keys_64, i) ((keys_64) != NULL ? (keys_64)[i] : (int64_t)(keys)[i])
+
+typedef struct {
+  int fold;
+  const int *keys;
+  const int64_t *keys_64;
+  const float *X;
+  int64_t incX;
+  int64_t nkeys;
+  int64_t N;
+  int ntasks;
+  float_indexed **partials;
+  int64_t **touched;
+  int64_t *ntouched;
+} siskeysum_args;
+
+//add to Y[k * incY] the elements i0 <= i < i1 of X with key k, a block at a time, and return the number of keys seen, which are stored in touched. Keys seen in a block get a single update with the largest absolute value of their elements in the block, and are renormalized only when their next block could exceed the endurance of their accumulators.
+static int64_t siskeysum_blocks(const siskeysum_args *args, const int64_t i0, const int64_t i1, float_indexed *Y, const int64_t incY, int64_t *touched){
+  int fold = args->fold;
+  int64_t i;
+  int64_t j;
+  int64_t n;
+  int64_t k;
+  int64_t nseen;
+  int64_t ntouched = 0;
+  int64_t *seen = (int64_t*)malloc(N_BLOCK * sizeof(int64_t));
+  int64_t *count = (int64_t*)calloc(args->nkeys, sizeof(int64_t));
+  float *bound = (float*)malloc(args->nkeys * sizeof(float));
+  float *amax = (float*)calloc(args->nkeys, sizeof(float));
+  float x;
+
+  //every key is updated the first time it is seen, even if its elements are zero
+  for(k = 0; k < args->nkeys; k++){
+    bound[k] = -1.0f;
+  }
+
+  for(i = i0; i < i1; i += N_BLOCK){
+    n = MIN(N_BLOCK, i1 - i);
+    nseen = 0;
+    for(j = i; j < i + n; j++){
+      k = KEY(args->keys, args->keys_64, j);
+      if(k < 0 || k >= args->nkeys){
+        continue;
+      }
+      if(count[k] >= 0){
+        //mark the key as seen in this block
+        seen[nseen++] = k;
+        count[k] = -count[k] - 1;
+      }
+      x = fabsf(args->X[j * args->incX]);
+      amax[k] = x > amax[k] ? x : amax[k];
+    }
+    for(j = 0; j < nseen; j++){
+      k = seen[j];
+      if(bound[k] < 0.0f){
+        touched[ntouched++] = k;
+      }
+      if(amax[k] > bound[k]){
+        idxd_sisupdate(fold, amax[k], Y + k * incY * idxd_sinum(fold));
+        bound[k] = amax[k];
+      }
+      amax[k] = 0.0f;
+    }
+    for(j = i; j < i + n; j++){
+      k = KEY(args->keys, args->keys_64, j);
+      if(k < 0 || k >= args->nkeys){
+        continue;
+      }
+      idxd_sisdeposit(fold, args->X[j * args->incX], Y + k * incY * idxd_sinum(fold));
+      count[k]--;
+    }
+    for(j = 0; j < nseen; j++){
+      k = seen[j];
+      count[k] = -count[k] - 1;
+      if(count[k] > idxd_SIENDURANCE - N_BLOCK){
+        idxd_sirenorm(fold, Y + k * incY * idxd_sinum(fold));
+        count[k] = 0;
+      }
+    }
+  }
+  for(j = 0; j < ntouched; j++){
+    k = touched[j];
+    if(count[k] > 0){
+      idxd_sirenorm(fold, Y + k * incY * idxd_sinum(fold));
+    }
+  }
+  free(seen);
+  free(count);
+  free(bound);
+  free(amax);
+  return ntouched;
+}
+
+//the first element of task t
+static int64_t siskeysum_split(const siskeysum_args *args, const int t){
+  return (args->N / args->ntasks) * t + MIN(t, args->N % args->ntasks);
+}
+
+static void siskeysum_task(void *args_, const int t){
+  siskeysum_args *args = (siskeysum_args*)args_;
+  int64_t i0 = siskeysum_split(args, t);
+  int64_t i1 = siskeysum_split(args, t + 1);
+
+  args->partials[t] = (float_indexed*)calloc(args->nkeys, idxd_sisize(args->fold));
+  args->touched[t] = (int64_t*)malloc(MIN(args->nkeys, i1 - i0) * sizeof(int64_t));
+  args->ntouched[t] = siskeysum_blocks(args, i0, i1, args->partials[t], 1, args->touched[t]);
+}
+
+static void siskeysum(const int fold, const int64_t N, const int *keys, const int64_t *keys_64,
+                      const float *X, const int64_t incX, const int64_t nkeys,
+                      float_indexed *Y, const int64_t incY){
+  siskeysum_args args;
+  int64_t *touched;
+  int64_t j;
+  int64_t k;
+  int t;
+
+  if(N <= 0 || nkeys <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    for(k = 0; k < nkeys; k++){
+      idxd_sisadd(fold, NAN, Y + k * incY * idxd_sinum(fold));
+    }
+    return;
+  }
+  args.fold = fold;
+  args.keys = keys;
+  args.keys_64 = keys_64;
+  args.X = X;
+  args.incX = incX;
+  args.nkeys = nkeys;
+  args.N = N;
+  //each task sums a contiguous part of X into an indexed vector of size nkeys of its own (along with the state of its keys), so there are only as many tasks as fit in the memory taken by X and the keys
+  args.ntasks = idxdPool_num_tasks((double)N, (double)nkeys * (idxd_sisize(fold) + sizeof(int64_t) + 2 * sizeof(float)), (double)N * (sizeof(float) + (keys_64 != NULL ? sizeof(int64_t) : sizeof(int))));
+  if(args.ntasks > 1 && args.ntasks > N / idxdPool_MINCHUNK){
+    args.ntasks = (int)(N / idxdPool_MINCHUNK);
+  }
+  if(args.ntasks <= 1){
+    touched = (int64_t*)malloc(MIN(nkeys, N) * sizeof(int64_t));
+    siskeysum_blocks(&args, 0, N, Y, incY, touched);
+    free(touched);
+    return;
+  }
+  args.partials = (float_indexed**)malloc(args.ntasks * sizeof(float_indexed*));
+  args.touched = (int64_t**)malloc(args.ntasks * sizeof(int64_t*));
+  args.ntouched = (int64_t*)malloc(args.ntasks * sizeof(int64_t));
+  idxdPool_dispatch(args.ntasks, siskeysum_task, &args);
+  //only the keys seen by a task are added to Y
+  for(t = 0; t < args.ntasks; t++){
+    for(j = 0; j < args.ntouched[t]; j++){
+      k = args.touched[t][j];
+      idxd_sisiadd(fold, args.partials[t] + k * idxd_sinum(fold), Y + k * incY * idxd_sinum(fold));
+    }
+    free(args.partials[t]);
+    free(args.touched[t]);
+  }
+  free(args.partials);
+  free(args.touched);
+  free(args.ntouched);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the elements of single precision vector X with each key
+ *
+ * Performs the operation
+ *
+ *   y_k := y_k + sum_{i : keys_i = k} x_i,
+ *
+ * for k = 0, ..., nkeys - 1, where y is an indexed vector. Elements with keys outside of this range are ignored.
+ *
+ * X is read once, a block at a time. The accumulator of each key seen in a block is updated once with the largest absolute value of its elements in the block before they are deposited, and is renormalized only when needed. Each element of y is the same as that of #idxdBLAS_sissum() applied to the elements with its key, whatever their order, and does not depend on the number of threads. Each thread sums a part of X into an indexed vector of size nkeys of its own, so fewer threads are used when these would take more memory than X and the keys.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y indexed single precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_siskeysum(const int fold, const int N, const int *keys,
+                        const float *X, const int incX, const int nkeys,
+                        float_indexed *Y, const int incY){
+  siskeysum(fold, N, keys, NULL, X, incX, nkeys, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the elements of single precision vector X with each key
+ *
+ * Performs the operation
+ *
+ *   y_k := y_k + sum_{i : keys_i = k} x_i,
+ *
+ * for k = 0, ..., nkeys - 1, where y is an indexed vector. Elements with keys outside of this range are ignored.
+ *
+ * X is read once, a block at a time. The accumulator of each key seen in a block is updated once with the largest absolute value of its elements in the block before they are deposited, and is renormalized only when needed. Each element of y is the same as that of #idxdBLAS_sissum_64() applied to the elements with its key, whatever their order, and does not depend on the number of threads. Each thread sums a part of X into an indexed vector of size nkeys of its own, so fewer threads are used when these would take more memory than X and the keys.
+ *
+ * Same as #idxdBLAS_siskeysum(), except that the vector length, keys, number of keys and strides are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, every element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y indexed single precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_siskeysum_64(const int fold, const int64_t N, const int64_t *keys,
+                           const float *X, const int64_t incX, const int64_t nkeys,
+                           float_indexed *Y, const int64_t incY){
+  siskeysum(fold, N, NULL, keys, X, incX, nkeys, Y, incY);
+}
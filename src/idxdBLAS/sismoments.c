@@ -0,0 +1,129 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+#define N_BLOCK 1024
+
+typedef struct {
+  int fold;
+  int order;
+  const float *X;
+  int64_t incX;
+  float shift;
+} sismoments_args;
+
+//add to Y[p - 1] the sums of the p'th powers of X[i * incX] - shift, for p = 1 through order. The powers of a block of X are formed in buf (which holds order * N_BLOCK elements) and summed from there, so that X is read once.
+static void sismoments_blocks(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float *buf, float_indexed *Y){
+  int64_t i;
+  int64_t j;
+  int64_t n;
+  int p;
+  float d;
+
+  for(i = 0; i < N; i += N_BLOCK){
+    n = MIN(N_BLOCK, N - i);
+    for(j = 0; j < n; j++){
+      d = X[(i + j) * incX] - shift;
+      buf[j] = d;
+      if(order > 1){
+        buf[N_BLOCK + j] = d * d;
+      }
+      if(order > 2){
+        buf[2 * N_BLOCK + j] = buf[N_BLOCK + j] * d;
+      }
+      if(order > 3){
+        buf[3 * N_BLOCK + j] = buf[N_BLOCK + j] * buf[N_BLOCK + j];
+      }
+    }
+    for(p = 0; p < order; p++){
+      idxdBLAS_smssum_64(fold, n, buf + p * N_BLOCK, 1, Y + p * idxd_sinum(fold), 1, Y + p * idxd_sinum(fold) + fold, 1);
+    }
+  }
+}
+
+static void sismoments_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sismoments_args *args = (sismoments_args*)args_;
+  float *buf = (float*)malloc(args->order * N_BLOCK * sizeof(float));
+  sismoments_blocks(args->fold, args->order, n, args->X + i * args->incX, args->incX, args->shift, buf, (float_indexed*)Y);
+  free(buf);
+}
+
+static void sismoments_combine(void *args_, void *partial, void *Y){
+  sismoments_args *args = (sismoments_args*)args_;
+  int p;
+
+  for(p = 0; p < args->order; p++){
+    idxd_sisiadd(args->fold, (float_indexed*)partial + p * idxd_sinum(args->fold), (float_indexed*)Y + p * idxd_sinum(args->fold));
+  }
+}
+
+/**
+ * @brief Add to indexed float precision vector Y the sums of the powers of the elements of float precision vector X
+ *
+ * Add to the p'th element of Y the indexed sum of (x_i - shift)**p for p = 1, ..., order, reading X once.
+ *
+ * Each power is formed in float precision, as (x_i - shift), (x_i - shift)**2, (x_i - shift)**2 * (x_i - shift) and ((x_i - shift)**2)**2, and is not scaled, so large elements may overflow in the higher powers. The p'th element of Y is the same as that of #idxdBLAS_sissum() applied to the vector of p'th powers, and does not depend on the number of threads. A shift of 0 gives the raw moments, and a shift of the mean the centered ones.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of powers to sum (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param shift the value subtracted from each element of X before taking powers
+ * @param Y indexed float precision vector of size order (stored contiguously)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sismoments(const int fold, const int order, const int N, const float *X, const int incX, const float shift, float_indexed *Y){
+  idxdBLAS_sismoments_64(fold, order, N, X, incX, shift, Y);
+}
+
+/**
+ * @brief Add to indexed float precision vector Y the sums of the powers of the elements of float precision vector X
+ *
+ * Add to the p'th element of Y the indexed sum of (x_i - shift)**p for p = 1, ..., order, reading X once.
+ *
+ * Each power is formed in float precision, as (x_i - shift), (x_i - shift)**2, (x_i - shift)**2 * (x_i - shift) and ((x_i - shift)**2)**2, and is not scaled, so large elements may overflow in the higher powers. The p'th element of Y is the same as that of #idxdBLAS_sissum_64() applied to the vector of p'th powers, and does not depend on the number of threads. A shift of 0 gives the raw moments, and a shift of the mean the centered ones.
+ *
+ * Same as #idxdBLAS_sismoments(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, the first order (at most 4) elements of Y are set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of powers to sum (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param shift the value subtracted from each element of X before taking powers
+ * @param Y indexed float precision vector of size order (stored contiguously)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sismoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float_indexed *Y){
+  sismoments_args args;
+  float *buf;
+  int p;
+
+  if(N <= 0 || order <= 0){
+    return;
+  }
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    for(p = 0; p < MIN(order, 4); p++){
+      idxd_sisadd(fold, NAN, Y + p * idxd_sinum(fold));
+    }
+    return;
+  }
+  args.fold = fold;
+  args.order = MIN(order, 4);
+  args.X = X;
+  args.incX = incX;
+  args.shift = shift;
+  if(!idxdPool_parallel((double)N * args.order)){
+    buf = (float*)malloc(args.order * N_BLOCK * sizeof(float));
+    sismoments_blocks(fold, args.order, N, X, incX, shift, buf, Y);
+    free(buf);
+    return;
+  }
+  idxdPool_reduce(N, args.order * idxd_sisize(fold), sismoments_kernel, sismoments_combine, &args, X, incX * (ptrdiff_t)sizeof(float), Y);
+}
@@ -0,0 +1,148 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+//element s of the segment offsets given either as int or as int64_t
+#define SEG_INDEX(segptr, segptr_64, s) ((segptr_64) != NULL ? (segptr_64)[s] : (int64_t)(segptr)[s])
+
+typedef struct {
+  int fold;
+  int64_t nseg;
+  const int *segptr;
+  const int64_t *segptr_64;
+  const float *X;
+  int64_t incX;
+  float_indexed *Y;
+  int64_t incY;
+  int ntasks;
+} sissegsum_args;
+
+//the first segment of task t, splitting the elements evenly among the tasks
+static int64_t sissegsum_split(const sissegsum_args *args, const int t){
+  int64_t i0 = SEG_INDEX(args->segptr, args->segptr_64, 0);
+  int64_t target = i0 + (int64_t)(((double)(SEG_INDEX(args->segptr, args->segptr_64, args->nseg) - i0) * t) / args->ntasks);
+  int64_t lo = 0;
+  int64_t hi = args->nseg;
+  int64_t mid;
+
+  if(t >= args->ntasks){
+    return args->nseg;
+  }
+  while(lo < hi){
+    mid = lo + (hi - lo) / 2;
+    if(SEG_INDEX(args->segptr, args->segptr_64, mid) < target){
+      lo = mid + 1;
+    }else{
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+//add to Y[s * incY] the sum of segment s of X, for segments s0 through s1 - 1
+static void sissegsum_segments(const sissegsum_args *args, const int64_t s0, const int64_t s1){
+  int64_t s;
+  int64_t i0;
+  int64_t i1;
+
+  for(s = s0; s < s1; s++){
+    i0 = SEG_INDEX(args->segptr, args->segptr_64, s);
+    i1 = SEG_INDEX(args->segptr, args->segptr_64, s + 1);
+    if(i1 > i0){
+      idxdBLAS_sissum_64(args->fold, i1 - i0, args->X + i0 * args->incX, args->incX, args->Y + s * args->incY * idxd_sinum(args->fold));
+    }
+  }
+}
+
+static void sissegsum_task(void *args_, const int t){
+  sissegsum_args *args = (sissegsum_args*)args_;
+  sissegsum_segments(args, sissegsum_split(args, t), sissegsum_split(args, t + 1));
+}
+
+static void sissegsum(const int fold, const int64_t nseg, const int *segptr, const int64_t *segptr_64,
+                      const float *X, const int64_t incX, float_indexed *Y, const int64_t incY){
+  sissegsum_args args;
+  int64_t N;
+
+  if(nseg <= 0){
+    return;
+  }
+  N = SEG_INDEX(segptr, segptr_64, nseg) - SEG_INDEX(segptr, segptr_64, 0);
+
+  args.fold = fold;
+  args.nseg = nseg;
+  args.segptr = segptr;
+  args.segptr_64 = segptr_64;
+  args.X = X;
+  args.incX = incX;
+  args.Y = Y;
+  args.incY = incY;
+  args.ntasks = 1;
+  //with fewer segments than threads, the sum of each segment is threaded instead
+  if(idxdPool_parallel((double)N) && nseg >= idxdPool_get_num_threads()){
+    args.ntasks = idxdPool_get_num_threads() > 1 ? idxdPool_get_num_threads() : 2;
+  }
+  if(args.ntasks > 1){
+    idxdPool_dispatch(args.ntasks, sissegsum_task, &args);
+  }else{
+    sissegsum_segments(&args, 0, nseg);
+  }
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the segments of single precision vector X
+ *
+ * Performs the operation
+ *
+ *   y_s := y_s + sum_{segptr_s <= i < segptr_{s + 1}} x_i,
+ *
+ * for s = 0, ..., nseg - 1, where y is an indexed vector.
+ *
+ * Each element of y is the same as that of #idxdBLAS_sissum() applied to its segment, and does not depend on the number of threads. The segments are split among the threads by their number of elements, and if there are fewer segments than threads, the sum of each segment is threaded instead.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1. Segment s of X is made of elements segptr[s] through segptr[s + 1] - 1
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sissegsum(const int fold, const int nseg, const int *segptr,
+                        const float *X, const int incX,
+                        float_indexed *Y, const int incY){
+  sissegsum(fold, nseg, segptr, NULL, X, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed single precision vector Y the sums of the segments of single precision vector X
+ *
+ * Performs the operation
+ *
+ *   y_s := y_s + sum_{segptr_s <= i < segptr_{s + 1}} x_i,
+ *
+ * for s = 0, ..., nseg - 1, where y is an indexed vector.
+ *
+ * Each element of y is the same as that of #idxdBLAS_sissum_64() applied to its segment, and does not depend on the number of threads. The segments are split among the threads by their number of elements, and if there are fewer segments than threads, the sum of each segment is threaded instead.
+ *
+ * Same as #idxdBLAS_sissegsum(), except that the number of segments, segment offsets and strides are 64-bit integers. If a segment is longer than #idxd_SICAPACITY, its element of Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1. Segment s of X is made of elements segptr[s] through segptr[s + 1] - 1
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sissegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+                           const float *X, const int64_t incX,
+                           float_indexed *Y, const int64_t incY){
+  sissegsum(fold, nseg, NULL, segptr, X, incX, Y, incY);
+}
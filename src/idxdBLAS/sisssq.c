@@ -1,4 +1,27 @@
+#include <math.h>
+#include <stdlib.h>
+
 #include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} sisssq_args;
+
+static void sisssq_kernel(void *args_, const int64_t i, const int n, void *Y){
+  sisssq_args *args = (sisssq_args*)args_;
+  float *scaleY = (float*)Y;
+  *scaleY = idxdBLAS_smsssq_64(args->fold, n, args->X + i * args->incX, args->incX, 0.0, scaleY + 1, 1, scaleY + 1 + args->fold, 1);
+}
+
+static void sisssq_combine(void *args_, void *partial, void *Y){
+  sisssq_args *args = (sisssq_args*)args_;
+  float *scaleX = (float*)partial;
+  float *scaleY = (float*)Y;
+  *scaleY = idxd_sisiaddsq(args->fold, *scaleX, (float_indexed*)(scaleX + 1), *scaleY, (float_indexed*)(scaleY + 1));
+}
 
 /**
  * @brief Add to scaled indexed single precision Y the scaled sum of squares of elements of single precision vector X
@@ -17,5 +40,47 @@
  * @date   18 Jan 2016
  */
 float idxdBLAS_sisssq(const int fold, const int N, const float *X, const int incX, const float scaleY, float_indexed *Y){
-  return idxdBLAS_smsssq(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  return idxdBLAS_sisssq_64(fold, N, X, incX, scaleY, Y);
+}
+
+/**
+ * @brief Add to scaled indexed single precision Y the scaled sum of squares of elements of single precision vector X
+ *
+ * Add to Y the scaled indexed sum of the squares of each element of X. The scaling of each square is performed using #idxd_sscale()
+ *
+ * Same as #idxdBLAS_sisssq(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_SICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param scaleY the scaling factor of Y
+ * @param Y indexed scalar Y
+ * @return the new scaling factor of Y
+ *
+ * @date   18 Oct 2026
+ */
+float idxdBLAS_sisssq_64(const int fold, const int64_t N, const float *X, const int64_t incX, const float scaleY, float_indexed *Y){
+  sisssq_args args;
+  float *scaleZ;
+  float scale;
+
+  if(idxdBLAS_capacity_64(N, idxd_SICAPACITY)){
+    idxd_sisadd(fold, NAN, Y);
+    return scaleY;
+  }
+  if(!idxdPool_parallel(N)){
+    return idxdBLAS_smsssq_64(fold, N, X, incX, scaleY, Y, 1, Y + fold, 1);
+  }
+  args.fold = fold;
+  args.X = X;
+  args.incX = incX;
+  scaleZ = (float*)malloc(sizeof(float) + idxd_sisize(fold));
+  *scaleZ = scaleY;
+  idxd_sisiset(fold, Y, scaleZ + 1);
+  idxdPool_reduce(N, sizeof(float) + idxd_sisize(fold), sisssq_kernel, sisssq_combine, &args, X, incX * (ptrdiff_t)sizeof(float), scaleZ);
+  idxd_sisiset(fold, scaleZ + 1, Y);
+  scale = *scaleZ;
+  free(scaleZ);
+  return scale;
 }
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define N_BLOCK 32
+#define K_BLOCK 1024
+
+/**
+ * @brief Add to the upper or lower triangle of indexed single precision matrix C the symmetric rank-k product of single precision matrix A
+ *
+ * Performs one of the symmetric rank-k operations
+ *
+ *   C := alpha*A*A**T + C   or   C := alpha*A**T*A + C,
+ *
+ * where alpha is a scalar, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an indexed N by N matrix of which only the upper or lower triangle is updated.
+ *
+ * Rows of op(A) are packed into contiguous panels once per block and each panel is used for both factors of the block, so that only the requested triangle is computed. Element (i, j) of the triangle is the same as that of #idxdBLAS_sisgemm() with op(B) = op(A)**T.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**T + C, 't' or 'T' or 'c' or 'C' for C := alpha*A**T*A + C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param C indexed single precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sissyrk(const int fold, const char Order,
+                      const char Uplo, const char Trans,
+                      const int N, const int K,
+                      const float alpha, const float *A, const int lda,
+                      float_indexed *C, const int ldc){
+  idxdBLAS_sissyrk_64(fold, Order, Uplo, Trans, N, K, alpha, A, lda, C, ldc);
+}
+
+//set the N by K row-major matrix buf to the block of op(A) at row i and column k, scaled by alpha
+static void sissyrk_pack(const char Order, const char Trans, const int64_t i, const int64_t k, const int64_t N, const int64_t K, const float alpha, const float *A, const int64_t lda, float *buf){
+  int64_t ii;
+  int64_t kk;
+  int row = (Order == 'r' || Order == 'R');
+  int trans = !(Trans == 'n' || Trans == 'N');
+
+  if(row != trans){
+    //rows of op(A) are contiguous
+    for(ii = 0; ii < N; ii++){
+      for(kk = 0; kk < K; kk++){
+        buf[ii * K + kk] = A[(i + ii) * lda + k + kk];
+      }
+    }
+  }else{
+    //columns of op(A) are contiguous
+    for(kk = 0; kk < K; kk++){
+      for(ii = 0; ii < N; ii++){
+        buf[ii * K + kk] = A[(k + kk) * lda + i + ii];
+      }
+    }
+  }
+  if(alpha != 1.0){
+    for(ii = 0; ii < N * K; ii++){
+      buf[ii] *= alpha;
+    }
+  }
+}
+
+/**
+ * @brief Add to the upper or lower triangle of indexed single precision matrix C the symmetric rank-k product of single precision matrix A
+ *
+ * Performs one of the symmetric rank-k operations
+ *
+ *   C := alpha*A*A**T + C   or   C := alpha*A**T*A + C,
+ *
+ * where alpha is a scalar, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an indexed N by N matrix of which only the upper or lower triangle is updated.
+ *
+ * Rows of op(A) are packed into contiguous panels once per block and each panel is used for both factors of the block, so that only the requested triangle is computed. Element (i, j) of the triangle is the same as that of #idxdBLAS_sisgemm_64() with op(B) = op(A)**T.
+ *
+ * Same as #idxdBLAS_sissyrk(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**T + C, 't' or 'T' or 'c' or 'C' for C := alpha*A**T*A + C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param C indexed single precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sissyrk_64(const int fold, const char Order,
+                         const char Uplo, const char Trans,
+                         const int64_t N, const int64_t K,
+                         const float alpha, const float *A, const int64_t lda,
+                         float_indexed *C, const int64_t ldc){
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t k;
+  int64_t m;
+  int64_t n;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+  int lower = (Uplo == 'l' || Uplo == 'L');
+  float *bufA;
+  float *bufB;
+  float *panel;
+
+  if(N == 0 || K == 0 || alpha == 0.0){
+    return;
+  }
+
+  bufA = (float*)malloc(N_BLOCK * K_BLOCK * sizeof(float));
+  bufB = (float*)malloc(N_BLOCK * K_BLOCK * sizeof(float));
+  for(k = 0; k < K; k += K_BLOCK){
+    l = MIN(K_BLOCK, K - k);
+    for(j = 0; j < N; j += N_BLOCK){
+      n = MIN(N_BLOCK, N - j);
+      //rows j through j + n of op(A) form the right factor of every block in this block column
+      sissyrk_pack(Order, Trans, j, k, n, l, 1.0, A, lda, bufB);
+      for(i = lower ? j : 0; i < (lower ? N : j + n); i += N_BLOCK){
+        m = MIN(N_BLOCK, N - i);
+        //the diagonal block reuses the right factor when there is nothing to scale
+        if(i == j && alpha == 1.0){
+          panel = bufB;
+        }else{
+          sissyrk_pack(Order, Trans, i, k, m, l, alpha, A, lda, bufA);
+          panel = bufA;
+        }
+        for(ii = 0; ii < m; ii++){
+          for(jj = 0; jj < n; jj++){
+            if(lower ? i + ii >= j + jj : i + ii <= j + jj){
+              idxdBLAS_sisdot_64(fold, l, panel + ii * l, 1, bufB + jj * l, 1, C + (row ? (i + ii) * ldc + j + jj : (j + jj) * ldc + i + ii) * idxd_sinum(fold));
+            }
+          }
+        }
+      }
+    }
+  }
+  free(bufA);
+  free(bufB);
+}
@@ -0,0 +1,210 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <math.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define T_BLOCK 32
+
+/**
+ * @brief Pack single precision matrix A for repeated products
+ *
+ * Copies op(A) into a new #idxdBLAS_spacked, where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * and op(A) is an M by N matrix. The largest absolute value of each panel of each row of op(A) is computed once here, so that idxdBLAS_sisgemv_packed() and idxdBLAS_sisgemm_packed() need not compute it for each product.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before packing ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A)
+ * @param N number of columns of matrix op(A)
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, N) if A is not transposed and (N, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the packed matrix, or NULL if it could not be allocated
+ *
+ * @date   18 Oct 2026
+ */
+idxdBLAS_spacked *idxdBLAS_spack(const char Order, const char TransA,
+                                 const int M, const int N,
+                                 const float *A, const int lda){
+  return idxdBLAS_spack_64(Order, TransA, M, N, A, lda);
+}
+
+/**
+ * @brief Pack single precision matrix A for repeated products
+ *
+ * Copies op(A) into a new #idxdBLAS_spacked, where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * and op(A) is an M by N matrix. The largest absolute value of each panel of each row of op(A) is computed once here, so that idxdBLAS_sisgemv_packed_64() and idxdBLAS_sisgemm_packed_64() need not compute it for each product.
+ *
+ * Same as #idxdBLAS_spack(), except that the dimensions and leading dimension are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before packing ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A)
+ * @param N number of columns of matrix op(A)
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, N) if A is not transposed and (N, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the packed matrix, or NULL if it could not be allocated
+ *
+ * @date   18 Oct 2026
+ */
+idxdBLAS_spacked *idxdBLAS_spack_64(const char Order, const char TransA,
+                                    const int64_t M, const int64_t N,
+                                    const float *A, const int64_t lda){
+  idxdBLAS_spacked *P;
+  void *mem;
+  int rows;
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t p;
+  int64_t n;
+  int64_t align = idxdBLAS_PACKED_ALIGN / (int64_t)sizeof(float);
+
+  P = (idxdBLAS_spacked*)malloc(sizeof(idxdBLAS_spacked));
+  if(P == NULL){
+    return NULL;
+  }
+  P->M = MAX(M, 0);
+  P->N = MAX(N, 0);
+  P->ldA = (P->N + align - 1) / align * align;
+  P->npanels = (P->N + idxdBLAS_PACKED_PANEL - 1) / idxdBLAS_PACKED_PANEL;
+  if(posix_memalign(&mem, idxdBLAS_PACKED_ALIGN, MAX(P->M * P->ldA, 1) * sizeof(float)) != 0){
+    free(P);
+    return NULL;
+  }
+  P->A = (float*)mem;
+  P->amax = (float*)malloc(MAX(P->M * P->npanels, 1) * sizeof(float));
+  P->iamax = (int*)malloc(MAX(P->M * P->npanels, 1) * sizeof(int));
+  if(P->amax == NULL || P->iamax == NULL){
+    idxdBLAS_spacked_free(P);
+    return NULL;
+  }
+
+  //op(A) is stored by rows in A if A is row major and not transposed or column major and transposed
+  switch(Order){
+    case 'r':
+    case 'R':
+      rows = TransA == 'n' || TransA == 'N';
+      break;
+    default:
+      rows = TransA != 'n' && TransA != 'N';
+      break;
+  }
+  if(rows){
+    for(i = 0; i < P->M; i++){
+      for(j = 0; j < P->N; j++){
+        P->A[i * P->ldA + j] = A[i * lda + j];
+      }
+    }
+  }else{
+    for(i = 0; i < P->M; i += T_BLOCK){
+      for(j = 0; j < P->N; j += T_BLOCK){
+        for(jj = j; jj < P->N && jj < j + T_BLOCK; jj++){
+          for(ii = i; ii < P->M && ii < i + T_BLOCK; ii++){
+            P->A[ii * P->ldA + jj] = A[jj * lda + ii];
+          }
+        }
+      }
+    }
+  }
+
+  for(i = 0; i < P->M; i++){
+    for(p = 0; p < P->npanels; p++){
+      n = MIN(idxdBLAS_PACKED_PANEL, P->N - p * idxdBLAS_PACKED_PANEL);
+      P->amax[i * P->npanels + p] = idxdBLAS_spacked_amax((int)n, P->A + i * P->ldA + p * idxdBLAS_PACKED_PANEL, P->iamax + i * P->npanels + p);
+    }
+  }
+  return P;
+}
+
+/**
+ * @brief Free a packed single precision matrix
+ *
+ * @param A the packed matrix (may be NULL)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_spacked_free(idxdBLAS_spacked *A){
+  if(A == NULL){
+    return;
+  }
+  free(A->A);
+  free(A->amax);
+  free(A->iamax);
+  free(A);
+}
+
+/**
+ * @internal
+ * @brief Find the largest absolute value of single precision vector X
+ *
+ * Unlike #idxdBLAS_samax(), also returns the position of the largest absolute value, and returns NaN if X holds a NaN.
+ *
+ * @param N vector length
+ * @param X single precision vector (contiguous)
+ * @param iamax the position of the returned value in X (0 if N is 0)
+ * @return the largest absolute value of X, 0 if N is 0, or NaN if X holds a NaN
+ *
+ * @date   18 Oct 2026
+ */
+float idxdBLAS_spacked_amax(const int N, const float *X, int *iamax){
+  float amax = 0.0f;
+  float a;
+  int i;
+
+  *iamax = 0;
+  for(i = 0; i < N; i++){
+    a = fabsf(X[i]);
+    if(a > amax){
+      amax = a;
+      *iamax = i;
+    }else if(isnan(a)){
+      *iamax = i;
+      return a;
+    }
+  }
+  return amax;
+}
+
+/**
+ * @internal
+ * @brief Add to indexed single precision Z the dot product of single precision vectors X and Y, given the largest absolute values of X and Y
+ *
+ * The product of @c amaxX and @c amaxY bounds the pairwise products of X and Y, and the products at @c iamaxX and @c iamaxY are among them. If the bound and the larger of these two products lie in the same bin, or if Z already holds a larger bin than the bound, the pairwise products are deposited with #idxdBLAS_smsdot_bounded() without computing their largest absolute value. Otherwise, #idxdBLAS_smsdot() is used. Either way, Z is the same as that of #idxdBLAS_sisdot().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector (contiguous)
+ * @param amaxX the largest absolute value of X, as given by #idxdBLAS_spacked_amax()
+ * @param iamaxX the position of @c amaxX in X
+ * @param Y single precision vector (contiguous)
+ * @param amaxY the largest absolute value of Y, as given by #idxdBLAS_spacked_amax()
+ * @param iamaxY the position of @c amaxY in Y
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_sispacked_dot(const int fold, const int N, const float *X, const float amaxX, const int iamaxX, const float *Y, const float amaxY, const int iamaxY, float_indexed *Z){
+  float bound;
+  float lower;
+
+  if(N <= 0){
+    return;
+  }
+  bound = amaxX * amaxY;
+  if(!ISNANINFF(bound)){
+    lower = MAX(fabsf(X[iamaxX] * Y[iamaxX]), fabsf(X[iamaxY] * Y[iamaxY]));
+    if(idxd_sindex(lower) == idxd_sindex(bound) || (Z[0] != 0.0 && !ISNANINFF(Z[0]) && idxd_smindex(Z) <= idxd_sindex(bound))){
+      idxdBLAS_smsdot_bounded(fold, N, X, 1, Y, 1, bound, Z, 1, Z + fold, 1);
+      return;
+    }
+  }
+  idxdBLAS_smsdot(fold, N, X, 1, Y, 1, Z, 1, Z + fold, 1);
+}
@@ -0,0 +1,177 @@
+#include <math.h>
+
+#include "../config.h"
+#include "idxdBLAS.h"
+
+#if (defined(__AVX__) && defined(__FMA__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#endif
+
+/**
+ * @internal
+ * @brief Split the pairwise products of double precision vectors X and Y into their rounded values and rounding errors
+ *
+ * Set W[i] to the rounded product X[i]*Y[i] and W[N + i] to its rounding error, so that W[i] + W[N + i] is exactly X[i]*Y[i] unless the product underflows. The error of a product that is not finite is set to zero. Contiguous vectors are split with FMA instructions when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK / 2)
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector (output, with room for 2 * N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dtwoprod(const int N, const double *X, const int64_t incX, const double *Y, const int64_t incY, double *W){
+  int i = 0;
+  double p;
+
+  if(incX == 1 && incY == 1){
+    #if (defined(__AVX__) && defined(__FMA__) && !defined(reproBLAS_no__AVX__))
+      __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+      __m256d inf = _mm256_set1_pd(INFINITY);
+      for(; i + 4 <= N; i += 4){
+        __m256d x = _mm256_loadu_pd(X + i);
+        __m256d y = _mm256_loadu_pd(Y + i);
+        __m256d q = _mm256_mul_pd(x, y);
+        __m256d finite = _mm256_cmp_pd(_mm256_and_pd(q, abs_mask), inf, _CMP_LT_OQ);
+        _mm256_storeu_pd(W + i, q);
+        _mm256_storeu_pd(W + N + i, _mm256_and_pd(_mm256_fmsub_pd(x, y, q), finite));
+      }
+    #endif
+  }
+  for(; i < N; i++){
+    p = X[i * incX] * Y[i * incY];
+    W[i] = p;
+    W[N + i] = isfinite(p) ? fma(X[i * incX], Y[i * incY], -p) : 0.0;
+  }
+}
+
+/**
+ * @internal
+ * @brief Split the pairwise products of single precision vectors X and Y into their rounded values and rounding errors
+ *
+ * Set W[i] to the rounded product X[i]*Y[i] and W[N + i] to its rounding error, so that W[i] + W[N + i] is exactly X[i]*Y[i] unless the product underflows. The error of a product that is not finite is set to zero. Contiguous vectors are split with FMA instructions when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK / 2)
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector (output, with room for 2 * N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_stwoprod(const int N, const float *X, const int64_t incX, const float *Y, const int64_t incY, float *W){
+  int i = 0;
+  float p;
+
+  if(incX == 1 && incY == 1){
+    #if (defined(__AVX__) && defined(__FMA__) && !defined(reproBLAS_no__AVX__))
+      __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+      __m256 inf = _mm256_set1_ps(INFINITY);
+      for(; i + 8 <= N; i += 8){
+        __m256 x = _mm256_loadu_ps(X + i);
+        __m256 y = _mm256_loadu_ps(Y + i);
+        __m256 q = _mm256_mul_ps(x, y);
+        __m256 finite = _mm256_cmp_ps(_mm256_and_ps(q, abs_mask), inf, _CMP_LT_OQ);
+        _mm256_storeu_ps(W + i, q);
+        _mm256_storeu_ps(W + N + i, _mm256_and_ps(_mm256_fmsub_ps(x, y, q), finite));
+      }
+    #endif
+  }
+  for(; i < N; i++){
+    p = X[i * incX] * Y[i * incY];
+    W[i] = p;
+    W[N + i] = isfinite(p) ? fmaf(X[i * incX], Y[i * incY], -p) : 0.0f;
+  }
+}
+
+/**
+ * @internal
+ * @brief Split the pairwise products of complex double precision vectors X and Y into their rounded partial products and rounding errors
+ *
+ * Set W[4 * i] through W[4 * i + 3] to four complex numbers whose sum is exactly X[i]*Y[i] (or conj(X[i])*Y[i]) unless a partial product underflows. The first two hold the rounded real and imaginary partial products and the last two their rounding errors. The error of a partial product that is not finite is set to zero.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK / 8)
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param conj 1 if X is to be conjugated, 0 otherwise
+ * @param W complex double precision vector (output, with room for 4 * N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_ztwoprod(const int N, const void *X, const int64_t incX, const void *Y, const int64_t incY, const int conj, void *W){
+  const double *x = (const double*)X;
+  const double *y = (const double*)Y;
+  double *w = (double*)W;
+  double a[4];
+  double b[4];
+  double p;
+  int i;
+  int j;
+
+  for(i = 0; i < N; i++){
+    //the real part is x_r*y_r - x_i*y_i and the imaginary part is x_r*y_i + x_i*y_r
+    a[0] = x[2 * i * incX];
+    b[0] = y[2 * i * incY];
+    a[1] = conj ? x[2 * i * incX + 1] : -x[2 * i * incX + 1];
+    b[1] = y[2 * i * incY + 1];
+    a[2] = x[2 * i * incX];
+    b[2] = y[2 * i * incY + 1];
+    a[3] = conj ? -x[2 * i * incX + 1] : x[2 * i * incX + 1];
+    b[3] = y[2 * i * incY];
+    for(j = 0; j < 4; j++){
+      p = a[j] * b[j];
+      w[8 * i + (j & 1) * 2 + (j >> 1)] = p;
+      w[8 * i + 4 + (j & 1) * 2 + (j >> 1)] = isfinite(p) ? fma(a[j], b[j], -p) : 0.0;
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Split the pairwise products of complex single precision vectors X and Y into their rounded partial products and rounding errors
+ *
+ * Set W[4 * i] through W[4 * i + 3] to four complex numbers whose sum is exactly X[i]*Y[i] (or conj(X[i])*Y[i]) unless a partial product underflows. The first two hold the rounded real and imaginary partial products and the last two their rounding errors. The error of a partial product that is not finite is set to zero.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK / 8)
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param conj 1 if X is to be conjugated, 0 otherwise
+ * @param W complex single precision vector (output, with room for 4 * N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_ctwoprod(const int N, const void *X, const int64_t incX, const void *Y, const int64_t incY, const int conj, void *W){
+  const float *x = (const float*)X;
+  const float *y = (const float*)Y;
+  float *w = (float*)W;
+  float a[4];
+  float b[4];
+  float p;
+  int i;
+  int j;
+
+  for(i = 0; i < N; i++){
+    //the real part is x_r*y_r - x_i*y_i and the imaginary part is x_r*y_i + x_i*y_r
+    a[0] = x[2 * i * incX];
+    b[0] = y[2 * i * incY];
+    a[1] = conj ? x[2 * i * incX + 1] : -x[2 * i * incX + 1];
+    b[1] = y[2 * i * incY + 1];
+    a[2] = x[2 * i * incX];
+    b[2] = y[2 * i * incY + 1];
+    a[3] = conj ? -x[2 * i * incX + 1] : x[2 * i * incX + 1];
+    b[3] = y[2 * i * incY];
+    for(j = 0; j < 4; j++){
+      p = a[j] * b[j];
+      w[8 * i + (j & 1) * 2 + (j >> 1)] = p;
+      w[8 * i + 4 + (j & 1) * 2 + (j >> 1)] = isfinite(p) ? fmaf(a[j], b[j], -p) : 0.0f;
+    }
+  }
+}
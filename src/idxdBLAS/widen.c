@@ -0,0 +1,174 @@
+#include <math.h>
+#include <string.h>
+
+#include "../config.h"
+#include "idxdBLAS.h"
+
+#if (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+  #include <immintrin.h>
+
+#elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+  #include <emmintrin.h>
+
+#endif
+
+/**
+ * @internal
+ * @brief Convert single precision vector X to contiguous double precision vector Y
+ *
+ * The conversion is exact. Contiguous vectors are converted with AVX or SSE2 when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK)
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dswiden(const int N, const float *X, const int64_t incX, double *Y){
+  int i = 0;
+
+  if(incX == 1){
+    #if (defined(__AVX__) && !defined(reproBLAS_no__AVX__))
+      for(; i + 8 <= N; i += 8){
+        __m256 x = _mm256_loadu_ps(X + i);
+        _mm256_storeu_pd(Y + i, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+        _mm256_storeu_pd(Y + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+      }
+    #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+      for(; i + 4 <= N; i += 4){
+        __m128 x = _mm_loadu_ps(X + i);
+        _mm_storeu_pd(Y + i, _mm_cvtps_pd(x));
+        _mm_storeu_pd(Y + i + 2, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+      }
+    #endif
+    for(; i < N; i++){
+      Y[i] = X[i];
+    }
+  }else{
+    for(; i < N; i++){
+      Y[i] = X[i * incX];
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Convert complex single precision vector X to contiguous complex double precision vector Y
+ *
+ * The conversion is exact. Contiguous vectors are converted with AVX or SSE2 when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK / 2)
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zcwiden(const int N, const void *X, const int64_t incX, void *Y){
+  const float *x = (const float*)X;
+  double *y = (double*)Y;
+  int i;
+
+  if(incX == 1){
+    idxdBLAS_dswiden(2 * N, x, 1, y);
+  }else{
+    for(i = 0; i < N; i++){
+      y[2 * i] = x[2 * i * incX];
+      y[2 * i + 1] = x[2 * i * incX + 1];
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Convert half precision vector X to contiguous double precision vector Y
+ *
+ * The elements of X are IEEE 754 binary16 bit patterns. The conversion is exact. Contiguous vectors are converted with AVX-512 or F16C when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK)
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dhwiden(const int N, const uint16_t *X, const int64_t incX, double *Y){
+  int i = 0;
+  uint16_t h;
+  int e;
+  int m;
+
+  if(incX == 1){
+    #if (defined(__AVX512F__) && defined(__F16C__) && !defined(reproBLAS_no__AVX__))
+      for(; i + 8 <= N; i += 8){
+        _mm512_storeu_pd(Y + i, _mm512_cvtps_pd(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(X + i)))));
+      }
+    #elif (defined(__AVX__) && defined(__F16C__) && !defined(reproBLAS_no__AVX__))
+      for(; i + 8 <= N; i += 8){
+        __m256 x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(X + i)));
+        _mm256_storeu_pd(Y + i, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+        _mm256_storeu_pd(Y + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+      }
+    #endif
+  }
+  for(; i < N; i++){
+    h = X[i * incX];
+    e = (h >> 10) & 0x1F;
+    m = h & 0x3FF;
+    if(e == 0x1F){
+      Y[i] = m ? NAN : INFINITY;
+    }else if(e == 0){
+      Y[i] = ldexp(m, -24);
+    }else{
+      Y[i] = ldexp(m | 0x400, e - 25);
+    }
+    if(h & 0x8000){
+      Y[i] = -Y[i];
+    }
+  }
+}
+
+/**
+ * @internal
+ * @brief Convert bfloat16 vector X to contiguous double precision vector Y
+ *
+ * The elements of X are the upper 16 bits of IEEE 754 binary32 bit patterns. The conversion is exact. Contiguous vectors are converted with AVX2 or SSE2 when available.
+ *
+ * @param N vector length (at most #idxdBLAS_WIDEN_BLOCK)
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector (output, with room for N elements)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_dbwiden(const int N, const uint16_t *X, const int64_t incX, double *Y){
+  int i = 0;
+  uint32_t b;
+  float f;
+
+  if(incX == 1){
+    #if (defined(__AVX2__) && !defined(reproBLAS_no__AVX__))
+      for(; i + 8 <= N; i += 8){
+        __m256 x = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(X + i))), 16));
+        _mm256_storeu_pd(Y + i, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+        _mm256_storeu_pd(Y + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+      }
+    #elif (defined(__SSE2__) && !defined(reproBLAS_no__SSE2__))
+      for(; i + 8 <= N; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i*)(X + i));
+        __m128 lo = _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), x));
+        __m128 hi = _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), x));
+        _mm_storeu_pd(Y + i, _mm_cvtps_pd(lo));
+        _mm_storeu_pd(Y + i + 2, _mm_cvtps_pd(_mm_movehl_ps(lo, lo)));
+        _mm_storeu_pd(Y + i + 4, _mm_cvtps_pd(hi));
+        _mm_storeu_pd(Y + i + 6, _mm_cvtps_pd(_mm_movehl_ps(hi, hi)));
+      }
+    #endif
+  }
+  for(; i < N; i++){
+    b = (uint32_t)X[i * incX] << 16;
+    memcpy(&f, &b, sizeof(float));
+    Y[i] = f;
+  }
+}
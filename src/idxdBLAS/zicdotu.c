@@ -0,0 +1,82 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+  const float *Y;
+  int64_t incY;
+} zicdotu_args;
+
+static void zicdotu_kernel(void *args_, const int64_t i, const int n, void *Z){
+  zicdotu_args *args = (zicdotu_args*)args_;
+  idxdBLAS_zmcdotu_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, args->Y + 2 * i * args->incY, args->incY, (double*)Z, 1, (double*)Z + 2 * args->fold, 1);
+}
+
+static void zicdotu_combine(void *args_, void *partial, void *Z){
+  zicdotu_args *args = (zicdotu_args*)args_;
+  idxd_ziziadd(args->fold, (double_complex_indexed*)partial, (double_complex_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed complex double precision Z the unconjugated dot product of complex single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_cicdotu().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zicdotu(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_complex_indexed *Z){
+  idxdBLAS_zicdotu_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed complex double precision Z the unconjugated dot product of complex single precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and Y.
+ *
+ * X and Y are converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_cicdotu().
+ *
+ * Same as #idxdBLAS_zicdotu(), except that the vector length and strides are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z indexed scalar Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zicdotu_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_complex_indexed *Z){
+  zicdotu_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    const double invalid[2] = {NAN, NAN};
+    idxd_zizadd(fold, invalid, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_zmcdotu_64(fold, N, X, incX, Y, incY, Z, 1, Z + 2 * fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  args.Y = (const float*)Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_zisize(fold), zicdotu_kernel, zicdotu_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Z);
+}
@@ -0,0 +1,74 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const float *X;
+  int64_t incX;
+} zicsum_args;
+
+static void zicsum_kernel(void *args_, const int64_t i, const int n, void *Y){
+  zicsum_args *args = (zicsum_args*)args_;
+  idxdBLAS_zmcsum_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, (double*)Y, 1, (double*)Y + 2 * args->fold, 1);
+}
+
+static void zicsum_combine(void *args_, void *partial, void *Y){
+  zicsum_args *args = (zicsum_args*)args_;
+  idxd_ziziadd(args->fold, (double_complex_indexed*)partial, (double_complex_indexed*)Y);
+}
+
+/**
+ * @brief Add to indexed complex double precision Y the sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_cicsum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zicsum(const int fold, const int N, const void *X, const int incX, double_complex_indexed *Y){
+  idxdBLAS_zicsum_64(fold, N, X, incX, Y);
+}
+
+/**
+ * @brief Add to indexed complex double precision Y the sum of complex single precision vector X
+ *
+ * Add to Y the indexed sum of X.
+ *
+ * X is converted to double precision and accumulated in indexed double precision, which needs fewer renormalizations and is more accurate than #idxdBLAS_cicsum().
+ *
+ * Same as #idxdBLAS_zicsum(), except that the vector length and stride are 64-bit integers. If @c N is greater than #idxd_DICAPACITY, Y is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y indexed scalar Y
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zicsum_64(const int fold, const int64_t N, const void *X, const int64_t incX, double_complex_indexed *Y){
+  zicsum_args args;
+
+  if(idxdBLAS_capacity_64(N, idxd_DICAPACITY)){
+    const double invalid[2] = {NAN, NAN};
+    idxd_zizadd(fold, invalid, Y);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_zmcsum_64(fold, N, X, incX, Y, 1, Y + 2 * fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const float*)X;
+  args.incX = incX;
+  idxdPool_reduce(N, idxd_zisize(fold), zicsum_kernel, zicsum_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(float), Y);
+}
@@ -0,0 +1,82 @@
+#include <math.h>
+
+#include "idxdBLAS.h"
+#include "idxdPool.h"
+
+typedef struct {
+  int fold;
+  const double *X;
+  int64_t incX;
+  const double *Y;
+  int64_t incY;
+} zizdotc_fma_args;
+
+static void zizdotc_fma_kernel(void *args_, const int64_t i, const int n, void *Z){
+  zizdotc_fma_args *args = (zizdotc_fma_args*)args_;
+  idxdBLAS_zmzdotc_fma_64(args->fold, n, args->X + 2 * i * args->incX, args->incX, args->Y + 2 * i * args->incY, args->incY, (double*)Z, 1, (double*)Z + 2 * args->fold, 1);
+}
+
+static void zizdotc_fma_combine(void *args_, void *partial, void *Z){
+  zizdotc_fma_args *args = (zizdotc_fma_args*)args_;
+  idxd_ziziadd(args->fold, (double_complex_indexed*)partial, (double_complex_indexed*)Z);
+}
+
+/**
+ * @brief Add to indexed complex double precision Z the conjugated dot product of complex double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and conjugated Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_zizdotc() of the same fold at the cost of depositing four times as many values.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z scalar return Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizdotc_fma(const int fold, const int N, const void *X, const int incX, const void *Y, const int incY, double_complex_indexed *Z){
+  idxdBLAS_zizdotc_fma_64(fold, N, X, incX, Y, incY, Z);
+}
+
+/**
+ * @brief Add to indexed complex double precision Z the conjugated dot product of complex double precision vectors X and Y
+ *
+ * Add to Z the indexed sum of the pairwise products of X and conjugated Y.
+ *
+ * Each product is split into its rounded value and rounding error, both of which are accumulated, so that the result is more accurate than that of #idxdBLAS_zizdotc() of the same fold at the cost of depositing four times as many values.
+ *
+ * Same as #idxdBLAS_zizdotc_fma(), except that the vector length and strides are 64-bit integers. If @c 4 * N is greater than #idxd_DICAPACITY, Z is set to NaN.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param Z scalar return Z
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizdotc_fma_64(const int fold, const int64_t N, const void *X, const int64_t incX, const void *Y, const int64_t incY, double_complex_indexed *Z){
+  zizdotc_fma_args args;
+
+  if(idxdBLAS_capacity_64(4 * N, idxd_DICAPACITY)){
+    const double invalid[2] = {NAN, NAN};
+    idxd_zizadd(fold, invalid, Z);
+    return;
+  }
+  if(!idxdPool_parallel(N)){
+    idxdBLAS_zmzdotc_fma_64(fold, N, X, incX, Y, incY, Z, 1, Z + 2 * fold, 1);
+    return;
+  }
+  args.fold = fold;
+  args.X = (const double*)X;
+  args.incX = incX;
+  args.Y = (const double*)Y;
+  args.incY = incY;
+  idxdPool_reduce(N, idxd_zisize(fold), zizdotc_fma_kernel, zizdotc_fma_combine, &args, X, 2 * incX * (ptrdiff_t)sizeof(double), Z);
+}
@@ -0,0 +1,186 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define M_BLOCK 32
+#define N_BLOCK 32
+#define K_BLOCK 1024
+
+/**
+ * @brief Add to indexed complex double precision matrix C the matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha is a scalar, A and B are matrices with op(A) an M by K matrix and op(B) a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * A and B are given in planar layout, as separate real matrices of their real and imaginary parts (see idxdBLAS_zdeinterleave()). Blocks of op(A) and op(B) are packed into contiguous real panels and the four real products of each complex product are deposited into the real and imaginary parts of C with the real indexed kernels. The result is the same as that of #idxdBLAS_zizgemm() on the interleaved A and B.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed complex double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizgemm_planar(const int fold, const char Order,
+                             const char TransA, const char TransB,
+                             const int M, const int N, const int K,
+                             const void *alpha, const double *AR, const double *AI, const int lda,
+                             const double *BR, const double *BI, const int ldb,
+                             double_complex_indexed *C, const int ldc){
+  idxdBLAS_zizgemm_planar_64(fold, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, C, ldc);
+}
+
+//set the M by N matrices bufR and bufI (in row-major order if rowbuf is set, column-major otherwise) to the real and imaginary parts of the block of op(X) at row i and column j
+static void zizgemm_planar_pack(const char Order, const char TransX, const int rowbuf, const int64_t i, const int64_t j, const int64_t M, const int64_t N, const double *XR, const double *XI, const int64_t ldx, double *bufR, double *bufI){
+  int64_t ii;
+  int64_t jj;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+  int trans = !(TransX == 'n' || TransX == 'N');
+  double sign = (TransX == 'c' || TransX == 'C') ? -1.0 : 1.0;
+
+  if(row != trans){
+    //rows of op(X) are contiguous
+    for(ii = 0; ii < M; ii++){
+      for(jj = 0; jj < N; jj++){
+        l = rowbuf ? ii * N + jj : jj * M + ii;
+        bufR[l] = XR[(i + ii) * ldx + j + jj];
+        bufI[l] = sign * XI[(i + ii) * ldx + j + jj];
+      }
+    }
+  }else{
+    //columns of op(X) are contiguous
+    for(jj = 0; jj < N; jj++){
+      for(ii = 0; ii < M; ii++){
+        l = rowbuf ? ii * N + jj : jj * M + ii;
+        bufR[l] = XR[(j + jj) * ldx + i + ii];
+        bufI[l] = sign * XI[(j + jj) * ldx + i + ii];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Add to indexed complex double precision matrix C the matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + C,
+ *
+ * where op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha is a scalar, A and B are matrices with op(A) an M by K matrix and op(B) a K by N matrix, and C is an indexed M by N matrix.
+ *
+ * A and B are given in planar layout, as separate real matrices of their real and imaginary parts (see idxdBLAS_zdeinterleave()). Blocks of op(A) and op(B) are packed into contiguous real panels and the four real products of each complex product are deposited into the real and imaginary parts of C with the real indexed kernels. The result is the same as that of #idxdBLAS_zizgemm_64() on the interleaved A and B.
+ *
+ * Same as #idxdBLAS_zizgemm_planar(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param C indexed complex double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizgemm_planar_64(const int fold, const char Order,
+                                const char TransA, const char TransB,
+                                const int64_t M, const int64_t N, const int64_t K,
+                                const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                                const double *BR, const double *BI, const int64_t ldb,
+                                double_complex_indexed *C, const int64_t ldc){
+  const double *alpha_ = (const double*)alpha;
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t k;
+  int64_t kk;
+  int64_t m;
+  int64_t n;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+  double ar;
+  double *bufAR;
+  double *bufAI;
+  double *bufBR;
+  double *bufBI;
+  double *bufBN;
+
+  if(M == 0 || N == 0 || K == 0 || (alpha_[0] == 0.0 && alpha_[1] == 0.0)){
+    return;
+  }
+
+  bufAR = (double*)malloc(M_BLOCK * K_BLOCK * sizeof(double));
+  bufAI = (double*)malloc(M_BLOCK * K_BLOCK * sizeof(double));
+  bufBR = (double*)malloc(K_BLOCK * N_BLOCK * sizeof(double));
+  bufBI = (double*)malloc(K_BLOCK * N_BLOCK * sizeof(double));
+  bufBN = (double*)malloc(K_BLOCK * N_BLOCK * sizeof(double));
+  for(k = 0; k < K; k += K_BLOCK){
+    l = MIN(K_BLOCK, K - k);
+    for(j = 0; j < N; j += N_BLOCK){
+      n = MIN(N_BLOCK, N - j);
+      //columns of op(B) are packed contiguously, along with their negated imaginary parts
+      zizgemm_planar_pack(Order, TransB, 0, k, j, l, n, BR, BI, ldb, bufBR, bufBI);
+      for(kk = 0; kk < l * n; kk++){
+        bufBN[kk] = -bufBI[kk];
+      }
+      for(i = 0; i < M; i += M_BLOCK){
+        m = MIN(M_BLOCK, M - i);
+        //rows of op(A) are packed contiguously and scaled by alpha as in idxdBLAS_zizgemm()
+        zizgemm_planar_pack(Order, TransA, 1, i, k, m, l, AR, AI, lda, bufAR, bufAI);
+        if(alpha_[0] != 1.0 || alpha_[1] != 0.0){
+          for(kk = 0; kk < m * l; kk++){
+            ar = bufAR[kk];
+            bufAR[kk] = ar * alpha_[0] - bufAI[kk] * alpha_[1];
+            bufAI[kk] = ar * alpha_[1] + bufAI[kk] * alpha_[0];
+          }
+        }
+        //the real part of a*b is ar*br + ai*(-bi) and the imaginary part is ar*bi + ai*br
+        for(ii = 0; ii < m; ii++){
+          for(jj = 0; jj < n; jj++){
+            idxdBLAS_zizdot_planar(fold, l, bufAR + ii * l, bufAI + ii * l, bufBR + jj * l, bufBN + jj * l, bufBI + jj * l, bufBR + jj * l, C + (row ? (i + ii) * ldc + j + jj : (j + jj) * ldc + i + ii) * idxd_zinum(fold));
+          }
+        }
+      }
+    }
+  }
+  free(bufAR);
+  free(bufAI);
+  free(bufBR);
+  free(bufBI);
+  free(bufBN);
+}
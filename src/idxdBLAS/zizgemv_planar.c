@@ -0,0 +1,174 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define X_BLOCK 1024
+#define A_BLOCK 16384
+
+/**
+ * @brief Add to indexed complex double precision vector Y the matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y   or   y := alpha*A**H*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * A and X are given in planar layout, as separate real matrices or vectors of their real and imaginary parts (see idxdBLAS_zdeinterleave()). The four real products of each complex product are deposited into the real and imaginary parts of Y with the real indexed kernels, which need no shuffles to separate real and imaginary parts. The result is the same as that of #idxdBLAS_zizgemv() on the interleaved A and X.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param Y indexed complex double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizgemv_planar(const int fold, const char Order,
+                             const char TransA, const int M, const int N,
+                             const void *alpha, const double *AR, const double *AI, const int lda,
+                             const double *XR, const double *XI, const int incX,
+                             double_complex_indexed *Y, const int incY){
+  idxdBLAS_zizgemv_planar_64(fold, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, Y, incY);
+}
+
+/**
+ * @brief Add to indexed complex double precision vector Y the matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + y   or   y := alpha*A**T*x + y   or   y := alpha*A**H*x + y,
+ *
+ * where alpha is a scalar, x is a vector, y is an indexed vector, and A is an M by N matrix.
+ *
+ * A and X are given in planar layout, as separate real matrices or vectors of their real and imaginary parts (see idxdBLAS_zdeinterleave()). The four real products of each complex product are deposited into the real and imaginary parts of Y with the real indexed kernels, which need no shuffles to separate real and imaginary parts. The result is the same as that of #idxdBLAS_zizgemv_64() on the interleaved A and X.
+ *
+ * Same as #idxdBLAS_zizgemv_planar(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param Y indexed complex double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizgemv_planar_64(const int fold, const char Order,
+                                const char TransA, const int64_t M, const int64_t N,
+                                const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                                const double *XR, const double *XI, const int64_t incX,
+                                double_complex_indexed *Y, const int64_t incY){
+  const double *alpha_ = (const double*)alpha;
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t opM;
+  int64_t opN;
+  int64_t m;
+  int64_t n;
+  int64_t mb;
+  int64_t nb;
+  int rows;
+  double sign;
+  double xr;
+  double xi;
+  double *bufX;
+  double *bufAR;
+  double *bufAI;
+
+  if(M == 0 || N == 0 || (alpha_[0] == 0.0 && alpha_[1] == 0.0)){
+    return;
+  }
+
+  //op(A) is opM by opN, and its rows are contiguous in A if rows is set
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opM = M;
+      opN = N;
+      rows = (Order == 'r' || Order == 'R');
+      sign = 1.0;
+      break;
+    case 't':
+    case 'T':
+      opM = N;
+      opN = M;
+      rows = !(Order == 'r' || Order == 'R');
+      sign = 1.0;
+      break;
+    default:
+      opM = N;
+      opN = M;
+      rows = !(Order == 'r' || Order == 'R');
+      sign = -1.0;
+      break;
+  }
+
+  //with a = (ar, sign * ai), the real part of a*x is ar*xr + ai*(-sign * xi) and the imaginary part is ar*xi + ai*(sign * xr)
+  bufX = (double*)malloc(4 * opN * sizeof(double));
+  for(j = 0; j < opN; j++){
+    if(alpha_[0] == 1.0 && alpha_[1] == 0.0){
+      xr = XR[j * incX];
+      xi = XI[j * incX];
+    }else{
+      xr = XR[j * incX] * alpha_[0] - XI[j * incX] * alpha_[1];
+      xi = XR[j * incX] * alpha_[1] + XI[j * incX] * alpha_[0];
+    }
+    bufX[j] = xr;
+    bufX[opN + j] = xi;
+    bufX[2 * opN + j] = -sign * xi;
+    bufX[3 * opN + j] = sign * xr;
+  }
+
+  if(rows){
+    for(j = 0; j < opN; j += X_BLOCK){
+      n = MIN(X_BLOCK, opN - j);
+      for(i = 0; i < opM; i++){
+        idxdBLAS_zizdot_planar(fold, n, AR + i * lda + j, AI + i * lda + j, bufX + j, bufX + 2 * opN + j, bufX + opN + j, bufX + 3 * opN + j, Y + i * incY * idxd_zinum(fold));
+      }
+    }
+  }else{
+    nb = MIN(opN, X_BLOCK);
+    mb = MIN(opM, A_BLOCK / nb);
+    bufAR = (double*)malloc(mb * nb * sizeof(double));
+    bufAI = (double*)malloc(mb * nb * sizeof(double));
+    for(i = 0; i < opM; i += mb){
+      m = MIN(mb, opM - i);
+      for(j = 0; j < opN; j += nb){
+        n = MIN(nb, opN - j);
+        for(jj = 0; jj < n; jj++){
+          for(ii = 0; ii < m; ii++){
+            bufAR[ii * n + jj] = AR[(j + jj) * lda + i + ii];
+            bufAI[ii * n + jj] = AI[(j + jj) * lda + i + ii];
+          }
+        }
+        for(ii = 0; ii < m; ii++){
+          idxdBLAS_zizdot_planar(fold, n, bufAR + ii * n, bufAI + ii * n, bufX + j, bufX + 2 * opN + j, bufX + opN + j, bufX + 3 * opN + j, Y + (i + ii) * incY * idxd_zinum(fold));
+        }
+      }
+    }
+    free(bufAR);
+    free(bufAI);
+  }
+  free(bufX);
+}
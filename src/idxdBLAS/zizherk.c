@@ -0,0 +1,161 @@
+#include <stdlib.h>
+
+#include "../common/common.h"
+#include "idxdBLAS.h"
+
+#define N_BLOCK 32
+#define K_BLOCK 1024
+
+/**
+ * @brief Add to the upper or lower triangle of indexed complex double precision matrix C the hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + C   or   C := alpha*A**H*A + C,
+ *
+ * where alpha is a real scalar, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an indexed N by N matrix of which only the upper or lower triangle is updated.
+ *
+ * Rows of op(A) are packed into contiguous panels once per block and each panel is used for both factors of the block, so that only the requested triangle is computed. Element (i, j) of the triangle is the same as that of #idxdBLAS_zizgemm() with op(B) = op(A)**H and the complex scalar (alpha, 0). In particular, the imaginary parts of the diagonal elements are accumulated as well and need not be zero.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + C, 'c' or 'C' for C := alpha*A**H*A + C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param C indexed complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizherk(const int fold, const char Order,
+                      const char Uplo, const char Trans,
+                      const int N, const int K,
+                      const double alpha, const void *A, const int lda,
+                      double_complex_indexed *C, const int ldc){
+  idxdBLAS_zizherk_64(fold, Order, Uplo, Trans, N, K, alpha, A, lda, C, ldc);
+}
+
+//set the N by K row-major complex matrix buf to the block of op(A) at row i and column k, scaled by alpha as in idxdBLAS_zizgemm()
+static void zizherk_pack(const char Order, const char Trans, const int64_t i, const int64_t k, const int64_t N, const int64_t K, const double alpha, const double *A, const int64_t lda, double *buf){
+  int64_t ii;
+  int64_t kk;
+  int row = (Order == 'r' || Order == 'R');
+  int trans = !(Trans == 'n' || Trans == 'N');
+  double alpha_[2] = {alpha, 0.0};
+  double ar;
+
+  if(row != trans){
+    //rows of op(A) are contiguous
+    for(ii = 0; ii < N; ii++){
+      for(kk = 0; kk < K; kk++){
+        buf[2 * (ii * K + kk)] = A[2 * ((i + ii) * lda + k + kk)];
+        buf[2 * (ii * K + kk) + 1] = A[2 * ((i + ii) * lda + k + kk) + 1];
+      }
+    }
+  }else{
+    //columns of op(A) are contiguous
+    for(kk = 0; kk < K; kk++){
+      for(ii = 0; ii < N; ii++){
+        buf[2 * (ii * K + kk)] = A[2 * ((k + kk) * lda + i + ii)];
+        buf[2 * (ii * K + kk) + 1] = A[2 * ((k + kk) * lda + i + ii) + 1];
+      }
+    }
+  }
+  if(trans){
+    for(ii = 0; ii < N * K; ii++){
+      buf[2 * ii + 1] = -buf[2 * ii + 1];
+    }
+  }
+  if(alpha != 1.0){
+    for(ii = 0; ii < N * K; ii++){
+      ar = buf[2 * ii];
+      buf[2 * ii] = ar * alpha_[0] - buf[2 * ii + 1] * alpha_[1];
+      buf[2 * ii + 1] = ar * alpha_[1] + buf[2 * ii + 1] * alpha_[0];
+    }
+  }
+}
+
+/**
+ * @brief Add to the upper or lower triangle of indexed complex double precision matrix C the hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + C   or   C := alpha*A**H*A + C,
+ *
+ * where alpha is a real scalar, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an indexed N by N matrix of which only the upper or lower triangle is updated.
+ *
+ * Rows of op(A) are packed into contiguous panels once per block and each panel is used for both factors of the block, so that only the requested triangle is computed. Element (i, j) of the triangle is the same as that of #idxdBLAS_zizgemm_64() with op(B) = op(A)**H and the complex scalar (alpha, 0). In particular, the imaginary parts of the diagonal elements are accumulated as well and need not be zero.
+ *
+ * Same as #idxdBLAS_zizherk(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + C, 'c' or 'C' for C := alpha*A**H*A + C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param C indexed complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void idxdBLAS_zizherk_64(const int fold, const char Order,
+                         const char Uplo, const char Trans,
+                         const int64_t N, const int64_t K,
+                         const double alpha, const void *A, const int64_t lda,
+                         double_complex_indexed *C, const int64_t ldc){
+  int64_t i;
+  int64_t ii;
+  int64_t j;
+  int64_t jj;
+  int64_t k;
+  int64_t m;
+  int64_t n;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+  int lower = (Uplo == 'l' || Uplo == 'L');
+  double *bufA;
+  double *bufB;
+  double *panel;
+
+  if(N == 0 || K == 0 || alpha == 0.0){
+    return;
+  }
+
+  bufA = (double*)malloc(2 * N_BLOCK * K_BLOCK * sizeof(double));
+  bufB = (double*)malloc(2 * N_BLOCK * K_BLOCK * sizeof(double));
+  for(k = 0; k < K; k += K_BLOCK){
+    l = MIN(K_BLOCK, K - k);
+    for(j = 0; j < N; j += N_BLOCK){
+      n = MIN(N_BLOCK, N - j);
+      //rows j through j + n of op(A) form the right factor of every block in this block column
+      zizherk_pack(Order, Trans, j, k, n, l, 1.0, (const double*)A, lda, bufB);
+      for(i = lower ? j : 0; i < (lower ? N : j + n); i += N_BLOCK){
+        m = MIN(N_BLOCK, N - i);
+        //the diagonal block reuses the right factor when there is nothing to scale
+        if(i == j && alpha == 1.0){
+          panel = bufB;
+        }else{
+          zizherk_pack(Order, Trans, i, k, m, l, alpha, (const double*)A, lda, bufA);
+          panel = bufA;
+        }
+        for(ii = 0; ii < m; ii++){
+          for(jj = 0; jj < n; jj++){
+            if(lower ? i + ii >= j + jj : i + ii <= j + jj){
+              idxdBLAS_zizdotc_64(fold, l, bufB + 2 * jj * l, 1, panel + 2 * ii * l, 1, C + (row ? (i + ii) * ldc + j + jj : (j + jj) * ldc + i + ii) * idxd_zinum(fold));
+            }
+          }
+        }
+      }
+    }
+  }
+  free(bufA);
+  free(bufB);
+}
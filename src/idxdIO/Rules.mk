@@ -0,0 +1,11 @@
+TARGETS := libidxdio.a
+SUBDIRS :=
+
+INSTALL_LIB := $(TARGETS)
+
+LIBIDXDIO := $(OBJPATH)/libidxdio.a
+
+libidxdio.a_DEPS = $$(LIBIDXD) header.o \
+                               write.o \
+                               read.o \
+                               map.o
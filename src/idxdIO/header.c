@@ -0,0 +1,138 @@
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdIO.h>
+
+static uint32_t idxdIO_swap32(uint32_t x){
+  return (x >> 24) | ((x >> 8) & 0x0000FF00u) | ((x << 8) & 0x00FF0000u) | (x << 24);
+}
+
+static uint64_t idxdIO_swap64(uint64_t x){
+  return ((uint64_t)idxdIO_swap32((uint32_t)x) << 32) | idxdIO_swap32((uint32_t)(x >> 32));
+}
+
+/**
+ * @brief Get the size of a stored indexed value
+ *
+ * @param type the type of the value
+ * @param fold the fold of the value
+ * @return the size (in bytes) of the value, or 0 if @c type or @c fold is not valid
+ *
+ * @date   18 Oct 2026
+ */
+size_t idxdIO_size(const idxdIO_type type, const int fold){
+  switch(type){
+    case idxdIO_DOUBLE_INDEXED:
+      return fold >= 1 && fold <= idxd_DIMAXFOLD ? idxd_disize(fold) : 0;
+    case idxdIO_DOUBLE_COMPLEX_INDEXED:
+      return fold >= 1 && fold <= idxd_DIMAXFOLD ? idxd_zisize(fold) : 0;
+    case idxdIO_FLOAT_INDEXED:
+      return fold >= 1 && fold <= idxd_SIMAXFOLD ? idxd_sisize(fold) : 0;
+    case idxdIO_FLOAT_COMPLEX_INDEXED:
+      return fold >= 1 && fold <= idxd_SIMAXFOLD ? idxd_cisize(fold) : 0;
+    case idxdIO_DOUBLE_INDEXED_SCALED:
+      return fold >= 1 && fold <= idxd_DIMAXFOLD ? sizeof(double) + idxd_disize(fold) : 0;
+    case idxdIO_FLOAT_INDEXED_SCALED:
+      return fold >= 1 && fold <= idxd_SIMAXFOLD ? sizeof(float) + idxd_sisize(fold) : 0;
+  }
+  return 0;
+}
+
+/**
+ * @brief Fill in a header
+ *
+ * @param header the header (output)
+ * @param type the type of the values
+ * @param fold the fold of the values
+ * @param count the number of values
+ * @return 0 on success, nonzero if @c type or @c fold is not valid
+ *
+ * @date   18 Oct 2026
+ */
+int idxdIO_header_init(idxdIO_header *header, const idxdIO_type type, const int fold, const size_t count){
+  memset(header, 0, sizeof(idxdIO_header));
+  memcpy(header->magic, idxdIO_MAGIC, sizeof(header->magic));
+  header->endian = idxdIO_ENDIAN;
+  header->version = idxdIO_VERSION;
+  header->type = (uint32_t)type;
+  header->fold = (uint32_t)fold;
+  header->diwidth = DIWIDTH;
+  header->siwidth = SIWIDTH;
+  header->dimaxindex = idxd_DIMAXINDEX;
+  header->simaxindex = idxd_SIMAXINDEX;
+  header->count = (uint64_t)count;
+  header->size = (uint64_t)idxdIO_size(type, fold);
+  header->offset = idxdIO_HEADER_SIZE;
+  return header->size == 0;
+}
+
+/**
+ * @brief Check a header and convert its fields to the byte order of the current machine
+ *
+ * All fields but @c endian are converted, so that @c header->endian is still #idxdIO_ENDIAN if and only if the values that follow the header are in the byte order of the current machine.
+ *
+ * @param header the header (as read from a file)
+ * @return 0 if the header is valid, nonzero if it is not in the format, is of a later version, was written by a library built with other bin parameters, or does not describe a valid type, fold and size
+ *
+ * @date   18 Oct 2026
+ */
+int idxdIO_header_check(idxdIO_header *header){
+  if(memcmp(header->magic, idxdIO_MAGIC, sizeof(header->magic)) != 0){
+    return 1;
+  }
+  if(header->endian != idxdIO_ENDIAN){
+    if(idxdIO_swap32(header->endian) != idxdIO_ENDIAN){
+      return 1;
+    }
+    header->version = idxdIO_swap32(header->version);
+    header->type = idxdIO_swap32(header->type);
+    header->fold = idxdIO_swap32(header->fold);
+    header->diwidth = idxdIO_swap32(header->diwidth);
+    header->siwidth = idxdIO_swap32(header->siwidth);
+    header->dimaxindex = idxdIO_swap32(header->dimaxindex);
+    header->simaxindex = idxdIO_swap32(header->simaxindex);
+    header->count = idxdIO_swap64(header->count);
+    header->size = idxdIO_swap64(header->size);
+    header->offset = idxdIO_swap64(header->offset);
+  }
+  if(header->version < 1 || header->version > idxdIO_VERSION || header->offset < idxdIO_HEADER_SIZE){
+    return 1;
+  }
+  //the values are only meaningful in the bins they were accumulated in
+  if(header->diwidth != DIWIDTH || header->siwidth != SIWIDTH || header->dimaxindex != idxd_DIMAXINDEX || header->simaxindex != idxd_SIMAXINDEX){
+    return 1;
+  }
+  return header->size == 0 || header->size != (uint64_t)idxdIO_size((idxdIO_type)header->type, (int)header->fold);
+}
+
+/**
+ * @brief Reverse the byte order of stored indexed values
+ *
+ * Each @c double (or @c float) making up the values has its bytes reversed.
+ *
+ * @param type the type of the values
+ * @param n the number of bytes making up the values
+ * @param X the values
+ *
+ * @date   18 Oct 2026
+ */
+void idxdIO_swap(const idxdIO_type type, const size_t n, void *X){
+  size_t i;
+  uint64_t *X64 = (uint64_t*)X;
+  uint32_t *X32 = (uint32_t*)X;
+
+  switch(type){
+    case idxdIO_DOUBLE_INDEXED:
+    case idxdIO_DOUBLE_COMPLEX_INDEXED:
+    case idxdIO_DOUBLE_INDEXED_SCALED:
+      for(i = 0; i < n / sizeof(uint64_t); i++){
+        X64[i] = idxdIO_swap64(X64[i]);
+      }
+      break;
+    default:
+      for(i = 0; i < n / sizeof(uint32_t); i++){
+        X32[i] = idxdIO_swap32(X32[i]);
+      }
+      break;
+  }
+}
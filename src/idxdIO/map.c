@@ -0,0 +1,37 @@
+#include <string.h>
+
+#include <idxdIO.h>
+
+/**
+ * @brief Use indexed values stored in memory in place
+ *
+ * @c buffer holds a header followed by values, typically because a file has been mapped into memory. The header is checked and the address of the first value is returned, so that the values can be used without copying them. If the values were written on a machine of the other byte order, they are converted in place and the header in @c buffer is rewritten in the current byte order, so that later calls on the same buffer (or a shared mapping of the same file) find nothing to convert. For this reason @c buffer must be writable if the values might come from a machine of the other byte order (a private mapping suffices).
+ *
+ * @param buffer the buffer
+ * @param length the length (in bytes) of the buffer
+ * @param header the header, converted to the current byte order (output)
+ * @return the address of the first value in @c buffer, or NULL if the buffer does not hold a valid header followed by all of its values
+ *
+ * @date   18 Oct 2026
+ */
+void *idxdIO_map(void *buffer, const size_t length, idxdIO_header *header){
+  char *values;
+
+  if(length < idxdIO_HEADER_SIZE){
+    return NULL;
+  }
+  memcpy(header, buffer, sizeof(idxdIO_header));
+  if(idxdIO_header_check(header) != 0){
+    return NULL;
+  }
+  if(header->offset > length || (length - header->offset) / header->size < header->count){
+    return NULL;
+  }
+  values = (char*)buffer + header->offset;
+  if(header->endian != idxdIO_ENDIAN){
+    idxdIO_swap((idxdIO_type)header->type, (size_t)(header->count * header->size), values);
+    header->endian = idxdIO_ENDIAN;
+    memcpy(buffer, header, sizeof(idxdIO_header));
+  }
+  return values;
+}
@@ -0,0 +1,46 @@
+#include <idxdIO.h>
+
+/**
+ * @brief Read the header of indexed values from a stream
+ *
+ * The header is checked and converted with idxdIO_header_check(). The stream is left positioned at the first value, so that idxdIO_read() can follow. A caller expecting a given type and fold should compare them to @c header->type and @c header->fold.
+ *
+ * @param stream the stream, positioned at the start of a header
+ * @param header the header (output)
+ * @return 0 on success, nonzero if the stream could not be read or does not hold a valid header
+ *
+ * @date   18 Oct 2026
+ */
+int idxdIO_read_header(FILE *stream, idxdIO_header *header){
+  if(fread(header, sizeof(idxdIO_header), 1, stream) != 1 || idxdIO_header_check(header) != 0){
+    return 1;
+  }
+  if(header->offset > idxdIO_HEADER_SIZE && fseek(stream, (long)(header->offset - idxdIO_HEADER_SIZE), SEEK_CUR) != 0){
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief Read indexed values from a stream
+ *
+ * Reads the @c header->count values following a header read with idxdIO_read_header(), with a single call to @c fread(). Values written on a machine of the other byte order are converted.
+ *
+ * @param stream the stream, as left by idxdIO_read_header()
+ * @param header the header
+ * @param X the values (output, with room for @c header->count values of @c header->size bytes)
+ * @return 0 on success, nonzero if the stream could not be read
+ *
+ * @date   18 Oct 2026
+ */
+int idxdIO_read(FILE *stream, const idxdIO_header *header, void *X){
+  size_t count = (size_t)header->count;
+
+  if(count > 0 && fread(X, (size_t)header->size, count, stream) != count){
+    return 1;
+  }
+  if(header->endian != idxdIO_ENDIAN){
+    idxdIO_swap((idxdIO_type)header->type, count * (size_t)header->size, X);
+  }
+  return 0;
+}
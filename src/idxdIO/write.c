@@ -0,0 +1,30 @@
+#include <idxdIO.h>
+
+/**
+ * @brief Write indexed values to a stream
+ *
+ * Writes a header followed by the @c count values of @c X, as they are laid out in memory. The values are written with a single call to @c fwrite().
+ *
+ * @param stream the stream, positioned where the header should start (typically at the start of a file)
+ * @param type the type of the values
+ * @param fold the fold of the values
+ * @param count the number of values
+ * @param X the values (@c count consecutive indexed types)
+ * @return 0 on success, nonzero if @c type or @c fold is not valid or the stream could not be written
+ *
+ * @date   18 Oct 2026
+ */
+int idxdIO_write(FILE *stream, const idxdIO_type type, const int fold, const size_t count, const void *X){
+  idxdIO_header header;
+
+  if(idxdIO_header_init(&header, type, fold, count) != 0){
+    return 1;
+  }
+  if(fwrite(&header, sizeof(header), 1, stream) != 1){
+    return 1;
+  }
+  if(count > 0 && fwrite(X, (size_t)header.size, count, stream) != count){
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,11 @@
+TARGETS := libidxdpool.a
+SUBDIRS :=
+
+INSTALL_LIB := $(TARGETS)
+
+LIBIDXDPOOL := $(OBJPATH)/libidxdpool.a
+
+libidxdpool.a_DEPS = pool.o \
+                     library.o \
+                     reduce.o \
+                     numa.o
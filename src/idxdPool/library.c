@@ -0,0 +1,360 @@
+#include <stdlib.h>
+#ifndef reproBLAS_no_pthread
+#include <pthread.h>
+#endif
+
+#include <idxdPool.h>
+
+/*
+ * The library pool is created on first use with REPROBLAS_NUM_THREADS threads
+ * (1 if the variable is not set), and recreated by idxdPool_set_num_threads().
+ * Library routines hold a reference to the pool they run on, and a pool that
+ * has been replaced is only freed once its last reference is released.
+ */
+typedef struct {
+  idxdPool *pool;
+  int refs;
+} idxdPool_library_ref;
+
+static idxdPool_library_ref *idxdPool_library_current = NULL;
+static int idxdPool_library_nthreads = 0;
+static idxdPool *idxdPool_shared_pool = NULL;
+static idxdPool_executor idxdPool_shared_executor = NULL;
+static void *idxdPool_shared_ctx = NULL;
+static int idxdPool_threshold = idxdPool_DEFAULT_THRESHOLD;
+
+#ifndef reproBLAS_no_pthread
+static pthread_mutex_t idxdPool_library_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+typedef struct {
+  idxdPool_task task;
+  void *arg;
+} idxdPool_executor_task;
+
+static void idxdPool_executor_run(void *task_, const int t){
+  idxdPool_executor_task *task = (idxdPool_executor_task*)task_;
+  int in_task = idxdPool_set_in_task(1);
+  task->task(task->arg, t);
+  idxdPool_set_in_task(in_task);
+}
+
+//create the library pool if it does not exist yet (with the library lock held)
+static void idxdPool_library_create(void){
+  const char *env;
+
+  if(idxdPool_library_current == NULL){
+    if(idxdPool_library_nthreads == 0){
+      env = getenv("REPROBLAS_NUM_THREADS");
+      idxdPool_library_nthreads = env == NULL ? 1 : atoi(env);
+      if(idxdPool_library_nthreads < 1){
+        idxdPool_library_nthreads = 1;
+      }
+    }
+    idxdPool_library_current = (idxdPool_library_ref*)malloc(sizeof(idxdPool_library_ref));
+    idxdPool_library_current->pool = idxdPool_create(idxdPool_library_nthreads);
+    idxdPool_library_current->refs = 0;
+  }
+}
+
+//get a reference to the library pool, which stays valid until it is given to idxdPool_library_release()
+static idxdPool_library_ref *idxdPool_library_acquire(void){
+  idxdPool_library_ref *ref;
+
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_lock(&idxdPool_library_lock);
+#endif
+  idxdPool_library_create();
+  ref = idxdPool_library_current;
+  ref->refs++;
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_unlock(&idxdPool_library_lock);
+#endif
+  return ref;
+}
+
+//release a reference to a library pool, freeing the pool if it has been replaced and this was its last reference
+static void idxdPool_library_release(idxdPool_library_ref *ref){
+  int retired;
+
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_lock(&idxdPool_library_lock);
+#endif
+  ref->refs--;
+  retired = ref->refs == 0 && ref != idxdPool_library_current;
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_unlock(&idxdPool_library_lock);
+#endif
+  if(retired){
+    idxdPool_free(ref->pool);
+    free(ref);
+  }
+}
+
+/**
+ * @internal
+ * @brief Get the library pool
+ *
+ * Creates the library pool if it does not exist yet. The pool is freed by idxdPool_set_num_threads(), so the caller must not use it once idxdPool_set_num_threads() may have been called.
+ *
+ * @return the library pool, or NULL if it could not be created
+ *
+ * @date   18 Oct 2026
+ */
+idxdPool *idxdPool_library(void){
+  idxdPool *pool;
+
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_lock(&idxdPool_library_lock);
+#endif
+  idxdPool_library_create();
+  pool = idxdPool_library_current->pool;
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_unlock(&idxdPool_library_lock);
+#endif
+  return pool;
+}
+
+/**
+ * @brief Set the number of threads of the library pool
+ *
+ * Replaces the library pool with one of @c nthreads threads. Library routines that are already running on the old pool finish on it, and the old pool is freed once the last of them returns.
+ *
+ * @param nthreads the number of threads, including the calling thread (values smaller than 1 are taken to be 1)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_set_num_threads(const int nthreads){
+  idxdPool_library_ref *old;
+
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_lock(&idxdPool_library_lock);
+#endif
+  old = idxdPool_library_current;
+  idxdPool_library_current = NULL;
+  idxdPool_library_nthreads = nthreads < 1 ? 1 : nthreads;
+  if(old != NULL && old->refs > 0){
+    //freed by the last idxdPool_library_release()
+    old = NULL;
+  }
+#ifndef reproBLAS_no_pthread
+  pthread_mutex_unlock(&idxdPool_library_lock);
+#endif
+  if(old != NULL){
+    idxdPool_free(old->pool);
+    free(old);
+  }
+}
+
+/**
+ * @brief Get the number of threads of the library pool
+ *
+ * @return the number of threads of the library pool, including the calling thread
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_get_num_threads(void){
+  idxdPool_library_ref *ref = idxdPool_library_acquire();
+  int nthreads = ref->pool == NULL ? 1 : idxdPool_num_threads(ref->pool);
+
+  idxdPool_library_release(ref);
+  return nthreads;
+}
+
+/**
+ * @brief Run library routines on a pool of the caller
+ *
+ * After this call, threaded library routines run on @c pool instead of the library pool, so that the caller and the library share the same threads. Overrides idxdPool_set_executor().
+ *
+ * @param pool the pool (if NULL, library routines go back to the library pool)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_share(idxdPool *pool){
+  idxdPool_shared_pool = pool;
+  idxdPool_shared_executor = NULL;
+  idxdPool_shared_ctx = NULL;
+}
+
+/**
+ * @brief Run library routines on a thread pool that is not an #idxdPool
+ *
+ * After this call, threaded library routines hand their tasks to @c executor (along with @c ctx) instead of running them on the library pool. This allows the library to share an existing OpenMP, TBB or other thread pool. Overrides idxdPool_share().
+ *
+ * @param executor the executor (if NULL, library routines go back to the library pool)
+ * @param ctx the first argument passed to @c executor
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_set_executor(idxdPool_executor executor, void *ctx){
+  idxdPool_shared_pool = NULL;
+  idxdPool_shared_executor = executor;
+  idxdPool_shared_ctx = ctx;
+}
+
+/**
+ * @brief Set the size below which library routines run on the calling thread
+ *
+ * A routine runs on the calling thread when its input has less than @c N elements (for a matrix-vector product, @c N is compared to the number of elements of the matrix, and for a matrix-matrix product, to M * N * K).
+ *
+ * @param N the threshold (defaults to #idxdPool_DEFAULT_THRESHOLD)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_set_threshold(const int N){
+  idxdPool_threshold = N;
+}
+
+/**
+ * @brief Get the size below which library routines run on the calling thread
+ *
+ * @return the threshold set with idxdPool_set_threshold()
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_get_threshold(void){
+  return idxdPool_threshold;
+}
+
+/**
+ * @internal
+ * @brief Decide whether a library routine should use more than one thread
+ *
+ * @param work the size of the input of the routine
+ * @return nonzero if the work should be split into tasks and given to idxdPool_dispatch(), 0 otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_parallel(const double work){
+  if(work < idxdPool_threshold || idxdPool_in_task()){
+    return 0;
+  }
+  if(idxdPool_shared_executor != NULL){
+    return 1;
+  }
+  if(idxdPool_shared_pool != NULL){
+    return idxdPool_num_threads(idxdPool_shared_pool) > 1;
+  }
+  return idxdPool_get_num_threads() > 1;
+}
+
+/**
+ * @internal
+ * @brief Decide how many tasks a library routine that needs memory of its own for each task should use
+ *
+ * Like idxdPool_parallel(), except that the routine is split into as many tasks as there are threads, each of which needs @c size bytes of its own, and the number of tasks is reduced so that they need at most @c budget bytes in total.
+ *
+ * @param work the size of the input of the routine
+ * @param size the memory (in bytes) needed by each task
+ * @param budget the memory (in bytes) that all tasks together may use
+ * @return the number of tasks to give to idxdPool_dispatch(), or 1 if the routine should run on the calling thread
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_num_tasks(const double work, const double size, const double budget){
+  int ntasks;
+
+  if(!idxdPool_parallel(work)){
+    return 1;
+  }
+  ntasks = idxdPool_get_num_threads() > 1 ? idxdPool_get_num_threads() : 2;
+  if(size > 0.0 && ntasks * size > budget){
+    ntasks = budget / size >= 1.0 ? (int)(budget / size) : 1;
+  }
+  return ntasks;
+}
+
+/**
+ * @internal
+ * @brief Run the tasks of a library routine
+ *
+ * Runs the tasks on the executor set with idxdPool_set_executor(), the pool set with idxdPool_share(), or the library pool, in that order of preference.
+ *
+ * @param ntasks the number of tasks
+ * @param task the task
+ * @param arg the argument passed to the task
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_dispatch(const int ntasks, idxdPool_task task, void *arg){
+  idxdPool_executor_task executor_task;
+  idxdPool_library_ref *ref;
+  idxdPool *pool;
+  int t;
+
+  if(idxdPool_shared_executor != NULL){
+    executor_task.task = task;
+    executor_task.arg = arg;
+    idxdPool_shared_executor(idxdPool_shared_ctx, ntasks, idxdPool_executor_run, &executor_task);
+    return;
+  }
+  ref = idxdPool_shared_pool != NULL ? NULL : idxdPool_library_acquire();
+  pool = ref != NULL ? ref->pool : idxdPool_shared_pool;
+  if(pool == NULL){
+    for(t = 0; t < ntasks; t++){
+      task(arg, t);
+    }
+  }else{
+    idxdPool_run(pool, ntasks, task, arg);
+  }
+  if(ref != NULL){
+    idxdPool_library_release(ref);
+  }
+}
+
+/**
+ * @internal
+ * @brief Get the number of NUMA nodes the tasks of a library routine can be placed on
+ *
+ * @return the number of nodes the pool used by idxdPool_dispatch() is bound to, or 0 if it is not bound (or if an executor is set)
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_dispatch_num_nodes(void){
+  idxdPool_library_ref *ref;
+  int nnodes;
+
+  if(idxdPool_shared_executor != NULL){
+    return 0;
+  }
+  if(idxdPool_shared_pool != NULL){
+    return idxdPool_num_nodes(idxdPool_shared_pool);
+  }
+  ref = idxdPool_library_acquire();
+  nnodes = ref->pool == NULL ? 0 : idxdPool_num_nodes(ref->pool);
+  idxdPool_library_release(ref);
+  return nnodes;
+}
+
+/**
+ * @internal
+ * @brief Run the tasks of a library routine on the NUMA nodes holding their data
+ *
+ * Like idxdPool_dispatch(), except that the tasks are started on the threads of the node given by @c task_nodes when the pool is bound to the NUMA nodes (see idxdPool_run_nodes()).
+ *
+ * @param ntasks the number of tasks
+ * @param task the task
+ * @param arg the argument passed to the task
+ * @param task_nodes the node (from 0 to idxdPool_dispatch_num_nodes() - 1) of each task
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_dispatch_nodes(const int ntasks, idxdPool_task task, void *arg, const int *task_nodes){
+  idxdPool_library_ref *ref;
+  idxdPool *pool;
+
+  if(idxdPool_shared_executor != NULL){
+    idxdPool_dispatch(ntasks, task, arg);
+    return;
+  }
+  ref = idxdPool_shared_pool != NULL ? NULL : idxdPool_library_acquire();
+  pool = ref != NULL ? ref->pool : idxdPool_shared_pool;
+  if(pool == NULL || idxdPool_num_nodes(pool) == 0){
+    idxdPool_dispatch(ntasks, task, arg);
+  }else{
+    idxdPool_run_nodes(pool, ntasks, task, arg, task_nodes);
+  }
+  if(ref != NULL){
+    idxdPool_library_release(ref);
+  }
+}
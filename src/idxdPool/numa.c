@@ -0,0 +1,288 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#ifndef reproBLAS_no_pthread
+#include <pthread.h>
+#include <sched.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <idxdPool.h>
+
+/*
+ * The topology is read once, from the nodeN/cpulist files of
+ * /sys/devices/system/node (or of the directory named by the environment
+ * variable REPROBLAS_SYSFS_NODE, which is how the checks describe machines
+ * they are not running on). Nodes without processors are ignored. If no node
+ * is found, the machine is treated as one node with no processor list.
+ */
+#define idxdPool_MAXNODES 64
+#define idxdPool_MAXNODECPUS 1024
+
+typedef struct {
+  int id;
+  int ncpus;
+  int cpus[idxdPool_MAXNODECPUS];
+} idxdPool_node;
+
+static int idxdPool_nnodes = 0;
+static idxdPool_node idxdPool_nodes[idxdPool_MAXNODES];
+#ifndef reproBLAS_no_pthread
+static pthread_once_t idxdPool_numa_once = PTHREAD_ONCE_INIT;
+#endif
+
+static void idxdPool_read_cpulist(const char *path, idxdPool_node *node){
+  FILE *f = fopen(path, "r");
+  char buf[4096];
+  char *p;
+  long lo;
+  long hi;
+  long cpu;
+
+  node->ncpus = 0;
+  if(f == NULL){
+    return;
+  }
+  if(fgets(buf, sizeof(buf), f) != NULL){
+    p = buf;
+    while(*p != '\0' && *p != '\n'){
+      lo = strtol(p, &p, 10);
+      hi = lo;
+      if(*p == '-'){
+        hi = strtol(p + 1, &p, 10);
+      }
+      for(cpu = lo; cpu <= hi && node->ncpus < idxdPool_MAXNODECPUS; cpu++){
+        node->cpus[node->ncpus++] = (int)cpu;
+      }
+      if(*p == ','){
+        p++;
+      }else{
+        break;
+      }
+    }
+  }
+  fclose(f);
+}
+
+static void idxdPool_numa_detect(void){
+  const char *dir = getenv("REPROBLAS_SYSFS_NODE");
+  char path[4096];
+  DIR *d;
+  struct dirent *entry;
+  idxdPool_node tmp;
+  int id;
+  int i;
+  int j;
+
+  if(dir == NULL){
+    dir = "/sys/devices/system/node";
+  }
+  d = opendir(dir);
+  if(d != NULL){
+    while((entry = readdir(d)) != NULL && idxdPool_nnodes < idxdPool_MAXNODES){
+      if(strncmp(entry->d_name, "node", 4) != 0 || sscanf(entry->d_name + 4, "%d", &id) != 1){
+        continue;
+      }
+      snprintf(path, sizeof(path), "%s/%s/cpulist", dir, entry->d_name);
+      idxdPool_nodes[idxdPool_nnodes].id = id;
+      idxdPool_read_cpulist(path, &idxdPool_nodes[idxdPool_nnodes]);
+      if(idxdPool_nodes[idxdPool_nnodes].ncpus > 0){
+        idxdPool_nnodes++;
+      }
+    }
+    closedir(d);
+  }
+  //sort the nodes by id
+  for(i = 1; i < idxdPool_nnodes; i++){
+    for(j = i; j > 0 && idxdPool_nodes[j - 1].id > idxdPool_nodes[j].id; j--){
+      tmp = idxdPool_nodes[j];
+      idxdPool_nodes[j] = idxdPool_nodes[j - 1];
+      idxdPool_nodes[j - 1] = tmp;
+    }
+  }
+  if(idxdPool_nnodes == 0){
+    idxdPool_nodes[0].id = -1;
+    idxdPool_nodes[0].ncpus = 0;
+    idxdPool_nnodes = 1;
+  }
+}
+
+static void idxdPool_numa_init(void){
+#ifndef reproBLAS_no_pthread
+  pthread_once(&idxdPool_numa_once, idxdPool_numa_detect);
+#else
+  if(idxdPool_nnodes == 0){
+    idxdPool_numa_detect();
+  }
+#endif
+}
+
+/**
+ * @brief Get the number of NUMA nodes
+ *
+ * Nodes are numbered from 0 to the number of nodes - 1 in the order of their operating system ids. Nodes without processors are not counted.
+ *
+ * @return the number of NUMA nodes (1 if the topology is unknown)
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_numa_num_nodes(void){
+  idxdPool_numa_init();
+  return idxdPool_nnodes;
+}
+
+/**
+ * @brief Get the NUMA nodes holding some addresses
+ *
+ * Nodes that cannot be determined (because the memory has not been touched yet, the node has no processors, or the platform is not Linux) are reported as -1.
+ *
+ * @param n the number of addresses
+ * @param addrs the addresses
+ * @param nodes the node (from 0 to idxdPool_numa_num_nodes() - 1) holding each address (output)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_numa_nodes_of(const int n, const void **addrs, int *nodes){
+  int i;
+  int j;
+
+  idxdPool_numa_init();
+  for(i = 0; i < n; i++){
+    nodes[i] = -1;
+  }
+#if defined(__linux__) && defined(SYS_move_pages)
+  if(idxdPool_nnodes > 1 && syscall(SYS_move_pages, 0, (unsigned long)n, addrs, NULL, nodes, 0) == 0){
+    for(i = 0; i < n; i++){
+      for(j = 0; j < idxdPool_nnodes && idxdPool_nodes[j].id != nodes[i]; j++);
+      nodes[i] = j < idxdPool_nnodes ? j : -1;
+    }
+  }else{
+    for(i = 0; i < n; i++){
+      nodes[i] = -1;
+    }
+  }
+#else
+  (void)addrs;
+  (void)j;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Bind a thread to the processors of a NUMA node
+ *
+ * @param thread the thread (a @c pthread_t)
+ * @param node the node (from 0 to idxdPool_numa_num_nodes() - 1)
+ * @return 0 on success, nonzero if the thread could not be bound
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_numa_bind(void *thread, const int node){
+#if !defined(reproBLAS_no_pthread) && defined(__linux__) && defined(CPU_SET)
+  cpu_set_t set;
+  int i;
+
+  idxdPool_numa_init();
+  if(node < 0 || node >= idxdPool_nnodes || idxdPool_nodes[node].ncpus == 0){
+    return 1;
+  }
+  CPU_ZERO(&set);
+  for(i = 0; i < idxdPool_nodes[node].ncpus; i++){
+    if(idxdPool_nodes[node].cpus[i] < CPU_SETSIZE){
+      CPU_SET(idxdPool_nodes[node].cpus[i], &set);
+    }
+  }
+  return pthread_setaffinity_np(*(pthread_t*)thread, sizeof(set), &set) != 0;
+#else
+  (void)thread;
+  (void)node;
+  return 1;
+#endif
+}
+
+#ifndef reproBLAS_no_pthread
+typedef struct {
+  char *mem;
+  size_t size;
+  int node;
+} idxdPool_touch_args;
+
+static void *idxdPool_touch(void *args_){
+  idxdPool_touch_args *args = (idxdPool_touch_args*)args_;
+  pthread_t self = pthread_self();
+  idxdPool_numa_bind(&self, args->node);
+  memset(args->mem, 0, args->size);
+  return NULL;
+}
+#endif
+
+/**
+ * @brief Allocate memory spread over the NUMA nodes
+ *
+ * Allocates @c size bytes and sets them to zero. The memory is split into as many contiguous parts as there are NUMA nodes, and part @c k is first touched by a thread running on node @c k, so that (under the default first-touch policy of the operating system) it is placed on node @c k. A vector allocated this way and summed by a pool bound with idxdPool_bind_numa() is read by each node from its own memory.
+ *
+ * @param size the number of bytes
+ * @return the memory (free with idxdPool_numa_free()), or NULL if it could not be allocated
+ *
+ * @date   18 Oct 2026
+ */
+void *idxdPool_numa_alloc(const size_t size){
+  long page = 4096;
+  size_t part;
+  void *mem = NULL;
+#ifndef reproBLAS_no_pthread
+  idxdPool_touch_args args[idxdPool_MAXNODES];
+  pthread_t threads[idxdPool_MAXNODES];
+  int created[idxdPool_MAXNODES];
+  int k;
+#endif
+
+#ifdef _SC_PAGESIZE
+  page = sysconf(_SC_PAGESIZE) > 0 ? sysconf(_SC_PAGESIZE) : page;
+#endif
+  idxdPool_numa_init();
+  if(posix_memalign(&mem, (size_t)page, size > 0 ? size : 1) != 0){
+    return NULL;
+  }
+  part = ((size + idxdPool_nnodes - 1) / idxdPool_nnodes + page - 1) / page * page;
+#ifndef reproBLAS_no_pthread
+  if(idxdPool_nnodes > 1){
+    for(k = 0; k < idxdPool_nnodes; k++){
+      args[k].mem = (char*)mem + (part * k < size ? part * k : size);
+      args[k].size = part * k < size ? (size - part * k < part ? size - part * k : part) : 0;
+      args[k].node = k;
+      created[k] = pthread_create(&threads[k], NULL, idxdPool_touch, &args[k]) == 0;
+      if(!created[k]){
+        memset(args[k].mem, 0, args[k].size);
+      }
+    }
+    for(k = 0; k < idxdPool_nnodes; k++){
+      if(created[k]){
+        pthread_join(threads[k], NULL);
+      }
+    }
+    return mem;
+  }
+#endif
+  (void)part;
+  memset(mem, 0, size);
+  return mem;
+}
+
+/**
+ * @brief Free memory allocated with idxdPool_numa_alloc()
+ *
+ * @param mem the memory (may be NULL)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_numa_free(void *mem){
+  free(mem);
+}
@@ -0,0 +1,599 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef reproBLAS_no_pthread
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <idxdPool.h>
+
+/*
+ * Each thread of a pool (the thread calling idxdPool_run() is thread 0) owns a
+ * range [lo, hi) of the task indices of the current job. The owner takes tasks
+ * from the bottom of its range, and thieves take the top half of the range.
+ * Ranges are padded to whole cache lines so that threads do not share them.
+ *
+ * Once a pool is bound to the NUMA nodes with idxdPool_bind_numa(), nodes[i]
+ * is the node of thread i (-1 for thread 0, which is not bound), and thieves
+ * look for work on their own node before looking anywhere else.
+ */
+#define idxdPool_CACHELINE 64
+
+#ifndef reproBLAS_no_pthread
+
+typedef struct {
+  pthread_mutex_t lock;
+  int lo;
+  int hi;
+} idxdPool_range;
+
+typedef union {
+  idxdPool_range range;
+  char pad[((sizeof(idxdPool_range) + idxdPool_CACHELINE - 1) / idxdPool_CACHELINE) * idxdPool_CACHELINE];
+} idxdPool_deque;
+
+struct idxdPool_ {
+  int nthreads;
+  pthread_t *threads;
+  idxdPool_deque *deques;
+  int *nodes;
+  int numa;
+  void *mem;
+  pthread_mutex_t busy;
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  unsigned long job;
+  int active;
+  int shutdown;
+  idxdPool_task task;
+  void *arg;
+};
+
+typedef struct {
+  idxdPool *pool;
+  int id;
+} idxdPool_worker;
+
+typedef struct {
+  idxdPool_task task;
+  void *arg;
+  const int *perm;
+} idxdPool_permutation;
+
+static pthread_once_t idxdPool_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t idxdPool_key;
+static char idxdPool_key_value;
+
+static void idxdPool_key_create(void){
+  pthread_key_create(&idxdPool_key, NULL);
+}
+
+static int idxdPool_pop(idxdPool_range *range){
+  int task = -1;
+  pthread_mutex_lock(&range->lock);
+  if(range->lo < range->hi){
+    task = range->lo++;
+  }
+  pthread_mutex_unlock(&range->lock);
+  return task;
+}
+
+static int idxdPool_steal(idxdPool *pool, int id){
+  idxdPool_range *mine = &pool->deques[id].range;
+  idxdPool_range *victim;
+  int lo = 0;
+  int hi = 0;
+  int near;
+  int i;
+  int v;
+
+  for(near = pool->nodes[id] >= 0; near >= 0 && lo == hi; near--){
+    for(i = 1; i < pool->nthreads && lo == hi; i++){
+      v = (id + i) % pool->nthreads;
+      if(near && pool->nodes[v] != pool->nodes[id]){
+        continue;
+      }
+      victim = &pool->deques[v].range;
+      pthread_mutex_lock(&victim->lock);
+      if(victim->lo < victim->hi){
+        hi = victim->hi;
+        lo = victim->hi - (victim->hi - victim->lo + 1) / 2;
+        victim->hi = lo;
+      }
+      pthread_mutex_unlock(&victim->lock);
+    }
+  }
+  if(lo == hi){
+    return -1;
+  }
+  pthread_mutex_lock(&mine->lock);
+  mine->lo = lo + 1;
+  mine->hi = hi;
+  pthread_mutex_unlock(&mine->lock);
+  return lo;
+}
+
+static void idxdPool_work(idxdPool *pool, int id, idxdPool_task task, void *arg){
+  int t;
+  while((t = idxdPool_pop(&pool->deques[id].range)) >= 0 || (t = idxdPool_steal(pool, id)) >= 0){
+    task(arg, t);
+  }
+}
+
+static void *idxdPool_main(void *worker_){
+  idxdPool_worker *worker = (idxdPool_worker*)worker_;
+  idxdPool *pool = worker->pool;
+  int id = worker->id;
+  unsigned long job = 0;
+  idxdPool_task task;
+  void *arg;
+
+  free(worker);
+  pthread_setspecific(idxdPool_key, &idxdPool_key_value);
+  pthread_mutex_lock(&pool->lock);
+  while(1){
+    while(!pool->shutdown && pool->job == job){
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if(pool->shutdown){
+      break;
+    }
+    job = pool->job;
+    task = pool->task;
+    arg = pool->arg;
+    pthread_mutex_unlock(&pool->lock);
+
+    idxdPool_work(pool, id, task, arg);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->active--;
+    if(pool->active == 0){
+      pthread_cond_signal(&pool->done);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+static void idxdPool_permuted(void *permutation_, const int t){
+  idxdPool_permutation *permutation = (idxdPool_permutation*)permutation_;
+  permutation->task(permutation->arg, permutation->perm[t]);
+}
+
+/*
+ * Run a job whose task ranges are already set, with the busy lock held.
+ */
+static void idxdPool_start(idxdPool *pool, idxdPool_task task, void *arg){
+  pthread_mutex_lock(&pool->lock);
+  pool->task = task;
+  pool->arg = arg;
+  pool->active = pool->nthreads - 1;
+  pool->job++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  idxdPool_set_in_task(1);
+  idxdPool_work(pool, 0, task, arg);
+  idxdPool_set_in_task(0);
+
+  pthread_mutex_lock(&pool->lock);
+  while(pool->active > 0){
+    pthread_cond_wait(&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  pthread_mutex_unlock(&pool->busy);
+}
+
+#else
+
+struct idxdPool_ {
+  int nthreads;
+};
+
+static int idxdPool_in_task_flag = 0;
+
+#endif
+
+/**
+ * @brief Create a thread pool
+ *
+ * The calling thread of idxdPool_run() counts as one of the threads of the pool, so @c nthreads - 1 worker threads are started. The workers sleep until tasks are given to the pool.
+ *
+ * @param nthreads the number of threads of the pool (values smaller than 1 are taken to be 1)
+ * @return a pool (free with idxdPool_free()), or NULL if the pool could not be created
+ *
+ * @date   18 Oct 2026
+ */
+idxdPool *idxdPool_create(const int nthreads){
+#ifndef reproBLAS_no_pthread
+  idxdPool *pool = (idxdPool*)malloc(sizeof(idxdPool));
+  idxdPool_worker *worker;
+  int n = nthreads < 1 ? 1 : nthreads;
+  int i;
+  int rc;
+
+  if(pool == NULL){
+    return NULL;
+  }
+  pthread_once(&idxdPool_key_once, idxdPool_key_create);
+  pool->nthreads = 1;
+  pool->numa = 0;
+  pool->mem = malloc(n * sizeof(idxdPool_deque) + idxdPool_CACHELINE);
+  pool->threads = (pthread_t*)malloc(n * sizeof(pthread_t));
+  pool->nodes = (int*)malloc(n * sizeof(int));
+  if(pool->mem == NULL || pool->threads == NULL || pool->nodes == NULL){
+    free(pool->mem);
+    free(pool->threads);
+    free(pool->nodes);
+    free(pool);
+    return NULL;
+  }
+  pool->deques = (idxdPool_deque*)(((size_t)pool->mem + idxdPool_CACHELINE - 1) / idxdPool_CACHELINE * idxdPool_CACHELINE);
+  for(i = 0; i < n; i++){
+    pthread_mutex_init(&pool->deques[i].range.lock, NULL);
+    pool->deques[i].range.lo = 0;
+    pool->deques[i].range.hi = 0;
+    pool->nodes[i] = -1;
+  }
+  pthread_mutex_init(&pool->busy, NULL);
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  pool->job = 0;
+  pool->active = 0;
+  pool->shutdown = 0;
+  pool->task = NULL;
+  pool->arg = NULL;
+  for(i = 1; i < n; i++){
+    worker = (idxdPool_worker*)malloc(sizeof(idxdPool_worker));
+    if(worker == NULL){
+      break;
+    }
+    worker->pool = pool;
+    worker->id = i;
+    rc = pthread_create(&pool->threads[i], NULL, idxdPool_main, worker);
+    if(rc != 0){
+      fprintf(stderr, "[%s.%d] ReproBLAS error: pthread_create error: %d\n", __FILE__, __LINE__, rc);
+      free(worker);
+      break;
+    }
+    pool->nthreads = i + 1;
+  }
+  return pool;
+#else
+  idxdPool *pool = (idxdPool*)malloc(sizeof(idxdPool));
+  (void)nthreads;
+  if(pool != NULL){
+    pool->nthreads = 1;
+  }
+  return pool;
+#endif
+}
+
+/**
+ * @brief Free a thread pool
+ *
+ * Stops and joins the workers of the pool. The pool must not be running tasks.
+ *
+ * @param pool the pool (may be NULL)
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_free(idxdPool *pool){
+#ifndef reproBLAS_no_pthread
+  int i;
+
+  if(pool == NULL){
+    return;
+  }
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = 1;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for(i = 1; i < pool->nthreads; i++){
+    pthread_join(pool->threads[i], NULL);
+  }
+  for(i = 0; i < pool->nthreads; i++){
+    pthread_mutex_destroy(&pool->deques[i].range.lock);
+  }
+  pthread_mutex_destroy(&pool->busy);
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->start);
+  pthread_cond_destroy(&pool->done);
+  free(pool->threads);
+  free(pool->nodes);
+  free(pool->mem);
+#endif
+  free(pool);
+}
+
+/**
+ * @brief Get the number of threads of a thread pool
+ *
+ * @param pool the pool
+ * @return the number of threads of the pool, including the calling thread
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_num_threads(const idxdPool *pool){
+  return pool->nthreads;
+}
+
+/**
+ * @brief Bind the workers of a thread pool to processors
+ *
+ * Worker @c i (for @c i from 1 to the number of threads - 1) is bound to processor @c cpus[(i - 1) % ncpus]. The thread calling idxdPool_run() is not bound. Binding is only supported on Linux.
+ *
+ * @param pool the pool (if NULL, the library pool is used)
+ * @param cpus the processor numbers
+ * @param ncpus the number of processor numbers
+ * @return 0 on success, nonzero if a worker could not be bound
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_set_affinity(idxdPool *pool, const int *cpus, const int ncpus){
+#if !defined(reproBLAS_no_pthread) && defined(__linux__) && defined(CPU_SET)
+  cpu_set_t set;
+  int i;
+  int rc = 0;
+
+  if(pool == NULL){
+    pool = idxdPool_library();
+  }
+  if(pool == NULL || ncpus < 1){
+    return pool == NULL;
+  }
+  for(i = 1; i < pool->nthreads; i++){
+    CPU_ZERO(&set);
+    CPU_SET(cpus[(i - 1) % ncpus], &set);
+    if(pthread_setaffinity_np(pool->threads[i], sizeof(set), &set) != 0){
+      rc = 1;
+    }
+  }
+  return rc;
+#else
+  (void)pool;
+  (void)cpus;
+  (void)ncpus;
+  return 1;
+#endif
+}
+
+/**
+ * @brief Bind the workers of a thread pool to the NUMA nodes
+ *
+ * Worker @c i (for @c i from 1 to the number of threads - 1) is bound to the processors of NUMA node (@c i - 1) % idxdPool_numa_num_nodes(). The thread calling idxdPool_run() is not bound. Once bound, the pool runs each chunk of a threaded library reduction on a worker of the node holding the chunk (see idxdPool_numa_alloc()), and adds the partial sums of each node together before adding the sums of the nodes together in order of node. The results are identical to those of an unbound pool. Binding is only supported on Linux.
+ *
+ * @param pool the pool (if NULL, the library pool is used)
+ * @return 0 on success, nonzero if a worker could not be bound
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_bind_numa(idxdPool *pool){
+#ifndef reproBLAS_no_pthread
+  int nnodes = idxdPool_numa_num_nodes();
+  int i;
+  int rc = 0;
+
+  if(pool == NULL){
+    pool = idxdPool_library();
+  }
+  if(pool == NULL){
+    return 1;
+  }
+  for(i = 1; i < pool->nthreads; i++){
+    pool->nodes[i] = (i - 1) % nnodes;
+    if(idxdPool_numa_bind(&pool->threads[i], pool->nodes[i]) != 0){
+      rc = 1;
+    }
+  }
+  pool->numa = nnodes;
+  return rc;
+#else
+  (void)pool;
+  return 1;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Get the number of NUMA nodes a thread pool is bound to
+ *
+ * @param pool the pool
+ * @return the number of nodes, or 0 if idxdPool_bind_numa() has not been called on the pool
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_num_nodes(const idxdPool *pool){
+#ifndef reproBLAS_no_pthread
+  return pool->numa;
+#else
+  (void)pool;
+  return 0;
+#endif
+}
+
+/**
+ * @brief Run tasks on a thread pool
+ *
+ * Calls @c task(arg, t) once for each @c t from 0 to @c ntasks - 1 on the threads of the pool, and returns when all of the calls have returned. If the pool is already running tasks for another thread, or if the calling thread is itself running a task of a pool, the tasks are run on the calling thread.
+ *
+ * @param pool the pool
+ * @param ntasks the number of tasks
+ * @param task the task
+ * @param arg the argument passed to the task
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_run(idxdPool *pool, const int ntasks, idxdPool_task task, void *arg){
+  int t;
+#ifndef reproBLAS_no_pthread
+  int i;
+
+  if(ntasks <= 0){
+    return;
+  }
+  if(pool->nthreads == 1 || ntasks == 1 || idxdPool_in_task() || pthread_mutex_trylock(&pool->busy) != 0){
+    for(t = 0; t < ntasks; t++){
+      task(arg, t);
+    }
+    return;
+  }
+  for(i = 0; i < pool->nthreads; i++){
+    pthread_mutex_lock(&pool->deques[i].range.lock);
+    pool->deques[i].range.lo = (int)(((long long)ntasks * i) / pool->nthreads);
+    pool->deques[i].range.hi = (int)(((long long)ntasks * (i + 1)) / pool->nthreads);
+    pthread_mutex_unlock(&pool->deques[i].range.lock);
+  }
+  idxdPool_start(pool, task, arg);
+#else
+  int in_task;
+
+  (void)pool;
+  in_task = idxdPool_set_in_task(1);
+  for(t = 0; t < ntasks; t++){
+    task(arg, t);
+  }
+  idxdPool_set_in_task(in_task);
+#endif
+}
+
+/**
+ * @internal
+ * @brief Check whether the calling thread is running a task of a pool
+ *
+ * @return nonzero if the calling thread is running a task of a pool (or of the executor set with idxdPool_set_executor()), 0 otherwise
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_in_task(void){
+#ifndef reproBLAS_no_pthread
+  pthread_once(&idxdPool_key_once, idxdPool_key_create);
+  return pthread_getspecific(idxdPool_key) != NULL;
+#else
+  return idxdPool_in_task_flag;
+#endif
+}
+
+/**
+ * @internal
+ * @brief Mark whether the calling thread is running a task of a pool
+ *
+ * @param in_task nonzero if the calling thread is starting a task, 0 if it is done with it
+ * @return the previous state (as returned by idxdPool_in_task())
+ *
+ * @date   18 Oct 2026
+ */
+int idxdPool_set_in_task(const int in_task){
+  int previous = idxdPool_in_task();
+#ifndef reproBLAS_no_pthread
+  pthread_setspecific(idxdPool_key, in_task ? &idxdPool_key_value : NULL);
+#else
+  idxdPool_in_task_flag = in_task != 0;
+#endif
+  return previous;
+}
+
+/**
+ * @internal
+ * @brief Run tasks on the NUMA nodes of a thread pool
+ *
+ * Like idxdPool_run(), except that the tasks with @c task_nodes[t] equal to @c k start out on the threads bound to node @c k. Tasks of nodes without threads start out on the calling thread. The pool must have been bound with idxdPool_bind_numa().
+ *
+ * @param pool the pool
+ * @param ntasks the number of tasks
+ * @param task the task
+ * @param arg the argument passed to the task
+ * @param task_nodes the node (from 0 to idxdPool_num_nodes(pool) - 1) of each task
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_run_nodes(idxdPool *pool, const int ntasks, idxdPool_task task, void *arg, const int *task_nodes){
+#ifndef reproBLAS_no_pthread
+  idxdPool_permutation permutation;
+  int nnodes = pool->numa;
+  int *perm;
+  int *counts;
+  int *sizes;
+  int *starts;
+  int orphans;
+  int node;
+  int lo;
+  int i;
+  int j;
+  int t;
+
+  if(ntasks <= 0){
+    return;
+  }
+  if(nnodes < 1 || pool->nthreads == 1 || ntasks == 1 || idxdPool_in_task() || pthread_mutex_trylock(&pool->busy) != 0){
+    idxdPool_run(pool, ntasks, task, arg);
+    return;
+  }
+  perm = (int*)malloc(ntasks * sizeof(int));
+  counts = (int*)calloc(nnodes, sizeof(int));
+  sizes = (int*)calloc(nnodes, sizeof(int));
+  starts = (int*)malloc(nnodes * sizeof(int));
+
+  for(i = 1; i < pool->nthreads; i++){
+    counts[pool->nodes[i]]++;
+  }
+  for(t = 0; t < ntasks; t++){
+    sizes[task_nodes[t]]++;
+  }
+  //order the tasks by node, placing the nodes without threads last
+  lo = 0;
+  for(orphans = 0; orphans <= 1; orphans++){
+    for(node = 0; node < nnodes; node++){
+      if((counts[node] == 0) == orphans){
+        starts[node] = lo;
+        lo += sizes[node];
+      }
+    }
+  }
+  for(t = 0; t < ntasks; t++){
+    perm[starts[task_nodes[t]]++] = t;
+  }
+  //the calling thread starts with the tasks of nodes without threads
+  lo = ntasks;
+  for(node = 0; node < nnodes; node++){
+    if(counts[node] == 0){
+      lo -= sizes[node];
+    }
+  }
+  pthread_mutex_lock(&pool->deques[0].range.lock);
+  pool->deques[0].range.lo = lo;
+  pool->deques[0].range.hi = ntasks;
+  pthread_mutex_unlock(&pool->deques[0].range.lock);
+  //the tasks of other nodes are split evenly between the threads of the node
+  for(node = 0; node < nnodes; node++){
+    lo = starts[node] - sizes[node];
+    for(i = 1, j = 0; i < pool->nthreads; i++){
+      if(pool->nodes[i] == node){
+        pthread_mutex_lock(&pool->deques[i].range.lock);
+        pool->deques[i].range.lo = lo + (int)(((long long)sizes[node] * j) / counts[node]);
+        pool->deques[i].range.hi = lo + (int)(((long long)sizes[node] * (j + 1)) / counts[node]);
+        pthread_mutex_unlock(&pool->deques[i].range.lock);
+        j++;
+      }
+    }
+  }
+  free(starts);
+  free(sizes);
+  free(counts);
+
+  permutation.task = task;
+  permutation.arg = arg;
+  permutation.perm = perm;
+  idxdPool_start(pool, idxdPool_permuted, &permutation);
+  free(perm);
+#else
+  (void)task_nodes;
+  idxdPool_run(pool, ntasks, task, arg);
+#endif
+}
@@ -0,0 +1,97 @@
+#include <stdlib.h>
+
+#include <idxdPool.h>
+
+typedef struct {
+  int64_t N;
+  int64_t chunk;
+  size_t size;
+  char *partials;
+  void (*kernel)(void *arg, const int64_t i, const int n, void *partial);
+  void *arg;
+} idxdPool_reduction;
+
+static void idxdPool_reduce_task(void *reduction_, const int t){
+  idxdPool_reduction *reduction = (idxdPool_reduction*)reduction_;
+  int64_t i = t * reduction->chunk;
+  int n = (int)(reduction->N - i < reduction->chunk ? reduction->N - i : reduction->chunk);
+  reduction->kernel(reduction->arg, i, n, reduction->partials + t * reduction->size);
+}
+
+/**
+ * @internal
+ * @brief Compute a reduction over a vector on several threads
+ *
+ * Splits the indices from 0 to @c N - 1 into chunks of at most #idxdPool_MAXCHUNK elements whose boundaries depend only on @c N. For each chunk, @c kernel(arg, i, n, partial) adds the elements @c i to @c i + @c n - 1 to a partial result of @c size bytes, initially set to zero bytes. The partial results are then given to @c combine(arg, partial, Y) in the order of the chunks. @c Y has the same layout as a partial result.
+ *
+ * If the pool is bound to several NUMA nodes (see idxdPool_bind_numa()), each chunk is run on the node holding element @c i of the chunk, which is found at @c X + @c i * @c incX bytes. The partial results of the chunks of each node are then combined (in the order of the chunks) into a partial result of the node, and the partial results of the nodes are combined into @c Y in the order of the nodes.
+ *
+ * @param N the number of elements
+ * @param size the size (in bytes) of a partial result
+ * @param kernel the function that computes the partial results
+ * @param combine the function that adds a partial result to Y
+ * @param arg the first argument to @c kernel and @c combine
+ * @param X the address of element 0
+ * @param incX the distance (in bytes) between consecutive elements
+ * @param Y the result
+ *
+ * @date   18 Oct 2026
+ */
+void idxdPool_reduce(const int64_t N, const size_t size, void (*kernel)(void *arg, const int64_t i, const int n, void *partial), void (*combine)(void *arg, void *partial, void *Y), void *arg, const void *X, const ptrdiff_t incX, void *Y){
+  idxdPool_reduction reduction;
+  const void **addrs;
+  int *task_nodes;
+  char *node_partials;
+  int nnodes = idxdPool_dispatch_num_nodes();
+  int nchunks;
+  int t;
+
+  reduction.N = N;
+  reduction.chunk = (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  if(reduction.chunk < idxdPool_MINCHUNK){
+    reduction.chunk = idxdPool_MINCHUNK;
+  }
+  if(reduction.chunk > idxdPool_MAXCHUNK){
+    reduction.chunk = idxdPool_MAXCHUNK;
+  }
+  nchunks = (int)((N + reduction.chunk - 1) / reduction.chunk);
+  reduction.size = size;
+  reduction.partials = (char*)calloc(nchunks, size);
+  reduction.kernel = kernel;
+  reduction.arg = arg;
+
+  if(nnodes > 1){
+    addrs = (const void**)malloc(nchunks * sizeof(void*));
+    task_nodes = (int*)malloc(nchunks * sizeof(int));
+    node_partials = (char*)calloc(nnodes, size);
+    for(t = 0; t < nchunks; t++){
+      addrs[t] = (const char*)X + t * reduction.chunk * incX;
+    }
+    idxdPool_numa_nodes_of(nchunks, addrs, task_nodes);
+    for(t = 0; t < nchunks; t++){
+      //untouched or unknown memory is assumed to be split as by idxdPool_numa_alloc()
+      if(task_nodes[t] < 0 || task_nodes[t] >= nnodes){
+        task_nodes[t] = (int)(((long long)t * nnodes) / nchunks);
+      }
+    }
+
+    idxdPool_dispatch_nodes(nchunks, idxdPool_reduce_task, &reduction, task_nodes);
+
+    for(t = 0; t < nchunks; t++){
+      combine(arg, reduction.partials + t * size, node_partials + task_nodes[t] * size);
+    }
+    for(t = 0; t < nnodes; t++){
+      combine(arg, node_partials + t * size, Y);
+    }
+    free(addrs);
+    free(task_nodes);
+    free(node_partials);
+  }else{
+    idxdPool_dispatch(nchunks, idxdPool_reduce_task, &reduction);
+
+    for(t = 0; t < nchunks; t++){
+      combine(arg, reduction.partials + t * size, Y);
+    }
+  }
+  free(reduction.partials);
+}
@@ -12,15 +12,67 @@ libreproblas.a_DEPS = $$(LIBIDXD) $$(LIBIDXDBLAS)                          \
                       rssum.o rsasum.o rsnrm2.o rsdot.o                    \
                       rcsum_sub.o rscasum.o rscnrm2.o rcdotc_sub.o         \
                         rcdotu_sub.o                                       \
+                      rsdssum.o rsdsasum.o rsdsnrm2.o rsdsdot.o            \
+                      rcdcsum_sub.o rscdcasum.o rscdcnrm2.o rcdcdotc_sub.o \
+                        rcdcdotu_sub.o                                     \
+                      rsdhsum.o rsdhasum.o rsdhnrm2.o rsdhdot.o            \
+                      rsdbsum.o rsdbasum.o rsdbnrm2.o rsdbdot.o            \
+                      rddot_fma.o rsdot_fma.o                              \
+                      rzdotu_fma_sub.o rzdotc_fma_sub.o                    \
+                      rcdotu_fma_sub.o rcdotc_fma_sub.o                    \
                       rdgemv.o rdgemm.o                                    \
                       rzgemv.o rzgemm.o                                    \
                       rsgemv.o rsgemm.o                                    \
                       rcgemv.o rcgemm.o                                    \
+                      rdsgemv.o rdsgemm.o                                  \
+                      rzgemv_planar.o rzgemm_planar.o                      \
+                      rdsyrk.o rssyrk.o rzherk.o                           \
+                      rdtrsm.o rdtrsv.o                                    \
+                      rdcsrmv.o rscsrmv.o                                  \
+                      rdgesum.o rdgeasum.o rdgenrm2.o rdlange.o            \
+                      rsgesum.o rsgeasum.o rsgenrm2.o rslange.o            \
+                      rdmoments.o rdcmoments.o rsmoments.o rscmoments.o    \
+                      rdsegsum.o rdkeysum.o rssegsum.o rskeysum.o          \
+                      rdscan.o rdexscan.o rsscan.o rsexscan.o              \
+                      rdgemvdot.o rsgemvdot.o                              \
+                      rdaxpbydot.o rsaxpbydot.o                            \
+                      rzaxpbydotc_sub.o rcaxpbydotc_sub.o                  \
+                      rdaxpbynrm2.o rsaxpbynrm2.o                          \
+                      rdzaxpbynrm2.o rscaxpbynrm2.o                        \
+                      rdmdot.o rsmdot.o                                    \
+                      rdsum_bounded.o rdasum_bounded.o rddot_bounded.o     \
+                      rssum_bounded.o rsasum_bounded.o rsdot_bounded.o     \
                       dsum.o dasum.o dnrm2.o ddot.o                        \
                       zsum_sub.o dzasum.o dznrm2.o zdotc_sub.o zdotu_sub.o \
                       ssum.o sasum.o snrm2.o sdot.o                        \
                       csum_sub.o scasum.o scnrm2.o cdotc_sub.o cdotu_sub.o \
+                      sdssum.o sdsasum.o sdsnrm2.o sdsdot.o                \
+                      cdcsum_sub.o scdcasum.o scdcnrm2.o cdcdotc_sub.o     \
+                        cdcdotu_sub.o                                      \
+                      sdhsum.o sdhasum.o sdhnrm2.o sdhdot.o                \
+                      sdbsum.o sdbasum.o sdbnrm2.o sdbdot.o                \
+                      ddot_fma.o sdot_fma.o                                \
+                      zdotu_fma_sub.o zdotc_fma_sub.o                      \
+                      cdotu_fma_sub.o cdotc_fma_sub.o                      \
                       dgemv.o dgemm.o                                      \
                       zgemv.o zgemm.o                                      \
                       sgemv.o sgemm.o                                      \
                       cgemv.o cgemm.o                                      \
+                      dsgemv.o dsgemm.o                                    \
+                      zgemv_planar.o zgemm_planar.o                        \
+                      dsyrk.o ssyrk.o zherk.o                              \
+                      dtrsm.o dtrsv.o                                      \
+                      dcsrmv.o scsrmv.o                                    \
+                      dgesum.o dgeasum.o dgenrm2.o dlange.o                \
+                      sgesum.o sgeasum.o sgenrm2.o slange.o                \
+                      dmoments.o dcmoments.o smoments.o scmoments.o        \
+                      dsegsum.o dkeysum.o ssegsum.o skeysum.o              \
+                      dscan.o dexscan.o sscan.o sexscan.o                  \
+                      dgemvdot.o sgemvdot.o                                \
+                      daxpbydot.o saxpbydot.o                              \
+                      zaxpbydotc_sub.o caxpbydotc_sub.o                    \
+                      daxpbynrm2.o saxpbynrm2.o                            \
+                      dzaxpbynrm2.o scaxpbynrm2.o                          \
+                      dmdot.o smdot.o                                      \
+                      dsum_bounded.o dasum_bounded.o ddot_bounded.o        \
+                      ssum_bounded.o sasum_bounded.o sdot_bounded.o        \
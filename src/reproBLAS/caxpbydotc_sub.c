@@ -0,0 +1,63 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and compute the reproducible conjugated dot product of complex single precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and computes the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types of default fold using #idxdBLAS_cicaxpbydotc(). The result is the same as that of #reproBLAS_cdotc_sub() applied to W and the updated Y. W may be Y itself.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_caxpbydotc_sub(const int N, const void *alpha, const void *X, const int incX,
+                              const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc){
+  reproBLAS_rcaxpbydotc_sub(SIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY, W, incW, dotc);
+}
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and compute the reproducible conjugated dot product of complex single precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and computes the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types of default fold using #idxdBLAS_cicaxpbydotc_64(). The result is the same as that of #reproBLAS_cdotc_sub_64() applied to W and the updated Y. W may be Y itself.
+ *
+ * Same as #reproBLAS_caxpbydotc_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_caxpbydotc_sub_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                                 const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc){
+  reproBLAS_rcaxpbydotc_sub_64(SIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY, W, incW, dotc);
+}
@@ -0,0 +1,45 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_zicdotu()
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdcdotu_sub(const int N, const void* X, const int incX, const void *Y, const int incY, void *dotu) {
+  reproBLAS_rcdcdotu_sub(DIDEFAULTFOLD, N, X, incX, Y, incY, dotu);
+}
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_zicdotu_64()
+ *
+ * Same as #reproBLAS_cdcdotu_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdcdotu_sub_64(const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotu) {
+  reproBLAS_rcdcdotu_sub_64(DIDEFAULTFOLD, N, X, incX, Y, incY, dotu);
+}
@@ -0,0 +1,41 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible sum of complex single precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_zicsum()
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdcsum_sub(const int N, const void* X, const int incX, void *sum) {
+  reproBLAS_rcdcsum_sub(DIDEFAULTFOLD, N, X, incX, sum);
+}
+
+/**
+ * @brief Compute the reproducible sum of complex single precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_zicsum_64()
+ *
+ * Same as #reproBLAS_cdcsum_sub(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdcsum_sub_64(const int64_t N, const void* X, const int64_t incX, void *sum) {
+  reproBLAS_rcdcsum_sub_64(DIDEFAULTFOLD, N, X, incX, sum);
+}
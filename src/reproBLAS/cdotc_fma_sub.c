@@ -0,0 +1,45 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible conjugated dot product of complex single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_cicdotc_fma()
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdotc_fma_sub(const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc) {
+  reproBLAS_rcdotc_fma_sub(SIDEFAULTFOLD, N, X, incX, Y, incY, dotc);
+}
+
+/**
+ * @brief Compute the reproducible conjugated dot product of complex single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_cicdotc_fma_64()
+ *
+ * Same as #reproBLAS_cdotc_fma_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cdotc_fma_sub_64(const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotc) {
+  reproBLAS_rcdotc_fma_sub_64(SIDEFAULTFOLD, N, X, incX, Y, incY, dotc);
+}
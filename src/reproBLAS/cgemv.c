@@ -36,3 +36,39 @@ void reproBLAS_cgemv(const char Order,
                      const void *beta, void *Y, const int incY){
   reproBLAS_rcgemv(SIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
 }
+
+/**
+ * @brief Add to complex single precision vector Y the reproducible matrix-vector product of complex single precision matrix A and complex single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types of default fold with #idxdBLAS_cicgemv_64()
+ *
+ * Same as #reproBLAS_cgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A complex single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X complex single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_cgemv_64(const char Order,
+                        const char TransA, const int64_t M, const int64_t N,
+                        const void *alpha, const void *A, const int64_t lda,
+                        const void *X, const int64_t incX,
+                        const void *beta, void *Y, const int64_t incY){
+  reproBLAS_rcgemv_64(SIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
@@ -20,3 +20,23 @@
 double reproBLAS_dasum(const int N, const double* X, const int incX) {
   return reproBLAS_rdasum(DIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible absolute sum of double precision vector X
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types of default fold using #idxdBLAS_didasum_64()
+ *
+ * Same as #reproBLAS_dasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dasum_64(const int64_t N, const double* X, const int64_t incX) {
+  return reproBLAS_rdasum_64(DIDEFAULTFOLD, N, X, incX);
+}
@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible absolute sum of double precision vector X, given a bound on its elements
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types of default fold using #idxdBLAS_didasum_bounded(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_dasum().
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dasum_bounded(const int N, const double* X, const int incX, const double bound) {
+  return reproBLAS_rdasum_bounded(DIDEFAULTFOLD, N, X, incX, bound);
+}
+
+/**
+ * @brief Compute the reproducible absolute sum of double precision vector X, given a bound on its elements
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types of default fold using #idxdBLAS_didasum_bounded_64(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_dasum_64().
+ *
+ * Same as #reproBLAS_dasum_bounded(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dasum_bounded_64(const int64_t N, const double* X, const int64_t incX, const double bound) {
+  return reproBLAS_rdasum_bounded_64(DIDEFAULTFOLD, N, X, incX, bound);
+}
@@ -0,0 +1,63 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Update double precision vector Y with a scaled double precision vector X and compute the reproducible dot product of double precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types of default fold using #idxdBLAS_didaxpbydot(). The result is the same as that of #reproBLAS_ddot() applied to W and the updated Y. W may be Y itself.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_daxpbydot(const int N, const double alpha, const double *X, const int incX,
+                           const double beta, double *Y, const int incY, const double *W, const int incW){
+  return reproBLAS_rdaxpbydot(DIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY, W, incW);
+}
+
+/**
+ * @brief Update double precision vector Y with a scaled double precision vector X and compute the reproducible dot product of double precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types of default fold using #idxdBLAS_didaxpbydot_64(). The result is the same as that of #reproBLAS_ddot_64() applied to W and the updated Y. W may be Y itself.
+ *
+ * Same as #reproBLAS_daxpbydot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_daxpbydot_64(const int64_t N, const double alpha, const double *X, const int64_t incX,
+                              const double beta, double *Y, const int64_t incY, const double *W, const int64_t incW){
+  return reproBLAS_rdaxpbydot_64(DIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY, W, incW);
+}
@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible mean and central moments of double precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rdsum(), and the central moments with #reproBLAS_rdmoments() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M double precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dcmoments(const int order, const int N, const double *X, const int incX, double *M){
+  reproBLAS_rdcmoments(DIDEFAULTFOLD, order, N, X, incX, M);
+}
+
+/**
+ * @brief Compute the reproducible mean and central moments of double precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rdsum_64(), and the central moments with #reproBLAS_rdmoments_64() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * Same as #reproBLAS_dcmoments(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M double precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dcmoments_64(const int order, const int64_t N, const double *X, const int64_t incX, double *M){
+  reproBLAS_rdcmoments_64(DIDEFAULTFOLD, order, N, X, incX, M);
+}
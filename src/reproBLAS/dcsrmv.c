@@ -0,0 +1,75 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of sparse double precision matrix A in compressed sparse row format and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_didcsrmv(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_dcsramax() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax double precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dcsrmv(const char TransA,
+                      const int M, const int N,
+                      const double alpha, const double *val, const int *rowptr, const int *colind,
+                      const double *rowmax, const double *X, const int incX,
+                      const double beta, double *Y, const int incY){
+  reproBLAS_rdcsrmv(DIDEFAULTFOLD, TransA, M, N, alpha, val, rowptr, colind, rowmax, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of sparse double precision matrix A in compressed sparse row format and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_didcsrmv_64(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_dcsramax_64() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * Same as #reproBLAS_dcsrmv(), except that the dimensions, indices and strides are 64-bit integers.
+ *
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax double precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dcsrmv_64(const char TransA,
+                         const int64_t M, const int64_t N,
+                         const double alpha, const double *val, const int64_t *rowptr, const int64_t *colind,
+                         const double *rowmax, const double *X, const int64_t incX,
+                         const double beta, double *Y, const int64_t incY){
+  reproBLAS_rdcsrmv_64(DIDEFAULTFOLD, TransA, M, N, alpha, val, rowptr, colind, rowmax, X, incX, beta, Y, incY);
+}
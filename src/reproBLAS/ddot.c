@@ -22,3 +22,25 @@
 double reproBLAS_ddot(const int N, const double* X, const int incX, const double *Y, const int incY) {
   return reproBLAS_rddot(DIDEFAULTFOLD, N, X, incX, Y, incY);
 }
+
+/**
+ * @brief Compute the reproducible dot product of double precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_diddot_64()
+ *
+ * Same as #reproBLAS_ddot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_ddot_64(const int64_t N, const double* X, const int64_t incX, const double *Y, const int64_t incY) {
+  return reproBLAS_rddot_64(DIDEFAULTFOLD, N, X, incX, Y, incY);
+}
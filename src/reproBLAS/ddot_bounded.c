@@ -0,0 +1,47 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible dot product of double precision vectors X and Y, given a bound on their products
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_diddot_bounded(), which reads X and Y once. If @c bound is at least the absolute value of every pairwise product of X and Y and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_ddot().
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_ddot_bounded(const int N, const double* X, const int incX, const double *Y, const int incY, const double bound) {
+  return reproBLAS_rddot_bounded(DIDEFAULTFOLD, N, X, incX, Y, incY, bound);
+}
+
+/**
+ * @brief Compute the reproducible dot product of double precision vectors X and Y, given a bound on their products
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_diddot_bounded_64(), which reads X and Y once. If @c bound is at least the absolute value of every pairwise product of X and Y and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_ddot_64().
+ *
+ * Same as #reproBLAS_ddot_bounded(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_ddot_bounded_64(const int64_t N, const double* X, const int64_t incX, const double *Y, const int64_t incY, const double bound) {
+  return reproBLAS_rddot_bounded_64(DIDEFAULTFOLD, N, X, incX, Y, incY, bound);
+}
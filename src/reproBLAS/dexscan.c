@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible exclusive scan of double precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_didexscan(), and each element of Y is the same as #reproBLAS_rdsum() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dexscan(const int N, const double *X, const int incX, double *Y, const int incY){
+  reproBLAS_rdexscan(DIDEFAULTFOLD, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible exclusive scan of double precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_didexscan_64(), and each element of Y is the same as #reproBLAS_rdsum_64() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * Same as #reproBLAS_dexscan(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dexscan_64(const int64_t N, const double *X, const int64_t incX, double *Y, const int64_t incY){
+  reproBLAS_rdexscan_64(DIDEFAULTFOLD, N, X, incX, Y, incY);
+}
@@ -0,0 +1,81 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of double precision matrix A and double precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_didgemvdot(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_dgemv(), and the result is the same as #reproBLAS_ddot() of W and the new Y, whatever the number of threads.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dgemvdot(const char Order,
+                          const char TransA, const int M, const int N,
+                          const double alpha, const double *A, const int lda,
+                          const double *X, const int incX,
+                          const double beta, double *Y, const int incY,
+                          const double *W, const int incW){
+  return reproBLAS_rdgemvdot(DIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY, W, incW);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of double precision matrix A and double precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_didgemvdot_64(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_dgemv_64(), and the result is the same as #reproBLAS_ddot_64() of W and the new Y, whatever the number of threads.
+ *
+ * Same as #reproBLAS_dgemvdot(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dgemvdot_64(const char Order,
+                             const char TransA, const int64_t M, const int64_t N,
+                             const double alpha, const double *A, const int64_t lda,
+                             const double *X, const int64_t incX,
+                             const double beta, double *Y, const int64_t incY,
+                             const double *W, const int64_t incW){
+  return reproBLAS_rdgemvdot_64(DIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY, W, incW);
+}
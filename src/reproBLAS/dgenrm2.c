@@ -0,0 +1,55 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible Euclidian norms of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the square root of the sum of the squared elements of the corresponding row or column of A.
+ *
+ * The reproducible Euclidian norms are computed with scaled indexed types using #idxdBLAS_didgessq(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdnrm2() of the corresponding row or column.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to take the norm of ('r' or 'R' for each row of A, 'c' or 'C' for each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dgenrm2(const char Order, const char Dim,
+                       const int M, const int N,
+                       const double *A, const int lda,
+                       double *Y, const int incY){
+  reproBLAS_rdgenrm2(DIDEFAULTFOLD, Order, Dim, M, N, A, lda, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible Euclidian norms of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the square root of the sum of the squared elements of the corresponding row or column of A.
+ *
+ * The reproducible Euclidian norms are computed with scaled indexed types using #idxdBLAS_didgessq_64(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdnrm2_64() of the corresponding row or column.
+ *
+ * Same as #reproBLAS_dgenrm2(), except that the dimensions, leading dimension and stride are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to take the norm of ('r' or 'R' for each row of A, 'c' or 'C' for each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dgenrm2_64(const char Order, const char Dim,
+                          const int64_t M, const int64_t N,
+                          const double *A, const int64_t lda,
+                          double *Y, const int64_t incY){
+  reproBLAS_rdgenrm2_64(DIDEFAULTFOLD, Order, Dim, M, N, A, lda, Y, incY);
+}
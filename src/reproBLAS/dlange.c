@@ -0,0 +1,61 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute a reproducible norm of double precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_didgeasum(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_didgessq() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rdnrm2() of the elements of A.
+ *
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dlange(const char Norm, const char Order,
+                        const int M, const int N,
+                        const double *A, const int lda){
+  return reproBLAS_rdlange(DIDEFAULTFOLD, Norm, Order, M, N, A, lda);
+}
+
+/**
+ * @brief Compute a reproducible norm of double precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_didgeasum_64(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_didgessq_64() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rdnrm2_64() of the elements of A.
+ *
+ * Same as #reproBLAS_dlange(), except that the dimensions and leading dimension are 64-bit integers.
+ *
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dlange_64(const char Norm, const char Order,
+                           const int64_t M, const int64_t N,
+                           const double *A, const int64_t lda){
+  return reproBLAS_rdlange_64(DIDEFAULTFOLD, Norm, Order, M, N, A, lda);
+}
@@ -20,3 +20,23 @@
 double reproBLAS_dnrm2(const int N, const double* X, const int incX) {
   return reproBLAS_rdnrm2(DIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible Euclidian norm of double precision vector X
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types of default fold using #idxdBLAS_didssq_64()
+ *
+ * Same as #reproBLAS_dnrm2(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dnrm2_64(const int64_t N, const double* X, const int64_t incX) {
+  return reproBLAS_rdnrm2_64(DIDEFAULTFOLD, N, X, incX);
+}
@@ -0,0 +1,77 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types of default fold with #idxdBLAS_disgemv()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and X to double precision at once. The result is the same as that of #reproBLAS_dgemv() on A and X converted to double precision.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dsgemv(const char Order, const char TransA,
+                      const int M, const int N,
+                      const double alpha, const float *A, const int lda,
+                      const float *X, const int incX,
+                      const double beta, double *Y, const int incY){
+  reproBLAS_rdsgemv(DIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types of default fold with #idxdBLAS_disgemv_64()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and X to double precision at once. The result is the same as that of #reproBLAS_dgemv() on A and X converted to double precision.
+ *
+ * Same as #reproBLAS_dsgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dsgemv_64(const char Order, const char TransA,
+                         const int64_t M, const int64_t N,
+                         const double alpha, const float *A, const int64_t lda,
+                         const float *X, const int64_t incX,
+                         const double beta, double *Y, const int64_t incY){
+  reproBLAS_rdsgemv_64(DIDEFAULTFOLD, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
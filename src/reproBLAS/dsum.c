@@ -20,3 +20,23 @@
 double reproBLAS_dsum(const int N, const double* X, const int incX) {
   return reproBLAS_rdsum(DIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible sum of double precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_didsum_64()
+ *
+ * Same as #reproBLAS_dsum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dsum_64(const int64_t N, const double* X, const int64_t incX) {
+  return reproBLAS_rdsum_64(DIDEFAULTFOLD, N, X, incX);
+}
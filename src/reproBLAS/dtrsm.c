@@ -0,0 +1,81 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Solve a triangular system of equations with multiple right hand sides reproducibly
+ *
+ * Solves one of the matrix equations
+ *
+ *   op(A)*X = alpha*B   or   X*op(A) = alpha*B,
+ *
+ * where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * alpha is a scalar, X and B are M by N matrices, and A is a unit or non-unit, upper or lower triangular matrix. X overwrites B.
+ *
+ * Each element of X is the sum of the corresponding element of alpha*B and the products of the elements of A with the elements of X already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The products are accumulated in blocks with #idxdBLAS_didgemm() and #idxdBLAS_diddot(), so that the result is independent of the blocking and of the number of threads, and is the same as that of a substitution that accumulates each element with a single indexed dot product.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Side a character specifying whether op(A) multiplies X from the left or the right ('l' or 'L' for op(A)*X = alpha*B, 'r' or 'R' for X*op(A) = alpha*B)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param M number of rows of matrix B.
+ * @param N number of columns of matrix B.
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (ka, lda) in row-major or (lda, ka) in column-major. ka is M if Side is 'l' or 'L' and N otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least ka.
+ * @param B double precision matrix of dimension (M, ldb) in row-major or (ldb, N) in column-major.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dtrsm(const char Order, const char Side, const char Uplo,
+                     const char TransA, const char Diag,
+                     const int M, const int N,
+                     const double alpha, const double *A, const int lda,
+                     double *B, const int ldb){
+  reproBLAS_rdtrsm(DIDEFAULTFOLD, Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+/**
+ * @brief Solve a triangular system of equations with multiple right hand sides reproducibly
+ *
+ * Solves one of the matrix equations
+ *
+ *   op(A)*X = alpha*B   or   X*op(A) = alpha*B,
+ *
+ * where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * alpha is a scalar, X and B are M by N matrices, and A is a unit or non-unit, upper or lower triangular matrix. X overwrites B.
+ *
+ * Each element of X is the sum of the corresponding element of alpha*B and the products of the elements of A with the elements of X already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The products are accumulated in blocks with #idxdBLAS_didgemm_64() and #idxdBLAS_diddot_64(), so that the result is independent of the blocking and of the number of threads, and is the same as that of a substitution that accumulates each element with a single indexed dot product.
+ *
+ * Same as #reproBLAS_dtrsm(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Side a character specifying whether op(A) multiplies X from the left or the right ('l' or 'L' for op(A)*X = alpha*B, 'r' or 'R' for X*op(A) = alpha*B)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param M number of rows of matrix B.
+ * @param N number of columns of matrix B.
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (ka, lda) in row-major or (lda, ka) in column-major. ka is M if Side is 'l' or 'L' and N otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least ka.
+ * @param B double precision matrix of dimension (M, ldb) in row-major or (ldb, N) in column-major.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dtrsm_64(const char Order, const char Side, const char Uplo,
+                        const char TransA, const char Diag,
+                        const int64_t M, const int64_t N,
+                        const double alpha, const double *A, const int64_t lda,
+                        double *B, const int64_t ldb){
+  reproBLAS_rdtrsm_64(DIDEFAULTFOLD, Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
@@ -0,0 +1,65 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Solve a triangular system of equations reproducibly
+ *
+ * Solves one of the systems of equations
+ *
+ *   A*x = b   or   A**T*x = b,
+ *
+ * where b and x are vectors of length N and A is a unit or non-unit, upper or lower triangular N by N matrix. x overwrites b.
+ *
+ * Each element of x is the sum of the corresponding element of b and the products of the elements of A with the elements of x already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The result is the same as that of #reproBLAS_rdtrsm() with one right hand side.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param N number of rows and columns of matrix A.
+ * @param A double precision matrix of dimension (N, lda) in row-major or (lda, N) in column-major.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least N.
+ * @param X double precision vector of at least size N. On entry, the right hand side b, and on exit, the solution x.
+ * @param incX X vector stride (use every incX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dtrsv(const char Order, const char Uplo,
+                     const char TransA, const char Diag,
+                     const int N, const double *A, const int lda,
+                     double *X, const int incX){
+  reproBLAS_rdtrsv(DIDEFAULTFOLD, Order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
+
+/**
+ * @brief Solve a triangular system of equations reproducibly
+ *
+ * Solves one of the systems of equations
+ *
+ *   A*x = b   or   A**T*x = b,
+ *
+ * where b and x are vectors of length N and A is a unit or non-unit, upper or lower triangular N by N matrix. x overwrites b.
+ *
+ * Each element of x is the sum of the corresponding element of b and the products of the elements of A with the elements of x already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The result is the same as that of #reproBLAS_rdtrsm_64() with one right hand side.
+ *
+ * Same as #reproBLAS_dtrsv(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param N number of rows and columns of matrix A.
+ * @param A double precision matrix of dimension (N, lda) in row-major or (lda, N) in column-major.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least N.
+ * @param X double precision vector of at least size N. On entry, the right hand side b, and on exit, the solution x.
+ * @param incX X vector stride (use every incX'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_dtrsv_64(const char Order, const char Uplo,
+                        const char TransA, const char Diag,
+                        const int64_t N, const double *A, const int64_t lda,
+                        double *X, const int64_t incX){
+  reproBLAS_rdtrsv_64(DIDEFAULTFOLD, Order, Uplo, TransA, Diag, N, A, lda, X, incX);
+}
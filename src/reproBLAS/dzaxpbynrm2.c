@@ -0,0 +1,59 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types of default fold using #idxdBLAS_dizaxpbyssq(). The result is the same as that of #reproBLAS_dznrm2() applied to the updated Y.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dzaxpbynrm2(const int N, const void *alpha, const void *X, const int incX,
+                             const void *beta, void *Y, const int incY){
+  return reproBLAS_rdzaxpbynrm2(DIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types of default fold using #idxdBLAS_dizaxpbyssq_64(). The result is the same as that of #reproBLAS_dznrm2_64() applied to the updated Y.
+ *
+ * Same as #reproBLAS_dzaxpbynrm2(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_dzaxpbynrm2_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                                const void *beta, void *Y, const int64_t incY){
+  return reproBLAS_rdzaxpbynrm2_64(DIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY);
+}
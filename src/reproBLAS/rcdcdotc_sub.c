@@ -0,0 +1,61 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible conjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcdotc_sub(), and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_zicdotc()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcdotc_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc) {
+  reproBLAS_rcdcdotc_sub_64(fold, N, X, incX, Y, incY, dotc);
+}
+
+/**
+ * @brief Compute the reproducible conjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcdotc_sub(), and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_zicdotc_64()
+ *
+ * Same as #reproBLAS_rcdcdotc_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcdotc_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotc) {
+  double dotcd[2];
+  double_complex_indexed *dotci = idxd_zialloc(fold);
+
+  idxd_zisetzero(fold, dotci);
+
+  idxdBLAS_zicdotc_64(fold, N, X, incX, Y, incY, dotci);
+
+  idxd_zziconv_sub(fold, dotci, dotcd);
+  ((float*)dotc)[0] = (float)dotcd[0];
+  ((float*)dotc)[1] = (float)dotcd[1];
+  free(dotci);
+  return;
+}
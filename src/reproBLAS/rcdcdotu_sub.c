@@ -0,0 +1,61 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcdotu_sub(), and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_zicdotu()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcdotu_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotu) {
+  reproBLAS_rcdcdotu_sub_64(fold, N, X, incX, Y, incY, dotu);
+}
+
+/**
+ * @brief Compute the reproducible unconjugated dot product of complex single precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcdotu_sub(), and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_zicdotu_64()
+ *
+ * Same as #reproBLAS_rcdcdotu_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotu scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcdotu_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotu) {
+  double dotud[2];
+  double_complex_indexed *dotui = idxd_zialloc(fold);
+
+  idxd_zisetzero(fold, dotui);
+
+  idxdBLAS_zicdotu_64(fold, N, X, incX, Y, incY, dotui);
+
+  idxd_zziconv_sub(fold, dotui, dotud);
+  ((float*)dotu)[0] = (float)dotud[0];
+  ((float*)dotu)[1] = (float)dotud[1];
+  free(dotui);
+  return;
+}
@@ -0,0 +1,57 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sum of complex single precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcsum_sub(), and then rounded to single precision.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_zicsum()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcsum_sub(const int fold, const int N, const void* X, const int incX, void *sum) {
+  reproBLAS_rcdcsum_sub_64(fold, N, X, incX, sum);
+}
+
+/**
+ * @brief Compute the reproducible sum of complex single precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The result is accumulated in indexed double precision types, which need fewer renormalizations and are more accurate than the indexed single precision types of #reproBLAS_rcsum_sub(), and then rounded to single precision.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_zicsum_64()
+ *
+ * Same as #reproBLAS_rcdcsum_sub(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcdcsum_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, void *sum) {
+  double sumd[2];
+  double_complex_indexed *sumi = idxd_zialloc(fold);
+
+  idxd_zisetzero(fold, sumi);
+
+  idxdBLAS_zicsum_64(fold, N, X, incX, sumi);
+
+  idxd_zziconv_sub(fold, sumi, sumd);
+  ((float*)sum)[0] = (float)sumd[0];
+  ((float*)sum)[1] = (float)sumd[1];
+  free(sumi);
+  return;
+}
@@ -3,6 +3,65 @@
 
 #include <reproBLAS.h>
 #include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int64_t M;
+  int64_t N;
+  int64_t K;
+  const void *alpha;
+  const void *A;
+  int64_t lda;
+  const void *B;
+  int64_t ldb;
+  float_complex_indexed *CI;
+  int64_t ldc;
+  int64_t chunk;
+} rcgemm_args;
+
+static void rcgemm_task(void *args_, const int t){
+  rcgemm_args *args = (rcgemm_args*)args_;
+  int64_t j = t * args->chunk;
+  int64_t n = args->N - j < args->chunk ? args->N - j : args->chunk;
+  int row_major = args->Order == 'r' || args->Order == 'R';
+  int trans_B = args->TransB != 'n' && args->TransB != 'N';
+
+  idxdBLAS_cicgemm_64(args->fold, args->Order, args->TransA, args->TransB, args->M, n, args->K, args->alpha, args->A, args->lda, (const float*)args->B + 2 * (row_major != trans_B ? j : j * args->ldb), args->ldb, args->CI + (row_major ? j : j * args->ldc) * idxd_cinum(args->fold), args->ldc);
+}
+
+static void rcgemm_pool(const int fold, const char Order, const char TransA, const char TransB, const int64_t M, const int64_t N, const int64_t K, const void *alpha, const void *A, const int64_t lda, const void *B, const int64_t ldb, float_complex_indexed *CI, const int64_t ldc){
+  rcgemm_args args;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N * K)){
+    idxdBLAS_cicgemm_64(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, ldc);
+    return;
+  }
+  args.chunk = (double)M * K < idxdPool_MINCHUNK ? (idxdPool_MINCHUNK + M * K - 1) / (M * K) : 1;
+  if(args.chunk < (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((N + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.CI = CI;
+  args.ldc = ldc;
+  idxdPool_dispatch(ntasks, rcgemm_task, &args);
+}
 
 /**
  * @brief Add to complex single precision matrix C the reproducible matrix-matrix product of complex single precision matrices A and B
@@ -43,10 +102,53 @@ void reproBLAS_rcgemm(const int fold, const char Order, const char TransA, const
                       const void *alpha, const void *A, const int lda,
                       const void *B, const int ldb,
                       const void *beta, void *C, const int ldc){
+  reproBLAS_rcgemm_64(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+/**
+ * @brief Add to complex single precision matrix C the reproducible matrix-matrix product of complex single precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * The matrix-matrix product is computed using indexed types with #idxdBLAS_cicgemm_64()
+ *
+ * Same as #reproBLAS_rcgemm(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A complex single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B complex single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C complex single precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcgemm_64(const int fold, const char Order, const char TransA, const char TransB,
+                         const int64_t M, const int64_t N, const int64_t K,
+                         const void *alpha, const void *A, const int64_t lda,
+                         const void *B, const int64_t ldb,
+                         const void *beta, void *C, const int64_t ldc){
   float_complex_indexed *CI;
   float betaC[2];
-  int i;
-  int j;
+  int64_t i;
+  int64_t j;
 
   if(M == 0 || N == 0){
     return;
@@ -73,7 +175,7 @@ void reproBLAS_rcgemm(const int fold, const char Order, const char TransA, const
           }
         }
       }
-      idxdBLAS_cicgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
+      rcgemm_pool(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
       for(i = 0; i < M; i++){
         for(j = 0; j < N; j++){
           idxd_cciconv_sub(fold, CI + (i * N + j) * idxd_cinum(fold), ((float*)C) + 2 * (i * ldc + j));
@@ -98,7 +200,7 @@ void reproBLAS_rcgemm(const int fold, const char Order, const char TransA, const
           }
         }
       }
-      idxdBLAS_cicgemm(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
+      rcgemm_pool(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
       for(j = 0; j < N; j++){
         for(i = 0; i < M; i++){
           idxd_cciconv_sub(fold, CI + (j * M + i) * idxd_cinum(fold), ((float*)C) + 2 * (j * ldc + i));
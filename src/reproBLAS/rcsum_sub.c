@@ -18,11 +18,32 @@
  * @date   15 Jan 2016
  */
 void reproBLAS_rcsum_sub(const int fold, const int N, const void* X, const int incX, void *sum) {
+  reproBLAS_rcsum_sub_64(fold, N, X, incX, sum);
+}
+
+/**
+ * @brief Compute the reproducible sum of complex single precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_cicsum_64()
+ *
+ * Same as #reproBLAS_rcsum_sub(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rcsum_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, void *sum) {
   float_complex_indexed *sumi = idxd_cialloc(fold);
 
   idxd_cisetzero(fold, sumi);
 
-  idxdBLAS_cicsum(fold, N, X, incX, sumi);
+  idxdBLAS_cicsum_64(fold, N, X, incX, sumi);
 
   idxd_cciconv_sub(fold, sumi, sum);
   free(sumi);
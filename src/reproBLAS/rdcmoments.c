@@ -0,0 +1,57 @@
+#include <reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible mean and central moments of double precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rdsum(), and the central moments with #reproBLAS_rdmoments() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M double precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdcmoments(const int fold, const int order, const int N, const double *X, const int incX, double *M){
+  reproBLAS_rdcmoments_64(fold, order, N, X, incX, M);
+}
+
+/**
+ * @brief Compute the reproducible mean and central moments of double precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rdsum_64(), and the central moments with #reproBLAS_rdmoments_64() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * Same as #reproBLAS_rdcmoments(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M double precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdcmoments_64(const int fold, const int order, const int64_t N, const double *X, const int64_t incX, double *M){
+  double mean;
+
+  if(order <= 0){
+    return;
+  }
+  if(N <= 0){
+    reproBLAS_rdmoments_64(fold, order, N, X, incX, 0.0, M);
+    return;
+  }
+
+  mean = reproBLAS_rdsum_64(fold, N, X, incX) / N;
+  if(order > 1){
+    reproBLAS_rdmoments_64(fold, order, N, X, incX, mean, M);
+  }
+  M[0] = mean;
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+static void rdcsrmv(const int fold, const char TransA, const int64_t M, const int64_t N,
+                    const double alpha, const double *val,
+                    const int *rowptr, const int64_t *rowptr_64, const int *colind, const int64_t *colind_64,
+                    const double *rowmax, const double *X, const int64_t incX,
+                    const double beta, double *Y, const int64_t incY){
+  double_indexed *YI;
+  int64_t L = (TransA == 'n' || TransA == 'N') ? M : N;
+  int64_t i;
+
+  if(N == 0 || M == 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(L * idxd_disize(fold));
+  if(beta == 0.0){
+    memset(YI, 0, L * idxd_disize(fold));
+  }else if(beta == 1.0){
+    for(i = 0; i < L; i++){
+      idxd_didconv(fold, Y[i * incY], YI + i * idxd_dinum(fold));
+    }
+  }else{
+    for(i = 0; i < L; i++){
+      idxd_didconv(fold, Y[i * incY] * beta, YI + i * idxd_dinum(fold));
+    }
+  }
+  if(rowptr_64 != NULL){
+    idxdBLAS_didcsrmv_64(fold, TransA, M, N, alpha, val, rowptr_64, colind_64, rowmax, X, incX, YI, 1);
+  }else{
+    idxdBLAS_didcsrmv(fold, TransA, (int)M, (int)N, alpha, val, rowptr, colind, rowmax, X, (int)incX, YI, 1);
+  }
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ddiconv(fold, YI + i * idxd_dinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of sparse double precision matrix A in compressed sparse row format and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_didcsrmv(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_dcsramax() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax double precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdcsrmv(const int fold, const char TransA,
+                       const int M, const int N,
+                       const double alpha, const double *val, const int *rowptr, const int *colind,
+                       const double *rowmax, const double *X, const int incX,
+                       const double beta, double *Y, const int incY){
+  rdcsrmv(fold, TransA, M, N, alpha, val, rowptr, NULL, colind, NULL, rowmax, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of sparse double precision matrix A in compressed sparse row format and double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_didcsrmv_64(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_dcsramax_64() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * Same as #reproBLAS_rdcsrmv(), except that the dimensions, indices and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax double precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdcsrmv_64(const int fold, const char TransA,
+                          const int64_t M, const int64_t N,
+                          const double alpha, const double *val, const int64_t *rowptr, const int64_t *colind,
+                          const double *rowmax, const double *X, const int64_t incX,
+                          const double beta, double *Y, const int64_t incY){
+  rdcsrmv(fold, TransA, M, N, alpha, val, NULL, rowptr, NULL, colind, rowmax, X, incX, beta, Y, incY);
+}
@@ -0,0 +1,74 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible absolute sums of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the sum of the absolute values of the corresponding row or column of A.
+ *
+ * The reproducible absolute sums are computed with indexed types using #idxdBLAS_didgeasum(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdasum() of the corresponding row or column.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdgeasum(const int fold, const char Order, const char Dim,
+                       const int M, const int N,
+                       const double *A, const int lda,
+                       double *Y, const int incY){
+  reproBLAS_rdgeasum_64(fold, Order, Dim, M, N, A, lda, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible absolute sums of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the sum of the absolute values of the corresponding row or column of A.
+ *
+ * The reproducible absolute sums are computed with indexed types using #idxdBLAS_didgeasum_64(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdasum_64() of the corresponding row or column.
+ *
+ * Same as #reproBLAS_rdgeasum(), except that the dimensions, leading dimension and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdgeasum_64(const int fold, const char Order, const char Dim,
+                          const int64_t M, const int64_t N,
+                          const double *A, const int64_t lda,
+                          double *Y, const int64_t incY){
+  double_indexed *YI;
+  int64_t L = (Dim == 'r' || Dim == 'R') ? M : N;
+  int64_t i;
+
+  if(L == 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(L * idxd_disize(fold));
+  for(i = 0; i < L; i++){
+    idxd_disetzero(fold, YI + i * idxd_dinum(fold));
+  }
+  idxdBLAS_didgeasum_64(fold, Order, Dim, M, N, A, lda, YI, 1);
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ddiconv(fold, YI + i * idxd_dinum(fold));
+  }
+  free(YI);
+}
@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  int64_t M;
+  int64_t N;
+  double alpha;
+  const double *A;
+  int64_t lda;
+  const double *X;
+  int64_t incX;
+  double_indexed *YI;
+  const double *W;
+  int64_t incW;
+  double_indexed *DI;
+  int64_t chunk;
+} rdgemvdot_args;
+
+static void rdgemvdot_task(void *args_, const int t){
+  rdgemvdot_args *args = (rdgemvdot_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t n;
+
+  switch(args->TransA){
+    case 'n':
+    case 'N':
+      n = args->M - i < args->chunk ? args->M - i : args->chunk;
+      idxdBLAS_didgemvdot_64(args->fold, args->Order, args->TransA, n, args->N, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i * args->lda : i), args->lda, args->X, args->incX, args->YI + i * idxd_dinum(args->fold), 1, args->W + i * args->incW, args->incW, args->DI + t * idxd_dinum(args->fold));
+      break;
+    default:
+      n = args->N - i < args->chunk ? args->N - i : args->chunk;
+      idxdBLAS_didgemvdot_64(args->fold, args->Order, args->TransA, args->M, n, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i : i * args->lda), args->lda, args->X, args->incX, args->YI + i * idxd_dinum(args->fold), 1, args->W + i * args->incW, args->incW, args->DI + t * idxd_dinum(args->fold));
+      break;
+  }
+}
+
+//the chunks of outputs are split as in reproBLAS_rdgemv(), and the partial dot products of the tasks are added to DI in order
+static void rdgemvdot_pool(const int fold, const char Order, const char TransA, const int64_t M, const int64_t N, const double alpha, const double *A, const int64_t lda, const double *X, const int64_t incX, double_indexed *YI, const double *W, const int64_t incW, double_indexed *DI){
+  rdgemvdot_args args;
+  int64_t L;
+  int ntasks;
+  int t;
+
+  if(!idxdPool_parallel((double)M * N)){
+    idxdBLAS_didgemvdot_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1, W, incW, DI);
+    return;
+  }
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      args.chunk = (idxdPool_MINCHUNK + N - 1) / N;
+      break;
+    default:
+      L = N;
+      args.chunk = (idxdPool_MINCHUNK + M - 1) / M;
+      break;
+  }
+  if(args.chunk < (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((L + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.M = M;
+  args.N = N;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.X = X;
+  args.incX = incX;
+  args.YI = YI;
+  args.W = W;
+  args.incW = incW;
+  args.DI = (double_indexed*)calloc(ntasks, idxd_disize(fold));
+  idxdPool_dispatch(ntasks, rdgemvdot_task, &args);
+  for(t = 0; t < ntasks; t++){
+    idxd_didiadd(fold, args.DI + t * idxd_dinum(fold), DI);
+  }
+  free(args.DI);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of double precision matrix A and double precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_didgemvdot(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_rdgemv(), and the result is the same as #reproBLAS_rddot() of W and the new Y, whatever the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdgemvdot(const int fold, const char Order,
+                           const char TransA, const int M, const int N,
+                           const double alpha, const double *A, const int lda,
+                           const double *X, const int incX,
+                           const double beta, double *Y, const int incY,
+                           const double *W, const int incW){
+  return reproBLAS_rdgemvdot_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY, W, incW);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of double precision matrix A and double precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_didgemvdot_64(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_rdgemv_64(), and the result is the same as #reproBLAS_rddot_64() of W and the new Y, whatever the number of threads.
+ *
+ * Same as #reproBLAS_rdgemvdot(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W double precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdgemvdot_64(const int fold, const char Order,
+                              const char TransA, const int64_t M, const int64_t N,
+                              const double alpha, const double *A, const int64_t lda,
+                              const double *X, const int64_t incX,
+                              const double beta, double *Y, const int64_t incY,
+                              const double *W, const int64_t incW){
+  double_indexed *YI;
+  double_indexed *DI;
+  double dot;
+  int64_t L;
+  int64_t i;
+
+  L = (TransA == 'n' || TransA == 'N') ? M : N;
+  if(N == 0 || M == 0){
+    return reproBLAS_rddot_64(fold, L, W, incW, Y, incY);
+  }
+
+  YI = (double_indexed*)malloc(L * idxd_disize(fold));
+  if(beta == 0.0){
+    memset(YI, 0, L * idxd_disize(fold));
+  }else if(beta == 1.0){
+    for(i = 0; i < L; i++){
+      idxd_didconv(fold, Y[i * incY], YI + i * idxd_dinum(fold));
+    }
+  }else{
+    for(i = 0; i < L; i++){
+      idxd_didconv(fold, Y[i * incY] * beta, YI + i * idxd_dinum(fold));
+    }
+  }
+  DI = idxd_dialloc(fold);
+  idxd_disetzero(fold, DI);
+  rdgemvdot_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, W, incW, DI);
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ddiconv(fold, YI + i * idxd_dinum(fold));
+  }
+  dot = idxd_ddiconv(fold, DI);
+  free(YI);
+  free(DI);
+  return dot;
+}
@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible Euclidian norms of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the square root of the sum of the squared elements of the corresponding row or column of A.
+ *
+ * The reproducible Euclidian norms are computed with scaled indexed types using #idxdBLAS_didgessq(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdnrm2() of the corresponding row or column.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to take the norm of ('r' or 'R' for each row of A, 'c' or 'C' for each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdgenrm2(const int fold, const char Order, const char Dim,
+                        const int M, const int N,
+                        const double *A, const int lda,
+                        double *Y, const int incY){
+  reproBLAS_rdgenrm2_64(fold, Order, Dim, M, N, A, lda, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible Euclidian norms of the rows or columns of double precision matrix A
+ *
+ * Sets each element of Y to the square root of the sum of the squared elements of the corresponding row or column of A.
+ *
+ * The reproducible Euclidian norms are computed with scaled indexed types using #idxdBLAS_didgessq_64(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rdnrm2_64() of the corresponding row or column.
+ *
+ * Same as #reproBLAS_rdgenrm2(), except that the dimensions, leading dimension and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to take the norm of ('r' or 'R' for each row of A, 'c' or 'C' for each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y double precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdgenrm2_64(const int fold, const char Order, const char Dim,
+                           const int64_t M, const int64_t N,
+                           const double *A, const int64_t lda,
+                           double *Y, const int64_t incY){
+  double_indexed *YI;
+  double *scl;
+  int64_t L = (Dim == 'r' || Dim == 'R') ? M : N;
+  int64_t i;
+
+  if(L == 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(L * idxd_disize(fold));
+  scl = (double*)malloc(L * sizeof(double));
+  for(i = 0; i < L; i++){
+    idxd_disetzero(fold, YI + i * idxd_dinum(fold));
+    scl[i] = 0.0;
+  }
+  idxdBLAS_didgessq_64(fold, Order, Dim, M, N, A, lda, scl, YI, 1);
+  for(i = 0; i < L; i++){
+    Y[i * incY] = scl[i] * sqrt(idxd_ddiconv(fold, YI + i * idxd_dinum(fold)));
+  }
+  free(YI);
+  free(scl);
+}
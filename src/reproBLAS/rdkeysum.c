@@ -0,0 +1,84 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sums of the elements of double precision vector X with each key
+ *
+ * Sets Y[k * incY] to the sum of the elements x_i of X with keys[i] = k, for k = 0, ..., nkeys - 1. Keys with no elements sum to 0, and elements with keys outside of this range are ignored.
+ *
+ * The sums are computed in one pass over X with indexed types using #idxdBLAS_didkeysum(). Each element of Y is the same as #reproBLAS_rdsum() of the elements with its key, in any order.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y double precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdkeysum(const int fold, const int N, const int *keys,
+                        const double *X, const int incX, const int nkeys,
+                        double *Y, const int incY){
+  double_indexed *YI;
+  int k;
+
+  if(nkeys <= 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(nkeys * idxd_disize(fold));
+  for(k = 0; k < nkeys; k++){
+    idxd_disetzero(fold, YI + k * idxd_dinum(fold));
+  }
+  idxdBLAS_didkeysum(fold, N, keys, X, incX, nkeys, YI, 1);
+  for(k = 0; k < nkeys; k++){
+    Y[k * incY] = idxd_ddiconv(fold, YI + k * idxd_dinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Compute the reproducible sums of the elements of double precision vector X with each key
+ *
+ * Sets Y[k * incY] to the sum of the elements x_i of X with keys[i] = k, for k = 0, ..., nkeys - 1. Keys with no elements sum to 0, and elements with keys outside of this range are ignored.
+ *
+ * The sums are computed in one pass over X with indexed types using #idxdBLAS_didkeysum_64(). Each element of Y is the same as #reproBLAS_rdsum_64() of the elements with its key, in any order.
+ *
+ * Same as #reproBLAS_rdkeysum(), except that the vector length, keys, number of keys and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y double precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdkeysum_64(const int fold, const int64_t N, const int64_t *keys,
+                           const double *X, const int64_t incX, const int64_t nkeys,
+                           double *Y, const int64_t incY){
+  double_indexed *YI;
+  int64_t k;
+
+  if(nkeys <= 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(nkeys * idxd_disize(fold));
+  for(k = 0; k < nkeys; k++){
+    idxd_disetzero(fold, YI + k * idxd_dinum(fold));
+  }
+  idxdBLAS_didkeysum_64(fold, N, keys, X, incX, nkeys, YI, 1);
+  for(k = 0; k < nkeys; k++){
+    Y[k * incY] = idxd_ddiconv(fold, YI + k * idxd_dinum(fold));
+  }
+  free(YI);
+}
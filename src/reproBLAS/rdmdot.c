@@ -0,0 +1,71 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible dot products of several pairs of double precision vectors
+ *
+ * The j'th of the k vectors starts at X + j * ldX and has stride incX. Sets dots[p] to the sum of the pairwise products of the vectors pairs[2 * p] and pairs[2 * p + 1], for p = 0, ..., npairs - 1. Pairs that name a vector outside of 0, ..., k - 1 give 0.
+ *
+ * The dot products are computed in one pass over the vectors with indexed types using #idxdBLAS_didmdot(). Each is the same as that of #reproBLAS_rddot() applied to its pair.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param k number of vectors
+ * @param X double precision vectors
+ * @param ldX distance between the first elements of consecutive vectors
+ * @param incX X vector stride (use every incX'th element)
+ * @param npairs number of pairs
+ * @param pairs the indices of the two vectors of each pair (size 2 * npairs)
+ * @param dots double precision vector of size npairs
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdmdot(const int fold, const int N, const int k,
+                      const double *X, const int ldX, const int incX,
+                      const int npairs, const int *pairs, double *dots){
+  reproBLAS_rdmdot_64(fold, N, k, X, ldX, incX, npairs, pairs, dots);
+}
+
+/**
+ * @brief Compute the reproducible dot products of several pairs of double precision vectors
+ *
+ * The j'th of the k vectors starts at X + j * ldX and has stride incX. Sets dots[p] to the sum of the pairwise products of the vectors pairs[2 * p] and pairs[2 * p + 1], for p = 0, ..., npairs - 1. Pairs that name a vector outside of 0, ..., k - 1 give 0.
+ *
+ * The dot products are computed in one pass over the vectors with indexed types using #idxdBLAS_didmdot_64(). Each is the same as that of #reproBLAS_rddot_64() applied to its pair.
+ *
+ * Same as #reproBLAS_rdmdot(), except that the vector length, distance between vectors and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param k number of vectors
+ * @param X double precision vectors
+ * @param ldX distance between the first elements of consecutive vectors
+ * @param incX X vector stride (use every incX'th element)
+ * @param npairs number of pairs
+ * @param pairs the indices of the two vectors of each pair (size 2 * npairs)
+ * @param dots double precision vector of size npairs
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdmdot_64(const int fold, const int64_t N, const int k,
+                         const double *X, const int64_t ldX, const int64_t incX,
+                         const int npairs, const int *pairs, double *dots){
+  double_indexed *ZI;
+  int p;
+
+  if(npairs <= 0){
+    return;
+  }
+
+  ZI = (double_indexed*)malloc(npairs * idxd_disize(fold));
+  for(p = 0; p < npairs; p++){
+    idxd_disetzero(fold, ZI + p * idxd_dinum(fold));
+  }
+  idxdBLAS_didmdot_64(fold, N, k, X, ldX, incX, npairs, pairs, ZI);
+  for(p = 0; p < npairs; p++){
+    dots[p] = idxd_ddiconv(fold, ZI + p * idxd_dinum(fold));
+  }
+  free(ZI);
+}
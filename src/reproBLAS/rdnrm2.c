@@ -20,13 +20,34 @@
  * @date   15 Jan 2016
  */
 double reproBLAS_rdnrm2(const int fold, const int N, const double* X, const int incX) {
+  return reproBLAS_rdnrm2_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible Euclidian norm of double precision vector X
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types using #idxdBLAS_didssq_64()
+ *
+ * Same as #reproBLAS_rdnrm2(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdnrm2_64(const int fold, const int64_t N, const double* X, const int64_t incX) {
   double_indexed *ssq = idxd_dialloc(fold);
   double scl;
   double nrm2;
 
   idxd_disetzero(fold, ssq);
 
-  scl = idxdBLAS_didssq(fold, N, X, incX, 0.0, ssq);
+  scl = idxdBLAS_didssq_64(fold, N, X, incX, 0.0, ssq);
 
   nrm2 = scl * sqrt(idxd_ddiconv(fold, ssq));
   free(ssq);
@@ -0,0 +1,82 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sums of the segments of double precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_didsegsum(). Each element of Y is the same as #reproBLAS_rdsum() of its segment.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsegsum(const int fold, const int nseg, const int *segptr,
+                        const double *X, const int incX,
+                        double *Y, const int incY){
+  double_indexed *YI;
+  int s;
+
+  if(nseg <= 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(nseg * idxd_disize(fold));
+  for(s = 0; s < nseg; s++){
+    idxd_disetzero(fold, YI + s * idxd_dinum(fold));
+  }
+  idxdBLAS_didsegsum(fold, nseg, segptr, X, incX, YI, 1);
+  for(s = 0; s < nseg; s++){
+    Y[s * incY] = idxd_ddiconv(fold, YI + s * idxd_dinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Compute the reproducible sums of the segments of double precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_didsegsum_64(). Each element of Y is the same as #reproBLAS_rdsum_64() of its segment.
+ *
+ * Same as #reproBLAS_rdsegsum(), except that the number of segments, segment offsets and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y double precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+                           const double *X, const int64_t incX,
+                           double *Y, const int64_t incY){
+  double_indexed *YI;
+  int64_t s;
+
+  if(nseg <= 0){
+    return;
+  }
+
+  YI = (double_indexed*)malloc(nseg * idxd_disize(fold));
+  for(s = 0; s < nseg; s++){
+    idxd_disetzero(fold, YI + s * idxd_dinum(fold));
+  }
+  idxdBLAS_didsegsum_64(fold, nseg, segptr, X, incX, YI, 1);
+  for(s = 0; s < nseg; s++){
+    Y[s * incY] = idxd_ddiconv(fold, YI + s * idxd_dinum(fold));
+  }
+  free(YI);
+}
@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int64_t M;
+  int64_t N;
+  int64_t K;
+  double alpha;
+  const float *A;
+  int64_t lda;
+  const float *B;
+  int64_t ldb;
+  double_indexed *CI;
+  int64_t ldc;
+  int64_t chunk;
+} rdsgemm_args;
+
+static void rdsgemm_task(void *args_, const int t){
+  rdsgemm_args *args = (rdsgemm_args*)args_;
+  int64_t j = t * args->chunk;
+  int64_t n = args->N - j < args->chunk ? args->N - j : args->chunk;
+  int row_major = args->Order == 'r' || args->Order == 'R';
+  int trans_B = args->TransB != 'n' && args->TransB != 'N';
+
+  idxdBLAS_disgemm_64(args->fold, args->Order, args->TransA, args->TransB, args->M, n, args->K, args->alpha, args->A, args->lda, args->B + (row_major != trans_B ? j : j * args->ldb), args->ldb, args->CI + (row_major ? j : j * args->ldc) * idxd_dinum(args->fold), args->ldc);
+}
+
+static void rdsgemm_pool(const int fold, const char Order, const char TransA, const char TransB, const int64_t M, const int64_t N, const int64_t K, const double alpha, const float *A, const int64_t lda, const float *B, const int64_t ldb, double_indexed *CI, const int64_t ldc){
+  rdsgemm_args args;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N * K)){
+    idxdBLAS_disgemm_64(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, ldc);
+    return;
+  }
+  args.chunk = (double)M * K < idxdPool_MINCHUNK ? (idxdPool_MINCHUNK + M * K - 1) / (M * K) : 1;
+  if(args.chunk < (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((N + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.CI = CI;
+  args.ldc = ldc;
+  idxdPool_dispatch(ntasks, rdsgemm_task, &args);
+}
+
+/**
+ * @brief Add to double precision matrix C the reproducible matrix-matrix product of single precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * The matrix-matrix product is computed using indexed types with #idxdBLAS_disgemm()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and B to double precision at once. The result is the same as that of #reproBLAS_rdgemm() on A and B converted to double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsgemm(const int fold, const char Order, const char TransA, const char TransB,
+                       const int M, const int N, const int K,
+                       const double alpha, const float *A, const int lda,
+                       const float *B, const int ldb,
+                       const double beta, double *C, const int ldc){
+  reproBLAS_rdsgemm_64(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+/**
+ * @brief Add to double precision matrix C the reproducible matrix-matrix product of single precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * The matrix-matrix product is computed using indexed types with #idxdBLAS_disgemm_64()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and B to double precision at once. The result is the same as that of #reproBLAS_rdgemm() on A and B converted to double precision.
+ *
+ * Same as #reproBLAS_rdsgemm(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param B single precision matrix of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param C double precision matrix of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsgemm_64(const int fold, const char Order, const char TransA, const char TransB,
+                          const int64_t M, const int64_t N, const int64_t K,
+                          const double alpha, const float *A, const int64_t lda,
+                          const float *B, const int64_t ldb,
+                          const double beta, double *C, const int64_t ldc){
+  double_indexed *CI;
+  int64_t i;
+  int64_t j;
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  CI = (double_indexed*)malloc(M * N * idxd_disize(fold));
+  switch(Order){
+    case 'r':
+    case 'R':
+      if(beta == 0.0){
+        memset(CI, 0, M * N * idxd_disize(fold));
+      }else if(beta == 1.0){
+        for(i = 0; i < M; i++){
+          for(j = 0; j < N; j++){
+            idxd_didconv(fold, C[i * ldc + j], CI + (i * N + j) * idxd_dinum(fold));
+          }
+        }
+      }else{
+        for(i = 0; i < M; i++){
+          for(j = 0; j < N; j++){
+            idxd_didconv(fold, C[i * ldc + j] * beta, CI + (i * N + j) * idxd_dinum(fold));
+          }
+        }
+      }
+      rdsgemm_pool(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, N);
+      for(i = 0; i < M; i++){
+        for(j = 0; j < N; j++){
+          C[i * ldc + j] = idxd_ddiconv(fold, CI + (i * N + j) * idxd_dinum(fold));
+        }
+      }
+      break;
+    default:
+      if(beta == 0.0){
+        memset(CI, 0, M * N * idxd_disize(fold));
+      }else if(beta == 1.0){
+        for(j = 0; j < N; j++){
+          for(i = 0; i < M; i++){
+            idxd_didconv(fold, C[j * ldc + i], CI + (j * M + i) * idxd_dinum(fold));
+          }
+        }
+      }else{
+        for(j = 0; j < N; j++){
+          for(i = 0; i < M; i++){
+            idxd_didconv(fold, C[j * ldc + i] * beta, CI + (j * M + i) * idxd_dinum(fold));
+          }
+        }
+      }
+      rdsgemm_pool(fold, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, CI, M);
+      for(j = 0; j < N; j++){
+        for(i = 0; i < M; i++){
+          C[j * ldc + i] = idxd_ddiconv(fold, CI + (j * M + i) * idxd_dinum(fold));
+        }
+      }
+      break;
+  }
+  free(CI);
+}
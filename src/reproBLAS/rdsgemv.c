@@ -0,0 +1,199 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  int64_t M;
+  int64_t N;
+  double alpha;
+  const float *A;
+  int64_t lda;
+  const float *X;
+  int64_t incX;
+  double_indexed *YI;
+  int64_t chunk;
+} rdsgemv_args;
+
+static void rdsgemv_task(void *args_, const int t){
+  rdsgemv_args *args = (rdsgemv_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t n;
+
+  switch(args->TransA){
+    case 'n':
+    case 'N':
+      n = args->M - i < args->chunk ? args->M - i : args->chunk;
+      idxdBLAS_disgemv_64(args->fold, args->Order, args->TransA, n, args->N, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i * args->lda : i), args->lda, args->X, args->incX, args->YI + i * idxd_dinum(args->fold), 1);
+      break;
+    default:
+      n = args->N - i < args->chunk ? args->N - i : args->chunk;
+      idxdBLAS_disgemv_64(args->fold, args->Order, args->TransA, args->M, n, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i : i * args->lda), args->lda, args->X, args->incX, args->YI + i * idxd_dinum(args->fold), 1);
+      break;
+  }
+}
+
+static void rdsgemv_pool(const int fold, const char Order, const char TransA, const int64_t M, const int64_t N, const double alpha, const float *A, const int64_t lda, const float *X, const int64_t incX, double_indexed *YI){
+  rdsgemv_args args;
+  int64_t L;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N)){
+    idxdBLAS_disgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1);
+    return;
+  }
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      args.chunk = (idxdPool_MINCHUNK + N - 1) / N;
+      break;
+    default:
+      L = N;
+      args.chunk = (idxdPool_MINCHUNK + M - 1) / M;
+      break;
+  }
+  if(args.chunk < (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((L + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.M = M;
+  args.N = N;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.X = X;
+  args.incX = incX;
+  args.YI = YI;
+  idxdPool_dispatch(ntasks, rdsgemv_task, &args);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_disgemv()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and X to double precision at once. The result is the same as that of #reproBLAS_rdgemv() on A and X converted to double precision.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsgemv(const int fold, const char Order,
+                       const char TransA, const int M, const int N,
+                       const double alpha, const float *A, const int lda,
+                       const float *X, const int incX,
+                       const double beta, double *Y, const int incY){
+  reproBLAS_rdsgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to double precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_disgemv_64()
+ *
+ * The products are formed and accumulated in double precision without converting all of A and X to double precision at once. The result is the same as that of #reproBLAS_rdgemv() on A and X converted to double precision.
+ *
+ * Same as #reproBLAS_rdsgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdsgemv_64(const int fold, const char Order,
+                          const char TransA, const int64_t M, const int64_t N,
+                          const double alpha, const float *A, const int64_t lda,
+                          const float *X, const int64_t incX,
+                          const double beta, double *Y, const int64_t incY){
+  double_indexed *YI;
+  int64_t i;
+
+  if(N == 0 || M == 0){
+    return;
+  }
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      YI = (double_indexed*)malloc(M * idxd_disize(fold));
+      if(beta == 0.0){
+        memset(YI, 0, M * idxd_disize(fold));
+      }else if(beta == 1.0){
+        for(i = 0; i < M; i++){
+          idxd_didconv(fold, Y[i * incY], YI + i * idxd_dinum(fold));
+        }
+      }else{
+        for(i = 0; i < M; i++){
+          idxd_didconv(fold, Y[i * incY] * beta, YI + i * idxd_dinum(fold));
+        }
+      }
+      rdsgemv_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI);
+      for(i = 0; i < M; i++){
+        Y[i * incY] = idxd_ddiconv(fold, YI + i * idxd_dinum(fold));
+      }
+      break;
+    default:
+      YI = (double_indexed*)malloc(N * idxd_disize(fold));
+      if(beta == 0.0){
+        memset(YI, 0, N * idxd_disize(fold));
+      }else if(beta == 1.0){
+        for(i = 0; i < N; i++){
+          idxd_didconv(fold, Y[i * incY], YI + i * idxd_dinum(fold));
+        }
+      }else{
+        for(i = 0; i < N; i++){
+          idxd_didconv(fold, Y[i * incY] * beta, YI + i * idxd_dinum(fold));
+        }
+      }
+      rdsgemv_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI);
+      for(i = 0; i < N; i++){
+        Y[i * incY] = idxd_ddiconv(fold, YI + i * idxd_dinum(fold));
+      }
+      break;
+  }
+  free(YI);
+}
@@ -18,12 +18,33 @@
  * @date   15 Jan 2016
  */
 double reproBLAS_rdsum(const int fold, const int N, const double* X, const int incX) {
+  return reproBLAS_rdsum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible sum of double precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_didsum_64()
+ *
+ * Same as #reproBLAS_rdsum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdsum_64(const int fold, const int64_t N, const double* X, const int64_t incX) {
   double_indexed *sumi = idxd_dialloc(fold);
   double sum;
 
   idxd_disetzero(fold, sumi);
 
-  idxdBLAS_didsum(fold, N, X, incX, sumi);
+  idxdBLAS_didsum_64(fold, N, X, incX, sumi);
 
   sum = idxd_ddiconv(fold, sumi);
   free(sumi);
@@ -0,0 +1,216 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+#define T_BLOCK 32
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransT;
+  int64_t M;
+  int64_t N;
+  int64_t K;
+  const double *A;
+  int64_t lda;
+  const double *B;
+  int64_t ldb;
+  double_indexed *CI;
+  int64_t ldc;
+  int64_t chunk;
+} rdtrsm_args;
+
+static void rdtrsm_task(void *args_, const int t){
+  rdtrsm_args *args = (rdtrsm_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t m = args->M - i < args->chunk ? args->M - i : args->chunk;
+  int row_major = args->Order == 'r' || args->Order == 'R';
+  int trans_T = args->TransT != 'n' && args->TransT != 'N';
+
+  idxdBLAS_didgemm_64(args->fold, args->Order, args->TransT, 'n', m, args->N, args->K, 1.0, args->A + (row_major != trans_T ? i * args->lda : i), args->lda, args->B, args->ldb, args->CI + (row_major ? i * args->ldc : i) * idxd_dinum(args->fold), args->ldc);
+}
+
+//add to the rows of the indexed matrix CI the product of op(A) (M by K) and B (K by N), splitting the rows among tasks
+static void rdtrsm_pool(const int fold, const char Order, const char TransT, const int64_t M, const int64_t N, const int64_t K, const double *A, const int64_t lda, const double *B, const int64_t ldb, double_indexed *CI, const int64_t ldc){
+  rdtrsm_args args;
+  int ntasks;
+
+  if(M == 0 || !idxdPool_parallel((double)M * N * K)){
+    idxdBLAS_didgemm_64(fold, Order, TransT, 'n', M, N, K, 1.0, A, lda, B, ldb, CI, ldc);
+    return;
+  }
+  args.chunk = (idxdPool_MINCHUNK + N * K - 1) / (N * K);
+  if(args.chunk < (M + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (M + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((M + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransT = TransT;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.A = A;
+  args.lda = lda;
+  args.B = B;
+  args.ldb = ldb;
+  args.CI = CI;
+  args.ldc = ldc;
+  idxdPool_dispatch(ntasks, rdtrsm_task, &args);
+}
+
+/**
+ * @brief Solve a triangular system of equations with multiple right hand sides reproducibly
+ *
+ * Solves one of the matrix equations
+ *
+ *   op(A)*X = alpha*B   or   X*op(A) = alpha*B,
+ *
+ * where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * alpha is a scalar, X and B are M by N matrices, and A is a unit or non-unit, upper or lower triangular matrix. X overwrites B.
+ *
+ * Each element of X is the sum of the corresponding element of alpha*B and the products of the elements of A with the elements of X already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The products are accumulated in blocks with #idxdBLAS_didgemm() and #idxdBLAS_diddot(), so that the result is independent of the blocking and of the number of threads, and is the same as that of a substitution that accumulates each element with a single indexed dot product.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Side a character specifying whether op(A) multiplies X from the left or the right ('l' or 'L' for op(A)*X = alpha*B, 'r' or 'R' for X*op(A) = alpha*B)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param M number of rows of matrix B.
+ * @param N number of columns of matrix B.
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (ka, lda) in row-major or (lda, ka) in column-major. ka is M if Side is 'l' or 'L' and N otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least ka.
+ * @param B double precision matrix of dimension (M, ldb) in row-major or (ldb, N) in column-major.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdtrsm(const int fold, const char Order, const char Side, const char Uplo,
+                      const char TransA, const char Diag,
+                      const int M, const int N,
+                      const double alpha, const double *A, const int lda,
+                      double *B, const int ldb){
+  reproBLAS_rdtrsm_64(fold, Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+/**
+ * @brief Solve a triangular system of equations with multiple right hand sides reproducibly
+ *
+ * Solves one of the matrix equations
+ *
+ *   op(A)*X = alpha*B   or   X*op(A) = alpha*B,
+ *
+ * where op(A) is one of
+ *
+ *   op(A) = A   or   op(A) = A**T,
+ *
+ * alpha is a scalar, X and B are M by N matrices, and A is a unit or non-unit, upper or lower triangular matrix. X overwrites B.
+ *
+ * Each element of X is the sum of the corresponding element of alpha*B and the products of the elements of A with the elements of X already computed, accumulated in an indexed type and rounded once before the division by the diagonal element of A. The products are accumulated in blocks with #idxdBLAS_didgemm_64() and #idxdBLAS_diddot_64(), so that the result is independent of the blocking and of the number of threads, and is the same as that of a substitution that accumulates each element with a single indexed dot product.
+ *
+ * Same as #reproBLAS_rdtrsm(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Side a character specifying whether op(A) multiplies X from the left or the right ('l' or 'L' for op(A)*X = alpha*B, 'r' or 'R' for X*op(A) = alpha*B)
+ * @param Uplo a character specifying whether A is upper or lower triangular ('u' or 'U' for upper triangular, 'l' or 'L' for lower triangular)
+ * @param TransA a character specifying whether or not to transpose A ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param Diag a character specifying whether or not A has a unit diagonal ('u' or 'U' for unit diagonal, 'n' or 'N' otherwise). The diagonal elements of A are not referenced if A has a unit diagonal.
+ * @param M number of rows of matrix B.
+ * @param N number of columns of matrix B.
+ * @param alpha scalar alpha
+ * @param A double precision matrix of dimension (ka, lda) in row-major or (lda, ka) in column-major. ka is M if Side is 'l' or 'L' and N otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least ka.
+ * @param B double precision matrix of dimension (M, ldb) in row-major or (ldb, N) in column-major.
+ * @param ldb the first dimension of B as declared in the calling program. ldb must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rdtrsm_64(const int fold, const char Order, const char Side, const char Uplo,
+                         const char TransA, const char Diag,
+                         const int64_t M, const int64_t N,
+                         const double alpha, const double *A, const int64_t lda,
+                         double *B, const int64_t ldb){
+  double_indexed *YI;
+  double *NX;
+  double x;
+  int row = (Order == 'r' || Order == 'R');
+  int left = (Side == 'l' || Side == 'L');
+  int unit = (Diag == 'u' || Diag == 'U');
+  //the system is T*x = alpha*b for each right hand side, where T is op(A) if A is on the left and op(A)**T otherwise
+  int trans = (TransA == 'n' || TransA == 'N') ? !left : left;
+  int forward = (Uplo == 'l' || Uplo == 'L') != trans;
+  int64_t L = left ? M : N;
+  int64_t R = left ? N : M;
+  //element (i, r) of B is B[i * incB + r * incR], with incB and incR chosen so that the solution index i runs over the system
+  int64_t incB = (left == row) ? ldb : 1;
+  int64_t incR = (left == row) ? 1 : ldb;
+  //elements (i, j) of T are A[i * incTi + j * incTj]
+  int64_t incTi = (row != trans) ? lda : 1;
+  int64_t incTj = (row != trans) ? 1 : lda;
+  //NX and YI hold -X and the indexed sums as L by R matrices in the ordering of A
+  int64_t ld = row ? R : L;
+  int64_t incI = row ? R : 1;
+  int64_t incJ = row ? 1 : L;
+  int64_t s;
+  int64_t e;
+  int64_t i;
+  int64_t r;
+  int64_t j0;
+  int64_t n;
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  if(alpha == 0.0){
+    for(i = 0; i < L; i++){
+      for(r = 0; r < R; r++){
+        B[i * incB + r * incR] = 0.0;
+      }
+    }
+    return;
+  }
+
+  YI = (double_indexed*)malloc(L * R * idxd_disize(fold));
+  NX = (double*)malloc(L * R * sizeof(double));
+  for(i = 0; i < L; i++){
+    for(r = 0; r < R; r++){
+      idxd_didconv(fold, alpha == 1.0 ? B[i * incB + r * incR] : B[i * incB + r * incR] * alpha, YI + (i * incI + r * incJ) * idxd_dinum(fold));
+    }
+  }
+
+  for(s = forward ? 0 : ((L - 1) / T_BLOCK) * T_BLOCK; s >= 0 && s < L; s += forward ? T_BLOCK : -T_BLOCK){
+    e = L - s < T_BLOCK ? L : s + T_BLOCK;
+    //solve the diagonal block by substitution with the elements of the block already computed
+    for(i = forward ? s : e - 1; i >= s && i < e; i += forward ? 1 : -1){
+      j0 = forward ? s : i + 1;
+      n = forward ? i - s : e - i - 1;
+      for(r = 0; r < R; r++){
+        idxdBLAS_diddot_64(fold, n, A + i * incTi + j0 * incTj, incTj, NX + j0 * incI + r * incJ, incI, YI + (i * incI + r * incJ) * idxd_dinum(fold));
+        x = idxd_ddiconv(fold, YI + (i * incI + r * incJ) * idxd_dinum(fold));
+        if(!unit){
+          x /= A[i * incTi + i * incTj];
+        }
+        B[i * incB + r * incR] = x;
+        NX[i * incI + r * incJ] = -x;
+      }
+    }
+    //update the remaining rows of the system with the solved block
+    if(forward){
+      rdtrsm_pool(fold, Order, trans ? 't' : 'n', L - e, R, e - s, A + e * incTi + s * incTj, lda, NX + s * incI, ld, YI + e * incI * idxd_dinum(fold), ld);
+    }else{
+      rdtrsm_pool(fold, Order, trans ? 't' : 'n', s, R, e - s, A + s * incTj, lda, NX + s * incI, ld, YI, ld);
+    }
+  }
+
+  free(YI);
+  free(NX);
+}
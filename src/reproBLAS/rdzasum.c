@@ -18,12 +18,33 @@
  * @date   15 Jan 2016
  */
 double reproBLAS_rdzasum(const int fold, const int N, const void* X, const int incX) {
+  return reproBLAS_rdzasum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible absolute sum of complex double precision vector X
+ *
+ * Return the sum of magnitudes of elements of X.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_dizasum_64()
+ *
+ * Same as #reproBLAS_rdzasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdzasum_64(const int fold, const int64_t N, const void* X, const int64_t incX) {
   double_indexed *asumi = idxd_dialloc(fold);
   double asum;
 
   idxd_disetzero(fold, asumi);
 
-  idxdBLAS_dizasum(fold, N, X, incX, asumi);
+  idxdBLAS_dizasum_64(fold, N, X, incX, asumi);
 
   asum = idxd_ddiconv(fold, asumi);
   free(asumi);
@@ -0,0 +1,72 @@
+#include <math.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types using #idxdBLAS_dizaxpbyssq(). The result is the same as that of #reproBLAS_rdznrm2() applied to the updated Y.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdzaxpbynrm2(const int fold, const int N, const void *alpha, const void *X, const int incX,
+                              const void *beta, void *Y, const int incY){
+  return reproBLAS_rdzaxpbynrm2_64(fold, N, alpha, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types using #idxdBLAS_dizaxpbyssq_64(). The result is the same as that of #reproBLAS_rdznrm2_64() applied to the updated Y.
+ *
+ * Same as #reproBLAS_rdzaxpbynrm2(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+double reproBLAS_rdzaxpbynrm2_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                                 const void *beta, void *Y, const int64_t incY){
+  double_indexed *ssq = idxd_dialloc(fold);
+  double scl;
+  double nrm2;
+
+  idxd_disetzero(fold, ssq);
+
+  scl = idxdBLAS_dizaxpbyssq_64(fold, N, alpha, X, incX, beta, Y, incY, 0.0, ssq);
+
+  nrm2 = scl * sqrt(idxd_ddiconv(fold, ssq));
+  free(ssq);
+  return nrm2;
+}
@@ -0,0 +1,53 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible absolute sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_sisasum_bounded(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_rsasum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsasum_bounded(const int fold, const int N, const float* X, const int incX, const float bound) {
+  return reproBLAS_rsasum_bounded_64(fold, N, X, incX, bound);
+}
+
+/**
+ * @brief Compute the reproducible absolute sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_sisasum_bounded_64(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_rsasum_64().
+ *
+ * Same as #reproBLAS_rsasum_bounded(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsasum_bounded_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float bound) {
+  float_indexed *asumi = idxd_sialloc(fold);
+  float asum;
+
+  idxd_sisetzero(fold, asumi);
+
+  idxdBLAS_sisasum_bounded_64(fold, N, X, incX, bound, asumi);
+
+  asum = idxd_ssiconv(fold, asumi);
+  free(asumi);
+  return asum;
+}
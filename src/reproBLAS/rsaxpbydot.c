@@ -0,0 +1,73 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and compute the reproducible dot product of single precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types using #idxdBLAS_sisaxpbydot(). The result is the same as that of #reproBLAS_rsdot() applied to W and the updated Y. W may be Y itself.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsaxpbydot(const int fold, const int N, const float alpha, const float *X, const int incX,
+                           const float beta, float *Y, const int incY, const float *W, const int incW){
+  return reproBLAS_rsaxpbydot_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW);
+}
+
+/**
+ * @brief Update single precision vector Y with a scaled single precision vector X and compute the reproducible dot product of single precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the sum of the pairwise products of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types using #idxdBLAS_sisaxpbydot_64(). The result is the same as that of #reproBLAS_rsdot_64() applied to W and the updated Y. W may be Y itself.
+ *
+ * Same as #reproBLAS_rsaxpbydot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsaxpbydot_64(const int fold, const int64_t N, const float alpha, const float *X, const int64_t incX,
+                              const float beta, float *Y, const int64_t incY, const float *W, const int64_t incW){
+  float_indexed *doti = idxd_sialloc(fold);
+  float dot;
+
+  idxd_sisetzero(fold, doti);
+
+  idxdBLAS_sisaxpbydot_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW, doti);
+
+  dot = idxd_ssiconv(fold, doti);
+  free(doti);
+  return dot;
+}
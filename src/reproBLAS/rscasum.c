@@ -18,12 +18,33 @@
  * @date   15 Jan 2016
  */
 float reproBLAS_rscasum(const int fold, const int N, const void* X, const int incX) {
+  return reproBLAS_rscasum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible absolute sum of complex single precision vector X
+ *
+ * Return the sum of magnitudes of elements of X.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_sicasum_64()
+ *
+ * Same as #reproBLAS_rscasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rscasum_64(const int fold, const int64_t N, const void* X, const int64_t incX) {
   float_indexed *asumi = idxd_sialloc(fold);
   float asum;
 
   idxd_sisetzero(fold, asumi);
 
-  idxdBLAS_sicasum(fold, N, X, incX, asumi);
+  idxdBLAS_sicasum_64(fold, N, X, incX, asumi);
 
   asum = idxd_ssiconv(fold, asumi);
   free(asumi);
@@ -0,0 +1,57 @@
+#include <reproBLAS.h>
+
+/**
+ * @brief Compute the reproducible mean and central moments of float precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rssum(), and the central moments with #reproBLAS_rsmoments() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M float precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rscmoments(const int fold, const int order, const int N, const float *X, const int incX, float *M){
+  reproBLAS_rscmoments_64(fold, order, N, X, incX, M);
+}
+
+/**
+ * @brief Compute the reproducible mean and central moments of float precision vector X
+ *
+ * Sets M[0] to the mean of X and M[p - 1] to the mean of (x_i - mean)**p for p = 2, ..., order, so that M[1] is the (population) variance of X.
+ *
+ * The mean is computed with #reproBLAS_rssum_64(), and the central moments with #reproBLAS_rsmoments_64() about the rounded mean, in a second pass over X. This avoids the cancellation of computing central moments from raw moments.
+ *
+ * Same as #reproBLAS_rscmoments(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param M float precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rscmoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, float *M){
+  float mean;
+
+  if(order <= 0){
+    return;
+  }
+  if(N <= 0){
+    reproBLAS_rsmoments_64(fold, order, N, X, incX, 0.0f, M);
+    return;
+  }
+
+  mean = reproBLAS_rssum_64(fold, N, X, incX) / N;
+  if(order > 1){
+    reproBLAS_rsmoments_64(fold, order, N, X, incX, mean, M);
+  }
+  M[0] = mean;
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+static void rscsrmv(const int fold, const char TransA, const int64_t M, const int64_t N,
+                    const float alpha, const float *val,
+                    const int *rowptr, const int64_t *rowptr_64, const int *colind, const int64_t *colind_64,
+                    const float *rowmax, const float *X, const int64_t incX,
+                    const float beta, float *Y, const int64_t incY){
+  float_indexed *YI;
+  int64_t L = (TransA == 'n' || TransA == 'N') ? M : N;
+  int64_t i;
+
+  if(N == 0 || M == 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(L * idxd_sisize(fold));
+  if(beta == 0.0){
+    memset(YI, 0, L * idxd_sisize(fold));
+  }else if(beta == 1.0){
+    for(i = 0; i < L; i++){
+      idxd_sisconv(fold, Y[i * incY], YI + i * idxd_sinum(fold));
+    }
+  }else{
+    for(i = 0; i < L; i++){
+      idxd_sisconv(fold, Y[i * incY] * beta, YI + i * idxd_sinum(fold));
+    }
+  }
+  if(rowptr_64 != NULL){
+    idxdBLAS_siscsrmv_64(fold, TransA, M, N, alpha, val, rowptr_64, colind_64, rowmax, X, incX, YI, 1);
+  }else{
+    idxdBLAS_siscsrmv(fold, TransA, (int)M, (int)N, alpha, val, rowptr, colind, rowmax, X, (int)incX, YI, 1);
+  }
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ssiconv(fold, YI + i * idxd_sinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Add to single precision vector Y the reproducible matrix-vector product of sparse single precision matrix A in compressed sparse row format and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_siscsrmv(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_scsramax() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax single precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rscsrmv(const int fold, const char TransA,
+                       const int M, const int N,
+                       const float alpha, const float *val, const int *rowptr, const int *colind,
+                       const float *rowmax, const float *X, const int incX,
+                       const float beta, float *Y, const int incY){
+  rscsrmv(fold, TransA, M, N, alpha, val, rowptr, NULL, colind, NULL, rowmax, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to single precision vector Y the reproducible matrix-vector product of sparse single precision matrix A in compressed sparse row format and single precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N sparse matrix in compressed sparse row format.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_siscsrmv_64(). Each element of y is updated with the largest absolute value of its products, for which the bound given by rowmax stands in whenever the two lie in the same bin, so that computing rowmax once with #idxdBLAS_scsramax_64() saves a pass over each row on repeated products with A. The result does not depend on the number of threads.
+ *
+ * Same as #reproBLAS_rscsrmv(), except that the dimensions, indices and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param val the nonzero elements of A, row by row
+ * @param rowptr array of size M + 1. The elements of row i of A are val[rowptr[i]] through val[rowptr[i + 1] - 1]
+ * @param colind the column indices (starting at 0) of the elements of val
+ * @param rowmax single precision vector of size M bounding the absolute values of the elements of the rows of A, or NULL
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rscsrmv_64(const int fold, const char TransA,
+                          const int64_t M, const int64_t N,
+                          const float alpha, const float *val, const int64_t *rowptr, const int64_t *colind,
+                          const float *rowmax, const float *X, const int64_t incX,
+                          const float beta, float *Y, const int64_t incY){
+  rscsrmv(fold, TransA, M, N, alpha, val, NULL, rowptr, NULL, colind, rowmax, X, incX, beta, Y, incY);
+}
@@ -0,0 +1,55 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible absolute sum of bfloat16 vector X with double precision accumulation
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_dibasum()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdbasum(const int fold, const int N, const uint16_t* X, const int incX) {
+  return reproBLAS_rsdbasum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible absolute sum of bfloat16 vector X with double precision accumulation
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible absolute sum is computed with indexed types using #idxdBLAS_dibasum_64()
+ *
+ * Same as #reproBLAS_rsdbasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdbasum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX) {
+  double_indexed *asumi = idxd_dialloc(fold);
+  double asum;
+
+  idxd_disetzero(fold, asumi);
+
+  idxdBLAS_dibasum_64(fold, N, X, incX, asumi);
+
+  asum = idxd_ddiconv(fold, asumi);
+  free(asumi);
+  return asum;
+}
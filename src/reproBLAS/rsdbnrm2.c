@@ -0,0 +1,58 @@
+#include <math.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible Euclidian norm of bfloat16 vector X with double precision accumulation
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types using #idxdBLAS_dibssq()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdbnrm2(const int fold, const int N, const uint16_t* X, const int incX) {
+  return reproBLAS_rsdbnrm2_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible Euclidian norm of bfloat16 vector X with double precision accumulation
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types using #idxdBLAS_dibssq_64()
+ *
+ * Same as #reproBLAS_rsdbnrm2(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdbnrm2_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX) {
+  double_indexed *ssq = idxd_dialloc(fold);
+  double scl;
+  double nrm2;
+
+  idxd_disetzero(fold, ssq);
+
+  scl = idxdBLAS_dibssq_64(fold, N, X, incX, 0.0, ssq);
+
+  nrm2 = scl * sqrt(idxd_ddiconv(fold, ssq));
+  free(ssq);
+  return nrm2;
+}
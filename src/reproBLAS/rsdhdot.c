@@ -0,0 +1,59 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible dot product of half precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_dihdot()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y half precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdhdot(const int fold, const int N, const uint16_t* X, const int incX, const uint16_t *Y, const int incY) {
+  return reproBLAS_rsdhdot_64(fold, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible dot product of half precision vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_dihdot_64()
+ *
+ * Same as #reproBLAS_rsdhdot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y half precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdhdot_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t *Y, const int64_t incY) {
+  double_indexed *doti = idxd_dialloc(fold);
+  double dot;
+
+  idxd_disetzero(fold, doti);
+
+  idxdBLAS_dihdot_64(fold, N, X, incX, Y, incY, doti);
+
+  dot = idxd_ddiconv(fold, doti);
+  free(doti);
+  return dot;
+}
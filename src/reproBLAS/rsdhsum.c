@@ -0,0 +1,55 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sum of half precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_dihsum()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdhsum(const int fold, const int N, const uint16_t* X, const int incX) {
+  return reproBLAS_rsdhsum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible sum of half precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The result is accumulated in indexed double precision types and then rounded to single precision.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_dihsum_64()
+ *
+ * Same as #reproBLAS_rsdhsum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdhsum_64(const int fold, const int64_t N, const uint16_t* X, const int64_t incX) {
+  double_indexed *sumi = idxd_dialloc(fold);
+  double sum;
+
+  idxd_disetzero(fold, sumi);
+
+  idxdBLAS_dihsum_64(fold, N, X, incX, sumi);
+
+  sum = idxd_ddiconv(fold, sumi);
+  free(sumi);
+  return sum;
+}
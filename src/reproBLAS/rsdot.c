@@ -20,12 +20,35 @@
  * @date   15 Jan 2016
  */
 float reproBLAS_rsdot(const int fold, const int N, const float* X, const int incX, const float *Y, const int incY) {
+  return reproBLAS_rsdot_64(fold, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_sisdot_64()
+ *
+ * Same as #reproBLAS_rsdot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdot_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float *Y, const int64_t incY) {
   float_indexed *doti = idxd_sialloc(fold);
   float dot;
 
   idxd_sisetzero(fold, doti);
 
-  idxdBLAS_sisdot(fold, N, X, incX, Y, incY, doti);
+  idxdBLAS_sisdot_64(fold, N, X, incX, Y, incY, doti);
 
   dot = idxd_ssiconv(fold, doti);
   free(doti);
@@ -0,0 +1,59 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The products are formed with error-free transformations, so that only their accumulation is inexact. The result is more accurate than that of #reproBLAS_rsdot() of the same fold, and a smaller fold may be used for the same accuracy.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_sisdot_fma()
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdot_fma(const int fold, const int N, const float* X, const int incX, const float *Y, const int incY) {
+  return reproBLAS_rsdot_fma_64(fold, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The products are formed with error-free transformations, so that only their accumulation is inexact. The result is more accurate than that of #reproBLAS_rsdot() of the same fold, and a smaller fold may be used for the same accuracy.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_sisdot_fma_64()
+ *
+ * Same as #reproBLAS_rsdot_fma(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsdot_fma_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float *Y, const int64_t incY) {
+  float_indexed *doti = idxd_sialloc(fold);
+  float dot;
+
+  idxd_sisetzero(fold, doti);
+
+  idxdBLAS_sisdot_fma_64(fold, N, X, incX, Y, incY, doti);
+
+  dot = idxd_ssiconv(fold, doti);
+  free(doti);
+  return dot;
+}
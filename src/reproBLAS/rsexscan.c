@@ -0,0 +1,50 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible exclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisexscan(), and each element of Y is the same as #reproBLAS_rssum() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsexscan(const int fold, const int N, const float *X, const int incX, float *Y, const int incY){
+  reproBLAS_rsexscan_64(fold, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible exclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisexscan_64(), and each element of Y is the same as #reproBLAS_rssum_64() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * Same as #reproBLAS_rsexscan(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsexscan_64(const int fold, const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY){
+  float_indexed *SI = idxd_sialloc(fold);
+
+  idxd_sisetzero(fold, SI);
+  idxdBLAS_sisexscan_64(fold, N, X, incX, SI, Y, incY);
+  free(SI);
+}
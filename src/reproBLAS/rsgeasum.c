@@ -0,0 +1,74 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible absolute sums of the rows or columns of float precision matrix A
+ *
+ * Sets each element of Y to the sum of the absolute values of the corresponding row or column of A.
+ *
+ * The reproducible absolute sums are computed with indexed types using #idxdBLAS_sisgeasum(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rsasum() of the corresponding row or column.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y float precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsgeasum(const int fold, const char Order, const char Dim,
+                       const int M, const int N,
+                       const float *A, const int lda,
+                       float *Y, const int incY){
+  reproBLAS_rsgeasum_64(fold, Order, Dim, M, N, A, lda, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible absolute sums of the rows or columns of float precision matrix A
+ *
+ * Sets each element of Y to the sum of the absolute values of the corresponding row or column of A.
+ *
+ * The reproducible absolute sums are computed with indexed types using #idxdBLAS_sisgeasum_64(), which sweeps A once in its storage order. Each element of Y is the same as #reproBLAS_rsasum_64() of the corresponding row or column.
+ *
+ * Same as #reproBLAS_rsgeasum(), except that the dimensions, leading dimension and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Dim a character specifying what to sum ('r' or 'R' to sum each row of A, 'c' or 'C' to sum each column of A)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param Y float precision vector Y of at least size M if Dim is 'r' or 'R' and size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsgeasum_64(const int fold, const char Order, const char Dim,
+                          const int64_t M, const int64_t N,
+                          const float *A, const int64_t lda,
+                          float *Y, const int64_t incY){
+  float_indexed *YI;
+  int64_t L = (Dim == 'r' || Dim == 'R') ? M : N;
+  int64_t i;
+
+  if(L == 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(L * idxd_sisize(fold));
+  for(i = 0; i < L; i++){
+    idxd_sisetzero(fold, YI + i * idxd_sinum(fold));
+  }
+  idxdBLAS_sisgeasum_64(fold, Order, Dim, M, N, A, lda, YI, 1);
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ssiconv(fold, YI + i * idxd_sinum(fold));
+  }
+  free(YI);
+}
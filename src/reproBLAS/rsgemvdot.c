@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  int64_t M;
+  int64_t N;
+  float alpha;
+  const float *A;
+  int64_t lda;
+  const float *X;
+  int64_t incX;
+  float_indexed *YI;
+  const float *W;
+  int64_t incW;
+  float_indexed *DI;
+  int64_t chunk;
+} rsgemvdot_args;
+
+static void rsgemvdot_task(void *args_, const int t){
+  rsgemvdot_args *args = (rsgemvdot_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t n;
+
+  switch(args->TransA){
+    case 'n':
+    case 'N':
+      n = args->M - i < args->chunk ? args->M - i : args->chunk;
+      idxdBLAS_sisgemvdot_64(args->fold, args->Order, args->TransA, n, args->N, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i * args->lda : i), args->lda, args->X, args->incX, args->YI + i * idxd_sinum(args->fold), 1, args->W + i * args->incW, args->incW, args->DI + t * idxd_sinum(args->fold));
+      break;
+    default:
+      n = args->N - i < args->chunk ? args->N - i : args->chunk;
+      idxdBLAS_sisgemvdot_64(args->fold, args->Order, args->TransA, args->M, n, args->alpha, args->A + ((args->Order == 'r' || args->Order == 'R') ? i : i * args->lda), args->lda, args->X, args->incX, args->YI + i * idxd_sinum(args->fold), 1, args->W + i * args->incW, args->incW, args->DI + t * idxd_sinum(args->fold));
+      break;
+  }
+}
+
+//the chunks of outputs are split as in reproBLAS_rsgemv(), and the partial dot products of the tasks are added to DI in order
+static void rsgemvdot_pool(const int fold, const char Order, const char TransA, const int64_t M, const int64_t N, const float alpha, const float *A, const int64_t lda, const float *X, const int64_t incX, float_indexed *YI, const float *W, const int64_t incW, float_indexed *DI){
+  rsgemvdot_args args;
+  int64_t L;
+  int ntasks;
+  int t;
+
+  if(!idxdPool_parallel((double)M * N)){
+    idxdBLAS_sisgemvdot_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1, W, incW, DI);
+    return;
+  }
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      args.chunk = (idxdPool_MINCHUNK + N - 1) / N;
+      break;
+    default:
+      L = N;
+      args.chunk = (idxdPool_MINCHUNK + M - 1) / M;
+      break;
+  }
+  if(args.chunk < (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((L + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.M = M;
+  args.N = N;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.X = X;
+  args.incX = incX;
+  args.YI = YI;
+  args.W = W;
+  args.incW = incW;
+  args.DI = (float_indexed*)calloc(ntasks, idxd_sisize(fold));
+  idxdPool_dispatch(ntasks, rsgemvdot_task, &args);
+  for(t = 0; t < ntasks; t++){
+    idxd_sisiadd(fold, args.DI + t * idxd_sinum(fold), DI);
+  }
+  free(args.DI);
+}
+
+/**
+ * @brief Add to single precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_sisgemvdot(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_rsgemv(), and the result is the same as #reproBLAS_rsdot() of W and the new Y, whatever the number of threads.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsgemvdot(const int fold, const char Order,
+                           const char TransA, const int M, const int N,
+                           const float alpha, const float *A, const int lda,
+                           const float *X, const int incX,
+                           const float beta, float *Y, const int incY,
+                           const float *W, const int incW){
+  return reproBLAS_rsgemvdot_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY, W, incW);
+}
+
+/**
+ * @brief Add to single precision vector Y the reproducible matrix-vector product of single precision matrix A and single precision vector X, and return the reproducible dot product of W and Y
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix, and returns w**T*y for a vector w, as in the q = A*p, p**T*q step of a Krylov iteration.
+ *
+ * The matrix-vector product and dot product are computed together using indexed types with #idxdBLAS_sisgemvdot_64(), which reads A once and adds each block of outputs to the dot product as it is completed. Y is the same as with #reproBLAS_rsgemv_64(), and the result is the same as #reproBLAS_rsdot_64() of W and the new Y, whatever the number of threads.
+ *
+ * Same as #reproBLAS_rsgemvdot(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' or 'c' or 'C' to transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A single precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X single precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y single precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W single precision vector of the same size as Y
+ * @param incW W vector stride (use every incW'th element)
+ * @return the dot product of W and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rsgemvdot_64(const int fold, const char Order,
+                              const char TransA, const int64_t M, const int64_t N,
+                              const float alpha, const float *A, const int64_t lda,
+                              const float *X, const int64_t incX,
+                              const float beta, float *Y, const int64_t incY,
+                              const float *W, const int64_t incW){
+  float_indexed *YI;
+  float_indexed *DI;
+  float dot;
+  int64_t L;
+  int64_t i;
+
+  L = (TransA == 'n' || TransA == 'N') ? M : N;
+  if(N == 0 || M == 0){
+    return reproBLAS_rsdot_64(fold, L, W, incW, Y, incY);
+  }
+
+  YI = (float_indexed*)malloc(L * idxd_sisize(fold));
+  if(beta == 0.0f){
+    memset(YI, 0, L * idxd_sisize(fold));
+  }else if(beta == 1.0f){
+    for(i = 0; i < L; i++){
+      idxd_sisconv(fold, Y[i * incY], YI + i * idxd_sinum(fold));
+    }
+  }else{
+    for(i = 0; i < L; i++){
+      idxd_sisconv(fold, Y[i * incY] * beta, YI + i * idxd_sinum(fold));
+    }
+  }
+  DI = idxd_sialloc(fold);
+  idxd_sisetzero(fold, DI);
+  rsgemvdot_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, W, incW, DI);
+  for(i = 0; i < L; i++){
+    Y[i * incY] = idxd_ssiconv(fold, YI + i * idxd_sinum(fold));
+  }
+  dot = idxd_ssiconv(fold, DI);
+  free(YI);
+  free(DI);
+  return dot;
+}
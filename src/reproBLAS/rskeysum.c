@@ -0,0 +1,84 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sums of the elements of single precision vector X with each key
+ *
+ * Sets Y[k * incY] to the sum of the elements x_i of X with keys[i] = k, for k = 0, ..., nkeys - 1. Keys with no elements sum to 0, and elements with keys outside of this range are ignored.
+ *
+ * The sums are computed in one pass over X with indexed types using #idxdBLAS_siskeysum(). Each element of Y is the same as #reproBLAS_rssum() of the elements with its key, in any order.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y single precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rskeysum(const int fold, const int N, const int *keys,
+                        const float *X, const int incX, const int nkeys,
+                        float *Y, const int incY){
+  float_indexed *YI;
+  int k;
+
+  if(nkeys <= 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(nkeys * idxd_sisize(fold));
+  for(k = 0; k < nkeys; k++){
+    idxd_sisetzero(fold, YI + k * idxd_sinum(fold));
+  }
+  idxdBLAS_siskeysum(fold, N, keys, X, incX, nkeys, YI, 1);
+  for(k = 0; k < nkeys; k++){
+    Y[k * incY] = idxd_ssiconv(fold, YI + k * idxd_sinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Compute the reproducible sums of the elements of single precision vector X with each key
+ *
+ * Sets Y[k * incY] to the sum of the elements x_i of X with keys[i] = k, for k = 0, ..., nkeys - 1. Keys with no elements sum to 0, and elements with keys outside of this range are ignored.
+ *
+ * The sums are computed in one pass over X with indexed types using #idxdBLAS_siskeysum_64(). Each element of Y is the same as #reproBLAS_rssum_64() of the elements with its key, in any order.
+ *
+ * Same as #reproBLAS_rskeysum(), except that the vector length, keys, number of keys and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param keys the key of each element of X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param nkeys number of keys
+ * @param Y single precision vector of size nkeys
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rskeysum_64(const int fold, const int64_t N, const int64_t *keys,
+                           const float *X, const int64_t incX, const int64_t nkeys,
+                           float *Y, const int64_t incY){
+  float_indexed *YI;
+  int64_t k;
+
+  if(nkeys <= 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(nkeys * idxd_sisize(fold));
+  for(k = 0; k < nkeys; k++){
+    idxd_sisetzero(fold, YI + k * idxd_sinum(fold));
+  }
+  idxdBLAS_siskeysum_64(fold, N, keys, X, incX, nkeys, YI, 1);
+  for(k = 0; k < nkeys; k++){
+    Y[k * incY] = idxd_ssiconv(fold, YI + k * idxd_sinum(fold));
+  }
+  free(YI);
+}
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute a reproducible norm of float precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_sisgeasum(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_sisgessq() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rsnrm2() of the elements of A.
+ *
+ * @param fold the fold of the indexed types
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rslange(const int fold, const char Norm, const char Order,
+                         const int M, const int N,
+                         const float *A, const int lda){
+  return reproBLAS_rslange_64(fold, Norm, Order, M, N, A, lda);
+}
+
+/**
+ * @brief Compute a reproducible norm of float precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_sisgeasum_64(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_sisgessq_64() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rsnrm2_64() of the elements of A.
+ *
+ * Same as #reproBLAS_rslange(), except that the dimensions and leading dimension are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rslange_64(const int fold, const char Norm, const char Order,
+                            const int64_t M, const int64_t N,
+                            const float *A, const int64_t lda){
+  float_indexed *YI;
+  float *scl;
+  float nrm = 0.0f;
+  float tmp;
+  float scale;
+  int row = (Order == 'r' || Order == 'R');
+  char Dim;
+  int64_t L;
+  int64_t i;
+  int64_t j;
+
+  if(M == 0 || N == 0){
+    return 0.0f;
+  }
+
+  switch(Norm){
+    case 'm':
+    case 'M':
+      for(i = 0; i < (row ? M : N); i++){
+        for(j = 0; j < (row ? N : M); j++){
+          tmp = fabsf(A[i * lda + j]);
+          //invalid elements are kept once seen
+          if(tmp > nrm || tmp != tmp){
+            nrm = tmp;
+          }
+        }
+      }
+      return nrm;
+
+    case '1':
+    case 'o':
+    case 'O':
+    case 'i':
+    case 'I':
+      Dim = (Norm == 'i' || Norm == 'I') ? 'r' : 'c';
+      L = Dim == 'r' ? M : N;
+      YI = (float_indexed*)malloc(L * idxd_sisize(fold));
+      for(i = 0; i < L; i++){
+        idxd_sisetzero(fold, YI + i * idxd_sinum(fold));
+      }
+      idxdBLAS_sisgeasum_64(fold, Order, Dim, M, N, A, lda, YI, 1);
+      for(i = 0; i < L; i++){
+        tmp = idxd_ssiconv(fold, YI + i * idxd_sinum(fold));
+        if(tmp > nrm || tmp != tmp){
+          nrm = tmp;
+        }
+      }
+      free(YI);
+      return nrm;
+
+    default:
+      //the rows (or columns) that are contiguous are reduced first and then added together in order
+      L = row ? M : N;
+      YI = (float_indexed*)malloc((L + 1) * idxd_sisize(fold));
+      scl = (float*)malloc(L * sizeof(float));
+      for(i = 0; i <= L; i++){
+        idxd_sisetzero(fold, YI + i * idxd_sinum(fold));
+      }
+      for(i = 0; i < L; i++){
+        scl[i] = 0.0f;
+      }
+      idxdBLAS_sisgessq_64(fold, Order, row ? 'r' : 'c', M, N, A, lda, scl, YI, 1);
+      scale = 0.0f;
+      for(i = 0; i < L; i++){
+        scale = idxd_sisiaddsq(fold, scl[i], YI + i * idxd_sinum(fold), scale, YI + L * idxd_sinum(fold));
+      }
+      nrm = scale * sqrt(idxd_ssiconv(fold, YI + L * idxd_sinum(fold)));
+      free(YI);
+      free(scl);
+      return nrm;
+  }
+}
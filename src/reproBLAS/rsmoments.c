@@ -0,0 +1,69 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible moments of float precision vector X about a given point
+ *
+ * Sets M[p - 1] to the mean of (x_i - shift)**p for p = 1, ..., order. With a shift of 0, these are the raw moments of X.
+ *
+ * The sums of the powers are computed in one pass over X with indexed types using #idxdBLAS_sismoments(). M[p - 1] is the same as #reproBLAS_rssum() of the vector of p'th powers divided by N. Central moments computed from the raw moments may suffer from cancellation; see #reproBLAS_rscmoments().
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param shift the point about which the moments are taken
+ * @param M float precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsmoments(const int fold, const int order, const int N, const float *X, const int incX, const float shift, float *M){
+  reproBLAS_rsmoments_64(fold, order, N, X, incX, shift, M);
+}
+
+/**
+ * @brief Compute the reproducible moments of float precision vector X about a given point
+ *
+ * Sets M[p - 1] to the mean of (x_i - shift)**p for p = 1, ..., order. With a shift of 0, these are the raw moments of X.
+ *
+ * The sums of the powers are computed in one pass over X with indexed types using #idxdBLAS_sismoments_64(). M[p - 1] is the same as #reproBLAS_rssum_64() of the vector of p'th powers divided by N. Central moments computed from the raw moments may suffer from cancellation; see #reproBLAS_rscmoments_64().
+ *
+ * Same as #reproBLAS_rsmoments(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param order the number of moments to compute (1, 2, 3 or 4)
+ * @param N vector length
+ * @param X float precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param shift the point about which the moments are taken
+ * @param M float precision vector of size order. If N is 0, M is set to 0.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rsmoments_64(const int fold, const int order, const int64_t N, const float *X, const int64_t incX, const float shift, float *M){
+  float_indexed *YI;
+  int p;
+
+  if(order <= 0){
+    return;
+  }
+  if(N <= 0){
+    for(p = 0; p < order; p++){
+      M[p] = 0.0f;
+    }
+    return;
+  }
+
+  YI = (float_indexed*)malloc(order * idxd_sisize(fold));
+  for(p = 0; p < order; p++){
+    idxd_sisetzero(fold, YI + p * idxd_sinum(fold));
+  }
+  idxdBLAS_sismoments_64(fold, order, N, X, incX, shift, YI);
+  for(p = 0; p < order; p++){
+    M[p] = idxd_ssiconv(fold, YI + p * idxd_sinum(fold)) / N;
+  }
+  free(YI);
+}
@@ -0,0 +1,82 @@
+#include <stdlib.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sums of the segments of single precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_sissegsum(). Each element of Y is the same as #reproBLAS_rssum() of its segment.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rssegsum(const int fold, const int nseg, const int *segptr,
+                        const float *X, const int incX,
+                        float *Y, const int incY){
+  float_indexed *YI;
+  int s;
+
+  if(nseg <= 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(nseg * idxd_sisize(fold));
+  for(s = 0; s < nseg; s++){
+    idxd_sisetzero(fold, YI + s * idxd_sinum(fold));
+  }
+  idxdBLAS_sissegsum(fold, nseg, segptr, X, incX, YI, 1);
+  for(s = 0; s < nseg; s++){
+    Y[s * incY] = idxd_ssiconv(fold, YI + s * idxd_sinum(fold));
+  }
+  free(YI);
+}
+
+/**
+ * @brief Compute the reproducible sums of the segments of single precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_sissegsum_64(). Each element of Y is the same as #reproBLAS_rssum_64() of its segment.
+ *
+ * Same as #reproBLAS_rssegsum(), except that the number of segments, segment offsets and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rssegsum_64(const int fold, const int64_t nseg, const int64_t *segptr,
+                           const float *X, const int64_t incX,
+                           float *Y, const int64_t incY){
+  float_indexed *YI;
+  int64_t s;
+
+  if(nseg <= 0){
+    return;
+  }
+
+  YI = (float_indexed*)malloc(nseg * idxd_sisize(fold));
+  for(s = 0; s < nseg; s++){
+    idxd_sisetzero(fold, YI + s * idxd_sinum(fold));
+  }
+  idxdBLAS_sissegsum_64(fold, nseg, segptr, X, incX, YI, 1);
+  for(s = 0; s < nseg; s++){
+    Y[s * incY] = idxd_ssiconv(fold, YI + s * idxd_sinum(fold));
+  }
+  free(YI);
+}
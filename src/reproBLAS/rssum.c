@@ -18,12 +18,33 @@
  * @date   15 Jan 2016
  */
 float reproBLAS_rssum(const int fold, const int N, const float* X, const int incX) {
+  return reproBLAS_rssum_64(fold, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_sissum_64()
+ *
+ * Same as #reproBLAS_rssum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rssum_64(const int fold, const int64_t N, const float* X, const int64_t incX) {
   float_indexed *sumi = idxd_sialloc(fold);
   float sum;
 
   idxd_sisetzero(fold, sumi);
 
-  idxdBLAS_sissum(fold, N, X, incX, sumi);
+  idxdBLAS_sissum_64(fold, N, X, incX, sumi);
 
   sum = idxd_ssiconv(fold, sumi);
   free(sumi);
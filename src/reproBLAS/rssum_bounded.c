@@ -0,0 +1,53 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_sissum_bounded(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_rssum().
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rssum_bounded(const int fold, const int N, const float* X, const int incX, const float bound) {
+  return reproBLAS_rssum_bounded_64(fold, N, X, incX, bound);
+}
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types using #idxdBLAS_sissum_bounded_64(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_rssum_64().
+ *
+ * Same as #reproBLAS_rssum_bounded(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_rssum_bounded_64(const int fold, const int64_t N, const float* X, const int64_t incX, const float bound) {
+  float_indexed *sumi = idxd_sialloc(fold);
+  float sum;
+
+  idxd_sisetzero(fold, sumi);
+
+  idxdBLAS_sissum_bounded_64(fold, N, X, incX, bound, sumi);
+
+  sum = idxd_ssiconv(fold, sumi);
+  free(sumi);
+  return sum;
+}
@@ -0,0 +1,72 @@
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible conjugated dot product of complex double precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and computes the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types using #idxdBLAS_zizaxpbydotc(). The result is the same as that of #reproBLAS_rzdotc_sub() applied to W and the updated Y. W may be Y itself.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex double precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzaxpbydotc_sub(const int fold, const int N, const void *alpha, const void *X, const int incX,
+                               const void *beta, void *Y, const int incY, const void *W, const int incW, void *dotc){
+  reproBLAS_rzaxpbydotc_sub_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW, dotc);
+}
+
+/**
+ * @brief Update complex double precision vector Y with a scaled complex double precision vector X and compute the reproducible conjugated dot product of complex double precision vector W and the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and computes the conjugated dot product of W and the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible dot product are computed in one sweep over Y with indexed types using #idxdBLAS_zizaxpbydotc_64(). The result is the same as that of #reproBLAS_rzdotc_sub_64() applied to W and the updated Y. W may be Y itself.
+ *
+ * Same as #reproBLAS_rzaxpbydotc_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param W complex double precision vector
+ * @param incW W vector stride (use every incW'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzaxpbydotc_sub_64(const int fold, const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                                  const void *beta, void *Y, const int64_t incY, const void *W, const int64_t incW, void *dotc){
+  double_complex_indexed *dotci = idxd_zialloc(fold);
+
+  idxd_zisetzero(fold, dotci);
+
+  idxdBLAS_zizaxpbydotc_64(fold, N, alpha, X, incX, beta, Y, incY, W, incW, dotci);
+
+  idxd_zziconv_sub(fold, dotci, dotc);
+  free(dotci);
+  return;
+}
@@ -20,11 +20,34 @@
  * @date   15 Jan 2016
  */
 void reproBLAS_rzdotc_sub(const int fold, const int N, const void* X, const int incX, const void *Y, const int incY, void *dotc) {
+  reproBLAS_rzdotc_sub_64(fold, N, X, incX, Y, incY, dotc);
+}
+
+/**
+ * @brief Compute the reproducible conjugated dot product of complex double precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and conjugated Y.
+ *
+ * The reproducible dot product is computed with indexed types using #idxdBLAS_zizdotc_64()
+ *
+ * Same as #reproBLAS_rzdotc_sub(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y complex double precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param dotc scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzdotc_sub_64(const int fold, const int64_t N, const void* X, const int64_t incX, const void *Y, const int64_t incY, void *dotc) {
   double_complex_indexed *dotci = idxd_zialloc(fold);
 
   idxd_zisetzero(fold, dotci);
 
-  idxdBLAS_zizdotc(fold, N, X, incX, Y, incY, dotci);
+  idxdBLAS_zizdotc_64(fold, N, X, incX, Y, incY, dotci);
 
   idxd_zziconv_sub(fold, dotci, dotc);
   free(dotci);
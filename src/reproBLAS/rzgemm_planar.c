@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  char TransB;
+  int64_t M;
+  int64_t N;
+  int64_t K;
+  const void *alpha;
+  const double *AR;
+  const double *AI;
+  int64_t lda;
+  const double *BR;
+  const double *BI;
+  int64_t ldb;
+  double_complex_indexed *Cidx;
+  int64_t ldc;
+  int64_t chunk;
+} rzgemm_planar_args;
+
+static void rzgemm_planar_task(void *args_, const int t){
+  rzgemm_planar_args *args = (rzgemm_planar_args*)args_;
+  int64_t j = t * args->chunk;
+  int64_t n = args->N - j < args->chunk ? args->N - j : args->chunk;
+  int row_major = args->Order == 'r' || args->Order == 'R';
+  int trans_B = args->TransB != 'n' && args->TransB != 'N';
+  int64_t offset = row_major != trans_B ? j : j * args->ldb;
+
+  idxdBLAS_zizgemm_planar_64(args->fold, args->Order, args->TransA, args->TransB, args->M, n, args->K, args->alpha, args->AR, args->AI, args->lda, args->BR + offset, args->BI + offset, args->ldb, args->Cidx + (row_major ? j : j * args->ldc) * idxd_zinum(args->fold), args->ldc);
+}
+
+static void rzgemm_planar_pool(const int fold, const char Order, const char TransA, const char TransB, const int64_t M, const int64_t N, const int64_t K, const void *alpha, const double *AR, const double *AI, const int64_t lda, const double *BR, const double *BI, const int64_t ldb, double_complex_indexed *Cidx, const int64_t ldc){
+  rzgemm_planar_args args;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N * K)){
+    idxdBLAS_zizgemm_planar_64(fold, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, Cidx, ldc);
+    return;
+  }
+  args.chunk = (double)M * K < idxdPool_MINCHUNK ? (idxdPool_MINCHUNK + M * K - 1) / (M * K) : 1;
+  if(args.chunk < (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (N + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((N + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.TransB = TransB;
+  args.M = M;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.AR = AR;
+  args.AI = AI;
+  args.lda = lda;
+  args.BR = BR;
+  args.BI = BI;
+  args.ldb = ldb;
+  args.Cidx = Cidx;
+  args.ldc = ldc;
+  idxdPool_dispatch(ntasks, rzgemm_planar_task, &args);
+}
+
+/**
+ * @brief Add to planar complex double precision matrix C the reproducible matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * A, B and C are given in planar layout, as separate real matrices of their real and imaginary parts. The matrix-matrix product is computed using indexed types with #idxdBLAS_zizgemm_planar(), and the result is the same as that of #reproBLAS_rzgemm() on the interleaved A, B and C.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param CR double precision matrix of the real parts of C, of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param CI double precision matrix of the imaginary parts of C, of the same dimension as CR.
+ * @param ldc the first dimension of CR and CI as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzgemm_planar(const int fold, const char Order, const char TransA, const char TransB,
+                             const int M, const int N, const int K,
+                             const void *alpha, const double *AR, const double *AI, const int lda,
+                             const double *BR, const double *BI, const int ldb,
+                             const void *beta, double *CR, double *CI, const int ldc){
+  reproBLAS_rzgemm_planar_64(fold, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+}
+
+/**
+ * @brief Add to planar complex double precision matrix C the reproducible matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * A, B and C are given in planar layout, as separate real matrices of their real and imaginary parts. The matrix-matrix product is computed using indexed types with #idxdBLAS_zizgemm_planar_64(), and the result is the same as that of #reproBLAS_rzgemm_64() on the interleaved A, B and C.
+ *
+ * Same as #reproBLAS_rzgemm_planar(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param CR double precision matrix of the real parts of C, of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param CI double precision matrix of the imaginary parts of C, of the same dimension as CR.
+ * @param ldc the first dimension of CR and CI as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzgemm_planar_64(const int fold, const char Order, const char TransA, const char TransB,
+                                const int64_t M, const int64_t N, const int64_t K,
+                                const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                                const double *BR, const double *BI, const int64_t ldb,
+                                const void *beta, double *CR, double *CI, const int64_t ldc){
+  double_complex_indexed *Cidx;
+  double betaC[2];
+  int64_t i;
+  int64_t j;
+  int64_t c;
+  int64_t l;
+  int row = (Order == 'r' || Order == 'R');
+
+  if(M == 0 || N == 0){
+    return;
+  }
+
+  //Cidx is stored in the same order as C with leading dimension N in row-major or M in column-major
+  Cidx = (double_complex_indexed*)malloc(M * N * idxd_zisize(fold));
+  if(((double*)beta)[0] == 0.0 && ((double*)beta)[1] == 0.0){
+    memset(Cidx, 0, M * N * idxd_zisize(fold));
+  }else{
+    for(i = 0; i < M; i++){
+      for(j = 0; j < N; j++){
+        c = row ? i * ldc + j : j * ldc + i;
+        l = row ? i * N + j : j * M + i;
+        if(((double*)beta)[0] == 1.0 && ((double*)beta)[1] == 0.0){
+          betaC[0] = CR[c];
+          betaC[1] = CI[c];
+        }else{
+          betaC[0] = CR[c] * ((double*)beta)[0] - CI[c] * ((double*)beta)[1];
+          betaC[1] = CR[c] * ((double*)beta)[1] + CI[c] * ((double*)beta)[0];
+        }
+        idxd_zizconv(fold, betaC, Cidx + l * idxd_zinum(fold));
+      }
+    }
+  }
+  rzgemm_planar_pool(fold, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, Cidx, row ? N : M);
+  for(i = 0; i < M; i++){
+    for(j = 0; j < N; j++){
+      c = row ? i * ldc + j : j * ldc + i;
+      l = row ? i * N + j : j * M + i;
+      idxd_zziconv_sub(fold, Cidx + l * idxd_zinum(fold), betaC);
+      CR[c] = betaC[0];
+      CI[c] = betaC[1];
+    }
+  }
+  free(Cidx);
+}
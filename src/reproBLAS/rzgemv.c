@@ -3,6 +3,78 @@
 
 #include <reproBLAS.h>
 #include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  int64_t M;
+  int64_t N;
+  const void *alpha;
+  const void *A;
+  int64_t lda;
+  const void *X;
+  int64_t incX;
+  double_complex_indexed *YI;
+  int64_t chunk;
+} rzgemv_args;
+
+static void rzgemv_task(void *args_, const int t){
+  rzgemv_args *args = (rzgemv_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t n;
+
+  switch(args->TransA){
+    case 'n':
+    case 'N':
+      n = args->M - i < args->chunk ? args->M - i : args->chunk;
+      idxdBLAS_zizgemv_64(args->fold, args->Order, args->TransA, n, args->N, args->alpha, (const double*)args->A + 2 * ((args->Order == 'r' || args->Order == 'R') ? i * args->lda : i), args->lda, args->X, args->incX, args->YI + i * idxd_zinum(args->fold), 1);
+      break;
+    default:
+      n = args->N - i < args->chunk ? args->N - i : args->chunk;
+      idxdBLAS_zizgemv_64(args->fold, args->Order, args->TransA, args->M, n, args->alpha, (const double*)args->A + 2 * ((args->Order == 'r' || args->Order == 'R') ? i : i * args->lda), args->lda, args->X, args->incX, args->YI + i * idxd_zinum(args->fold), 1);
+      break;
+  }
+}
+
+static void rzgemv_pool(const int fold, const char Order, const char TransA, const int64_t M, const int64_t N, const void *alpha, const void *A, const int64_t lda, const void *X, const int64_t incX, double_complex_indexed *YI){
+  rzgemv_args args;
+  int64_t L;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N)){
+    idxdBLAS_zizgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1);
+    return;
+  }
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      args.chunk = (idxdPool_MINCHUNK + N - 1) / N;
+      break;
+    default:
+      L = N;
+      args.chunk = (idxdPool_MINCHUNK + M - 1) / M;
+      break;
+  }
+  if(args.chunk < (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((L + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.M = M;
+  args.N = N;
+  args.alpha = alpha;
+  args.A = A;
+  args.lda = lda;
+  args.X = X;
+  args.incX = incX;
+  args.YI = YI;
+  idxdPool_dispatch(ntasks, rzgemv_task, &args);
+}
 
 /**
  * @brief Add to complex double precision vector Y the reproducible matrix-vector product of complex double precision matrix A and complex double precision vector X
@@ -37,9 +109,46 @@ void reproBLAS_rzgemv(const int fold, const char Order,
                       const void *alpha, const void *A, const int lda,
                       const void *X, const int incX,
                       const void *beta, void *Y, const int incY){
+  reproBLAS_rzgemv_64(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Add to complex double precision vector Y the reproducible matrix-vector product of complex double precision matrix A and complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * The matrix-vector product is computed using indexed types with #idxdBLAS_zizgemv_64()
+ *
+ * Same as #reproBLAS_rzgemv(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @param X complex double precision vector of at least size N if not transposed or size M otherwise
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex double precision vector Y of at least size M if not transposed or size N otherwise
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzgemv_64(const int fold, const char Order,
+                         const char TransA, const int64_t M, const int64_t N,
+                         const void *alpha, const void *A, const int64_t lda,
+                         const void *X, const int64_t incX,
+                         const void *beta, void *Y, const int64_t incY){
   double_complex_indexed *YI;
   double betaY[2];
-  int i;
+  int64_t i;
 
   if(N == 0 || M == 0){
     return;
@@ -62,7 +171,7 @@ void reproBLAS_rzgemv(const int fold, const char Order,
           idxd_zizconv(fold, betaY, YI + i * idxd_zinum(fold));
         }
       }
-      idxdBLAS_zizgemv(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1);
+      rzgemv_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI);
       for(i = 0; i < M; i++){
         idxd_zziconv_sub(fold, YI + i * idxd_zinum(fold), ((double*)Y) + 2 * i * incY);
       }
@@ -82,7 +191,7 @@ void reproBLAS_rzgemv(const int fold, const char Order,
           idxd_zizconv(fold, betaY, YI + i * idxd_zinum(fold));
         }
       }
-      idxdBLAS_zizgemv(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI, 1);
+      rzgemv_pool(fold, Order, TransA, M, N, alpha, A, lda, X, incX, YI);
       for(i = 0; i < N; i++){
         idxd_zziconv_sub(fold, YI + i * idxd_zinum(fold), ((double*)Y) + 2 * i * incY);
       }
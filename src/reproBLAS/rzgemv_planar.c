@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+typedef struct {
+  int fold;
+  char Order;
+  char TransA;
+  int64_t M;
+  int64_t N;
+  const void *alpha;
+  const double *AR;
+  const double *AI;
+  int64_t lda;
+  const double *XR;
+  const double *XI;
+  int64_t incX;
+  double_complex_indexed *Yidx;
+  int64_t chunk;
+} rzgemv_planar_args;
+
+static void rzgemv_planar_task(void *args_, const int t){
+  rzgemv_planar_args *args = (rzgemv_planar_args*)args_;
+  int64_t i = t * args->chunk;
+  int64_t n;
+  int64_t offset;
+
+  switch(args->TransA){
+    case 'n':
+    case 'N':
+      n = args->M - i < args->chunk ? args->M - i : args->chunk;
+      offset = (args->Order == 'r' || args->Order == 'R') ? i * args->lda : i;
+      idxdBLAS_zizgemv_planar_64(args->fold, args->Order, args->TransA, n, args->N, args->alpha, args->AR + offset, args->AI + offset, args->lda, args->XR, args->XI, args->incX, args->Yidx + i * idxd_zinum(args->fold), 1);
+      break;
+    default:
+      n = args->N - i < args->chunk ? args->N - i : args->chunk;
+      offset = (args->Order == 'r' || args->Order == 'R') ? i : i * args->lda;
+      idxdBLAS_zizgemv_planar_64(args->fold, args->Order, args->TransA, args->M, n, args->alpha, args->AR + offset, args->AI + offset, args->lda, args->XR, args->XI, args->incX, args->Yidx + i * idxd_zinum(args->fold), 1);
+      break;
+  }
+}
+
+static void rzgemv_planar_pool(const int fold, const char Order, const char TransA, const int64_t M, const int64_t N, const void *alpha, const double *AR, const double *AI, const int64_t lda, const double *XR, const double *XI, const int64_t incX, double_complex_indexed *Yidx){
+  rzgemv_planar_args args;
+  int64_t L;
+  int ntasks;
+
+  if(!idxdPool_parallel((double)M * N)){
+    idxdBLAS_zizgemv_planar_64(fold, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, Yidx, 1);
+    return;
+  }
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      args.chunk = (idxdPool_MINCHUNK + N - 1) / N;
+      break;
+    default:
+      L = N;
+      args.chunk = (idxdPool_MINCHUNK + M - 1) / M;
+      break;
+  }
+  if(args.chunk < (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS){
+    args.chunk = (L + idxdPool_MAXCHUNKS - 1) / idxdPool_MAXCHUNKS;
+  }
+  ntasks = (int)((L + args.chunk - 1) / args.chunk);
+  args.fold = fold;
+  args.Order = Order;
+  args.TransA = TransA;
+  args.M = M;
+  args.N = N;
+  args.alpha = alpha;
+  args.AR = AR;
+  args.AI = AI;
+  args.lda = lda;
+  args.XR = XR;
+  args.XI = XI;
+  args.incX = incX;
+  args.Yidx = Yidx;
+  idxdPool_dispatch(ntasks, rzgemv_planar_task, &args);
+}
+
+/**
+ * @brief Add to planar complex double precision vector Y the reproducible matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * A, X and Y are given in planar layout, as separate real matrices or vectors of their real and imaginary parts. The matrix-vector product is computed using indexed types with #idxdBLAS_zizgemv_planar(), and the result is the same as that of #reproBLAS_rzgemv() on the interleaved A, X and Y.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param YR double precision vector of the real parts of Y, of at least size M if not transposed or size N otherwise
+ * @param YI double precision vector of the imaginary parts of Y, of at least size M if not transposed or size N otherwise
+ * @param incY YR and YI vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzgemv_planar(const int fold, const char Order,
+                             const char TransA, const int M, const int N,
+                             const void *alpha, const double *AR, const double *AI, const int lda,
+                             const double *XR, const double *XI, const int incX,
+                             const void *beta, double *YR, double *YI, const int incY){
+  reproBLAS_rzgemv_planar_64(fold, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, beta, YR, YI, incY);
+}
+
+/**
+ * @brief Add to planar complex double precision vector Y the reproducible matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * A, X and Y are given in planar layout, as separate real matrices or vectors of their real and imaginary parts. The matrix-vector product is computed using indexed types with #idxdBLAS_zizgemv_planar_64(), and the result is the same as that of #reproBLAS_rzgemv_64() on the interleaved A, X and Y.
+ *
+ * Same as #reproBLAS_rzgemv_planar(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param YR double precision vector of the real parts of Y, of at least size M if not transposed or size N otherwise
+ * @param YI double precision vector of the imaginary parts of Y, of at least size M if not transposed or size N otherwise
+ * @param incY YR and YI vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzgemv_planar_64(const int fold, const char Order,
+                                const char TransA, const int64_t M, const int64_t N,
+                                const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                                const double *XR, const double *XI, const int64_t incX,
+                                const void *beta, double *YR, double *YI, const int64_t incY){
+  double_complex_indexed *Yidx;
+  double betaY[2];
+  int64_t L;
+  int64_t i;
+
+  if(N == 0 || M == 0){
+    return;
+  }
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      L = M;
+      break;
+    default:
+      L = N;
+      break;
+  }
+
+  Yidx = (double_complex_indexed*)malloc(L * idxd_zisize(fold));
+  if(((double*)beta)[0] == 0.0 && ((double*)beta)[1] == 0.0){
+    memset(Yidx, 0, L * idxd_zisize(fold));
+  }else{
+    for(i = 0; i < L; i++){
+      if(((double*)beta)[0] == 1.0 && ((double*)beta)[1] == 0.0){
+        betaY[0] = YR[i * incY];
+        betaY[1] = YI[i * incY];
+      }else{
+        betaY[0] = YR[i * incY] * ((double*)beta)[0] - YI[i * incY] * ((double*)beta)[1];
+        betaY[1] = YR[i * incY] * ((double*)beta)[1] + YI[i * incY] * ((double*)beta)[0];
+      }
+      idxd_zizconv(fold, betaY, Yidx + i * idxd_zinum(fold));
+    }
+  }
+  rzgemv_planar_pool(fold, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, Yidx);
+  for(i = 0; i < L; i++){
+    idxd_zziconv_sub(fold, Yidx + i * idxd_zinum(fold), betaY);
+    YR[i * incY] = betaY[0];
+    YI[i * incY] = betaY[1];
+  }
+
+  free(Yidx);
+}
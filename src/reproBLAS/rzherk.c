@@ -0,0 +1,200 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <reproBLAS.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+
+#define N_BLOCK 32
+
+typedef struct {
+  int fold;
+  char Order;
+  char Uplo;
+  char Trans;
+  int64_t N;
+  int64_t K;
+  double alpha;
+  const double *A;
+  int64_t lda;
+  double beta;
+  double *C;
+  int64_t ldc;
+} rzherk_args;
+
+//update the part of the triangle of C in lines t * N_BLOCK through (t + 1) * N_BLOCK (rows in row-major, columns in column-major) using an indexed buffer for those lines only
+static void rzherk_task(void *args_, const int t){
+  rzherk_args *args = (rzherk_args*)args_;
+  double_complex_indexed *CI;
+  double betaC[2];
+  double alpha[2] = {args->alpha, 0.0};
+  int64_t s = t * N_BLOCK;
+  int64_t n = args->N - s < N_BLOCK ? args->N - s : N_BLOCK;
+  int64_t line;
+  int64_t minor;
+  int64_t lo;
+  int64_t L;
+  int64_t r;
+  int64_t len;
+  int row = (args->Order == 'r' || args->Order == 'R');
+  int trans = !(args->Trans == 'n' || args->Trans == 'N');
+  int lower = !(args->Uplo == 'u' || args->Uplo == 'U');
+  //if head is set, line l of the triangle holds minor indices 0 through l, and l through N - 1 otherwise
+  int head = (row == lower);
+
+  lo = head ? 0 : s;
+  L = head ? s + n : args->N - s;
+  CI = (double_complex_indexed*)malloc(n * L * idxd_zisize(args->fold));
+  if(args->beta == 0.0){
+    memset(CI, 0, n * L * idxd_zisize(args->fold));
+  }else{
+    for(line = 0; line < n; line++){
+      for(minor = head ? 0 : s + line; minor < (head ? s + line + 1 : args->N); minor++){
+        if(args->beta == 1.0){
+          idxd_zizconv(args->fold, args->C + 2 * ((s + line) * args->ldc + minor), CI + (line * L + minor - lo) * idxd_zinum(args->fold));
+        }else{
+          betaC[0] = args->C[2 * ((s + line) * args->ldc + minor)] * args->beta;
+          betaC[1] = args->C[2 * ((s + line) * args->ldc + minor) + 1] * args->beta;
+          idxd_zizconv(args->fold, betaC, CI + (line * L + minor - lo) * idxd_zinum(args->fold));
+        }
+      }
+    }
+  }
+
+  //the off-diagonal part of the lines is a matrix-matrix product of rows of op(A)
+  r = head ? 0 : s + n;
+  len = head ? s : args->N - s - n;
+  if(len > 0){
+    if(row){
+      idxdBLAS_zizgemm_64(args->fold, args->Order, trans ? 'c' : 'n', trans ? 'n' : 'c', n, len, args->K, alpha, args->A + 2 * (row != trans ? s * args->lda : s), args->lda, args->A + 2 * (row != trans ? r * args->lda : r), args->lda, CI + (r - lo) * idxd_zinum(args->fold), L);
+    }else{
+      idxdBLAS_zizgemm_64(args->fold, args->Order, trans ? 'c' : 'n', trans ? 'n' : 'c', len, n, args->K, alpha, args->A + 2 * (row != trans ? r * args->lda : r), args->lda, args->A + 2 * (row != trans ? s * args->lda : s), args->lda, CI + (r - lo) * idxd_zinum(args->fold), L);
+    }
+  }
+  idxdBLAS_zizherk_64(args->fold, args->Order, lower ? 'l' : 'u', args->Trans, n, args->K, args->alpha, args->A + 2 * (row != trans ? s * args->lda : s), args->lda, CI + (s - lo) * idxd_zinum(args->fold), L);
+
+  for(line = 0; line < n; line++){
+    for(minor = head ? 0 : s + line; minor < (head ? s + line + 1 : args->N); minor++){
+      idxd_zziconv_sub(args->fold, CI + (line * L + minor - lo) * idxd_zinum(args->fold), args->C + 2 * ((s + line) * args->ldc + minor));
+    }
+    //the diagonal of a hermitian matrix is real
+    args->C[2 * ((s + line) * args->ldc + s + line) + 1] = 0.0;
+  }
+  free(CI);
+}
+
+static void rzherk_pool(const int fold, const char Order, const char Uplo, const char Trans, const int64_t N, const int64_t K, const double alpha, const void *A, const int64_t lda, const double beta, void *C, const int64_t ldc){
+  rzherk_args args;
+  int ntasks = (int)((N + N_BLOCK - 1) / N_BLOCK);
+  int t;
+
+  args.fold = fold;
+  args.Order = Order;
+  args.Uplo = Uplo;
+  args.Trans = Trans;
+  args.N = N;
+  args.K = K;
+  args.alpha = alpha;
+  args.A = (const double*)A;
+  args.lda = lda;
+  args.beta = beta;
+  args.C = (double*)C;
+  args.ldc = ldc;
+  if(!idxdPool_parallel((double)N * N * K * 2)){
+    for(t = 0; t < ntasks; t++){
+      rzherk_task(&args, t);
+    }
+    return;
+  }
+  idxdPool_dispatch(ntasks, rzherk_task, &args);
+}
+
+/**
+ * @brief Add to the upper or lower triangle of complex double precision matrix C the reproducible hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + beta*C   or   C := alpha*A**H*A + beta*C,
+ *
+ * where alpha and beta are real scalars, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an N by N hermitian matrix of which only the upper or lower triangle is referenced. The imaginary parts of the diagonal elements of C are set to zero.
+ *
+ * The hermitian rank-k product is computed using indexed types with #idxdBLAS_zizherk() and #idxdBLAS_zizgemm(), so that each element of the triangle (but for the imaginary parts of the diagonal) is the same as that of #reproBLAS_rzgemm() with op(B) = op(A)**H and complex scalars (alpha, 0) and (beta, 0). Only the triangle is computed and converted to indexed types, a few lines at a time.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle, 'a' or 'A' to update the lower triangle and copy its conjugate to the upper triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + beta*C, 'c' or 'C' for C := alpha*A**H*A + beta*C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param beta scalar beta
+ * @param C complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzherk(const int fold, const char Order, const char Uplo, const char Trans,
+                      const int N, const int K,
+                      const double alpha, const void *A, const int lda,
+                      const double beta, void *C, const int ldc){
+  reproBLAS_rzherk_64(fold, Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+/**
+ * @brief Add to the upper or lower triangle of complex double precision matrix C the reproducible hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + beta*C   or   C := alpha*A**H*A + beta*C,
+ *
+ * where alpha and beta are real scalars, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an N by N hermitian matrix of which only the upper or lower triangle is referenced. The imaginary parts of the diagonal elements of C are set to zero.
+ *
+ * The hermitian rank-k product is computed using indexed types with #idxdBLAS_zizherk_64() and #idxdBLAS_zizgemm_64(), so that each element of the triangle (but for the imaginary parts of the diagonal) is the same as that of #reproBLAS_rzgemm_64() with op(B) = op(A)**H and complex scalars (alpha, 0) and (beta, 0). Only the triangle is computed and converted to indexed types, a few lines at a time.
+ *
+ * Same as #reproBLAS_rzherk(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param fold the fold of the indexed types
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle, 'a' or 'A' to update the lower triangle and copy its conjugate to the upper triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + beta*C, 'c' or 'C' for C := alpha*A**H*A + beta*C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param beta scalar beta
+ * @param C complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_rzherk_64(const int fold, const char Order, const char Uplo, const char Trans,
+                         const int64_t N, const int64_t K,
+                         const double alpha, const void *A, const int64_t lda,
+                         const double beta, void *C, const int64_t ldc){
+  double *C_ = (double*)C;
+  int64_t i;
+  int64_t j;
+
+  if(N == 0){
+    return;
+  }
+
+  rzherk_pool(fold, Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+  if(Uplo == 'a' || Uplo == 'A'){
+    //the conjugate of the lower triangle is copied across the diagonal
+    for(i = 0; i < N; i++){
+      for(j = 0; j < i; j++){
+        if(Order == 'r' || Order == 'R'){
+          C_[2 * (j * ldc + i)] = C_[2 * (i * ldc + j)];
+          C_[2 * (j * ldc + i) + 1] = -C_[2 * (i * ldc + j) + 1];
+        }else{
+          C_[2 * (i * ldc + j)] = C_[2 * (j * ldc + i)];
+          C_[2 * (i * ldc + j) + 1] = -C_[2 * (j * ldc + i) + 1];
+        }
+      }
+    }
+  }
+}
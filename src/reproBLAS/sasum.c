@@ -20,3 +20,23 @@
 float reproBLAS_sasum(const int N, const float* X, const int incX) {
   return reproBLAS_rsasum(SIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible absolute sum of single precision vector X
+ *
+ * Return the sum of absolute values of elements in X.
+ *
+ * The reproducible absolute sum is computed with indexed types of default fold using #idxdBLAS_sisasum_64()
+ *
+ * Same as #reproBLAS_sasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sasum_64(const int64_t N, const float* X, const int64_t incX) {
+  return reproBLAS_rsasum_64(SIDEFAULTFOLD, N, X, incX);
+}
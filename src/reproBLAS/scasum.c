@@ -20,3 +20,23 @@
 float reproBLAS_scasum(const int N, const void* X, const int incX) {
   return reproBLAS_rscasum(SIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible absolute sum of complex single precision vector X
+ *
+ * Return the sum of magnitudes of elements of X.
+ *
+ * The reproducible absolute sum is computed with indexed types of default fold using #idxdBLAS_sicasum_64()
+ *
+ * Same as #reproBLAS_scasum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return absolute sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_scasum_64(const int64_t N, const void* X, const int64_t incX) {
+  return reproBLAS_rscasum_64(SIDEFAULTFOLD, N, X, incX);
+}
@@ -0,0 +1,59 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types of default fold using #idxdBLAS_sicaxpbyssq(). The result is the same as that of #reproBLAS_scnrm2() applied to the updated Y.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_scaxpbynrm2(const int N, const void *alpha, const void *X, const int incX,
+                            const void *beta, void *Y, const int incY){
+  return reproBLAS_rscaxpbynrm2(SIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY);
+}
+
+/**
+ * @brief Update complex single precision vector Y with a scaled complex single precision vector X and compute the reproducible Euclidian norm of the updated Y
+ *
+ * Performs the operation
+ *
+ *   y := alpha*x + beta*y,
+ *
+ * and returns the square root of the sum of the squared elements of the updated Y. If beta is zero, Y need not be set on input.
+ *
+ * The update and the reproducible Euclidian norm are computed in one sweep over Y with scaled indexed types of default fold using #idxdBLAS_sicaxpbyssq_64(). The result is the same as that of #reproBLAS_scnrm2_64() applied to the updated Y.
+ *
+ * Same as #reproBLAS_scaxpbynrm2(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param alpha scalar alpha
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param Y complex single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return Euclidian norm of the updated Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_scaxpbynrm2_64(const int64_t N, const void *alpha, const void *X, const int64_t incX,
+                               const void *beta, void *Y, const int64_t incY){
+  return reproBLAS_rscaxpbynrm2_64(SIDEFAULTFOLD, N, alpha, X, incX, beta, Y, incY);
+}
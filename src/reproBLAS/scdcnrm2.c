@@ -0,0 +1,41 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible Euclidian norm of complex single precision vector X with double precision accumulation
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types of default fold using #idxdBLAS_dicssq()
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_scdcnrm2(const int N, const void* X, const int incX) {
+  return reproBLAS_rscdcnrm2(DIDEFAULTFOLD, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible Euclidian norm of complex single precision vector X with double precision accumulation
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types of default fold using #idxdBLAS_dicssq_64()
+ *
+ * Same as #reproBLAS_scdcnrm2(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_scdcnrm2_64(const int64_t N, const void* X, const int64_t incX) {
+  return reproBLAS_rscdcnrm2_64(DIDEFAULTFOLD, N, X, incX);
+}
@@ -0,0 +1,45 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible dot product of bfloat16 vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_dibdot()
+ *
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y bfloat16 vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdbdot(const int N, const uint16_t* X, const int incX, const uint16_t *Y, const int incY) {
+  return reproBLAS_rsdbdot(DIDEFAULTFOLD, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible dot product of bfloat16 vectors X and Y with double precision accumulation
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_dibdot_64()
+ *
+ * Same as #reproBLAS_sdbdot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X bfloat16 vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y bfloat16 vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdbdot_64(const int64_t N, const uint16_t* X, const int64_t incX, const uint16_t *Y, const int64_t incY) {
+  return reproBLAS_rsdbdot_64(DIDEFAULTFOLD, N, X, incX, Y, incY);
+}
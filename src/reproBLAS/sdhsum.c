@@ -0,0 +1,41 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible sum of half precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_dihsum()
+ *
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdhsum(const int N, const uint16_t* X, const int incX) {
+  return reproBLAS_rsdhsum(DIDEFAULTFOLD, N, X, incX);
+}
+
+/**
+ * @brief Compute the reproducible sum of half precision vector X with double precision accumulation
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_dihsum_64()
+ *
+ * Same as #reproBLAS_sdhsum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X half precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdhsum_64(const int64_t N, const uint16_t* X, const int64_t incX) {
+  return reproBLAS_rsdhsum_64(DIDEFAULTFOLD, N, X, incX);
+}
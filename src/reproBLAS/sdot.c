@@ -22,3 +22,25 @@
 float reproBLAS_sdot(const int N, const float* X, const int incX, const float *Y, const int incY) {
   return reproBLAS_rsdot(SIDEFAULTFOLD, N, X, incX, Y, incY);
 }
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_sisdot_64()
+ *
+ * Same as #reproBLAS_sdot(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdot_64(const int64_t N, const float* X, const int64_t incX, const float *Y, const int64_t incY) {
+  return reproBLAS_rsdot_64(SIDEFAULTFOLD, N, X, incX, Y, incY);
+}
@@ -0,0 +1,47 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y, given a bound on their products
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_sisdot_bounded(), which reads X and Y once. If @c bound is at least the absolute value of every pairwise product of X and Y and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_sdot().
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdot_bounded(const int N, const float* X, const int incX, const float *Y, const int incY, const float bound) {
+  return reproBLAS_rsdot_bounded(SIDEFAULTFOLD, N, X, incX, Y, incY, bound);
+}
+
+/**
+ * @brief Compute the reproducible dot product of single precision vectors X and Y, given a bound on their products
+ *
+ * Return the sum of the pairwise products of X and Y.
+ *
+ * The reproducible dot product is computed with indexed types of default fold using #idxdBLAS_sisdot_bounded_64(), which reads X and Y once. If @c bound is at least the absolute value of every pairwise product of X and Y and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_sdot_64().
+ *
+ * Same as #reproBLAS_sdot_bounded(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ * @param bound bound on the absolute values of the pairwise products of X and Y
+ * @return the dot product of X and Y
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_sdot_bounded_64(const int64_t N, const float* X, const int64_t incX, const float *Y, const int64_t incY, const float bound) {
+  return reproBLAS_rsdot_bounded_64(SIDEFAULTFOLD, N, X, incX, Y, incY, bound);
+}
@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible exclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisexscan(), and each element of Y is the same as #reproBLAS_rssum() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_sexscan(const int N, const float *X, const int incX, float *Y, const int incY){
+  reproBLAS_rsexscan(SIDEFAULTFOLD, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible exclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i - 1 of X, for i = 0, ..., N - 1 (so Y[0] is 0).
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisexscan_64(), and each element of Y is the same as #reproBLAS_rssum_64() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * Same as #reproBLAS_sexscan(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_sexscan_64(const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY){
+  reproBLAS_rsexscan_64(SIDEFAULTFOLD, N, X, incX, Y, incY);
+}
@@ -0,0 +1,61 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute a reproducible norm of float precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_sisgeasum(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_sisgessq() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rsnrm2() of the elements of A.
+ *
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_slange(const char Norm, const char Order,
+                        const int M, const int N,
+                        const float *A, const int lda){
+  return reproBLAS_rslange(SIDEFAULTFOLD, Norm, Order, M, N, A, lda);
+}
+
+/**
+ * @brief Compute a reproducible norm of float precision matrix A
+ *
+ * Return one of the matrix norms
+ *
+ *   max(abs(A_ij))   (the max norm, which is not a consistent matrix norm),
+ *   max_j sum_i abs(A_ij)   (the 1-norm),
+ *   max_i sum_j abs(A_ij)   (the infinity norm), or
+ *   sqrt(sum_ij A_ij**2)   (the Frobenius norm).
+ *
+ * The absolute sums of the columns or rows of A are computed with #idxdBLAS_sisgeasum_64(), and the Frobenius norm accumulates the scaled sums of squares of the rows (or columns) of A computed with #idxdBLAS_sisgessq_64() into one scaled indexed type, so that each norm is reproducible. The Frobenius norm is the same as #reproBLAS_rsnrm2_64() of the elements of A.
+ *
+ * Same as #reproBLAS_slange(), except that the dimensions and leading dimension are 64-bit integers.
+ *
+ * @param Norm a character specifying the norm ('m' or 'M' for the max norm, '1' or 'o' or 'O' for the 1-norm, 'i' or 'I' for the infinity norm, 'f' or 'F' or 'e' or 'E' for the Frobenius norm)
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param A float precision matrix of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of A as declared in the calling program
+ * @return the norm of A
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_slange_64(const char Norm, const char Order,
+                           const int64_t M, const int64_t N,
+                           const float *A, const int64_t lda){
+  return reproBLAS_rslange_64(SIDEFAULTFOLD, Norm, Order, M, N, A, lda);
+}
@@ -20,3 +20,23 @@
 float reproBLAS_snrm2(const int N, const float* X, const int incX) {
   return reproBLAS_rsnrm2(SIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible Euclidian norm of single precision vector X
+ *
+ * Return the square root of the sum of the squared elements of X.
+ *
+ * The reproducible Euclidian norm is computed with scaled indexed types of default fold using #idxdBLAS_sisssq_64()
+ *
+ * Same as #reproBLAS_snrm2(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return Euclidian norm of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_snrm2_64(const int64_t N, const float* X, const int64_t incX) {
+  return reproBLAS_rsnrm2_64(SIDEFAULTFOLD, N, X, incX);
+}
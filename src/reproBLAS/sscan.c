@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible inclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i of X, for i = 0, ..., N - 1.
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisscan(), and each element of Y is the same as #reproBLAS_rssum() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_sscan(const int N, const float *X, const int incX, float *Y, const int incY){
+  reproBLAS_rsscan(SIDEFAULTFOLD, N, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible inclusive scan of single precision vector X
+ *
+ * Sets Y[i * incY] to the sum of elements 0 through i of X, for i = 0, ..., N - 1.
+ *
+ * The prefix sums are computed with indexed types using #idxdBLAS_sisscan_64(), and each element of Y is the same as #reproBLAS_rssum_64() of its prefix, whatever the number of threads. X and Y may be the same vector if incX = incY.
+ *
+ * Same as #reproBLAS_sscan(), except that the vector length and strides are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_sscan_64(const int64_t N, const float *X, const int64_t incX, float *Y, const int64_t incY){
+  reproBLAS_rsscan_64(SIDEFAULTFOLD, N, X, incX, Y, incY);
+}
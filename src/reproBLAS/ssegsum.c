@@ -0,0 +1,45 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible sums of the segments of single precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_sissegsum(). Each element of Y is the same as #reproBLAS_rssum() of its segment.
+ *
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_ssegsum(const int nseg, const int *segptr, const float *X, const int incX, float *Y, const int incY){
+  reproBLAS_rssegsum(SIDEFAULTFOLD, nseg, segptr, X, incX, Y, incY);
+}
+
+/**
+ * @brief Compute the reproducible sums of the segments of single precision vector X
+ *
+ * Sets Y[s * incY] to the sum of elements segptr[s] through segptr[s + 1] - 1 of X, for s = 0, ..., nseg - 1. Empty segments sum to 0.
+ *
+ * The sums are computed with indexed types using #idxdBLAS_sissegsum_64(). Each element of Y is the same as #reproBLAS_rssum_64() of its segment.
+ *
+ * Same as #reproBLAS_ssegsum(), except that the number of segments, segment offsets and strides are 64-bit integers.
+ *
+ * @param nseg number of segments
+ * @param segptr array of size nseg + 1 holding the offsets of the segments in X
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param Y single precision vector of size nseg
+ * @param incY Y vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_ssegsum_64(const int64_t nseg, const int64_t *segptr, const float *X, const int64_t incX, float *Y, const int64_t incY){
+  reproBLAS_rssegsum_64(SIDEFAULTFOLD, nseg, segptr, X, incX, Y, incY);
+}
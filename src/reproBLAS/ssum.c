@@ -20,3 +20,23 @@
 float reproBLAS_ssum(const int N, const float* X, const int incX) {
   return reproBLAS_rssum(SIDEFAULTFOLD, N, X, incX);
 }
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_sissum_64()
+ *
+ * Same as #reproBLAS_ssum(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_ssum_64(const int64_t N, const float* X, const int64_t incX) {
+  return reproBLAS_rssum_64(SIDEFAULTFOLD, N, X, incX);
+}
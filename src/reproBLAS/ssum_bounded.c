@@ -0,0 +1,43 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_sissum_bounded(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_ssum().
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_ssum_bounded(const int N, const float* X, const int incX, const float bound) {
+  return reproBLAS_rssum_bounded(SIDEFAULTFOLD, N, X, incX, bound);
+}
+
+/**
+ * @brief Compute the reproducible sum of single precision vector X, given a bound on its elements
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_sissum_bounded_64(), which reads X once. If @c bound is at least the absolute value of every element of X and falls in the same bin as the largest of them, the result is the same as that of #reproBLAS_ssum_64().
+ *
+ * Same as #reproBLAS_ssum_bounded(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X single precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param bound bound on the absolute values of the elements of X
+ * @return sum of X
+ *
+ * @date   18 Oct 2026
+ */
+float reproBLAS_ssum_bounded_64(const int64_t N, const float* X, const int64_t incX, const float bound) {
+  return reproBLAS_rssum_bounded_64(SIDEFAULTFOLD, N, X, incX, bound);
+}
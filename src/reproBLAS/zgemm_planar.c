@@ -0,0 +1,91 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to planar complex double precision matrix C the reproducible matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * A, B and C are given in planar layout, as separate real matrices of their real and imaginary parts. The matrix-matrix product is computed using indexed types of default fold with #idxdBLAS_zizgemm_planar(), and the result is the same as that of #reproBLAS_zgemm() on the interleaved A, B and C.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param CR double precision matrix of the real parts of C, of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param CI double precision matrix of the imaginary parts of C, of the same dimension as CR.
+ * @param ldc the first dimension of CR and CI as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zgemm_planar(const char Order, const char TransA, const char TransB,
+                            const int M, const int N, const int K,
+                            const void *alpha, const double *AR, const double *AI, const int lda,
+                            const double *BR, const double *BI, const int ldb,
+                            const void *beta, double *CR, double *CI, const int ldc){
+  reproBLAS_rzgemm_planar(DIDEFAULTFOLD, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+}
+
+/**
+ * @brief Add to planar complex double precision matrix C the reproducible matrix-matrix product of planar complex double precision matrices A and B
+ *
+ * Performs one of the matrix-matrix operations
+ *
+ *   C := alpha*op(A)*op(B) + beta*C,
+ *
+ * where  op(X) is one of
+ *
+ *   op(X) = X   or   op(X) = X**T   or   op(X) = X**H,
+ *
+ * alpha and beta are scalars, A and B and C are matrices with op(A) an M by K matrix, op(B) a K by N matrix, and C is an M by N matrix.
+ *
+ * A, B and C are given in planar layout, as separate real matrices of their real and imaginary parts. The matrix-matrix product is computed using indexed types of default fold with #idxdBLAS_zizgemm_planar_64(), and the result is the same as that of #reproBLAS_zgemm_64() on the interleaved A, B and C.
+ *
+ * Same as #reproBLAS_zgemm_planar(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param TransB a character specifying whether or not to transpose B before taking the matrix-matrix product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix op(A) and of the matrix C.
+ * @param N number of columns of matrix op(B) and of the matrix C.
+ * @param K number of columns of matrix op(A) and columns of the matrix op(B).
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (M, K) if A is not transposed and (K, M) otherwise.
+ * @param AI double precision matrix of the imaginary parts of A, of the same dimension as AR.
+ * @param lda the first dimension of AR and AI as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param BR double precision matrix of the real parts of B, of dimension (mb, ldb) in row-major or (ldb, nb) in column-major. (mb, nb) is (K, N) if B is not transposed and (N, K) otherwise.
+ * @param BI double precision matrix of the imaginary parts of B, of the same dimension as BR.
+ * @param ldb the first dimension of BR and BI as declared in the calling program. ldb must be at least nb in row major or mb in column major.
+ * @param beta scalar beta
+ * @param CR double precision matrix of the real parts of C, of dimension (M, ldc) in row-major or (ldc, N) in column-major.
+ * @param CI double precision matrix of the imaginary parts of C, of the same dimension as CR.
+ * @param ldc the first dimension of CR and CI as declared in the calling program. ldc must be at least N in row major or M in column major.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zgemm_planar_64(const char Order, const char TransA, const char TransB,
+                               const int64_t M, const int64_t N, const int64_t K,
+                               const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                               const double *BR, const double *BI, const int64_t ldb,
+                               const void *beta, double *CR, double *CI, const int64_t ldc){
+  reproBLAS_rzgemm_planar_64(DIDEFAULTFOLD, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+}
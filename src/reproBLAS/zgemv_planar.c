@@ -0,0 +1,79 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to planar complex double precision vector Y the reproducible matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * A, X and Y are given in planar layout, as separate real matrices or vectors of their real and imaginary parts. The matrix-vector product is computed using indexed types of default fold with #idxdBLAS_zizgemv_planar(), and the result is the same as that of #reproBLAS_zgemv() on the interleaved A, X and Y.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param YR double precision vector of the real parts of Y, of at least size M if not transposed or size N otherwise
+ * @param YI double precision vector of the imaginary parts of Y, of at least size M if not transposed or size N otherwise
+ * @param incY YR and YI vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zgemv_planar(const char Order,
+                            const char TransA, const int M, const int N,
+                            const void *alpha, const double *AR, const double *AI, const int lda,
+                            const double *XR, const double *XI, const int incX,
+                            const void *beta, double *YR, double *YI, const int incY){
+  reproBLAS_rzgemv_planar(DIDEFAULTFOLD, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, beta, YR, YI, incY);
+}
+
+/**
+ * @brief Add to planar complex double precision vector Y the reproducible matrix-vector product of planar complex double precision matrix A and planar complex double precision vector X
+ *
+ * Performs one of the matrix-vector operations
+ *
+ *   y := alpha*A*x + beta*y   or   y := alpha*A**T*x + beta*y   or   y := alpha*A**H*x + beta*y,
+ *
+ * where alpha and beta are scalars, x and y are vectors, and A is an M by N matrix.
+ *
+ * A, X and Y are given in planar layout, as separate real matrices or vectors of their real and imaginary parts. The matrix-vector product is computed using indexed types of default fold with #idxdBLAS_zizgemv_planar_64(), and the result is the same as that of #reproBLAS_zgemv_64() on the interleaved A, X and Y.
+ *
+ * Same as #reproBLAS_zgemv_planar(), except that the dimensions, leading dimension and strides are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param TransA a character specifying whether or not to transpose A before taking the matrix-vector product ('n' or 'N' not to transpose, 't' or 'T' to transpose, 'c' or 'C' to conjugate transpose)
+ * @param M number of rows of matrix A
+ * @param N number of columns of matrix A
+ * @param alpha scalar alpha
+ * @param AR double precision matrix of the real parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param AI double precision matrix of the imaginary parts of A, of dimension (M, lda) in row-major or (lda, N) in column-major
+ * @param lda the first dimension of AR and AI as declared in the calling program
+ * @param XR double precision vector of the real parts of X, of at least size N if not transposed or size M otherwise
+ * @param XI double precision vector of the imaginary parts of X, of at least size N if not transposed or size M otherwise
+ * @param incX XR and XI vector stride (use every incX'th element)
+ * @param beta scalar beta
+ * @param YR double precision vector of the real parts of Y, of at least size M if not transposed or size N otherwise
+ * @param YI double precision vector of the imaginary parts of Y, of at least size M if not transposed or size N otherwise
+ * @param incY YR and YI vector stride (use every incY'th element)
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zgemv_planar_64(const char Order,
+                               const char TransA, const int64_t M, const int64_t N,
+                               const void *alpha, const double *AR, const double *AI, const int64_t lda,
+                               const double *XR, const double *XI, const int64_t incX,
+                               const void *beta, double *YR, double *YI, const int64_t incY){
+  reproBLAS_rzgemv_planar_64(DIDEFAULTFOLD, Order, TransA, M, N, alpha, AR, AI, lda, XR, XI, incX, beta, YR, YI, incY);
+}
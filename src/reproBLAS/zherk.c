@@ -0,0 +1,69 @@
+#include <reproBLAS.h>
+
+#include "../../config.h"
+
+/**
+ * @brief Add to the upper or lower triangle of complex double precision matrix C the reproducible hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + beta*C   or   C := alpha*A**H*A + beta*C,
+ *
+ * where alpha and beta are real scalars, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an N by N hermitian matrix of which only the upper or lower triangle is referenced. The imaginary parts of the diagonal elements of C are set to zero.
+ *
+ * The hermitian rank-k product is computed using indexed types with #idxdBLAS_zizherk() and #idxdBLAS_zizgemm(), so that each element of the triangle (but for the imaginary parts of the diagonal) is the same as that of #reproBLAS_rzgemm() with op(B) = op(A)**H and complex scalars (alpha, 0) and (beta, 0). Only the triangle is computed and converted to indexed types, a few lines at a time.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle, 'a' or 'A' to update the lower triangle and copy its conjugate to the upper triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + beta*C, 'c' or 'C' for C := alpha*A**H*A + beta*C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param beta scalar beta
+ * @param C complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zherk(const char Order, const char Uplo, const char Trans,
+                     const int N, const int K,
+                     const double alpha, const void *A, const int lda,
+                     const double beta, void *C, const int ldc){
+  reproBLAS_rzherk(DIDEFAULTFOLD, Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
+
+/**
+ * @brief Add to the upper or lower triangle of complex double precision matrix C the reproducible hermitian rank-k product of complex double precision matrix A
+ *
+ * Performs one of the hermitian rank-k operations
+ *
+ *   C := alpha*A*A**H + beta*C   or   C := alpha*A**H*A + beta*C,
+ *
+ * where alpha and beta are real scalars, A is an N by K matrix in the first case and a K by N matrix in the second case, and C is an N by N hermitian matrix of which only the upper or lower triangle is referenced. The imaginary parts of the diagonal elements of C are set to zero.
+ *
+ * The hermitian rank-k product is computed using indexed types with #idxdBLAS_zizherk_64() and #idxdBLAS_zizgemm_64(), so that each element of the triangle (but for the imaginary parts of the diagonal) is the same as that of #reproBLAS_rzgemm_64() with op(B) = op(A)**H and complex scalars (alpha, 0) and (beta, 0). Only the triangle is computed and converted to indexed types, a few lines at a time.
+ *
+ * Same as #reproBLAS_zherk(), except that the dimensions and leading dimensions are 64-bit integers.
+ *
+ * @param Order a character specifying the matrix ordering ('r' or 'R' for row-major, 'c' or 'C' for column major)
+ * @param Uplo a character specifying which triangle of C to update ('u' or 'U' for the upper triangle, 'l' or 'L' for the lower triangle, 'a' or 'A' to update the lower triangle and copy its conjugate to the upper triangle)
+ * @param Trans a character specifying the operation ('n' or 'N' for C := alpha*A*A**H + beta*C, 'c' or 'C' for C := alpha*A**H*A + beta*C)
+ * @param N number of rows and columns of the matrix C.
+ * @param K number of columns of matrix op(A).
+ * @param alpha scalar alpha
+ * @param A complex double precision matrix of dimension (ma, lda) in row-major or (lda, na) in column-major. (ma, na) is (N, K) if Trans is 'n' or 'N' and (K, N) otherwise.
+ * @param lda the first dimension of A as declared in the calling program. lda must be at least na in row major or ma in column major.
+ * @param beta scalar beta
+ * @param C complex double precision matrix of dimension (N, ldc) in row-major or (ldc, N) in column-major.
+ * @param ldc the first dimension of C as declared in the calling program. ldc must be at least N.
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zherk_64(const char Order, const char Uplo, const char Trans,
+                        const int64_t N, const int64_t K,
+                        const double alpha, const void *A, const int64_t lda,
+                        const double beta, void *C, const int64_t ldc){
+  reproBLAS_rzherk_64(DIDEFAULTFOLD, Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc);
+}
@@ -20,3 +20,23 @@
 void reproBLAS_zsum_sub(const int N, const void* X, const int incX, void *sum) {
   reproBLAS_rzsum_sub(DIDEFAULTFOLD, N, X, incX, sum);
 }
+
+/**
+ * @brief Compute the reproducible sum of complex double precision vector X
+ *
+ * Return the sum of X.
+ *
+ * The reproducible sum is computed with indexed types of default fold using #idxdBLAS_zizsum_64()
+ *
+ * Same as #reproBLAS_zsum_sub(), except that the vector length and stride are 64-bit integers.
+ *
+ * @param N vector length
+ * @param X complex double precision vector
+ * @param incX X vector stride (use every incX'th element)
+ * @param sum scalar return
+ *
+ * @date   18 Oct 2026
+ */
+void reproBLAS_zsum_sub_64(const int64_t N, const void* X, const int64_t incX, void *sum) {
+  reproBLAS_rzsum_sub_64(DIDEFAULTFOLD, N, X, incX, sum);
+}
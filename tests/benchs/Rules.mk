@@ -11,7 +11,7 @@ TARGETS := bench_damax$(EXE) bench_damaxm$(EXE)                     \
            bench_rzsum$(EXE) bench_rdzasum$(EXE) bench_rdznrm2$(EXE)\
              bench_rzdotc$(EXE) bench_rzdotu$(EXE)                  \
            bench_rsasum$(EXE)  bench_rsnrm2$(EXE) bench_rssum$(EXE) \
-             bench_rsdot$(EXE)                                      \
+             bench_rsdot$(EXE) bench_rsdssum$(EXE)                  \
            bench_rcsum$(EXE) bench_rscasum$(EXE) bench_rscnrm2$(EXE)\
              bench_rcdotc$(EXE) bench_rcdotu$(EXE)                  \
            bench_rdgemv$(EXE) bench_rdgemm$(EXE)                    \
@@ -45,8 +45,16 @@ TARGETS += bench_idamax$(EXE)                                  \
            bench_cgemv$(EXE) bench_cgemm$(EXE)
 endif
 
+ifneq ($(OMPFLAGS),)
+
+TARGETS += bench_omp_dsum$(EXE) bench_omp_rdsum$(EXE)
+endif
+
 SUBDIRS :=
 
+CFLAGS += $(OMPFLAGS)
+LDFLAGS += $(OMPFLAGS)
+
 bench_camax$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXDBLAS) bench_camax.o
 bench_camaxm$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXDBLAS) bench_camaxm.o
 bench_cciconv$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXDBLAS) bench_cciconv.o
@@ -68,6 +76,8 @@ bench_dnrm2$(EXE)_DEPS = $$(LIBTEST) bench_dnrm2.o
 bench_dsum$(EXE)_DEPS = $$(LIBTEST) bench_dsum.o
 bench_dzasum$(EXE)_DEPS = $$(LIBTEST) bench_dzasum.o
 bench_dznrm2$(EXE)_DEPS = $$(LIBTEST) bench_dznrm2.o
+bench_omp_dsum$(EXE)_DEPS = $$(LIBTEST) bench_omp_dsum.o
+bench_omp_rdsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXD) bench_omp_rdsum.o
 bench_icamax$(EXE)_DEPS = $$(LIBTEST) bench_icamax.o
 bench_idamax$(EXE)_DEPS = $$(LIBTEST) bench_idamax.o
 bench_isamax$(EXE)_DEPS = $$(LIBTEST) bench_isamax.o
@@ -93,6 +103,7 @@ bench_rsgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rsgemm.o
 bench_rsgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rsgemv.o
 bench_rsnrm2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rsnrm2.o
 bench_rssum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rssum.o
+bench_rsdssum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rsdssum.o
 bench_rzdotc$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rzdotc.o
 bench_rzdotu$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rzdotu.o
 bench_rzgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) bench_rzgemm.o
@@ -141,6 +152,8 @@ bench_dnrm2$(EXE)_LIBS = -lm
 bench_dsum$(EXE)_LIBS = -lm
 bench_dzasum$(EXE)_LIBS = -lm
 bench_dznrm2$(EXE)_LIBS = -lm
+bench_omp_dsum$(EXE)_LIBS = -lm
+bench_omp_rdsum$(EXE)_LIBS = -lm
 bench_icamax$(EXE)_LIBS = -lm
 bench_idamax$(EXE)_LIBS = -lm
 bench_isamax$(EXE)_LIBS = -lm
@@ -166,6 +179,7 @@ bench_rsgemm$(EXE)_LIBS = -lm
 bench_rsgemv$(EXE)_LIBS = -lm
 bench_rsnrm2$(EXE)_LIBS = -lm
 bench_rssum$(EXE)_LIBS = -lm
+bench_rsdssum$(EXE)_LIBS = -lm
 bench_rzdotc$(EXE)_LIBS = -lm
 bench_rzdotu$(EXE)_LIBS = -lm
 bench_rzgemm$(EXE)_LIBS = -lm
@@ -19,6 +19,7 @@ bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRDSUMTest(), benchs.Bench
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRZSUMTest(), benchs.BenchRDZASUMTest(), benchs.BenchRDZNRM2Test(), benchs.BenchRZDOTUTest(), benchs.BenchRZDOTCTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRSSUMTest(), benchs.BenchRSASUMTest(), benchs.BenchRSNRM2Test(), benchs.BenchRSDOTTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRCSUMTest(), benchs.BenchRSCASUMTest(), benchs.BenchRSCNRM2Test(), benchs.BenchRCDOTUTest(), benchs.BenchRCDOTCTest()], ["N", "fold"], [[4096], [3]], attribute, silent_flags="--FillA rand"))
+bench_harness.add_suite(benchs.BenchSuite([benchs.BenchOMPRDSUMTest(), benchs.BenchOMPDSUMTest()], ["N", "fold"], [[1048576], [3]], attribute, silent_flags="--FillA rand"))
 """
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRDGEMVTest(), benchs.BenchDGEMVTest()], [("N", "M"), "fold", "Order"], [[(2048, 2048)], [3], ["ColMajor", "RowMajor"]], attribute, silent_flags="--FillA rand --FillX rand"))
 bench_harness.add_suite(benchs.BenchSuite([benchs.BenchRZGEMVTest(), benchs.BenchZGEMVTest()], [("N", "M"), "fold", "Order"], [[(2048, 2048)], [3], ["ColMajor", "RowMajor"]], attribute, silent_flags="--FillA rand --FillX rand"))
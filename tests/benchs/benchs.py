@@ -125,6 +125,14 @@ class BenchRDSUMTest(BenchTest):
   name = "RDSUM"
   executable = "tests/benchs/bench_rdsum"
 
+class BenchOMPDSUMTest(BenchTest):
+  name = "OMPDSUM"
+  executable = "tests/benchs/bench_omp_dsum"
+
+class BenchOMPRDSUMTest(BenchTest):
+  name = "OMPRDSUM"
+  executable = "tests/benchs/bench_omp_rdsum"
+
 class BenchRDZASUMTest(BenchTest):
   name = "RDZASUM"
   executable = "tests/benchs/bench_rdzasum"
@@ -157,6 +165,10 @@ class BenchRSSUMTest(BenchTest):
   name = "RSSUM"
   executable = "tests/benchs/bench_rssum"
 
+class BenchRSDSSUMTest(BenchTest):
+  name = "RSDSSUM"
+  executable = "tests/benchs/bench_rsdssum"
+
 class BenchRZDOTCTest(BenchTest):
   name = "RZDOTC"
   executable = "tests/benchs/bench_rzdotc"
@@ -340,6 +352,7 @@ all_benchs = {"bench_camax": (BenchCAMAXTest, [""]),\
               "bench_dnrm2": (BenchDNRM2Test, [""]),\
               "bench_dzasum": (BenchDZASUMTest, [""]),\
               "bench_dznrm2": (BenchDZNRM2Test, [""]),\
+              "bench_omp_dsum": (BenchOMPDSUMTest, [""]),\
               "bench_icamax": (BenchICAMAXTest, [""]),\
               "bench_idamax": (BenchIDAMAXTest, [""]),\
               "bench_isamax": (BenchISAMAXTest, [""]),\
@@ -413,6 +426,8 @@ for i in range(1, terminal.get_dimaxfold() + 1):
   else:
     flagss = ["--fold {}".format(i)]
   all_benchs.update({"bench_rdsum_fold_{}".format(i): (BenchRDSUMTest, flagss),\
+                     "bench_rsdssum_fold_{}".format(i): (BenchRSDSSUMTest, flagss),\
+                     "bench_omp_rdsum_fold_{}".format(i): (BenchOMPRDSUMTest, flagss),\
                      "bench_rdasum_fold_{}".format(i): (BenchRDASUMTest, flagss),\
                      "bench_rdnrm2_fold_{}".format(i): (BenchRDNRM2Test, flagss),\
                      "bench_rddot_fold_{}".format(i): (BenchRDDOTTest, flagss),\
@@ -15,11 +15,38 @@ TARGETS := validate_internal_damax$(EXE) validate_internal_zamax$(EXE) validate_
            corroborate_rsgemm$(EXE) \
            corroborate_rcgemv$(EXE) \
            corroborate_rcgemm$(EXE) \
+           corroborate_cpp$(EXE) \
+           verify_idxdshard$(EXE) \
+           verify_idxdpool$(EXE) \
+           verify_idxdio$(EXE) \
+           verify_ilp64$(EXE) \
+           verify_sdsblas1$(EXE) \
+           verify_sdsblas2$(EXE) \
+           verify_sdhblas1$(EXE) \
+           verify_dotfma$(EXE) \
+           verify_zplanar$(EXE) \
+           verify_syrk$(EXE) \
+           verify_trsm$(EXE) \
+           verify_csrmv$(EXE) \
+           verify_gesum$(EXE) \
+           verify_moments$(EXE) \
+           verify_segsum$(EXE) \
+           verify_scan$(EXE) \
+           verify_gemvdot$(EXE) \
+           verify_axpbydot$(EXE) \
+           verify_mdot$(EXE) \
+           verify_packed$(EXE) \
+           verify_bounded$(EXE) \
+
+ifneq ($(OMPFLAGS),)
+
+TARGETS += verify_idxdomp$(EXE)
+endif
 
 SUBDIRS :=
 
-LDFLAGS += $(MPILDFLAGS)
-CFLAGS += $(MPICFLAGS)
+LDFLAGS += $(MPILDFLAGS) $(OMPFLAGS)
+CFLAGS += $(MPICFLAGS) $(OMPFLAGS)
 
 validate_internal_camax$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXDBLAS) validate_internal_camax.o
 validate_internal_damax$(EXE)_DEPS = $$(LIBTEST) $$(LIBIDXDBLAS) validate_internal_damax.o
@@ -49,6 +76,28 @@ verify_didssq$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_didssq.o
 verify_dizssq$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_dizssq.o
 verify_sisssq$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_sisssq.o
 verify_sicssq$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_sicssq.o
+verify_idxdshard$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_idxdshard.o
+verify_idxdpool$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_idxdpool.o
+verify_idxdio$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) $$(LIBIDXDIO) verify_idxdio.o
+verify_ilp64$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_ilp64.o
+verify_sdsblas1$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_sdsblas1.o
+verify_sdsblas2$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_sdsblas2.o
+verify_sdhblas1$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_sdhblas1.o
+verify_dotfma$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_dotfma.o
+verify_zplanar$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_zplanar.o
+verify_syrk$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_syrk.o
+verify_trsm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_trsm.o
+verify_csrmv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_csrmv.o
+verify_gesum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_gesum.o
+verify_moments$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_moments.o
+verify_segsum$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_segsum.o
+verify_scan$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_scan.o
+verify_gemvdot$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_gemvdot.o
+verify_axpbydot$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_axpbydot.o
+verify_mdot$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_mdot.o
+verify_packed$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_packed.o
+verify_bounded$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_bounded.o
+verify_idxdomp$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) verify_idxdomp.o
 corroborate_rdgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rdgemv.o
 corroborate_rdgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rdgemm.o
 corroborate_rzgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rzgemv.o
@@ -57,6 +106,7 @@ corroborate_rsgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rsgemv.
 corroborate_rsgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rsgemm.o
 corroborate_rcgemv$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rcgemv.o
 corroborate_rcgemm$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_rcgemm.o
+corroborate_cpp$(EXE)_DEPS = $$(LIBTEST) $$(LIBREPROBLAS) corroborate_cpp.o
 
 validate_internal_damax$(EXE)_LIBS = -lm
 validate_internal_zamax$(EXE)_LIBS = -lm
@@ -86,6 +136,28 @@ verify_didssq$(EXE)_LIBS = -lm
 verify_dizssq$(EXE)_LIBS = -lm
 verify_sisssq$(EXE)_LIBS = -lm
 verify_sicssq$(EXE)_LIBS = -lm
+verify_idxdshard$(EXE)_LIBS = -lm
+verify_idxdpool$(EXE)_LIBS = -lm
+verify_idxdio$(EXE)_LIBS = -lm
+verify_ilp64$(EXE)_LIBS = -lm
+verify_sdsblas1$(EXE)_LIBS = -lm
+verify_sdsblas2$(EXE)_LIBS = -lm
+verify_sdhblas1$(EXE)_LIBS = -lm
+verify_dotfma$(EXE)_LIBS = -lm
+verify_zplanar$(EXE)_LIBS = -lm
+verify_syrk$(EXE)_LIBS = -lm
+verify_trsm$(EXE)_LIBS = -lm
+verify_csrmv$(EXE)_LIBS = -lm
+verify_gesum$(EXE)_LIBS = -lm
+verify_moments$(EXE)_LIBS = -lm
+verify_segsum$(EXE)_LIBS = -lm
+verify_scan$(EXE)_LIBS = -lm
+verify_gemvdot$(EXE)_LIBS = -lm
+verify_axpbydot$(EXE)_LIBS = -lm
+verify_mdot$(EXE)_LIBS = -lm
+verify_packed$(EXE)_LIBS = -lm
+verify_bounded$(EXE)_LIBS = -lm
+verify_idxdomp$(EXE)_LIBS = -lm
 corroborate_rdgemv$(EXE)_LIBS = -lm
 corroborate_rdgemm$(EXE)_LIBS = -lm
 corroborate_rzgemv$(EXE)_LIBS = -lm
@@ -94,3 +166,6 @@ corroborate_rsgemv$(EXE)_LIBS = -lm
 corroborate_rsgemm$(EXE)_LIBS = -lm
 corroborate_rcgemv$(EXE)_LIBS = -lm
 corroborate_rcgemm$(EXE)_LIBS = -lm
+corroborate_cpp$(EXE)_LIBS = -lm
+
+corroborate_cpp$(EXE)_CMD = $(CXX_MAKECMD)
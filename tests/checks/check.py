@@ -60,10 +60,12 @@ check_suite.add_checks([checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalDIDIADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDIDDEPOSITINLINETest(),\
                         checks.ValidateInternalRSSUMTest(),\
                         checks.ValidateInternalSISIADDTest(),\
                         checks.ValidateInternalSISADDTest(),\
                         checks.ValidateInternalSISDEPOSITTest(),\
+                        checks.ValidateInternalSISDEPOSITINLINETest(),\
                         ],\
                        ["N", "fold", "incX", "RealScaleX", "FillX"],\
                        [[4095], folds, incs, [1.0, -1.0],\
@@ -188,12 +190,14 @@ check_suite.add_checks([checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalDIDIADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDIDDEPOSITINLINETest(),\
                         checks.ValidateInternalRSSUMTest(),\
                         checks.ValidateInternalRSASUMTest(),\
                         checks.ValidateInternalRSNRM2Test(),\
                         checks.ValidateInternalSISIADDTest(),\
                         checks.ValidateInternalSISADDTest(),\
                         checks.ValidateInternalSISDEPOSITTest(),\
+                        checks.ValidateInternalSISDEPOSITINLINETest(),\
                         ],\
                        ["N", "fold", "incX", "RealScaleX", "FillX"],\
                        [[255], inf_folds, incs, [1.0, -1.0],\
@@ -288,6 +292,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifyDIDIADDTest(),\
                         checks.VerifyDIDADDTest(),\
                         checks.VerifyDIDDEPOSITTest(),\
+                        checks.VerifyDIDDEPOSITINLINETest(),\
                         checks.VerifyRZSUMTest(),\
                         checks.VerifyRDZASUMTest(),\
                         checks.VerifyZIZIADDTest(),\
@@ -298,6 +303,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifySISIADDTest(),\
                         checks.VerifySISADDTest(),\
                         checks.VerifySISDEPOSITTest(),\
+                        checks.VerifySISDEPOSITINLINETest(),\
                         checks.VerifyRCSUMTest(),\
                         checks.VerifyRSCASUMTest(),\
                         checks.VerifyCICIADDTest(),\
@@ -314,6 +320,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifyDIDIADDTest(),\
                         checks.VerifyDIDADDTest(),\
                         checks.VerifyDIDDEPOSITTest(),\
+                        checks.VerifyDIDDEPOSITINLINETest(),\
                         checks.VerifyRZSUMTest(),\
                         checks.VerifyRDZASUMTest(),\
                         checks.VerifyRDZNRM2Test(),\
@@ -328,6 +335,7 @@ check_suite.add_checks([checks.VerifyRDSUMTest(),\
                         checks.VerifySISIADDTest(),\
                         checks.VerifySISADDTest(),\
                         checks.VerifySISDEPOSITTest(),\
+                        checks.VerifySISDEPOSITINLINETest(),\
                         checks.VerifyRCSUMTest(),\
                         checks.VerifyRSCASUMTest(),\
                         checks.VerifyRSCNRM2Test(),\
@@ -365,6 +373,7 @@ for i in range(DBL_BIN_WIDTH + 2):
                           checks.ValidateInternalDIDIADDTest(),\
                           checks.ValidateInternalDIDADDTest(),\
                           checks.ValidateInternalDIDDEPOSITTest(),\
+                          checks.ValidateInternalDIDDEPOSITINLINETest(),\
                           checks.ValidateInternalRDASUMTest(),\
                           checks.ValidateInternalRDNRM2Test(),\
                           checks.ValidateInternalRDDOTTest(),\
@@ -378,6 +387,7 @@ for i in range(DBL_BIN_WIDTH + 2):
                           checks.ValidateInternalDIDIADDTest(),\
                           checks.ValidateInternalDIDADDTest(),\
                           checks.ValidateInternalDIDDEPOSITTest(),\
+                          checks.ValidateInternalDIDDEPOSITINLINETest(),\
                           checks.ValidateInternalRDASUMTest(),\
                           checks.ValidateInternalRDNRM2Test(),\
                           checks.ValidateInternalRDDOTTest(),\
@@ -469,6 +479,7 @@ for i in range(FLT_BIN_WIDTH + 2):
                           checks.ValidateInternalSISIADDTest(),\
                           checks.ValidateInternalSISADDTest(),\
                           checks.ValidateInternalSISDEPOSITTest(),\
+                          checks.ValidateInternalSISDEPOSITINLINETest(),\
                           checks.ValidateInternalRSASUMTest(),\
                           checks.ValidateInternalRSNRM2Test(),\
                           checks.ValidateInternalRSDOTTest(),\
@@ -482,6 +493,7 @@ for i in range(FLT_BIN_WIDTH + 2):
                           checks.ValidateInternalSISIADDTest(),\
                           checks.ValidateInternalSISADDTest(),\
                           checks.ValidateInternalSISDEPOSITTest(),\
+                          checks.ValidateInternalSISDEPOSITINLINETest(),\
                           checks.ValidateInternalRSASUMTest(),\
                           checks.ValidateInternalRSNRM2Test(),\
                           checks.ValidateInternalRSDOTTest(),\
@@ -571,6 +583,7 @@ for i in range(FLT_BIN_WIDTH + 2):
 check_suite.add_checks([checks.ValidateInternalDIDIADDTest(),\
                         checks.ValidateInternalDIDADDTest(),\
                         checks.ValidateInternalDIDDEPOSITTest(),\
+                        checks.ValidateInternalDIDDEPOSITINLINETest(),\
                         checks.ValidateInternalRDSUMTest(),\
                         checks.ValidateInternalRDASUMTest(),\
                         checks.ValidateInternalRDDOTTest(),\
@@ -588,6 +601,7 @@ check_suite.add_checks([checks.ValidateInternalDIDIADDTest(),\
 check_suite.add_checks([checks.ValidateInternalSISIADDTest(),\
                         checks.ValidateInternalSISADDTest(),\
                         checks.ValidateInternalSISDEPOSITTest(),\
+                        checks.ValidateInternalSISDEPOSITINLINETest(),\
                         checks.ValidateInternalRSSUMTest(),\
                         checks.ValidateInternalRSASUMTest(),\
                         checks.ValidateInternalRSDOTTest(),\
@@ -635,6 +649,193 @@ check_suite.add_checks([checks.CorroborateRDGEMMTest(),
                         [(0.0, 0.0), (1.0, 0.0), (2.0, 2.0)],\
                         folds])
 
+#alpha with distinct real and imaginary parts (powers of two, so scaling A is exact), conjugate-transposed and column-major complex inputs, and M != N
+check_suite.add_checks([checks.CorroborateRZGEMVTest(),\
+                        checks.CorroborateRCGEMVTest(),\
+                        ],\
+                       ["O", "T", "M", "N", "lda", ("incX", "incY"), "FillA", "FillX", "FillY", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold"],\
+                       [["RowMajor", "ColMajor"], ["ConjTrans", "Trans"], [255, 512], [255, 512], [0], [(1, 1)],\
+                        ["rand"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(0.5, -2.0)],\
+                        [(1.0, 0.0)],\
+                        folds])
+
+check_suite.add_checks([checks.CorroborateRZGEMMTest(),\
+                        checks.CorroborateRCGEMMTest(),\
+                        ],\
+                       ["O", "TransA", "TransB", "M", "N", "K", ("lda", "ldb", "ldc"), "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold"],\
+                       [["RowMajor", "ColMajor"], ["ConjTrans", "Trans", "NoTrans"], ["ConjTrans", "Trans", "NoTrans"], [32], [64], [48], [(0, 0, 0)], \
+                        ["rand"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(0.5, -2.0)],\
+                        [(1.0, 0.0)],\
+                        folds])
+
+check_suite.add_checks([checks.VerifySDSBLAS2Test(),\
+                        ],\
+                       ["O", "TransA", "TransB", "M", "N", "K", ("lda", "ldb", "ldc"), "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], ["Trans", "NoTrans"], [33, 64], [33, 64], [32, 1500], [(0, 0, 0), (-63, -63, -63)], \
+                        ["rand", "small+grow*big"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(1.0, 0.0), (2.0, 0.0)],\
+                        [(0.0, 0.0), (1.0, 0.0)],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyZPLANARTest(),\
+                        ],\
+                       ["O", "TransA", "TransB", "M", "N", "K", ("lda", "ldb", "ldc"), "FillA", "FillB", "FillC", ("RealAlpha", "ImagAlpha"), ("RealBeta", "ImagBeta"), "fold"],\
+                       [["RowMajor", "ColMajor"], ["ConjTrans", "Trans", "NoTrans"], ["ConjTrans", "Trans", "NoTrans"], [32, 64], [32, 64], [32, 1500], [(0, 0, 0), (-63, -63, -63)], \
+                        ["rand", "small+grow*big"],\
+                        ["rand"],\
+                        ["rand"],\
+                        [(1.0, 0.0), (2.0, 0.5)],\
+                        [(0.0, 0.0), (1.0, 0.0), (0.5, 2.0)],\
+                        folds])
+
+check_suite.add_checks([checks.VerifySYRKTest(),\
+                        ],\
+                       ["O", "TransA", ("M", "N"), "K", ("lda", "ldb", "ldc"), "FillA", "FillC", "RealAlpha", "RealBeta", "fold"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], [(1, 1), (33, 33), (100, 100)], [32, 1500], [(0, 0, 0), (-7, -7, -7)], \
+                        ["rand", "small+grow*big"],\
+                        ["rand"],\
+                        [1.0, 2.5],\
+                        [0.0, 1.0, 0.5],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyTRSMTest(),\
+                        ],\
+                       ["O", "TransA", ("M", "N"), ("lda", "ldb", "ldc"), "FillA", "FillB", "RealAlpha", "fold"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], [(1, 1), (33, 70), (100, 3)], [(0, 0, 0), (-7, -7, -7)], \
+                        ["rand", "small+grow*big"],\
+                        ["rand", "small+grow*big"],\
+                        [1.0, 2.5],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyCSRMVTest(),\
+                        ],\
+                       ["T", "M", "N", ("incX", "incY"), "FillA", "FillX", "FillY", "RealAlpha", "RealBeta", "fold"],\
+                       [["Trans", "NoTrans"], [1, 37, 300], [1, 64, 255], [(1, 1), (2, 4)], \
+                        ["rand", "small+grow*big"],\
+                        ["rand", "small+grow*big"],\
+                        ["rand"],\
+                        [1.0, 2.5],\
+                        [0.0, 1.0, 0.5],\
+                        folds])
+
+#x over a wide range of exponents, so that the products of most rows and columns lie far below the largest element of alpha*x
+check_suite.add_checks([checks.VerifyCSRMVTest(),\
+                        ],\
+                       ["T", "M", "N", ("incX", "incY"), "FillA", "FillX", "FillY", "RealAlpha", "RealBeta", "fold"],\
+                       [["Trans", "NoTrans"], [37, 300], [64, 255], [(1, 1)], \
+                        ["rand", "full_range"],\
+                        ["full_range", "half_range"],\
+                        ["rand"],\
+                        [1.0, 2.5],\
+                        [0.0, 1.0],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyGESUMTest(),\
+                        ],\
+                       ["O", "M", "N", "lda", "incY", "FillA", "fold"],\
+                       [["RowMajor", "ColMajor"], [1, 37, 300], [1, 64, 255], [0, -7], [1, 2],\
+                        ["rand", "small+grow*big", "rand+(rand-1)"],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyMOMENTSTest(),\
+                        ],\
+                       ["N", "fold", "incX", "FillX"],\
+                       [[0, 1, 4095, 65536], folds, [1, 3], ["rand", "2*rand-1", "small+grow*big"]])
+
+check_suite.add_checks([checks.VerifySEGSUMTest(),\
+                        ],\
+                       ["N", "fold", "incX", "FillX"],\
+                       [[0, 1, 4095, 65536], folds, [1, 3], ["rand", "2*rand-1", "small+grow*big"]])
+
+check_suite.add_checks([checks.VerifySCANTest(),\
+                        ],\
+                       ["N", "fold", "incX", "incY", "FillX"],\
+                       [[0, 1, 4095, 65536], folds, [1, 3], [1, 2], ["rand", "2*rand-1", "small+grow*big"]])
+
+check_suite.add_checks([checks.VerifyGEMVDOTTest(),\
+                        ],\
+                       ["O", "T", "M", "N", "lda", ("incX", "incY"), "FillA", "RealAlpha", "RealBeta", "fold"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], [1, 37, 300], [1, 64, 255], [0, -7], [(1, 1), (2, 4)],\
+                        ["rand", "small+grow*big"],\
+                        [1.0, 2.5],\
+                        [0.0, 1.0],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyAXPBYDOTTest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[0, 1, 4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "2*rand-1", "small+grow*big"], ["rand"]])
+
+check_suite.add_checks([checks.VerifyMDOTTest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[0, 1, 255, 4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "2*rand-1", "small+grow*big"], ["rand", "sine"]])
+
+check_suite.add_checks([checks.VerifyPACKEDTest(),\
+                        ],\
+                       ["O", "T", "M", "N", "lda", "incX", "FillA", "FillX", "RealAlpha", "fold"],\
+                       [["RowMajor", "ColMajor"], ["Trans", "NoTrans"], [1, 37, 300], [1, 64, 2100], [0, -7], [1, 2],\
+                        ["rand", "2*rand-1", "small+grow*big"],\
+                        ["rand", "small+grow*big"],\
+                        [1.0, 2.5],\
+                        folds])
+
+check_suite.add_checks([checks.VerifyBOUNDEDTest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[0, 1, 255, 4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "2*rand-1", "small+grow*big", "full_range"], ["rand", "small+grow*big"]])
+
+check_suite.add_checks([checks.VerifyBOUNDEDTest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[1, 4095], folds, [(1, 1)], ["+inf", "+-inf", "+inf_nan"], ["rand"]])
+
+check_suite.add_checks([checks.VerifyIDXDSHARDTest(),\
+                        checks.VerifyIDXDOMPTest(),\
+                        ],\
+                       ["N", "fold", "incX", "FillX"],\
+                       [[4095], folds, incs, ["rand", "rand+(rand-1)", "small+grow*big", "sine"]])
+
+check_suite.add_checks([checks.VerifyIDXDPOOLTest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "small+grow*big"], ["rand"]])
+
+check_suite.add_checks([checks.VerifyIDXDPOOLTest(),\
+                        ],\
+                       ["N", "nodes", ("incX", "incY"), "FillX", "FillY"],\
+                       [[65536], [2, 3], [(1, 1), (2, 4)], ["rand", "small+grow*big"], ["rand"]])
+
+check_suite.add_checks([checks.VerifyIDXDIOTest(),\
+                        ],\
+                       ["N", "block", "fold", "incX", "FillX"],\
+                       [[0, 1, 4095], [1, 100], folds, [1, 4], ["rand", "small+grow*big"]])
+
+check_suite.add_checks([checks.VerifyILP64Test(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[0, 1, 4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "small+grow*big"], ["rand"]])
+
+check_suite.add_checks([checks.VerifySDSBLAS1Test(),\
+                        checks.VerifySDHBLAS1Test(),\
+                        checks.VerifyDOTFMATest(),\
+                        ],\
+                       ["N", "fold", ("incX", "incY"), "FillX", "FillY"],\
+                       [[0, 1, 4095, 65536], folds, [(1, 1), (2, 4)], ["rand", "2*rand-1", "small+grow*big"], ["rand"]])
+
+check_suite.add_checks([checks.CorroborateCPPTest(),\
+                        ],\
+                       ["N", "incX", "fold"],\
+                       [[0, 1, 255, 4095], incs, folds])
+
 check_harness = harness.Harness("check")
 check_harness.add_suite(check_suite)
 check_harness.run()
@@ -178,6 +178,11 @@ class ValidateInternalDIDDEPOSITTest(CheckTest):
   executable = "tests/checks/validate_internal_daugsum"
   name = "validate_internal_diddeposit"
 
+class ValidateInternalDIDDEPOSITINLINETest(CheckTest):
+  base_flags = "-w diddepositinline"
+  executable = "tests/checks/validate_internal_daugsum"
+  name = "validate_internal_diddepositinline"
+
 class ValidateInternalRZSUMTest(CheckTest):
   base_flags = "-w rzsum"
   executable = "tests/checks/validate_internal_zaugsum"
@@ -253,6 +258,11 @@ class ValidateInternalSISDEPOSITTest(CheckTest):
   executable = "tests/checks/validate_internal_saugsum"
   name = "validate_internal_sisdeposit"
 
+class ValidateInternalSISDEPOSITINLINETest(CheckTest):
+  base_flags = "-w sisdepositinline"
+  executable = "tests/checks/validate_internal_saugsum"
+  name = "validate_internal_sisdepositinline"
+
 class ValidateInternalRCSUMTest(CheckTest):
   base_flags = "-w rcsum"
   executable = "tests/checks/validate_internal_caugsum"
@@ -428,6 +438,11 @@ class VerifyDIDDEPOSITTest(CheckTest):
   executable = "tests/checks/verify_daugsum"
   name = "verify_diddeposit"
 
+class VerifyDIDDEPOSITINLINETest(CheckTest):
+  base_flags = "-w diddepositinline"
+  executable = "tests/checks/verify_daugsum"
+  name = "verify_diddepositinline"
+
 class VerifyRDSUMTest(CheckTest):
   base_flags = "-w rdsum"
   executable = "tests/checks/verify_daugsum"
@@ -503,6 +518,11 @@ class VerifySISDEPOSITTest(CheckTest):
   executable = "tests/checks/verify_saugsum"
   name = "verify_sisdeposit"
 
+class VerifySISDEPOSITINLINETest(CheckTest):
+  base_flags = "-w sisdepositinline"
+  executable = "tests/checks/verify_saugsum"
+  name = "verify_sisdepositinline"
+
 class VerifyRSSUMTest(CheckTest):
   base_flags = "-w rssum"
   executable = "tests/checks/verify_saugsum"
@@ -579,6 +599,102 @@ class VerifySICSSQTest(CheckTest):
   executable = "tests/checks/verify_sicssq"
   name = "verify_sicssq"
 
+class VerifyIDXDSHARDTest(CheckTest):
+  executable = "tests/checks/verify_idxdshard"
+  name = "verify_idxdshard"
+
+class VerifyIDXDPOOLTest(CheckTest):
+  executable = "tests/checks/verify_idxdpool"
+  name = "verify_idxdpool"
+
+class VerifyIDXDIOTest(CheckTest):
+  executable = "tests/checks/verify_idxdio"
+  name = "verify_idxdio"
+
+class VerifyILP64Test(CheckTest):
+  executable = "tests/checks/verify_ilp64"
+  name = "verify_ilp64"
+
+class VerifySDSBLAS1Test(CheckTest):
+  executable = "tests/checks/verify_sdsblas1"
+  name = "verify_sdsblas1"
+
+class VerifySDSBLAS2Test(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_sdsblas2"
+  name = "verify_sdsblas2"
+
+class VerifySDHBLAS1Test(CheckTest):
+  executable = "tests/checks/verify_sdhblas1"
+  name = "verify_sdhblas1"
+
+class VerifyDOTFMATest(CheckTest):
+  executable = "tests/checks/verify_dotfma"
+  name = "verify_dotfma"
+
+class VerifyZPLANARTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_zplanar"
+  name = "verify_zplanar"
+
+class VerifySYRKTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_syrk"
+  name = "verify_syrk"
+
+class VerifyTRSMTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_trsm"
+  name = "verify_trsm"
+
+class VerifyCSRMVTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_csrmv"
+  name = "verify_csrmv"
+
+class VerifyGESUMTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_gesum"
+  name = "verify_gesum"
+
+class VerifyMOMENTSTest(CheckTest):
+  executable = "tests/checks/verify_moments"
+  name = "verify_moments"
+
+class VerifySEGSUMTest(CheckTest):
+  executable = "tests/checks/verify_segsum"
+  name = "verify_segsum"
+
+class VerifySCANTest(CheckTest):
+  executable = "tests/checks/verify_scan"
+  name = "verify_scan"
+
+class VerifyGEMVDOTTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_gemvdot"
+  name = "verify_gemvdot"
+
+class VerifyAXPBYDOTTest(CheckTest):
+  executable = "tests/checks/verify_axpbydot"
+  name = "verify_axpbydot"
+
+class VerifyMDOTTest(CheckTest):
+  executable = "tests/checks/verify_mdot"
+  name = "verify_mdot"
+
+class VerifyPACKEDTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/verify_packed"
+  name = "verify_packed"
+
+class VerifyBOUNDEDTest(CheckTest):
+  executable = "tests/checks/verify_bounded"
+  name = "verify_bounded"
+
+class VerifyIDXDOMPTest(CheckTest):
+  executable = "tests/checks/verify_idxdomp"
+  name = "verify_idxdomp"
+
 class CorroborateRDGEMVTest(CheckTest):
   base_flags = ""
   executable = "tests/checks/corroborate_rdgemv"
@@ -619,6 +735,11 @@ class CorroborateRCGEMMTest(CheckTest):
   executable = "tests/checks/corroborate_rcgemm"
   name = "corroborate_rcgemm"
 
+class CorroborateCPPTest(CheckTest):
+  base_flags = ""
+  executable = "tests/checks/corroborate_cpp"
+  name = "corroborate_cpp"
+
 class ValidateInternalDSCALETest(CheckTest):
   base_flags = ""
   executable = "tests/checks/validate_internal_dscale"
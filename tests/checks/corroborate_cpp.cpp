@@ -0,0 +1,330 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <climits>
+#include <complex>
+#include <vector>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <reproBLAS.hpp>
+
+extern "C" {
+#include "../common/test_opt.h"
+}
+
+static opt_option help;
+static opt_option print;
+static opt_option N;
+static opt_option incX;
+static opt_option fold;
+
+static void corroborate_cpp_options_initialize(void){
+  help._flag.header.type       = opt_flag;
+  help._flag.header.short_name = 'h';
+  help._flag.header.long_name  = (char*)"help";
+  help._flag.header.help       = (char*)"show help";
+
+  print._flag.header.type       = opt_flag;
+  print._flag.header.short_name = 'p';
+  print._flag.header.long_name  = (char*)"print";
+  print._flag.header.help       = (char*)"print parameters but do not execute";
+
+  N._int.header.type       = opt_int;
+  N._int.header.short_name = 'N';
+  N._int.header.long_name  = (char*)"N_dim";
+  N._int.header.help       = (char*)"N dimension size";
+  N._int.required          = 0;
+  N._int.min               = 0;
+  N._int.max               = INT_MAX;
+  N._int.value             = 4096;
+
+  incX._int.header.type       = opt_int;
+  incX._int.header.short_name = '\0';
+  incX._int.header.long_name  = (char*)"incX";
+  incX._int.header.help       = (char*)"X vector increment";
+  incX._int.required          = 0;
+  incX._int.min               = 1;
+  incX._int.max               = INT_MAX;
+  incX._int.value             = 1;
+
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = (char*)"fold";
+  fold._int.header.help       = (char*)"fold (2, 3, 4, or 5)";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = 3;
+}
+
+static double rand_real(double *){
+  return (2.0 * std::rand() / RAND_MAX - 1.0) * std::ldexp(1.0, std::rand() % 40 - 20);
+}
+
+static float rand_real(float *){
+  return (float)((2.0 * std::rand() / RAND_MAX - 1.0) * std::ldexp(1.0, std::rand() % 10 - 5));
+}
+
+template<typename R> static R rand_value(R *){
+  return rand_real((R*)0);
+}
+
+template<typename R> static std::complex<R> rand_value(std::complex<R> *){
+  R re = rand_real((R*)0);
+  R im = rand_real((R*)0);
+  return std::complex<R>(re, im);
+}
+
+//complex scalars are kept on an axis so that the products in the scaling of X
+//and Y are exact, whatever multiply-adds the compiler chose to contract
+template<typename R> static R rand_scalar(R *){
+  return rand_real((R*)0);
+}
+
+template<typename R> static std::complex<R> rand_scalar(std::complex<R> *){
+  R r = rand_real((R*)0);
+  return std::rand() % 2 ? std::complex<R>(r, 0) : std::complex<R>(0, r);
+}
+
+template<typename T> static std::vector<T> rand_vector(int n){
+  std::vector<T> v(n > 0 ? n : 1);
+  int i;
+  for(i = 0; i < n; i++){
+    v[i] = rand_value((T*)0);
+  }
+  return v;
+}
+
+static double c_sum(int fold, int n, const double *X, int incX){
+  return reproBLAS_rdsum(fold, n, X, incX);
+}
+
+static float c_sum(int fold, int n, const float *X, int incX){
+  return reproBLAS_rssum(fold, n, X, incX);
+}
+
+static std::complex<double> c_sum(int fold, int n, const std::complex<double> *X, int incX){
+  std::complex<double> res;
+  reproBLAS_rzsum_sub(fold, n, X, incX, &res);
+  return res;
+}
+
+static std::complex<float> c_sum(int fold, int n, const std::complex<float> *X, int incX){
+  std::complex<float> res;
+  reproBLAS_rcsum_sub(fold, n, X, incX, &res);
+  return res;
+}
+
+static void c_isum(int fold, int n, const double *X, int incX, double *Y){
+  idxdBLAS_didsum(fold, n, X, incX, Y);
+}
+
+static void c_isum(int fold, int n, const float *X, int incX, float *Y){
+  idxdBLAS_sissum(fold, n, X, incX, Y);
+}
+
+static void c_isum(int fold, int n, const std::complex<double> *X, int incX, double *Y){
+  idxdBLAS_zizsum(fold, n, X, incX, Y);
+}
+
+static void c_isum(int fold, int n, const std::complex<float> *X, int incX, float *Y){
+  idxdBLAS_cicsum(fold, n, X, incX, Y);
+}
+
+static double c_dot(int fold, int n, const double *X, int incX, const double *Y, int incY){
+  return reproBLAS_rddot(fold, n, X, incX, Y, incY);
+}
+
+static float c_dot(int fold, int n, const float *X, int incX, const float *Y, int incY){
+  return reproBLAS_rsdot(fold, n, X, incX, Y, incY);
+}
+
+static std::complex<double> c_dot(int fold, int n, const std::complex<double> *X, int incX, const std::complex<double> *Y, int incY){
+  std::complex<double> res;
+  reproBLAS_rzdotu_sub(fold, n, X, incX, Y, incY, &res);
+  return res;
+}
+
+static std::complex<float> c_dot(int fold, int n, const std::complex<float> *X, int incX, const std::complex<float> *Y, int incY){
+  std::complex<float> res;
+  reproBLAS_rcdotu_sub(fold, n, X, incX, Y, incY, &res);
+  return res;
+}
+
+static std::complex<double> c_dotc(int fold, int n, const std::complex<double> *X, int incX, const std::complex<double> *Y, int incY){
+  std::complex<double> res;
+  reproBLAS_rzdotc_sub(fold, n, X, incX, Y, incY, &res);
+  return res;
+}
+
+static std::complex<float> c_dotc(int fold, int n, const std::complex<float> *X, int incX, const std::complex<float> *Y, int incY){
+  std::complex<float> res;
+  reproBLAS_rcdotc_sub(fold, n, X, incX, Y, incY, &res);
+  return res;
+}
+
+static void c_gemv(int fold, char Order, char TransA, int M, int N, double alpha, const double *A, int lda, const double *X, int incX, double beta, double *Y, int incY){
+  reproBLAS_rdgemv(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static void c_gemv(int fold, char Order, char TransA, int M, int N, float alpha, const float *A, int lda, const float *X, int incX, float beta, float *Y, int incY){
+  reproBLAS_rsgemv(fold, Order, TransA, M, N, alpha, A, lda, X, incX, beta, Y, incY);
+}
+
+static void c_gemv(int fold, char Order, char TransA, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int lda, const std::complex<double> *X, int incX, std::complex<double> beta, std::complex<double> *Y, int incY){
+  reproBLAS_rzgemv(fold, Order, TransA, M, N, &alpha, A, lda, X, incX, &beta, Y, incY);
+}
+
+static void c_gemv(int fold, char Order, char TransA, int M, int N, std::complex<float> alpha, const std::complex<float> *A, int lda, const std::complex<float> *X, int incX, std::complex<float> beta, std::complex<float> *Y, int incY){
+  reproBLAS_rcgemv(fold, Order, TransA, M, N, &alpha, A, lda, X, incX, &beta, Y, incY);
+}
+
+template<typename T> static int differ(const T &a, const T &b){
+  return std::memcmp(&a, &b, sizeof(T)) != 0;
+}
+
+template<int Fold, typename T> static int dotc_check(const char *type, int n, int inc, const T *X, const T *Y){
+  (void)type; (void)n; (void)inc; (void)X; (void)Y;
+  return 0;
+}
+
+template<int Fold, typename R> static int dotc_check(const char *type, int n, int inc, const std::complex<R> *X, const std::complex<R> *Y){
+  if(differ(reproBLAS::dotc<Fold>(n, X, inc, Y, inc), c_dotc(Fold, n, X, inc, Y, inc))){
+    printf("reproBLAS::dotc<%d>(%s) differs from the C interface\n", Fold, type);
+    return 1;
+  }
+  return 0;
+}
+
+template<int Fold, typename T> static int gemv_check(const char *type, char Order, char TransA, int M, int N, T alpha, T beta){
+  int lda = (Order == 'r' || Order == 'R') ? N + 3 : M + 3;
+  int opM = (TransA == 'n' || TransA == 'N') ? M : N;
+  int opN = (TransA == 'n' || TransA == 'N') ? N : M;
+  int rows = (Order == 'r' || Order == 'R') ? M : N;
+  std::vector<T> A = rand_vector<T>(rows * lda);
+  std::vector<T> X = rand_vector<T>(opN * 2);
+  std::vector<T> Y = rand_vector<T>(opM * 2);
+  std::vector<T> ref = Y;
+  int i;
+
+  reproBLAS::gemv<Fold>(Order, TransA, M, N, alpha, A.data(), lda, X.data(), 2, beta, Y.data(), 2);
+  c_gemv(Fold, Order, TransA, M, N, alpha, A.data(), lda, X.data(), 2, beta, ref.data(), 2);
+  for(i = 0; i < opM * 2; i++){
+    if(differ(Y[i], ref[i])){
+      printf("reproBLAS::gemv<%d>(%s, Order=%c, TransA=%c, M=%d, N=%d, alpha=%g, beta=%g)[%d] differs from the C interface\n", Fold, type, Order, TransA, M, N, (double)reproBLAS::detail::part(alpha, 0), (double)reproBLAS::detail::part(beta, 0), i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+template<int Fold, typename T> static int type_check(const char *type, int n, int inc){
+  typedef typename reproBLAS::indexed<T, Fold>::real_type R;
+  std::vector<T> X = rand_vector<T>(n * inc);
+  std::vector<T> Y = rand_vector<T>(n * inc);
+  reproBLAS::indexed<T, Fold> IX;
+  std::vector<R> CX(reproBLAS::indexed<T, Fold>::num, R(0));
+  const char Orders[] = {'r', 'c'};
+  const char TransAs[] = {'n', 't', 'c'};
+  int M = n % 61 + 1;
+  int N = n % 67 + 1;
+  int i;
+  int j;
+  int rc = 0;
+
+  if(differ(reproBLAS::sum<Fold>(n, X.data(), inc), c_sum(Fold, n, X.data(), inc))){
+    printf("reproBLAS::sum<%d>(%s) differs from the C interface\n", Fold, type);
+    rc = 1;
+  }
+  reproBLAS::sum(n, X.data(), inc, IX);
+  c_isum(Fold, n, X.data(), inc, CX.data());
+  if(std::memcmp(IX.data(), CX.data(), sizeof(IX)) != 0){
+    printf("reproBLAS::sum<%d>(%s) indexed result differs from the C interface\n", Fold, type);
+    rc = 1;
+  }
+  if(differ(IX.conv(), c_sum(Fold, n, X.data(), inc))){
+    printf("reproBLAS::indexed<%s, %d>::conv() differs from the C interface\n", type, Fold);
+    rc = 1;
+  }
+  if(differ(reproBLAS::dot<Fold>(n, X.data(), inc, Y.data(), inc), c_dot(Fold, n, X.data(), inc, Y.data(), inc))){
+    printf("reproBLAS::dot<%d>(%s) differs from the C interface\n", Fold, type);
+    rc = 1;
+  }
+  rc |= dotc_check<Fold>(type, n, inc, X.data(), Y.data());
+
+  reproBLAS::indexed<T, Fold> IS;
+  reproBLAS::indexed<T, Fold> IH;
+  for(i = 0; i < n; i++){
+    if(i < n / 2){
+      IS += X[i * inc];
+    }else{
+      IH += X[i * inc];
+    }
+  }
+  IS += IH;
+  if(differ(IS.conv(), c_sum(Fold, n, X.data(), inc))){
+    printf("reproBLAS::indexed<%s, %d>::operator+= differs from the C interface\n", type, Fold);
+    rc = 1;
+  }
+
+  for(i = 0; i < 2; i++){
+    for(j = 0; j < 3; j++){
+      //the C interface does not support non-square column major conjugate transposes
+      int Mij = (Orders[i] == 'c' && TransAs[j] == 'c') ? N : M;
+      rc |= gemv_check<Fold>(type, Orders[i], TransAs[j], Mij, N, rand_scalar((T*)0), rand_scalar((T*)0));
+      rc |= gemv_check<Fold>(type, Orders[i], TransAs[j], Mij, N, T(1), T(1));
+      rc |= gemv_check<Fold>(type, Orders[i], TransAs[j], Mij, N, T(1), T(0));
+    }
+  }
+  return rc;
+}
+
+template<int Fold> static int fold_check(int n, int inc){
+  int rc = 0;
+  rc |= type_check<Fold, double>("double", n, inc);
+  rc |= type_check<Fold, float>("float", n, inc);
+  rc |= type_check<Fold, std::complex<double> >("std::complex<double>", n, inc);
+  rc |= type_check<Fold, std::complex<float> >("std::complex<float>", n, inc);
+  return rc;
+}
+
+int main(int argc, char** argv){
+  corroborate_cpp_options_initialize();
+
+  opt_eval_option(argc, argv, &help);
+  if(help._flag.exists){
+    opt_show_option(help);
+    opt_show_option(print);
+    opt_show_option(N);
+    opt_show_option(incX);
+    opt_show_option(fold);
+    return 0;
+  }
+
+  opt_eval_option(argc, argv, &N);
+  opt_eval_option(argc, argv, &incX);
+  opt_eval_option(argc, argv, &fold);
+
+  opt_eval_option(argc, argv, &print);
+  if(print._flag.exists){
+    printf("Corroborate C++ interface results N=%d incX=%d fold=%d\n", N._int.value, incX._int.value, fold._int.value);
+    return 0;
+  }
+
+  std::srand(N._int.value);
+  switch(fold._int.value){
+    case 2:
+      return fold_check<2>(N._int.value, incX._int.value);
+    case 3:
+      return fold_check<3>(N._int.value, incX._int.value);
+    case 4:
+      return fold_check<4>(N._int.value, incX._int.value);
+    case 5:
+      return fold_check<5>(N._int.value, incX._int.value);
+  }
+  printf("ReproBLAS error: fold %d is not instantiated\n", fold._int.value);
+  return 125;
+}
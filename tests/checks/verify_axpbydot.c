@@ -0,0 +1,360 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+//the values of beta tested, with alpha = -1.5 (or -2 + 0.25i). Complex scalars have power of two parts, since the compiler may still fuse the complex products into fmaddsub instructions, and exact products make the update independent of that
+#define NBETAS 3
+static const double betas[NBETAS][2] = {{0.0, 0.0}, {1.0, 0.0}, {0.5, -0.25}};
+
+static opt_option fold;
+
+static void verify_axpbydot_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//results must match bitwise, except that any invalid values are considered equal
+static int dcompare(const char *name, const char *ref, double beta, int n, const double *a, const double *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(double)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s(beta=%g)[%d] = %a != %s = %a\n", name, beta, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const char *ref, double beta, int n, const float *a, const float *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(float)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s(beta=%g)[%d] = %a != %s = %a\n", name, beta, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//reference updates, computed in the same order as the kernels (there is no contraction under -std=c99), so the updated y must match bitwise
+static void daxpby(int N, double alpha, const double *X, int incX, double beta, double *Y, int incY){
+  int i;
+
+  for(i = 0; i < N; i++){
+    if(beta == 0.0){
+      Y[i * incY] = alpha * X[i * incX];
+    }else if(beta == 1.0){
+      Y[i * incY] = alpha * X[i * incX] + Y[i * incY];
+    }else{
+      Y[i * incY] = alpha * X[i * incX] + beta * Y[i * incY];
+    }
+  }
+}
+
+static void saxpby(int N, float alpha, const float *X, int incX, float beta, float *Y, int incY){
+  int i;
+
+  for(i = 0; i < N; i++){
+    if(beta == 0.0){
+      Y[i * incY] = alpha * X[i * incX];
+    }else if(beta == 1.0){
+      Y[i * incY] = alpha * X[i * incX] + Y[i * incY];
+    }else{
+      Y[i * incY] = alpha * X[i * incX] + beta * Y[i * incY];
+    }
+  }
+}
+
+static void zaxpby(int N, const double *alpha, const double *X, int incX, const double *beta, double *Y, int incY){
+  int i;
+  double re;
+  double im;
+
+  for(i = 0; i < N; i++){
+    re = alpha[0] * X[2 * i * incX] - alpha[1] * X[2 * i * incX + 1];
+    im = alpha[0] * X[2 * i * incX + 1] + alpha[1] * X[2 * i * incX];
+    if(beta[0] == 0.0 && beta[1] == 0.0){
+      Y[2 * i * incY] = re;
+      Y[2 * i * incY + 1] = im;
+    }else if(beta[0] == 1.0 && beta[1] == 0.0){
+      Y[2 * i * incY] = re + Y[2 * i * incY];
+      Y[2 * i * incY + 1] = im + Y[2 * i * incY + 1];
+    }else{
+      re = re + (beta[0] * Y[2 * i * incY] - beta[1] * Y[2 * i * incY + 1]);
+      im = im + (beta[0] * Y[2 * i * incY + 1] + beta[1] * Y[2 * i * incY]);
+      Y[2 * i * incY] = re;
+      Y[2 * i * incY + 1] = im;
+    }
+  }
+}
+
+static void caxpby(int N, const float *alpha, const float *X, int incX, const float *beta, float *Y, int incY){
+  int i;
+  float re;
+  float im;
+
+  for(i = 0; i < N; i++){
+    re = alpha[0] * X[2 * i * incX] - alpha[1] * X[2 * i * incX + 1];
+    im = alpha[0] * X[2 * i * incX + 1] + alpha[1] * X[2 * i * incX];
+    if(beta[0] == 0.0 && beta[1] == 0.0){
+      Y[2 * i * incY] = re;
+      Y[2 * i * incY + 1] = im;
+    }else if(beta[0] == 1.0 && beta[1] == 0.0){
+      Y[2 * i * incY] = re + Y[2 * i * incY];
+      Y[2 * i * incY + 1] = im + Y[2 * i * incY + 1];
+    }else{
+      re = re + (beta[0] * Y[2 * i * incY] - beta[1] * Y[2 * i * incY + 1]);
+      im = im + (beta[0] * Y[2 * i * incY + 1] + beta[1] * Y[2 * i * incY]);
+      Y[2 * i * incY] = re;
+      Y[2 * i * incY + 1] = im;
+    }
+  }
+}
+
+int vecvec_fill_show_help(void){
+  verify_axpbydot_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_axpbydot_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify fused axpby and dot fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int b;
+  int default_fold;
+  int sdefault_fold;
+  double alpha = -1.5;
+  double zalpha[2] = {-2.0, 0.25};
+  float salpha = -1.5f;
+  float calpha[2] = {-2.0f, 0.25f};
+  double beta;
+  float sbeta;
+  float cbeta[2];
+  double res[2];
+  double ref[2];
+  float sres[2];
+  float sref[2];
+
+  verify_axpbydot_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+  default_fold = fold._int.value == DIDEFAULTFOLD;
+  sdefault_fold = fold._int.value == SIDEFAULTFOLD;
+
+  double *X = (double*)util_zvec_alloc(N, incX);
+  double *Y = (double*)util_zvec_alloc(N, incY);
+  double *W = (double*)util_zvec_alloc(N, 1);
+  double *YR = (double*)util_zvec_alloc(N, incY);
+  double *YT = (double*)util_zvec_alloc(N, incY);
+  float *SX = (float*)util_cvec_alloc(N, incX);
+  float *SY = (float*)util_cvec_alloc(N, incY);
+  float *SW = (float*)util_cvec_alloc(N, 1);
+  float *SYR = (float*)util_cvec_alloc(N, incY);
+  float *SYT = (float*)util_cvec_alloc(N, incY);
+
+  util_zvec_fill(N, (double complex*)X, incX, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(N, (double complex*)Y, incY, FillY, RealScaleY, ImagScaleY);
+  util_zvec_fill(N, (double complex*)W, 1, util_Vec_Rand, 1.0, 1.0);
+  for(i = 0; i < 2 * N * incX; i++){
+    SX[i] = X[i];
+  }
+  for(i = 0; i < 2 * N * incY; i++){
+    SY[i] = Y[i];
+  }
+  for(i = 0; i < 2 * N; i++){
+    SW[i] = W[i];
+  }
+
+  //each fused function is first run serially, and its updated vector is the reference for the reduction and for the other runs
+  for(b = 0; b < NBETAS; b++){
+    beta = betas[b][0];
+    sbeta = beta;
+    cbeta[0] = betas[b][0];
+    cbeta[1] = betas[b][1];
+
+    //real vectors, using the real parts of the complex ones (with stride 2 * inc)
+    memcpy(YR, Y, 2 * N * incY * sizeof(double));
+    res[0] = reproBLAS_rdaxpbydot(fold._int.value, N, alpha, X, 2 * incX, beta, YR, 2 * incY, W, 2);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    daxpby(N, alpha, X, 2 * incX, beta, YT, 2 * incY);
+    rc |= dcompare("reproBLAS_rdaxpbydot(Y)", "axpby", beta, 2 * N * incY, YR, YT);
+    ref[0] = reproBLAS_rddot(fold._int.value, N, W, 2, YR, 2 * incY);
+    rc |= dcompare("reproBLAS_rdaxpbydot", "reproBLAS_rddot", beta, 1, res, ref);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    res[0] = reproBLAS_rdaxpbydot_64(fold._int.value, N, alpha, X, 2 * incX, beta, YT, 2 * incY, W, 2);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= dcompare("reproBLAS_rdaxpbydot_64(threaded)(Y)", "reproBLAS_rdaxpbydot(Y)", beta, 2 * N * incY, YT, YR);
+    rc |= dcompare("reproBLAS_rdaxpbydot_64(threaded)", "reproBLAS_rddot", beta, 1, res, ref);
+    if(default_fold){
+      memcpy(YT, Y, 2 * N * incY * sizeof(double));
+      res[0] = reproBLAS_daxpbydot(N, alpha, X, 2 * incX, beta, YT, 2 * incY, W, 2);
+      rc |= dcompare("reproBLAS_daxpbydot", "reproBLAS_rddot", beta, 1, res, ref);
+    }
+
+    ref[0] = reproBLAS_rddot(fold._int.value, N, YR, 2 * incY, YR, 2 * incY);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    res[0] = reproBLAS_rdaxpbydot(fold._int.value, N, alpha, X, 2 * incX, beta, YT, 2 * incY, YT, 2 * incY);
+    rc |= dcompare("reproBLAS_rdaxpbydot(W=Y)", "reproBLAS_rddot", beta, 1, res, ref);
+
+    ref[0] = reproBLAS_rdnrm2(fold._int.value, N, YR, 2 * incY);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    res[0] = reproBLAS_rdaxpbynrm2(fold._int.value, N, alpha, X, 2 * incX, beta, YT, 2 * incY);
+    rc |= dcompare("reproBLAS_rdaxpbynrm2(Y)", "reproBLAS_rdaxpbydot(Y)", beta, 2 * N * incY, YT, YR);
+    rc |= dcompare("reproBLAS_rdaxpbynrm2", "reproBLAS_rdnrm2", beta, 1, res, ref);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    res[0] = reproBLAS_rdaxpbynrm2_64(fold._int.value, N, alpha, X, 2 * incX, beta, YT, 2 * incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= dcompare("reproBLAS_rdaxpbynrm2_64(threaded)", "reproBLAS_rdnrm2", beta, 1, res, ref);
+    if(default_fold){
+      memcpy(YT, Y, 2 * N * incY * sizeof(double));
+      res[0] = reproBLAS_daxpbynrm2_64(N, alpha, X, 2 * incX, beta, YT, 2 * incY);
+      rc |= dcompare("reproBLAS_daxpbynrm2_64", "reproBLAS_rdnrm2", beta, 1, res, ref);
+    }
+
+    memcpy(SYR, SY, 2 * N * incY * sizeof(float));
+    sres[0] = reproBLAS_rsaxpbydot(fold._int.value, N, salpha, SX, 2 * incX, sbeta, SYR, 2 * incY, SW, 2);
+    memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+    saxpby(N, salpha, SX, 2 * incX, sbeta, SYT, 2 * incY);
+    rc |= scompare("reproBLAS_rsaxpbydot(Y)", "axpby", beta, 2 * N * incY, SYR, SYT);
+    sref[0] = reproBLAS_rsdot(fold._int.value, N, SW, 2, SYR, 2 * incY);
+    rc |= scompare("reproBLAS_rsaxpbydot", "reproBLAS_rsdot", beta, 1, sres, sref);
+    memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    sres[0] = reproBLAS_rsaxpbydot_64(fold._int.value, N, salpha, SX, 2 * incX, sbeta, SYT, 2 * incY, SW, 2);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= scompare("reproBLAS_rsaxpbydot_64(threaded)(Y)", "reproBLAS_rsaxpbydot(Y)", beta, 2 * N * incY, SYT, SYR);
+    rc |= scompare("reproBLAS_rsaxpbydot_64(threaded)", "reproBLAS_rsdot", beta, 1, sres, sref);
+    if(sdefault_fold){
+      memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+      sres[0] = reproBLAS_saxpbydot_64(N, salpha, SX, 2 * incX, sbeta, SYT, 2 * incY, SW, 2);
+      rc |= scompare("reproBLAS_saxpbydot_64", "reproBLAS_rsdot", beta, 1, sres, sref);
+    }
+    sref[0] = reproBLAS_rsnrm2(fold._int.value, N, SYR, 2 * incY);
+    memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    sres[0] = reproBLAS_rsaxpbynrm2(fold._int.value, N, salpha, SX, 2 * incX, sbeta, SYT, 2 * incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= scompare("reproBLAS_rsaxpbynrm2(threaded)", "reproBLAS_rsnrm2", beta, 1, sres, sref);
+    if(sdefault_fold){
+      memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+      sres[0] = reproBLAS_saxpbynrm2(N, salpha, SX, 2 * incX, sbeta, SYT, 2 * incY);
+      rc |= scompare("reproBLAS_saxpbynrm2", "reproBLAS_rsnrm2", beta, 1, sres, sref);
+    }
+
+    //complex vectors
+    memcpy(YR, Y, 2 * N * incY * sizeof(double));
+    reproBLAS_rzaxpbydotc_sub(fold._int.value, N, zalpha, X, incX, betas[b], YR, incY, W, 1, res);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    zaxpby(N, zalpha, X, incX, betas[b], YT, incY);
+    rc |= dcompare("reproBLAS_rzaxpbydotc_sub(Y)", "axpby", beta, 2 * N * incY, YR, YT);
+    reproBLAS_rzdotc_sub(fold._int.value, N, W, 1, YR, incY, ref);
+    rc |= dcompare("reproBLAS_rzaxpbydotc_sub", "reproBLAS_rzdotc_sub", beta, 2, res, ref);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rzaxpbydotc_sub_64(fold._int.value, N, zalpha, X, incX, betas[b], YT, incY, W, 1, res);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= dcompare("reproBLAS_rzaxpbydotc_sub_64(threaded)(Y)", "reproBLAS_rzaxpbydotc_sub(Y)", beta, 2 * N * incY, YT, YR);
+    rc |= dcompare("reproBLAS_rzaxpbydotc_sub_64(threaded)", "reproBLAS_rzdotc_sub", beta, 2, res, ref);
+    if(default_fold){
+      memcpy(YT, Y, 2 * N * incY * sizeof(double));
+      reproBLAS_zaxpbydotc_sub(N, zalpha, X, incX, betas[b], YT, incY, W, 1, res);
+      rc |= dcompare("reproBLAS_zaxpbydotc_sub", "reproBLAS_rzdotc_sub", beta, 2, res, ref);
+    }
+    ref[0] = reproBLAS_rdznrm2(fold._int.value, N, YR, incY);
+    memcpy(YT, Y, 2 * N * incY * sizeof(double));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    res[0] = reproBLAS_rdzaxpbynrm2(fold._int.value, N, zalpha, X, incX, betas[b], YT, incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= dcompare("reproBLAS_rdzaxpbynrm2(threaded)(Y)", "reproBLAS_rzaxpbydotc_sub(Y)", beta, 2 * N * incY, YT, YR);
+    rc |= dcompare("reproBLAS_rdzaxpbynrm2(threaded)", "reproBLAS_rdznrm2", beta, 1, res, ref);
+    if(default_fold){
+      memcpy(YT, Y, 2 * N * incY * sizeof(double));
+      res[0] = reproBLAS_dzaxpbynrm2(N, zalpha, X, incX, betas[b], YT, incY);
+      rc |= dcompare("reproBLAS_dzaxpbynrm2", "reproBLAS_rdznrm2", beta, 1, res, ref);
+    }
+
+    memcpy(SYR, SY, 2 * N * incY * sizeof(float));
+    reproBLAS_rcaxpbydotc_sub(fold._int.value, N, calpha, SX, incX, cbeta, SYR, incY, SW, 1, sres);
+    memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+    caxpby(N, calpha, SX, incX, cbeta, SYT, incY);
+    rc |= scompare("reproBLAS_rcaxpbydotc_sub(Y)", "axpby", beta, 2 * N * incY, SYR, SYT);
+    reproBLAS_rcdotc_sub(fold._int.value, N, SW, 1, SYR, incY, sref);
+    rc |= scompare("reproBLAS_rcaxpbydotc_sub", "reproBLAS_rcdotc_sub", beta, 2, sres, sref);
+    if(sdefault_fold){
+      memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+      reproBLAS_caxpbydotc_sub_64(N, calpha, SX, incX, cbeta, SYT, incY, SW, 1, sres);
+      rc |= scompare("reproBLAS_caxpbydotc_sub_64", "reproBLAS_rcdotc_sub", beta, 2, sres, sref);
+    }
+    sref[0] = reproBLAS_rscnrm2(fold._int.value, N, SYR, incY);
+    memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    sres[0] = reproBLAS_rscaxpbynrm2_64(fold._int.value, N, calpha, SX, incX, cbeta, SYT, incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= scompare("reproBLAS_rscaxpbynrm2_64(threaded)(Y)", "reproBLAS_rcaxpbydotc_sub(Y)", beta, 2 * N * incY, SYT, SYR);
+    rc |= scompare("reproBLAS_rscaxpbynrm2_64(threaded)", "reproBLAS_rscnrm2", beta, 1, sres, sref);
+    if(sdefault_fold){
+      memcpy(SYT, SY, 2 * N * incY * sizeof(float));
+      sres[0] = reproBLAS_scaxpbynrm2(N, calpha, SX, incX, cbeta, SYT, incY);
+      rc |= scompare("reproBLAS_scaxpbynrm2", "reproBLAS_rscnrm2", beta, 1, sres, sref);
+    }
+  }
+
+  free(X);
+  free(Y);
+  free(W);
+  free(YR);
+  free(YT);
+  free(SX);
+  free(SY);
+  free(SW);
+  free(SYR);
+  free(SYT);
+  return rc;
+}
@@ -0,0 +1,291 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+#define SUM  0
+#define ASUM 1
+#define DOT  2
+static const char *op_names[3] = {"sum", "asum", "dot"};
+
+static opt_option fold;
+
+static void verify_bounded_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//add to Z the sum or absolute sum of X or the dot product of X and Y, using bound if it is not NULL, on 4 threads if threaded
+static void dop(const int op, const int N, const double *X, const int incX, const double *Y, const int incY, const double *bound, const int threaded, double_indexed *Z){
+  idxd_disetzero(fold._int.value, Z);
+  if(threaded){
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+  }
+  switch(op){
+    case SUM:
+      if(bound) idxdBLAS_didsum_bounded_64(fold._int.value, N, X, incX, *bound, Z);
+      else idxdBLAS_didsum(fold._int.value, N, X, incX, Z);
+      break;
+    case ASUM:
+      if(bound) idxdBLAS_didasum_bounded_64(fold._int.value, N, X, incX, *bound, Z);
+      else idxdBLAS_didasum(fold._int.value, N, X, incX, Z);
+      break;
+    default:
+      if(bound) idxdBLAS_diddot_bounded_64(fold._int.value, N, X, incX, Y, incY, *bound, Z);
+      else idxdBLAS_diddot(fold._int.value, N, X, incX, Y, incY, Z);
+      break;
+  }
+  if(threaded){
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  }
+}
+
+static void sop(const int op, const int N, const float *X, const int incX, const float *Y, const int incY, const float *bound, const int threaded, float_indexed *Z){
+  idxd_sisetzero(fold._int.value, Z);
+  if(threaded){
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+  }
+  switch(op){
+    case SUM:
+      if(bound) idxdBLAS_sissum_bounded_64(fold._int.value, N, X, incX, *bound, Z);
+      else idxdBLAS_sissum(fold._int.value, N, X, incX, Z);
+      break;
+    case ASUM:
+      if(bound) idxdBLAS_sisasum_bounded_64(fold._int.value, N, X, incX, *bound, Z);
+      else idxdBLAS_sisasum(fold._int.value, N, X, incX, Z);
+      break;
+    default:
+      if(bound) idxdBLAS_sisdot_bounded_64(fold._int.value, N, X, incX, Y, incY, *bound, Z);
+      else idxdBLAS_sisdot(fold._int.value, N, X, incX, Y, incY, Z);
+      break;
+  }
+  if(threaded){
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  }
+}
+
+//indexed results must match bitwise, except that invalid results are considered equal
+static int dicompare(const char *name, const int op, const double bound, const double_indexed *a, const double_indexed *b){
+  double ra = idxd_ddiconv(fold._int.value, a);
+  double rb = idxd_ddiconv(fold._int.value, b);
+
+  if(memcmp(a, b, idxd_disize(fold._int.value)) != 0 && !(isnan(ra) && isnan(rb))){
+    printf("%s(%s, bound=%a) = %a != %a\n", name, op_names[op], bound, ra, rb);
+    return 1;
+  }
+  return 0;
+}
+
+static int sicompare(const char *name, const int op, const float bound, const float_indexed *a, const float_indexed *b){
+  float ra = idxd_ssiconv(fold._int.value, a);
+  float rb = idxd_ssiconv(fold._int.value, b);
+
+  if(memcmp(a, b, idxd_sisize(fold._int.value)) != 0 && !(isnan(ra) && isnan(rb))){
+    printf("%s(%s, bound=%a) = %a != %a\n", name, op_names[op], bound, ra, rb);
+    return 1;
+  }
+  return 0;
+}
+
+static int dcompare(const char *name, const double a, const double b){
+  if(memcmp(&a, &b, sizeof(double)) != 0 && !(isnan(a) && isnan(b))){
+    printf("%s = %a != %a\n", name, a, b);
+    return 1;
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const float a, const float b){
+  if(memcmp(&a, &b, sizeof(float)) != 0 && !(isnan(a) && isnan(b))){
+    printf("%s = %a != %a\n", name, a, b);
+    return 1;
+  }
+  return 0;
+}
+
+int vecvec_fill_show_help(void){
+  verify_bounded_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_bounded_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify bounded sums fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int op;
+  double amax;
+  double loose;
+  double invalid;
+  float samax;
+  float sloose;
+  float sinvalid;
+
+  verify_bounded_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = (double*)util_dvec_alloc(N, incX);
+  double *Y = (double*)util_dvec_alloc(N, incY);
+  float *SX = (float*)util_svec_alloc(N, incX);
+  float *SY = (float*)util_svec_alloc(N, incY);
+  double_indexed *ref = idxd_dialloc(fold._int.value);
+  double_indexed *res = idxd_dialloc(fold._int.value);
+  float_indexed *sref = idxd_sialloc(fold._int.value);
+  float_indexed *sres = idxd_sialloc(fold._int.value);
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N, Y, incY, FillY, RealScaleY, ImagScaleY);
+  for(i = 0; i < N; i++){
+    SX[i * incX] = X[i * incX];
+    SY[i * incY] = Y[i * incY];
+  }
+
+  for(op = SUM; op <= DOT; op++){
+    dop(op, N, X, incX, Y, incY, NULL, 0, ref);
+    amax = op == DOT ? idxdBLAS_damaxm(N, X, incX, Y, incY) : idxdBLAS_damax(N, X, incX);
+    if(isnan(amax) || isinf(amax)){
+      //infinite bounds are ignored
+      amax = INFINITY;
+      dop(op, N, X, incX, Y, incY, &amax, 0, res);
+      rc |= dicompare("idxdBLAS_did*_bounded_64", op, amax, res, ref);
+      continue;
+    }
+    //the largest power of two multiple of amax in the same bin, and the next one, which is not
+    loose = amax;
+    while(amax > 0.0 && !isinf(loose * 2.0) && idxd_dindex(loose * 2.0) == idxd_dindex(amax)){
+      loose *= 2.0;
+    }
+    invalid = amax > 0.0 ? loose * 2.0 : 1.0;
+
+    dop(op, N, X, incX, Y, incY, &amax, 0, res);
+    rc |= dicompare("idxdBLAS_did*_bounded_64", op, amax, res, ref);
+    dop(op, N, X, incX, Y, incY, &loose, 0, res);
+    rc |= dicompare("idxdBLAS_did*_bounded_64", op, loose, res, ref);
+    dop(op, N, X, incX, Y, incY, &loose, 1, res);
+    rc |= dicompare("idxdBLAS_did*_bounded_64(threaded)", op, loose, res, ref);
+    if(!isinf(invalid) && N > 0){
+      //a checked invalid bound is reported and ignored
+      idxdBLAS_set_check_bounds(1);
+      dop(op, N, X, incX, Y, incY, &loose, 0, res);
+      rc |= dicompare("idxdBLAS_did*_bounded_64(checked)", op, loose, res, ref);
+      dop(op, N, X, incX, Y, incY, &invalid, 0, res);
+      rc |= dicompare("idxdBLAS_did*_bounded_64(checked)", op, invalid, res, ref);
+      idxdBLAS_set_check_bounds(0);
+    }
+
+    switch(op){
+      case SUM:
+        rc |= dcompare("reproBLAS_rdsum_bounded", reproBLAS_rdsum_bounded(fold._int.value, N, X, incX, loose), reproBLAS_rdsum(fold._int.value, N, X, incX));
+        if(fold._int.value == DIDEFAULTFOLD){
+          rc |= dcompare("reproBLAS_dsum_bounded", reproBLAS_dsum_bounded(N, X, incX, loose), reproBLAS_dsum(N, X, incX));
+        }
+        break;
+      case ASUM:
+        rc |= dcompare("reproBLAS_rdasum_bounded", reproBLAS_rdasum_bounded(fold._int.value, N, X, incX, loose), reproBLAS_rdasum(fold._int.value, N, X, incX));
+        if(fold._int.value == DIDEFAULTFOLD){
+          rc |= dcompare("reproBLAS_dasum_bounded", reproBLAS_dasum_bounded(N, X, incX, loose), reproBLAS_dasum(N, X, incX));
+        }
+        break;
+      default:
+        rc |= dcompare("reproBLAS_rddot_bounded", reproBLAS_rddot_bounded(fold._int.value, N, X, incX, Y, incY, loose), reproBLAS_rddot(fold._int.value, N, X, incX, Y, incY));
+        if(fold._int.value == DIDEFAULTFOLD){
+          rc |= dcompare("reproBLAS_ddot_bounded", reproBLAS_ddot_bounded(N, X, incX, Y, incY, loose), reproBLAS_ddot(N, X, incX, Y, incY));
+        }
+        break;
+    }
+  }
+
+  for(op = SUM; op <= DOT; op++){
+    sop(op, N, SX, incX, SY, incY, NULL, 0, sref);
+    samax = op == DOT ? idxdBLAS_samaxm(N, SX, incX, SY, incY) : idxdBLAS_samax(N, SX, incX);
+    if(isnan(samax) || isinf(samax)){
+      samax = INFINITY;
+      sop(op, N, SX, incX, SY, incY, &samax, 0, sres);
+      rc |= sicompare("idxdBLAS_sis*_bounded_64", op, samax, sres, sref);
+      continue;
+    }
+    sloose = samax;
+    while(samax > 0.0 && !isinf(sloose * 2.0f) && idxd_sindex(sloose * 2.0f) == idxd_sindex(samax)){
+      sloose *= 2.0f;
+    }
+    sinvalid = samax > 0.0 ? sloose * 2.0f : 1.0f;
+
+    sop(op, N, SX, incX, SY, incY, &samax, 0, sres);
+    rc |= sicompare("idxdBLAS_sis*_bounded_64", op, samax, sres, sref);
+    sop(op, N, SX, incX, SY, incY, &sloose, 0, sres);
+    rc |= sicompare("idxdBLAS_sis*_bounded_64", op, sloose, sres, sref);
+    sop(op, N, SX, incX, SY, incY, &sloose, 1, sres);
+    rc |= sicompare("idxdBLAS_sis*_bounded_64(threaded)", op, sloose, sres, sref);
+    if(!isinf(sinvalid) && N > 0){
+      idxdBLAS_set_check_bounds(1);
+      sop(op, N, SX, incX, SY, incY, &sloose, 0, sres);
+      rc |= sicompare("idxdBLAS_sis*_bounded_64(checked)", op, sloose, sres, sref);
+      sop(op, N, SX, incX, SY, incY, &sinvalid, 0, sres);
+      rc |= sicompare("idxdBLAS_sis*_bounded_64(checked)", op, sinvalid, sres, sref);
+      idxdBLAS_set_check_bounds(0);
+    }
+
+    switch(op){
+      case SUM:
+        rc |= scompare("reproBLAS_rssum_bounded", reproBLAS_rssum_bounded(fold._int.value, N, SX, incX, sloose), reproBLAS_rssum(fold._int.value, N, SX, incX));
+        if(fold._int.value == SIDEFAULTFOLD){
+          rc |= scompare("reproBLAS_ssum_bounded", reproBLAS_ssum_bounded(N, SX, incX, sloose), reproBLAS_ssum(N, SX, incX));
+        }
+        break;
+      case ASUM:
+        rc |= scompare("reproBLAS_rsasum_bounded", reproBLAS_rsasum_bounded(fold._int.value, N, SX, incX, sloose), reproBLAS_rsasum(fold._int.value, N, SX, incX));
+        if(fold._int.value == SIDEFAULTFOLD){
+          rc |= scompare("reproBLAS_sasum_bounded", reproBLAS_sasum_bounded(N, SX, incX, sloose), reproBLAS_sasum(N, SX, incX));
+        }
+        break;
+      default:
+        rc |= scompare("reproBLAS_rsdot_bounded", reproBLAS_rsdot_bounded(fold._int.value, N, SX, incX, SY, incY, sloose), reproBLAS_rsdot(fold._int.value, N, SX, incX, SY, incY));
+        if(fold._int.value == SIDEFAULTFOLD){
+          rc |= scompare("reproBLAS_sdot_bounded", reproBLAS_sdot_bounded(N, SX, incX, SY, incY, sloose), reproBLAS_sdot(N, SX, incX, SY, incY));
+        }
+        break;
+    }
+  }
+
+  free(X);
+  free(Y);
+  free(SX);
+  free(SY);
+  free(ref);
+  free(res);
+  free(sref);
+  free(sres);
+  return rc;
+}
@@ -0,0 +1,266 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_matvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_csrmv_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const char *ref, const void *a, const void *b, int n, size_t size){
+  if(memcmp(a, b, n * size) != 0){
+    printf("%s != %s\n", name, ref);
+    return 1;
+  }
+  return 0;
+}
+
+int matvec_fill_show_help(void){
+  verify_csrmv_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_csrmv_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify sparse matrix-vector product fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matvec_fill_test(int argc, char** argv, char Order, char TransA, int M, int N, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillX, double RealScaleX, double ImagScaleX, int incX, double RealBeta, double ImagBeta, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int j;
+  int k;
+  int nnz;
+  int trans = !(TransA == 'n' || TransA == 'N');
+  int NX = trans ? M : N;
+  int NY = trans ? N : M;
+  double dot;
+  float sdot;
+  (void)Order;
+  (void)lda;
+  (void)ImagAlpha;
+  (void)ImagBeta;
+
+  verify_csrmv_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  double *A = util_dmat_alloc('r', M, N, N);
+  double *X = util_dvec_alloc(NX, incX);
+  double *Y = util_dvec_alloc(NY, incY);
+  util_dmat_fill('r', 'n', M, N, A, N, FillA, RealScaleA, ImagScaleA);
+  util_dvec_fill(NX, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(NY, Y, incY, FillY, RealScaleY, ImagScaleY);
+
+  //keep about a third of the elements and leave some rows empty
+  for(i = 0; i < M; i++){
+    for(j = 0; j < N; j++){
+      if(i % 11 == 5 || (i * 7 + j * 13) % 3 != 0){
+        A[i * N + j] = 0.0;
+      }
+    }
+  }
+
+  int *rowptr = (int*)malloc((M + 1) * sizeof(int));
+  int *colind = (int*)malloc(M * N * sizeof(int));
+  int *rcolind = (int*)malloc(M * N * sizeof(int));
+  int64_t *rowptr_64 = (int64_t*)malloc((M + 1) * sizeof(int64_t));
+  int64_t *colind_64 = (int64_t*)malloc(M * N * sizeof(int64_t));
+  double *val = (double*)malloc(M * N * sizeof(double));
+  double *rval = (double*)malloc(M * N * sizeof(double));
+  double *rowmax = (double*)malloc(M * sizeof(double));
+  double *rowmax_64 = (double*)malloc(M * sizeof(double));
+  float *sval = (float*)malloc(M * N * sizeof(float));
+  float *srval = (float*)malloc(M * N * sizeof(float));
+  float *srowmax = (float*)malloc(M * sizeof(float));
+  float *SX = (float*)malloc(NX * incX * sizeof(float));
+  float *SY = (float*)malloc(NY * incY * sizeof(float));
+  double *res = (double*)malloc(NY * incY * sizeof(double));
+  double *ref = (double*)malloc(NY * incY * sizeof(double));
+  double *dotA = (double*)malloc(NX * sizeof(double));
+  double *dotX = (double*)malloc(NX * sizeof(double));
+  double_indexed *YI = idxd_dialloc(fold._int.value);
+  float *sres = (float*)malloc(NY * incY * sizeof(float));
+  float *sref = (float*)malloc(NY * incY * sizeof(float));
+  float *sdotA = (float*)malloc(NX * sizeof(float));
+  float *sdotX = (float*)malloc(NX * sizeof(float));
+  float_indexed *SYI = idxd_sialloc(fold._int.value);
+
+  //the matrix is stored with the elements of each row in increasing and in decreasing column order
+  nnz = 0;
+  for(i = 0; i < M; i++){
+    rowptr[i] = nnz;
+    rowptr_64[i] = nnz;
+    for(j = 0; j < N; j++){
+      if(A[i * N + j] != 0.0){
+        nnz++;
+      }
+    }
+    for(j = 0, k = rowptr[i]; j < N; j++){
+      if(A[i * N + j] != 0.0){
+        val[k] = A[i * N + j];
+        colind[k] = j;
+        colind_64[k] = j;
+        rval[nnz - 1 - (k - rowptr[i])] = A[i * N + j];
+        rcolind[nnz - 1 - (k - rowptr[i])] = j;
+        k++;
+      }
+    }
+  }
+  rowptr[M] = nnz;
+  rowptr_64[M] = nnz;
+  for(k = 0; k < nnz; k++){
+    sval[k] = val[k];
+    srval[k] = rval[k];
+  }
+  for(i = 0; i < NX * incX; i++){
+    SX[i] = X[i];
+  }
+  for(i = 0; i < NY * incY; i++){
+    SY[i] = Y[i];
+  }
+
+  idxdBLAS_dcsramax(M, val, rowptr, rowmax);
+  idxdBLAS_dcsramax_64(M, val, rowptr_64, rowmax_64);
+  idxdBLAS_scsramax(M, sval, rowptr, srowmax);
+  rc |= compare("idxdBLAS_dcsramax_64", "idxdBLAS_dcsramax", rowmax_64, rowmax, M, sizeof(double));
+
+  memcpy(ref, Y, NY * incY * sizeof(double));
+  reproBLAS_rdcsrmv(fold._int.value, TransA, M, N, RealAlpha, val, rowptr, colind, NULL, X, incX, RealBeta, ref, incY);
+
+  //the result does not depend on whether the row bounds are cached, on the order of the elements in a row, on the width of the indices or on the number of threads
+  memcpy(res, Y, NY * incY * sizeof(double));
+  reproBLAS_rdcsrmv(fold._int.value, TransA, M, N, RealAlpha, val, rowptr, colind, rowmax, X, incX, RealBeta, res, incY);
+  rc |= compare("reproBLAS_rdcsrmv(rowmax)", "reproBLAS_rdcsrmv", res, ref, NY * incY, sizeof(double));
+  memcpy(res, Y, NY * incY * sizeof(double));
+  reproBLAS_rdcsrmv(fold._int.value, TransA, M, N, RealAlpha, rval, rowptr, rcolind, rowmax, X, incX, RealBeta, res, incY);
+  rc |= compare("reproBLAS_rdcsrmv(reversed rows)", "reproBLAS_rdcsrmv", res, ref, NY * incY, sizeof(double));
+  memcpy(res, Y, NY * incY * sizeof(double));
+  reproBLAS_rdcsrmv_64(fold._int.value, TransA, M, N, RealAlpha, val, rowptr_64, colind_64, rowmax_64, X, incX, RealBeta, res, incY);
+  rc |= compare("reproBLAS_rdcsrmv_64", "reproBLAS_rdcsrmv", res, ref, NY * incY, sizeof(double));
+  if(fold._int.value == DIDEFAULTFOLD){
+    memcpy(res, Y, NY * incY * sizeof(double));
+    reproBLAS_dcsrmv(TransA, M, N, RealAlpha, val, rowptr, colind, rowmax, X, incX, RealBeta, res, incY);
+    rc |= compare("reproBLAS_dcsrmv", "reproBLAS_rdcsrmv", res, ref, NY * incY, sizeof(double));
+  }
+
+  memcpy(sref, SY, NY * incY * sizeof(float));
+  reproBLAS_rscsrmv(fold._int.value, TransA, M, N, RealAlpha, sval, rowptr, colind, NULL, SX, incX, RealBeta, sref, incY);
+  memcpy(sres, SY, NY * incY * sizeof(float));
+  reproBLAS_rscsrmv(fold._int.value, TransA, M, N, RealAlpha, srval, rowptr, rcolind, srowmax, SX, incX, RealBeta, sres, incY);
+  rc |= compare("reproBLAS_rscsrmv(rowmax, reversed rows)", "reproBLAS_rscsrmv", sres, sref, NY * incY, sizeof(float));
+  memcpy(sres, SY, NY * incY * sizeof(float));
+  reproBLAS_rscsrmv_64(fold._int.value, TransA, M, N, RealAlpha, sval, rowptr_64, colind_64, NULL, SX, incX, RealBeta, sres, incY);
+  rc |= compare("reproBLAS_rscsrmv_64", "reproBLAS_rscsrmv", sres, sref, NY * incY, sizeof(float));
+  if(fold._int.value == SIDEFAULTFOLD){
+    memcpy(sres, SY, NY * incY * sizeof(float));
+    reproBLAS_scsrmv(TransA, M, N, RealAlpha, sval, rowptr, colind, srowmax, SX, incX, RealBeta, sres, incY);
+    rc |= compare("reproBLAS_scsrmv", "reproBLAS_rscsrmv", sres, sref, NY * incY, sizeof(float));
+  }
+
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  memcpy(res, Y, NY * incY * sizeof(double));
+  reproBLAS_rdcsrmv(fold._int.value, TransA, M, N, RealAlpha, val, rowptr, colind, rowmax, X, incX, RealBeta, res, incY);
+  rc |= compare("reproBLAS_rdcsrmv(threaded)", "reproBLAS_rdcsrmv", res, ref, NY * incY, sizeof(double));
+  memcpy(sres, SY, NY * incY * sizeof(float));
+  reproBLAS_rscsrmv(fold._int.value, TransA, M, N, RealAlpha, sval, rowptr, colind, srowmax, SX, incX, RealBeta, sres, incY);
+  rc |= compare("reproBLAS_rscsrmv(threaded)", "reproBLAS_rscsrmv", sres, sref, NY * incY, sizeof(float));
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+
+  //each element is the indexed dot product of its row (or, transposed, its column) with alpha*x, whatever the range of x
+  for(i = 0; i < NY; i++){
+    for(j = 0, k = 0; j < NX; j++){
+      if((trans ? A[j * N + i] : A[i * N + j]) != 0.0){
+        dotA[k] = trans ? A[j * N + i] : A[i * N + j];
+        dotX[k] = RealAlpha == 1.0 ? X[j * incX] : X[j * incX] * RealAlpha;
+        sdotA[k] = dotA[k];
+        sdotX[k] = (float)RealAlpha == 1.0f ? SX[j * incX] : SX[j * incX] * (float)RealAlpha;
+        k++;
+      }
+    }
+    if(RealBeta == 0.0){
+      idxd_disetzero(fold._int.value, YI);
+      idxd_sisetzero(fold._int.value, SYI);
+    }else if(RealBeta == 1.0){
+      idxd_didconv(fold._int.value, Y[i * incY], YI);
+      idxd_sisconv(fold._int.value, SY[i * incY], SYI);
+    }else{
+      idxd_didconv(fold._int.value, Y[i * incY] * RealBeta, YI);
+      idxd_sisconv(fold._int.value, SY[i * incY] * (float)RealBeta, SYI);
+    }
+    idxdBLAS_diddot(fold._int.value, k, dotA, 1, dotX, 1, YI);
+    idxdBLAS_sisdot(fold._int.value, k, sdotA, 1, sdotX, 1, SYI);
+    dot = idxd_ddiconv(fold._int.value, YI);
+    sdot = idxd_ssiconv(fold._int.value, SYI);
+    if(memcmp(&dot, ref + i * incY, sizeof(double)) != 0 && !(isnan(dot) && isnan(ref[i * incY]))){
+      printf("reproBLAS_rdcsrmv[%d] = %a != idxdBLAS_diddot = %a\n", i, ref[i * incY], dot);
+      rc = 1;
+      break;
+    }
+    if(memcmp(&sdot, sref + i * incY, sizeof(float)) != 0 && !(isnan(sdot) && isnan(sref[i * incY]))){
+      printf("reproBLAS_rscsrmv[%d] = %a != idxdBLAS_sisdot = %a\n", i, sref[i * incY], sdot);
+      rc = 1;
+      break;
+    }
+  }
+
+  free(A);
+  free(X);
+  free(Y);
+  free(rowptr);
+  free(colind);
+  free(rcolind);
+  free(rowptr_64);
+  free(colind_64);
+  free(val);
+  free(rval);
+  free(rowmax);
+  free(rowmax_64);
+  free(sval);
+  free(srval);
+  free(srowmax);
+  free(SX);
+  free(SY);
+  free(res);
+  free(ref);
+  free(dotA);
+  free(dotX);
+  free(YI);
+  free(sres);
+  free(sref);
+  free(sdotA);
+  free(sdotX);
+  free(SYI);
+
+  return rc;
+}
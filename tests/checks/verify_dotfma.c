@@ -0,0 +1,224 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_dotfma_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const char *ref, const void *a, const void *b, size_t size){
+  if(memcmp(a, b, size) != 0){
+    if(size == sizeof(float)){
+      printf("%s(X, Y) = %a != %s(split(X, Y)) = %a\n", name, *(const float*)a, ref, *(const float*)b);
+    }else if(size == sizeof(double)){
+      printf("%s(X, Y) = %a != %s(split(X, Y)) = %a\n", name, *(const double*)a, ref, *(const double*)b);
+    }else if(size == 2 * sizeof(float)){
+      printf("%s(X, Y) = %a + %ai != %s(split(X, Y)) = %a + %ai\n", name, ((const float*)a)[0], ((const float*)a)[1], ref, ((const float*)b)[0], ((const float*)b)[1]);
+    }else{
+      printf("%s(X, Y) = %a + %ai != %s(split(X, Y)) = %a + %ai\n", name, ((const double*)a)[0], ((const double*)a)[1], ref, ((const double*)b)[0], ((const double*)b)[1]);
+    }
+    return 1;
+  }
+  return 0;
+}
+
+//the rounded product a*b followed by its rounding error
+static void dsplit(double a, double b, double *p, double *e){
+  *p = a * b;
+  *e = isfinite(*p) ? fma(a, b, -*p) : 0.0;
+}
+
+static void ssplit(float a, float b, float *p, float *e){
+  *p = a * b;
+  *e = isfinite(*p) ? fmaf(a, b, -*p) : 0.0f;
+}
+
+//set W to 4 complex numbers per element summing exactly to X[i]*Y[i] (or conj(X[i])*Y[i])
+static void zsplit(int N, const double *X, int incX, const double *Y, int incY, int conj, double *W){
+  int i;
+  double s = conj ? -1.0 : 1.0;
+
+  for(i = 0; i < N; i++){
+    dsplit(X[2 * i * incX], Y[2 * i * incY], W + 8 * i, W + 8 * i + 4);
+    dsplit(X[2 * i * incX], Y[2 * i * incY + 1], W + 8 * i + 1, W + 8 * i + 5);
+    dsplit(-s * X[2 * i * incX + 1], Y[2 * i * incY + 1], W + 8 * i + 2, W + 8 * i + 6);
+    dsplit(s * X[2 * i * incX + 1], Y[2 * i * incY], W + 8 * i + 3, W + 8 * i + 7);
+  }
+}
+
+static void csplit(int N, const float *X, int incX, const float *Y, int incY, int conj, float *W){
+  int i;
+  float s = conj ? -1.0f : 1.0f;
+
+  for(i = 0; i < N; i++){
+    ssplit(X[2 * i * incX], Y[2 * i * incY], W + 8 * i, W + 8 * i + 4);
+    ssplit(X[2 * i * incX], Y[2 * i * incY + 1], W + 8 * i + 1, W + 8 * i + 5);
+    ssplit(-s * X[2 * i * incX + 1], Y[2 * i * incY + 1], W + 8 * i + 2, W + 8 * i + 6);
+    ssplit(s * X[2 * i * incX + 1], Y[2 * i * incY], W + 8 * i + 3, W + 8 * i + 7);
+  }
+}
+
+//compare the FMA dot products to the sums of the exactly split products
+static int check_real(int fold, int N, const double *X, int incX, const double *Y, int incY, const float *SX, const float *SY){
+  int rc = 0;
+  int i;
+  double d;
+  double dref;
+  float s;
+  float sref;
+  double *W = (double*)malloc(2 * N * sizeof(double));
+  float *SW = (float*)malloc(2 * N * sizeof(float));
+
+  for(i = 0; i < N; i++){
+    dsplit(X[i * incX], Y[i * incY], W + i, W + N + i);
+    ssplit(SX[i * incX], SY[i * incY], SW + i, SW + N + i);
+  }
+
+  dref = reproBLAS_rdsum(fold, 2 * N, W, 1);
+  d = reproBLAS_rddot_fma(fold, N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_rddot_fma", "reproBLAS_rdsum", &d, &dref, sizeof(double));
+  d = reproBLAS_rddot_fma_64(fold, N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_rddot_fma_64", "reproBLAS_rdsum", &d, &dref, sizeof(double));
+  sref = reproBLAS_rssum(fold, 2 * N, SW, 1);
+  s = reproBLAS_rsdot_fma(fold, N, SX, incX, SY, incY);
+  rc |= compare("reproBLAS_rsdot_fma", "reproBLAS_rssum", &s, &sref, sizeof(float));
+  s = reproBLAS_rsdot_fma_64(fold, N, SX, incX, SY, incY);
+  rc |= compare("reproBLAS_rsdot_fma_64", "reproBLAS_rssum", &s, &sref, sizeof(float));
+  if(fold == DIDEFAULTFOLD){
+    d = reproBLAS_ddot_fma(N, X, incX, Y, incY);
+    rc |= compare("reproBLAS_ddot_fma", "reproBLAS_rdsum", &d, &dref, sizeof(double));
+    s = reproBLAS_sdot_fma_64(N, SX, incX, SY, incY);
+    rc |= compare("reproBLAS_sdot_fma_64", "reproBLAS_rssum", &s, &sref, sizeof(float));
+  }
+
+  free(W);
+  free(SW);
+  return rc;
+}
+
+static int check_complex(int fold, int N, const double *X, int incX, const double *Y, int incY, const float *SX, const float *SY){
+  int rc = 0;
+  double d[2];
+  double dref[2];
+  float s[2];
+  float sref[2];
+  double *W = (double*)malloc(8 * N * sizeof(double));
+  float *SW = (float*)malloc(8 * N * sizeof(float));
+
+  zsplit(N, X, incX, Y, incY, 0, W);
+  reproBLAS_rzsum_sub(fold, 4 * N, W, 1, dref);
+  reproBLAS_rzdotu_fma_sub(fold, N, X, incX, Y, incY, d);
+  rc |= compare("reproBLAS_rzdotu_fma_sub", "reproBLAS_rzsum_sub", d, dref, 2 * sizeof(double));
+  reproBLAS_rzdotu_fma_sub_64(fold, N, X, incX, Y, incY, d);
+  rc |= compare("reproBLAS_rzdotu_fma_sub_64", "reproBLAS_rzsum_sub", d, dref, 2 * sizeof(double));
+  zsplit(N, X, incX, Y, incY, 1, W);
+  reproBLAS_rzsum_sub(fold, 4 * N, W, 1, dref);
+  reproBLAS_rzdotc_fma_sub(fold, N, X, incX, Y, incY, d);
+  rc |= compare("reproBLAS_rzdotc_fma_sub", "reproBLAS_rzsum_sub", d, dref, 2 * sizeof(double));
+  if(fold == DIDEFAULTFOLD){
+    reproBLAS_zdotc_fma_sub(N, X, incX, Y, incY, d);
+    rc |= compare("reproBLAS_zdotc_fma_sub", "reproBLAS_rzsum_sub", d, dref, 2 * sizeof(double));
+  }
+
+  csplit(N, SX, incX, SY, incY, 0, SW);
+  reproBLAS_rcsum_sub(fold, 4 * N, SW, 1, sref);
+  reproBLAS_rcdotu_fma_sub(fold, N, SX, incX, SY, incY, s);
+  rc |= compare("reproBLAS_rcdotu_fma_sub", "reproBLAS_rcsum_sub", s, sref, 2 * sizeof(float));
+  if(fold == DIDEFAULTFOLD){
+    reproBLAS_cdotu_fma_sub_64(N, SX, incX, SY, incY, s);
+    rc |= compare("reproBLAS_cdotu_fma_sub_64", "reproBLAS_rcsum_sub", s, sref, 2 * sizeof(float));
+  }
+  csplit(N, SX, incX, SY, incY, 1, SW);
+  reproBLAS_rcsum_sub(fold, 4 * N, SW, 1, sref);
+  reproBLAS_rcdotc_fma_sub(fold, N, SX, incX, SY, incY, s);
+  rc |= compare("reproBLAS_rcdotc_fma_sub", "reproBLAS_rcsum_sub", s, sref, 2 * sizeof(float));
+  reproBLAS_rcdotc_fma_sub_64(fold, N, SX, incX, SY, incY, s);
+  rc |= compare("reproBLAS_rcdotc_fma_sub_64", "reproBLAS_rcsum_sub", s, sref, 2 * sizeof(float));
+
+  free(W);
+  free(SW);
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_dotfma_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_dotfma_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify dot products with FMA error-free products fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  double *X;
+  double *Y;
+  float *SX;
+  float *SY;
+  double d;
+  double dref;
+
+  verify_dotfma_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  //complex vectors of length N double as real vectors of length 2 * N
+  X = (double*)util_zvec_alloc(N, incX);
+  Y = (double*)util_zvec_alloc(N, incY);
+  SX = (float*)util_cvec_alloc(N, incX);
+  SY = (float*)util_cvec_alloc(N, incY);
+
+  util_dvec_fill(2 * N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(2 * N, Y, incY, FillY, RealScaleY, ImagScaleY);
+  for(i = 0; i < 2 * N * incX; i++){
+    SX[i] = X[i];
+  }
+  for(i = 0; i < 2 * N * incY; i++){
+    SY[i] = Y[i];
+  }
+
+  rc |= check_real(fold._int.value, N, X, incX, Y, incY, SX, SY);
+  rc |= check_complex(fold._int.value, N, X, incX, Y, incY, SX, SY);
+
+  //the result must not depend on the order of the products
+  dref = reproBLAS_rddot_fma(fold._int.value, N, X, incX, Y, incY);
+  util_dvec_reverse(N, X, incX, NULL, 1);
+  util_dvec_reverse(N, Y, incY, NULL, 1);
+  d = reproBLAS_rddot_fma(fold._int.value, N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_rddot_fma", "reproBLAS_rddot_fma(reversed)", &d, &dref, sizeof(double));
+
+  free(X);
+  free(Y);
+  free(SX);
+  free(SY);
+
+  return rc;
+}
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_matvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_gemvdot_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//the output vectors must match bitwise, and the dot products must match (any invalid values are considered equal)
+static int compare(const char *name, const char *ref, const void *Y, const void *Yref, size_t size, double dot, double dotref){
+  if(memcmp(Y, Yref, size) != 0){
+    printf("%s(Y) != %s(Y)\n", name, ref);
+    return 1;
+  }
+  if(memcmp(&dot, &dotref, sizeof(double)) != 0 && !(isnan(dot) && isnan(dotref))){
+    printf("%s = %a != %s = %a\n", name, dot, ref, dotref);
+    return 1;
+  }
+  return 0;
+}
+
+int matvec_fill_show_help(void){
+  verify_gemvdot_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_gemvdot_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify fused gemv and dot fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matvec_fill_test(int argc, char** argv, char Order, char TransA, int M, int N, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillX, double RealScaleX, double ImagScaleX, int incX, double RealBeta, double ImagBeta, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int trans = !(TransA == 'n' || TransA == 'N');
+  int NX = trans ? M : N;
+  int NY = trans ? N : M;
+  int NM = (Order == 'r' || Order == 'R') ? M * lda : lda * N;
+  double dot;
+  double ref;
+  float sdot;
+  float sref;
+  (void)ImagAlpha;
+  (void)ImagBeta;
+
+  verify_gemvdot_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  double *A = util_dmat_alloc(Order, M, N, lda);
+  double *X = util_dvec_alloc(NX, incX);
+  double *Y = util_dvec_alloc(NY, incY);
+  double *W = util_dvec_alloc(NY, 1);
+  double *res = (double*)malloc(NY * incY * sizeof(double));
+  double *Yref = (double*)malloc(NY * incY * sizeof(double));
+  float *SA = (float*)malloc(NM * sizeof(float));
+  float *SX = (float*)malloc(NX * incX * sizeof(float));
+  float *SY = (float*)malloc(NY * incY * sizeof(float));
+  float *SW = (float*)malloc(NY * sizeof(float));
+  float *sres = (float*)malloc(NY * incY * sizeof(float));
+  float *SYref = (float*)malloc(NY * incY * sizeof(float));
+
+  util_dmat_fill(Order, 'n', M, N, A, lda, FillA, RealScaleA, ImagScaleA);
+  util_dvec_fill(NX, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(NY, Y, incY, FillY, RealScaleY, ImagScaleY);
+  util_dvec_fill(NY, W, 1, util_Vec_Rand, 1.0, 1.0);
+  for(i = 0; i < NM; i++){
+    SA[i] = A[i];
+  }
+  for(i = 0; i < NX * incX; i++){
+    SX[i] = X[i];
+  }
+  for(i = 0; i < NY * incY; i++){
+    SY[i] = Y[i];
+  }
+  for(i = 0; i < NY; i++){
+    SW[i] = W[i];
+  }
+
+  //the reference is a matrix-vector product followed by a dot product with the updated output
+  memcpy(Yref, Y, NY * incY * sizeof(double));
+  reproBLAS_rdgemv(fold._int.value, Order, TransA, M, N, RealAlpha, A, lda, X, incX, RealBeta, Yref, incY);
+  ref = reproBLAS_rddot(fold._int.value, NY, W, 1, Yref, incY);
+
+  memcpy(res, Y, NY * incY * sizeof(double));
+  dot = reproBLAS_rdgemvdot(fold._int.value, Order, TransA, M, N, RealAlpha, A, lda, X, incX, RealBeta, res, incY, W, 1);
+  rc |= compare("reproBLAS_rdgemvdot", "reproBLAS_rddot", res, Yref, NY * incY * sizeof(double), dot, ref);
+
+  memcpy(res, Y, NY * incY * sizeof(double));
+  dot = reproBLAS_rdgemvdot_64(fold._int.value, Order, TransA, M, N, RealAlpha, A, lda, X, incX, RealBeta, res, incY, W, 1);
+  rc |= compare("reproBLAS_rdgemvdot_64", "reproBLAS_rddot", res, Yref, NY * incY * sizeof(double), dot, ref);
+
+  memcpy(res, Y, NY * incY * sizeof(double));
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  dot = reproBLAS_rdgemvdot(fold._int.value, Order, TransA, M, N, RealAlpha, A, lda, X, incX, RealBeta, res, incY, W, 1);
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  rc |= compare("reproBLAS_rdgemvdot(threaded)", "reproBLAS_rddot", res, Yref, NY * incY * sizeof(double), dot, ref);
+
+  if(fold._int.value == DIDEFAULTFOLD){
+    memcpy(res, Y, NY * incY * sizeof(double));
+    dot = reproBLAS_dgemvdot(Order, TransA, M, N, RealAlpha, A, lda, X, incX, RealBeta, res, incY, W, 1);
+    rc |= compare("reproBLAS_dgemvdot", "reproBLAS_rddot", res, Yref, NY * incY * sizeof(double), dot, ref);
+  }
+
+  memcpy(SYref, SY, NY * incY * sizeof(float));
+  reproBLAS_rsgemv(fold._int.value, Order, TransA, M, N, RealAlpha, SA, lda, SX, incX, RealBeta, SYref, incY);
+  sref = reproBLAS_rsdot(fold._int.value, NY, SW, 1, SYref, incY);
+
+  memcpy(sres, SY, NY * incY * sizeof(float));
+  sdot = reproBLAS_rsgemvdot(fold._int.value, Order, TransA, M, N, RealAlpha, SA, lda, SX, incX, RealBeta, sres, incY, SW, 1);
+  rc |= compare("reproBLAS_rsgemvdot", "reproBLAS_rsdot", sres, SYref, NY * incY * sizeof(float), sdot, sref);
+
+  memcpy(sres, SY, NY * incY * sizeof(float));
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  sdot = reproBLAS_rsgemvdot_64(fold._int.value, Order, TransA, M, N, RealAlpha, SA, lda, SX, incX, RealBeta, sres, incY, SW, 1);
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  rc |= compare("reproBLAS_rsgemvdot_64(threaded)", "reproBLAS_rsdot", sres, SYref, NY * incY * sizeof(float), sdot, sref);
+
+  if(fold._int.value == SIDEFAULTFOLD){
+    memcpy(sres, SY, NY * incY * sizeof(float));
+    sdot = reproBLAS_sgemvdot(Order, TransA, M, N, RealAlpha, SA, lda, SX, incX, RealBeta, sres, incY, SW, 1);
+    rc |= compare("reproBLAS_sgemvdot", "reproBLAS_rsdot", sres, SYref, NY * incY * sizeof(float), sdot, sref);
+  }
+
+  free(A);
+  free(X);
+  free(Y);
+  free(W);
+  free(res);
+  free(Yref);
+  free(SA);
+  free(SX);
+  free(SY);
+  free(SW);
+  free(sres);
+  free(SYref);
+
+  return rc;
+}
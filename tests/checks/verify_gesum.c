@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_matvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_gesum_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const char *ref, char Dim, const void *a, const void *b, int n, size_t size){
+  if(memcmp(a, b, n * size) != 0){
+    printf("%s(Dim=%c) != %s\n", name, Dim, ref);
+    return 1;
+  }
+  return 0;
+}
+
+int matvec_fill_show_help(void){
+  verify_gesum_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_gesum_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify row and column reductions fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matvec_fill_test(int argc, char** argv, char Order, char TransA, int M, int N, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillX, double RealScaleX, double ImagScaleX, int incX, double RealBeta, double ImagBeta, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int j;
+  int d;
+  int L;
+  int K;
+  int row = (Order == 'r' || Order == 'R');
+  int NM = row ? M * lda : lda * N;
+  int stride;
+  double tmp;
+  double nrm;
+  char Dims[2] = {'r', 'c'};
+  char Dim;
+  (void)TransA;
+  (void)RealAlpha;
+  (void)ImagAlpha;
+  (void)FillX;
+  (void)RealScaleX;
+  (void)ImagScaleX;
+  (void)incX;
+  (void)RealBeta;
+  (void)ImagBeta;
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+
+  verify_gesum_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  int NY = (M > N ? M : N);
+  double *A = util_dmat_alloc(Order, M, N, lda);
+  float *SA = (float*)malloc(NM * sizeof(float));
+  double *packed = (double*)malloc(M * N * sizeof(double));
+  double *ref = (double*)malloc(NY * incY * sizeof(double));
+  double *res = (double*)malloc(NY * incY * sizeof(double));
+  float *sref = (float*)malloc(NY * incY * sizeof(float));
+  float *sres = (float*)malloc(NY * incY * sizeof(float));
+  util_dmat_fill(Order, 'n', M, N, A, lda, FillA, RealScaleA, ImagScaleA);
+  for(i = 0; i < NM; i++){
+    SA[i] = A[i];
+  }
+
+  for(d = 0; d < 2; d++){
+    Dim = Dims[d];
+    L = Dim == 'r' ? M : N;
+    K = Dim == 'r' ? N : M;
+    //element k of output l is X[l * (contiguous ? lda : 1) + k * stride]
+    stride = (Dim == 'r') == row ? 1 : lda;
+
+    //each element is the same as that of the vector function on its row or column, whatever the number of threads
+    for(i = 0; i < L; i++){
+      ref[i * incY] = reproBLAS_rdsum(fold._int.value, K, A + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rdgesum(fold._int.value, Order, Dim, M, N, A, lda, res, incY);
+    rc |= compare("reproBLAS_rdgesum", "reproBLAS_rdsum", Dim, res, ref, L * incY, sizeof(double));
+    reproBLAS_rdgesum_64(fold._int.value, Order, Dim, M, N, A, lda, res, incY);
+    rc |= compare("reproBLAS_rdgesum_64", "reproBLAS_rdsum", Dim, res, ref, L * incY, sizeof(double));
+
+    for(i = 0; i < L; i++){
+      ref[i * incY] = reproBLAS_rdasum(fold._int.value, K, A + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rdgeasum(fold._int.value, Order, Dim, M, N, A, lda, res, incY);
+    rc |= compare("reproBLAS_rdgeasum", "reproBLAS_rdasum", Dim, res, ref, L * incY, sizeof(double));
+
+    for(i = 0; i < L; i++){
+      ref[i * incY] = reproBLAS_rdnrm2(fold._int.value, K, A + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rdgenrm2(fold._int.value, Order, Dim, M, N, A, lda, res, incY);
+    rc |= compare("reproBLAS_rdgenrm2", "reproBLAS_rdnrm2", Dim, res, ref, L * incY, sizeof(double));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rdgenrm2(fold._int.value, Order, Dim, M, N, A, lda, res, incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= compare("reproBLAS_rdgenrm2(threaded)", "reproBLAS_rdnrm2", Dim, res, ref, L * incY, sizeof(double));
+    if(fold._int.value == DIDEFAULTFOLD){
+      reproBLAS_dgenrm2(Order, Dim, M, N, A, lda, res, incY);
+      rc |= compare("reproBLAS_dgenrm2", "reproBLAS_rdnrm2", Dim, res, ref, L * incY, sizeof(double));
+    }
+
+    for(i = 0; i < L; i++){
+      sref[i * incY] = reproBLAS_rssum(fold._int.value, K, SA + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rsgesum(fold._int.value, Order, Dim, M, N, SA, lda, sres, incY);
+    rc |= compare("reproBLAS_rsgesum", "reproBLAS_rssum", Dim, sres, sref, L * incY, sizeof(float));
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rsgesum(fold._int.value, Order, Dim, M, N, SA, lda, sres, incY);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= compare("reproBLAS_rsgesum(threaded)", "reproBLAS_rssum", Dim, sres, sref, L * incY, sizeof(float));
+
+    for(i = 0; i < L; i++){
+      sref[i * incY] = reproBLAS_rsasum(fold._int.value, K, SA + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rsgeasum(fold._int.value, Order, Dim, M, N, SA, lda, sres, incY);
+    rc |= compare("reproBLAS_rsgeasum", "reproBLAS_rsasum", Dim, sres, sref, L * incY, sizeof(float));
+
+    for(i = 0; i < L; i++){
+      sref[i * incY] = reproBLAS_rsnrm2(fold._int.value, K, SA + i * (stride == 1 ? lda : 1), stride);
+    }
+    reproBLAS_rsgenrm2(fold._int.value, Order, Dim, M, N, SA, lda, sres, incY);
+    rc |= compare("reproBLAS_rsgenrm2", "reproBLAS_rsnrm2", Dim, sres, sref, L * incY, sizeof(float));
+    if(fold._int.value == SIDEFAULTFOLD){
+      reproBLAS_sgenrm2_64(Order, Dim, M, N, SA, lda, sres, incY);
+      rc |= compare("reproBLAS_sgenrm2_64", "reproBLAS_rsnrm2", Dim, sres, sref, L * incY, sizeof(float));
+    }
+
+    //the 1-norm and infinity norm are the largest absolute sums of the columns and rows
+    nrm = 0.0;
+    for(i = 0; i < L; i++){
+      tmp = reproBLAS_rdasum(fold._int.value, K, A + i * (stride == 1 ? lda : 1), stride);
+      nrm = tmp > nrm ? tmp : nrm;
+    }
+    tmp = reproBLAS_rdlange(fold._int.value, Dim == 'r' ? 'i' : '1', Order, M, N, A, lda);
+    if(tmp != nrm){
+      printf("reproBLAS_rdlange(Norm=%c) = %g != %g\n", Dim == 'r' ? 'i' : '1', tmp, nrm);
+      rc = 1;
+    }
+  }
+
+  //the Frobenius norm is the Euclidian norm of the elements of A, and the max norm is their largest absolute value
+  for(i = 0; i < M; i++){
+    for(j = 0; j < N; j++){
+      packed[i * N + j] = row ? A[i * lda + j] : A[j * lda + i];
+    }
+  }
+  nrm = reproBLAS_rdnrm2(fold._int.value, M * N, packed, 1);
+  tmp = reproBLAS_rdlange(fold._int.value, 'f', Order, M, N, A, lda);
+  if(tmp != nrm){
+    printf("reproBLAS_rdlange(Norm=f) = %g != reproBLAS_rdnrm2 = %g\n", tmp, nrm);
+    rc = 1;
+  }
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  tmp = reproBLAS_rdlange_64(fold._int.value, 'F', Order, M, N, A, lda);
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  if(tmp != nrm){
+    printf("reproBLAS_rdlange_64(Norm=F, threaded) = %g != reproBLAS_rdnrm2 = %g\n", tmp, nrm);
+    rc = 1;
+  }
+  if(fold._int.value == DIDEFAULTFOLD){
+    tmp = reproBLAS_dlange('e', Order, M, N, A, lda);
+    if(tmp != nrm){
+      printf("reproBLAS_dlange(Norm=e) = %g != reproBLAS_rdnrm2 = %g\n", tmp, nrm);
+      rc = 1;
+    }
+  }
+  nrm = 0.0;
+  for(i = 0; i < M * N; i++){
+    nrm = fabs(packed[i]) > nrm ? fabs(packed[i]) : nrm;
+  }
+  tmp = reproBLAS_rdlange(fold._int.value, 'm', Order, M, N, A, lda);
+  if(tmp != nrm){
+    printf("reproBLAS_rdlange(Norm=m) = %g != %g\n", tmp, nrm);
+    rc = 1;
+  }
+
+  free(A);
+  free(SA);
+  free(packed);
+  free(ref);
+  free(res);
+  free(sref);
+  free(sres);
+
+  return rc;
+}
@@ -0,0 +1,338 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdIO.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include <sys/mman.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option block;
+static opt_option fold;
+
+static void verify_idxdio_options_initialize(void){
+  block._int.header.type       = opt_int;
+  block._int.header.short_name = 'B';
+  block._int.header.long_name  = "block";
+  block._int.header.help       = "size of blocks stored as indexed partial sums";
+  block._int.required          = 0;
+  block._int.min               = 1;
+  block._int.max               = INT_MAX;
+  block._int.value             = 100;
+
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static const char *type_names[] = {"", "DOUBLE_INDEXED", "DOUBLE_COMPLEX_INDEXED", "FLOAT_INDEXED", "FLOAT_COMPLEX_INDEXED", "DOUBLE_INDEXED_SCALED", "FLOAT_INDEXED_SCALED"};
+
+//compute the indexed partial sums (or scaled sums of squares) of the blocks of X
+static void *partials(idxdIO_type type, int fold, int N, const void *X, int incX, int B, int *count){
+  size_t size = idxdIO_size(type, fold);
+  int nblocks = (N + B - 1) / B;
+  char *P = (char*)calloc(nblocks > 0 ? nblocks : 1, size);
+  int b;
+  int n;
+
+  for(b = 0; b < nblocks; b++){
+    n = N - b * B < B ? N - b * B : B;
+    switch(type){
+      case idxdIO_DOUBLE_INDEXED:
+        idxdBLAS_didsum(fold, n, (const double*)X + b * B * incX, incX, (double_indexed*)(P + b * size));
+        break;
+      case idxdIO_DOUBLE_COMPLEX_INDEXED:
+        idxdBLAS_zizsum(fold, n, (const double complex*)X + b * B * incX, incX, (double_complex_indexed*)(P + b * size));
+        break;
+      case idxdIO_FLOAT_INDEXED:
+        idxdBLAS_sissum(fold, n, (const float*)X + b * B * incX, incX, (float_indexed*)(P + b * size));
+        break;
+      case idxdIO_FLOAT_COMPLEX_INDEXED:
+        idxdBLAS_cicsum(fold, n, (const float complex*)X + b * B * incX, incX, (float_complex_indexed*)(P + b * size));
+        break;
+      case idxdIO_DOUBLE_INDEXED_SCALED:
+        *(double*)(P + b * size) = idxdBLAS_didssq(fold, n, (const double*)X + b * B * incX, incX, 0.0, (double_indexed*)(P + b * size + sizeof(double)));
+        break;
+      case idxdIO_FLOAT_INDEXED_SCALED:
+        *(float*)(P + b * size) = idxdBLAS_sisssq(fold, n, (const float*)X + b * B * incX, incX, 0.0, (float_indexed*)(P + b * size + sizeof(float)));
+        break;
+    }
+  }
+  *count = nblocks;
+  return P;
+}
+
+//merge stored partial sums and compare the result to the reproducible result on the whole vector
+static int merge(idxdIO_type type, int fold, int N, const void *X, int incX, const void *P, int count){
+  size_t size = idxdIO_size(type, fold);
+  char *Y = (char*)calloc(1, size);
+  double d[2];
+  double complex z[2];
+  float s[2];
+  float complex c[2];
+  int i;
+  int rc = 0;
+
+  for(i = 0; i < count; i++){
+    switch(type){
+      case idxdIO_DOUBLE_INDEXED:
+        idxd_didiadd(fold, (const double_indexed*)((const char*)P + i * size), (double_indexed*)Y);
+        break;
+      case idxdIO_DOUBLE_COMPLEX_INDEXED:
+        idxd_ziziadd(fold, (const double_complex_indexed*)((const char*)P + i * size), (double_complex_indexed*)Y);
+        break;
+      case idxdIO_FLOAT_INDEXED:
+        idxd_sisiadd(fold, (const float_indexed*)((const char*)P + i * size), (float_indexed*)Y);
+        break;
+      case idxdIO_FLOAT_COMPLEX_INDEXED:
+        idxd_ciciadd(fold, (const float_complex_indexed*)((const char*)P + i * size), (float_complex_indexed*)Y);
+        break;
+      case idxdIO_DOUBLE_INDEXED_SCALED:
+        *(double*)Y = idxd_didiaddsq(fold, *(const double*)((const char*)P + i * size), (const double_indexed*)((const char*)P + i * size + sizeof(double)), *(double*)Y, (double_indexed*)(Y + sizeof(double)));
+        break;
+      case idxdIO_FLOAT_INDEXED_SCALED:
+        *(float*)Y = idxd_sisiaddsq(fold, *(const float*)((const char*)P + i * size), (const float_indexed*)((const char*)P + i * size + sizeof(float)), *(float*)Y, (float_indexed*)(Y + sizeof(float)));
+        break;
+    }
+  }
+  switch(type){
+    case idxdIO_DOUBLE_INDEXED:
+      d[0] = idxd_ddiconv(fold, (double_indexed*)Y);
+      d[1] = reproBLAS_rdsum(fold, N, (const double*)X, incX);
+      rc = memcmp(&d[0], &d[1], sizeof(double)) != 0;
+      break;
+    case idxdIO_DOUBLE_COMPLEX_INDEXED:
+      idxd_zziconv_sub(fold, (double_complex_indexed*)Y, &z[0]);
+      reproBLAS_rzsum_sub(fold, N, X, incX, &z[1]);
+      rc = memcmp(&z[0], &z[1], sizeof(double complex)) != 0;
+      break;
+    case idxdIO_FLOAT_INDEXED:
+      s[0] = idxd_ssiconv(fold, (float_indexed*)Y);
+      s[1] = reproBLAS_rssum(fold, N, (const float*)X, incX);
+      rc = memcmp(&s[0], &s[1], sizeof(float)) != 0;
+      break;
+    case idxdIO_FLOAT_COMPLEX_INDEXED:
+      idxd_cciconv_sub(fold, (float_complex_indexed*)Y, &c[0]);
+      reproBLAS_rcsum_sub(fold, N, X, incX, &c[1]);
+      rc = memcmp(&c[0], &c[1], sizeof(float complex)) != 0;
+      break;
+    case idxdIO_DOUBLE_INDEXED_SCALED:
+      d[0] = *(double*)Y * sqrt(idxd_ddiconv(fold, (double_indexed*)(Y + sizeof(double))));
+      d[1] = reproBLAS_rdnrm2(fold, N, (const double*)X, incX);
+      rc = memcmp(&d[0], &d[1], sizeof(double)) != 0;
+      break;
+    case idxdIO_FLOAT_INDEXED_SCALED:
+      s[0] = *(float*)Y * sqrtf(idxd_ssiconv(fold, (float_indexed*)(Y + sizeof(float))));
+      s[1] = reproBLAS_rsnrm2(fold, N, (const float*)X, incX);
+      rc = memcmp(&s[0], &s[1], sizeof(float)) != 0;
+      break;
+  }
+  if(rc){
+    printf("merged idxdIO_%s partial sums differ from the reproducible result\n", type_names[type]);
+  }
+  free(Y);
+  return rc;
+}
+
+//store the values as a machine of the other byte order would
+static void *foreign(idxdIO_type type, int fold, const void *P, int count){
+  size_t size = idxdIO_size(type, fold);
+  char *F = (char*)malloc(idxdIO_HEADER_SIZE + count * size);
+  idxdIO_header header;
+
+  idxdIO_header_init(&header, type, fold, count);
+  idxdIO_swap(idxdIO_FLOAT_INDEXED, 4 * sizeof(uint32_t), &header.endian);
+  idxdIO_swap(idxdIO_DOUBLE_INDEXED, 3 * sizeof(uint64_t), &header.count);
+  idxdIO_swap(idxdIO_FLOAT_INDEXED, 4 * sizeof(uint32_t), &header.diwidth);
+  memcpy(F, &header, sizeof(header));
+  memcpy(F + idxdIO_HEADER_SIZE, P, count * size);
+  idxdIO_swap(type, count * size, F + idxdIO_HEADER_SIZE);
+  return F;
+}
+
+//files written by a library built with other bin parameters are rejected
+static int check_params(idxdIO_type type, int fold){
+  idxdIO_header header;
+  idxdIO_header buffer[2];
+  uint32_t *params[4];
+  int i;
+  int rc = 0;
+
+  idxdIO_header_init(&buffer[0], type, fold, 0);
+  params[0] = &buffer[0].diwidth;
+  params[1] = &buffer[0].siwidth;
+  params[2] = &buffer[0].dimaxindex;
+  params[3] = &buffer[0].simaxindex;
+  for(i = 0; i < 4; i++){
+    *params[i] += 1;
+    buffer[1] = buffer[0];
+    if(idxdIO_map(&buffer[1], idxdIO_HEADER_SIZE, &header) != NULL){
+      printf("idxdIO_map(idxdIO_%s) accepted a header with other bin parameters\n", type_names[type]);
+      rc = 1;
+    }
+    *params[i] -= 1;
+  }
+  buffer[1] = buffer[0];
+  if(idxdIO_map(&buffer[1], idxdIO_HEADER_SIZE, &header) == NULL){
+    printf("idxdIO_map(idxdIO_%s) rejected a header with the bin parameters of the library\n", type_names[type]);
+    rc = 1;
+  }
+  return rc;
+}
+
+static int check_stream(idxdIO_type type, int fold, const void *P, int count, const void *raw, const char *mode){
+  size_t size = idxdIO_size(type, fold);
+  FILE *f = tmpfile();
+  idxdIO_header header;
+  char *Q = (char*)malloc(count * size + 1);
+  void *map;
+  size_t length = idxdIO_HEADER_SIZE + count * size;
+  int rc = 0;
+
+  if(f == NULL){
+    printf("could not create a temporary file\n");
+    free(Q);
+    return 1;
+  }
+  if(raw == NULL){
+    rc = idxdIO_write(f, type, fold, count, P);
+  }else{
+    rc = fwrite(raw, length, 1, f) != 1;
+  }
+  fflush(f);
+  rewind(f);
+  if(rc != 0 || idxdIO_read_header(f, &header) != 0 || header.type != (uint32_t)type || header.fold != (uint32_t)fold || header.count != (uint64_t)count || idxdIO_read(f, &header, Q) != 0){
+    printf("idxdIO_read(idxdIO_%s)[%s] failed\n", type_names[type], mode);
+    rc = 1;
+  }else if(memcmp(P, Q, count * size) != 0){
+    printf("idxdIO_read(idxdIO_%s)[%s] differs from the values written\n", type_names[type], mode);
+    rc = 1;
+  }
+
+  //map the file in place
+  if(rc == 0){
+    map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(f), 0);
+    if(map == MAP_FAILED){
+      printf("could not map a temporary file\n");
+      rc = 1;
+    }else{
+      if(idxdIO_map(map, length, &header) != (char*)map + idxdIO_HEADER_SIZE || header.count != (uint64_t)count){
+        printf("idxdIO_map(idxdIO_%s)[%s] failed\n", type_names[type], mode);
+        rc = 1;
+      }else if(memcmp(P, (char*)map + idxdIO_HEADER_SIZE, count * size) != 0){
+        printf("idxdIO_map(idxdIO_%s)[%s] differs from the values written\n", type_names[type], mode);
+        rc = 1;
+      }
+      //a second mapping of a converted buffer is left as is
+      if(rc == 0 && (idxdIO_map(map, length, &header) == NULL || header.endian != idxdIO_ENDIAN || memcmp(P, (char*)map + idxdIO_HEADER_SIZE, count * size) != 0)){
+        printf("idxdIO_map(idxdIO_%s)[%s] converted a buffer twice\n", type_names[type], mode);
+        rc = 1;
+      }
+      //truncated buffers are rejected
+      if(rc == 0 && count > 0 && idxdIO_map(map, length - 1, &header) != NULL){
+        printf("idxdIO_map(idxdIO_%s)[%s] accepted a truncated buffer\n", type_names[type], mode);
+        rc = 1;
+      }
+      munmap(map, length);
+    }
+  }
+  fclose(f);
+  free(Q);
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_idxdio_options_initialize();
+
+  opt_show_option(block);
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_idxdio_options_initialize();
+
+  opt_eval_option(argc, argv, &block);
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify indexed serialization block=%d fold=%d", block._int.value, fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  double *X;
+  double complex *ZX;
+  float *SX;
+  float complex *CX;
+  const void *Xs[7];
+  void *P;
+  void *F;
+  int count;
+  int type;
+
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+
+  verify_idxdio_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &block);
+  opt_eval_option(argc, argv, &fold);
+
+  X = util_dvec_alloc(N, incX);
+  ZX = util_zvec_alloc(N, incX);
+  SX = util_svec_alloc(N, incX);
+  CX = util_cvec_alloc(N, incX);
+
+  util_dvec_fill(N * incX, X, 1, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(N * incX, ZX, 1, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N * incX, SX, 1, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(N * incX, CX, 1, FillX, RealScaleX, ImagScaleX);
+
+  Xs[idxdIO_DOUBLE_INDEXED] = X;
+  Xs[idxdIO_DOUBLE_COMPLEX_INDEXED] = ZX;
+  Xs[idxdIO_FLOAT_INDEXED] = SX;
+  Xs[idxdIO_FLOAT_COMPLEX_INDEXED] = CX;
+  Xs[idxdIO_DOUBLE_INDEXED_SCALED] = X;
+  Xs[idxdIO_FLOAT_INDEXED_SCALED] = SX;
+
+  for(type = idxdIO_DOUBLE_INDEXED; type <= idxdIO_FLOAT_INDEXED_SCALED && rc == 0; type++){
+    P = partials((idxdIO_type)type, fold._int.value, N, Xs[type], incX, block._int.value, &count);
+    rc = merge((idxdIO_type)type, fold._int.value, N, Xs[type], incX, P, count);
+    if(rc == 0){
+      rc = check_params((idxdIO_type)type, fold._int.value);
+    }
+    if(rc == 0){
+      rc = check_stream((idxdIO_type)type, fold._int.value, P, count, NULL, "native");
+    }
+    if(rc == 0){
+      F = foreign((idxdIO_type)type, fold._int.value, P, count);
+      rc = check_stream((idxdIO_type)type, fold._int.value, P, count, F, "foreign");
+      free(F);
+    }
+    free(P);
+  }
+
+  free(X);
+  free(ZX);
+  free(SX);
+  free(CX);
+
+  return rc;
+}
@@ -0,0 +1,170 @@
+#include <idxdOMP.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include <omp.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option max_threads;
+static opt_option fold;
+
+static const int n_schedules = 4;
+static const omp_sched_t schedules[] = {omp_sched_static, omp_sched_static, omp_sched_dynamic, omp_sched_guided};
+static const int chunks[] = {0, 1, 16, 0};
+static const char *schedule_names[] = {"static", "static,1", "dynamic,16", "guided"};
+
+static void verify_idxdomp_options_initialize(void){
+  max_threads._int.header.type       = opt_int;
+  max_threads._int.header.short_name = 'T';
+  max_threads._int.header.long_name  = "threads";
+  max_threads._int.header.help       = "maximum number of threads";
+  max_threads._int.required          = 0;
+  max_threads._int.min               = 1;
+  max_threads._int.max               = INT_MAX;
+  max_threads._int.value             = 8;
+
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+int verify_idxdomp_reproducibility(int fold, int N, double *X, double complex *ZX, float *SX, float complex *CX, int incX, int max_num_threads){
+  int num_threads;
+  int s;
+  int i;
+  double refd = reproBLAS_rdsum(fold, N, X, incX);
+  double complex refz;
+  float refs = reproBLAS_rssum(fold, N, SX, incX);
+  float complex refc;
+  double resd;
+  double complex resz;
+  float ress;
+  float complex resc;
+  idxdOMP_double_indexed YD;
+  idxdOMP_double_complex_indexed YZ;
+  idxdOMP_float_indexed YS;
+  idxdOMP_float_complex_indexed YC;
+
+  reproBLAS_rzsum_sub(fold, N, ZX, incX, &refz);
+  reproBLAS_rcsum_sub(fold, N, CX, incX, &refc);
+
+  for(num_threads = 1; num_threads <= max_num_threads; num_threads *= 2){
+    omp_set_num_threads(num_threads);
+    for(s = 0; s < n_schedules; s++){
+      omp_set_schedule(schedules[s], chunks[s]);
+
+      idxdOMP_disetzero(fold, &YD);
+      idxdOMP_zisetzero(fold, &YZ);
+      idxdOMP_sisetzero(fold, &YS);
+      idxdOMP_cisetzero(fold, &YC);
+      #pragma omp parallel for schedule(runtime) reduction(+:YD, YZ, YS, YC)
+      for(i = 0; i < N; i++){
+        idxdOMP_didadd(X[i * incX], &YD);
+        idxdOMP_zizadd(ZX + i * incX, &YZ);
+        idxdOMP_sisadd(SX[i * incX], &YS);
+        idxdOMP_cicadd(CX + i * incX, &YC);
+      }
+      resd = idxdOMP_ddiconv(&YD);
+      idxdOMP_zziconv_sub(&YZ, &resz);
+      ress = idxdOMP_ssiconv(&YS);
+      idxdOMP_cciconv_sub(&YC, &resc);
+
+      if(memcmp(&resd, &refd, sizeof(resd)) != 0){
+        printf("reduction(+:double_indexed)[num_threads=%d,schedule=%s] = %g != %g\n", num_threads, schedule_names[s], resd, refd);
+        return 1;
+      }
+      if(memcmp(&resz, &refz, sizeof(resz)) != 0){
+        printf("reduction(+:double_complex_indexed)[num_threads=%d,schedule=%s] = %g + %gi != %g + %gi\n", num_threads, schedule_names[s], creal(resz), cimag(resz), creal(refz), cimag(refz));
+        return 1;
+      }
+      if(memcmp(&ress, &refs, sizeof(ress)) != 0){
+        printf("reduction(+:float_indexed)[num_threads=%d,schedule=%s] = %g != %g\n", num_threads, schedule_names[s], ress, refs);
+        return 1;
+      }
+      if(memcmp(&resc, &refc, sizeof(resc)) != 0){
+        printf("reduction(+:float_complex_indexed)[num_threads=%d,schedule=%s] = %g + %gi != %g + %gi\n", num_threads, schedule_names[s], crealf(resc), cimagf(resc), crealf(refc), cimagf(refc));
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int vecvec_fill_show_help(void){
+  verify_idxdomp_options_initialize();
+
+  opt_show_option(max_threads);
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_idxdomp_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify OpenMP indexed reduction reproducibility fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+  int rc = 0;
+
+  verify_idxdomp_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &max_threads);
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = util_dvec_alloc(N, incX);
+  double complex *ZX = util_zvec_alloc(N, incX);
+  float *SX = util_svec_alloc(N, incX);
+  float complex *CX = util_cvec_alloc(N, incX);
+  int *P;
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(N, ZX, incX, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N, SX, incX, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(N, CX, incX, FillX, RealScaleX, ImagScaleX);
+
+  rc = verify_idxdomp_reproducibility(fold._int.value, N, X, ZX, SX, CX, incX, max_threads._int.value);
+  if(rc != 0){
+    return rc;
+  }
+
+  P = util_identity_permutation(N);
+  util_dvec_shuffle(N, X, incX, P, 1);
+  util_zvec_permute(N, ZX, incX, P, 1, NULL, 1);
+  util_svec_permute(N, SX, incX, P, 1, NULL, 1);
+  util_cvec_permute(N, CX, incX, P, 1, NULL, 1);
+  free(P);
+
+  rc = verify_idxdomp_reproducibility(fold._int.value, N, X, ZX, SX, CX, incX, max_threads._int.value);
+  if(rc != 0){
+    return rc;
+  }
+
+  free(X);
+  free(ZX);
+  free(SX);
+  free(CX);
+
+  return rc;
+}
@@ -0,0 +1,433 @@
+#include <idxd.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+#define MAX_RESULTS 64
+#define GEMV_N 16
+#define GEMM_K 16
+#define GEMM_MAXM 64
+#define GEMM_MAXN 512
+
+static opt_option max_threads;
+static opt_option fold;
+static opt_option nodes;
+
+static void verify_idxdpool_options_initialize(void){
+  max_threads._int.header.type       = opt_int;
+  max_threads._int.header.short_name = 'T';
+  max_threads._int.header.long_name  = "threads";
+  max_threads._int.header.help       = "maximum number of threads";
+  max_threads._int.required          = 0;
+  max_threads._int.min               = 1;
+  max_threads._int.max               = INT_MAX;
+  max_threads._int.value             = 8;
+
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+
+  nodes._int.header.type       = opt_int;
+  nodes._int.header.short_name = 'n';
+  nodes._int.header.long_name  = "nodes";
+  nodes._int.header.help       = "number of NUMA nodes to simulate (0 uses the topology of the machine)";
+  nodes._int.required          = 0;
+  nodes._int.min               = 0;
+  nodes._int.max               = 64;
+  nodes._int.value             = 0;
+}
+
+typedef struct {
+  int n;
+  const char *names[MAX_RESULTS];
+  size_t sizes[MAX_RESULTS];
+  void *values[MAX_RESULTS];
+} results;
+
+static void record(results *R, const char *name, const void *value, size_t size){
+  R->names[R->n] = name;
+  R->sizes[R->n] = size;
+  R->values[R->n] = malloc(size);
+  memcpy(R->values[R->n], value, size);
+  R->n++;
+}
+
+static void results_free(results *R){
+  int i;
+  for(i = 0; i < R->n; i++){
+    free(R->values[i]);
+  }
+  R->n = 0;
+}
+
+static int results_compare(const char *mode, int num_threads, results *ref, results *res){
+  int i;
+  for(i = 0; i < ref->n; i++){
+    if(memcmp(ref->values[i], res->values[i], ref->sizes[i]) != 0){
+      printf("%s[%s,num_threads=%d] differs from the single-threaded result\n", ref->names[i], mode, num_threads);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+typedef struct {
+  int fold;
+  int N;
+  double *X;
+  double complex *ZX;
+  float *SX;
+  float complex *CX;
+  int incX;
+  double *Y;
+  double complex *ZY;
+  float *SY;
+  float complex *CY;
+  int incY;
+} problem;
+
+static void compute(problem *P, results *R){
+  int fold = P->fold;
+  int N = P->N;
+  int incX = P->incX;
+  int incY = P->incY;
+  int rows = N * incX / GEMV_N;
+  int gemm_M = rows < GEMM_MAXM ? rows : GEMM_MAXM;
+  int gemm_N = N * incY / GEMM_K < GEMM_MAXN ? N * incY / GEMM_K : GEMM_MAXN;
+  int L = rows > GEMV_N ? rows : GEMV_N;
+  double d;
+  double complex z;
+  float s;
+  float complex c;
+  double *dv = (double*)calloc(L > gemm_M * gemm_N ? L : gemm_M * gemm_N, sizeof(double complex));
+  double complex *zv = (double complex*)dv;
+  float *sv = (float*)dv;
+  float complex *cv = (float complex*)dv;
+  double complex zalpha = 1.0;
+  double complex zbeta = 0.0;
+  float complex calpha = 1.0;
+  float complex cbeta = 0.0;
+  char order;
+  char trans;
+  int j;
+  static const char orders[] = {'r', 'c'};
+  static const char transes[] = {'n', 't'};
+
+  d = reproBLAS_rdsum(fold, N, P->X, incX); record(R, "reproBLAS_rdsum", &d, sizeof(d));
+  d = reproBLAS_rdasum(fold, N, P->X, incX); record(R, "reproBLAS_rdasum", &d, sizeof(d));
+  d = reproBLAS_rdnrm2(fold, N, P->X, incX); record(R, "reproBLAS_rdnrm2", &d, sizeof(d));
+  d = reproBLAS_rddot(fold, N, P->X, incX, P->Y, incY); record(R, "reproBLAS_rddot", &d, sizeof(d));
+  reproBLAS_rzsum_sub(fold, N, P->ZX, incX, &z); record(R, "reproBLAS_rzsum", &z, sizeof(z));
+  d = reproBLAS_rdzasum(fold, N, P->ZX, incX); record(R, "reproBLAS_rdzasum", &d, sizeof(d));
+  d = reproBLAS_rdznrm2(fold, N, P->ZX, incX); record(R, "reproBLAS_rdznrm2", &d, sizeof(d));
+  reproBLAS_rzdotu_sub(fold, N, P->ZX, incX, P->ZY, incY, &z); record(R, "reproBLAS_rzdotu", &z, sizeof(z));
+  reproBLAS_rzdotc_sub(fold, N, P->ZX, incX, P->ZY, incY, &z); record(R, "reproBLAS_rzdotc", &z, sizeof(z));
+  s = reproBLAS_rssum(fold, N, P->SX, incX); record(R, "reproBLAS_rssum", &s, sizeof(s));
+  s = reproBLAS_rsasum(fold, N, P->SX, incX); record(R, "reproBLAS_rsasum", &s, sizeof(s));
+  s = reproBLAS_rsnrm2(fold, N, P->SX, incX); record(R, "reproBLAS_rsnrm2", &s, sizeof(s));
+  s = reproBLAS_rsdot(fold, N, P->SX, incX, P->SY, incY); record(R, "reproBLAS_rsdot", &s, sizeof(s));
+  reproBLAS_rcsum_sub(fold, N, P->CX, incX, &c); record(R, "reproBLAS_rcsum", &c, sizeof(c));
+  s = reproBLAS_rscasum(fold, N, P->CX, incX); record(R, "reproBLAS_rscasum", &s, sizeof(s));
+  s = reproBLAS_rscnrm2(fold, N, P->CX, incX); record(R, "reproBLAS_rscnrm2", &s, sizeof(s));
+  reproBLAS_rcdotu_sub(fold, N, P->CX, incX, P->CY, incY, &c); record(R, "reproBLAS_rcdotu", &c, sizeof(c));
+  reproBLAS_rcdotc_sub(fold, N, P->CX, incX, P->CY, incY, &c); record(R, "reproBLAS_rcdotc", &c, sizeof(c));
+
+  //X is used as a rows by GEMV_N column-major matrix (or a GEMV_N by rows row-major matrix)
+  if(rows > 0){
+    for(j = 0; j < 4; j++){
+      order = orders[j / 2];
+      trans = transes[j % 2];
+      reproBLAS_rdgemv(fold, order, trans, order == 'c' ? rows : GEMV_N, order == 'c' ? GEMV_N : rows, 1.0, P->X, rows, P->Y, 1, 0.0, dv, 1);
+      record(R, "reproBLAS_rdgemv", dv, L * sizeof(double));
+      reproBLAS_rzgemv(fold, order, trans, order == 'c' ? rows : GEMV_N, order == 'c' ? GEMV_N : rows, &zalpha, P->ZX, rows, P->ZY, 1, &zbeta, zv, 1);
+      record(R, "reproBLAS_rzgemv", zv, L * sizeof(double complex));
+      reproBLAS_rsgemv(fold, order, trans, order == 'c' ? rows : GEMV_N, order == 'c' ? GEMV_N : rows, 1.0, P->SX, rows, P->SY, 1, 0.0, sv, 1);
+      record(R, "reproBLAS_rsgemv", sv, L * sizeof(float));
+      reproBLAS_rcgemv(fold, order, trans, order == 'c' ? rows : GEMV_N, order == 'c' ? GEMV_N : rows, &calpha, P->CX, rows, P->CY, 1, &cbeta, cv, 1);
+      record(R, "reproBLAS_rcgemv", cv, L * sizeof(float complex));
+    }
+  }
+
+  //op(A) is the first gemm_M rows of X as a rows by GEMM_K column-major matrix, and op(B) is Y as a GEMM_K by gemm_N column-major matrix
+  if(gemm_M > 0 && gemm_N > 0){
+    for(j = 0; j < 2; j++){
+      order = orders[j];
+      trans = order == 'c' ? 'n' : 't';
+      reproBLAS_rdgemm(fold, order, trans, trans, gemm_M, gemm_N, GEMM_K, 1.0, P->X, rows, P->Y, GEMM_K, 0.0, dv, order == 'c' ? gemm_M : gemm_N);
+      record(R, "reproBLAS_rdgemm", dv, gemm_M * gemm_N * sizeof(double));
+      reproBLAS_rzgemm(fold, order, trans, trans, gemm_M, gemm_N, GEMM_K, &zalpha, P->ZX, rows, P->ZY, GEMM_K, &zbeta, zv, order == 'c' ? gemm_M : gemm_N);
+      record(R, "reproBLAS_rzgemm", zv, gemm_M * gemm_N * sizeof(double complex));
+      reproBLAS_rsgemm(fold, order, trans, trans, gemm_M, gemm_N, GEMM_K, 1.0, P->SX, rows, P->SY, GEMM_K, 0.0, sv, order == 'c' ? gemm_M : gemm_N);
+      record(R, "reproBLAS_rsgemm", sv, gemm_M * gemm_N * sizeof(float));
+      reproBLAS_rcgemm(fold, order, trans, trans, gemm_M, gemm_N, GEMM_K, &calpha, P->CX, rows, P->CY, GEMM_K, &cbeta, cv, order == 'c' ? gemm_M : gemm_N);
+      record(R, "reproBLAS_rcgemm", cv, gemm_M * gemm_N * sizeof(float complex));
+    }
+  }
+  free(dv);
+}
+
+//an executor that runs the tasks backwards on the calling thread
+static void reverse_executor(void *ctx, const int ntasks, idxdPool_task task, void *arg){
+  int t;
+  (void)ctx;
+  for(t = ntasks - 1; t >= 0; t--){
+    task(arg, t);
+  }
+}
+
+typedef struct {
+  problem *P;
+  results R[2];
+} nested_args;
+
+static void nested_task(void *args_, const int t){
+  nested_args *args = (nested_args*)args_;
+  compute(args->P, &args->R[t]);
+}
+
+typedef struct {
+  problem *P;
+  results R;
+  int num_threads;
+} resize_args;
+
+//task 0 runs library routines on the library pool while task 1 keeps replacing the pool
+static void resize_task(void *args_, const int t){
+  resize_args *args = (resize_args*)args_;
+  int in_task;
+  int k;
+
+  if(t == 0){
+    in_task = idxdPool_set_in_task(0);
+    compute(args->P, &args->R);
+    idxdPool_set_in_task(in_task);
+  }else{
+    for(k = 0; k < 16; k++){
+      idxdPool_set_num_threads(1 + k % args->num_threads);
+    }
+  }
+}
+
+//describe a machine with num_nodes NUMA nodes (numbered 1, 3, 5, ... so that real memory is never found on them) that all hold processor 0
+static void simulate_numa(int num_nodes){
+  char dir[64];
+  char path[MAX_LINE];
+  FILE *f;
+  int k;
+
+  snprintf(dir, sizeof(dir), "/tmp/verify_idxdpool.%d", (int)getpid());
+  mkdir(dir, 0700);
+  for(k = 0; k < num_nodes; k++){
+    snprintf(path, MAX_LINE, "%s/node%d", dir, 2 * k + 1);
+    mkdir(path, 0700);
+    snprintf(path, MAX_LINE, "%s/node%d/cpulist", dir, 2 * k + 1);
+    f = fopen(path, "w");
+    if(f != NULL){
+      fprintf(f, "0\n");
+      fclose(f);
+    }
+  }
+  setenv("REPROBLAS_SYSFS_NODE", dir, 1);
+  if(idxdPool_numa_num_nodes() != num_nodes){
+    printf("simulated %d NUMA nodes but found %d\n", num_nodes, idxdPool_numa_num_nodes());
+  }
+  for(k = 0; k < num_nodes; k++){
+    snprintf(path, MAX_LINE, "%s/node%d/cpulist", dir, 2 * k + 1);
+    remove(path);
+    snprintf(path, MAX_LINE, "%s/node%d", dir, 2 * k + 1);
+    remove(path);
+  }
+  remove(dir);
+}
+
+static void *numa_copy(const void *v, size_t size){
+  void *copy = idxdPool_numa_alloc(size);
+  memcpy(copy, v, size);
+  return copy;
+}
+
+int verify_idxdpool_reproducibility(problem *P, int max_num_threads){
+  int rc = 0;
+  int num_threads;
+  results ref;
+  results res;
+  idxdPool *pool;
+  nested_args nested;
+  resize_args resize;
+  problem Q;
+
+  ref.n = 0;
+  res.n = 0;
+
+  idxdPool_set_threshold(INT_MAX);
+  compute(P, &ref);
+  idxdPool_set_threshold(0);
+
+  for(num_threads = 1; num_threads <= max_num_threads && rc == 0; num_threads = num_threads < 4 ? num_threads + 1 : num_threads * 2){
+    idxdPool_set_num_threads(num_threads);
+    compute(P, &res);
+    rc = results_compare("library", num_threads, &ref, &res);
+    results_free(&res);
+
+    if(rc == 0){
+      pool = idxdPool_create(num_threads);
+      idxdPool_share(pool);
+      compute(P, &res);
+      rc = results_compare("shared", num_threads, &ref, &res);
+      results_free(&res);
+      idxdPool_share(NULL);
+
+      //library routines called from tasks run on the calling thread
+      if(rc == 0){
+        nested.P = P;
+        nested.R[0].n = 0;
+        nested.R[1].n = 0;
+        idxdPool_run(pool, 2, nested_task, &nested);
+        rc = results_compare("nested", num_threads, &ref, &nested.R[0]) || results_compare("nested", num_threads, &ref, &nested.R[1]);
+        results_free(&nested.R[0]);
+        results_free(&nested.R[1]);
+      }
+
+      //the library pool may be replaced while library routines run on it
+      if(rc == 0 && num_threads > 1){
+        resize.P = P;
+        resize.R.n = 0;
+        resize.num_threads = num_threads;
+        idxdPool_run(pool, 2, resize_task, &resize);
+        rc = results_compare("resized", num_threads, &ref, &resize.R);
+        results_free(&resize.R);
+        idxdPool_set_num_threads(num_threads);
+      }
+      idxdPool_free(pool);
+    }
+  }
+
+  //vectors spread over the NUMA nodes, summed by pools bound to the nodes
+  Q = *P;
+  Q.X = (double*)numa_copy(P->X, P->N * P->incX * sizeof(double));
+  Q.ZX = (double complex*)numa_copy(P->ZX, P->N * P->incX * sizeof(double complex));
+  Q.SX = (float*)numa_copy(P->SX, P->N * P->incX * sizeof(float));
+  Q.CX = (float complex*)numa_copy(P->CX, P->N * P->incX * sizeof(float complex));
+  Q.Y = (double*)numa_copy(P->Y, P->N * P->incY * sizeof(double));
+  Q.ZY = (double complex*)numa_copy(P->ZY, P->N * P->incY * sizeof(double complex));
+  Q.SY = (float*)numa_copy(P->SY, P->N * P->incY * sizeof(float));
+  Q.CY = (float complex*)numa_copy(P->CY, P->N * P->incY * sizeof(float complex));
+  for(num_threads = 1; num_threads <= max_num_threads && rc == 0; num_threads = num_threads < 4 ? num_threads + 1 : num_threads * 2){
+    pool = idxdPool_create(num_threads);
+    idxdPool_bind_numa(pool);
+    idxdPool_share(pool);
+    compute(&Q, &res);
+    rc = results_compare("numa", num_threads, &ref, &res);
+    results_free(&res);
+    idxdPool_share(NULL);
+    idxdPool_free(pool);
+  }
+  idxdPool_numa_free(Q.X);
+  idxdPool_numa_free(Q.ZX);
+  idxdPool_numa_free(Q.SX);
+  idxdPool_numa_free(Q.CX);
+  idxdPool_numa_free(Q.Y);
+  idxdPool_numa_free(Q.ZY);
+  idxdPool_numa_free(Q.SY);
+  idxdPool_numa_free(Q.CY);
+
+  if(rc == 0){
+    idxdPool_set_executor(reverse_executor, NULL);
+    compute(P, &res);
+    rc = results_compare("executor", 1, &ref, &res);
+    results_free(&res);
+    idxdPool_set_executor(NULL, NULL);
+  }
+
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  results_free(&ref);
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_idxdpool_options_initialize();
+
+  opt_show_option(max_threads);
+  opt_show_option(fold);
+  opt_show_option(nodes);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_idxdpool_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &nodes);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify thread pool reproducibility fold=%d nodes=%d", fold._int.value, nodes._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  problem P;
+
+  verify_idxdpool_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &max_threads);
+  opt_eval_option(argc, argv, &fold);
+  opt_eval_option(argc, argv, &nodes);
+
+  if(nodes._int.value > 0){
+    simulate_numa(nodes._int.value);
+  }
+
+  P.fold = fold._int.value;
+  P.N = N;
+  P.incX = incX;
+  P.incY = incY;
+  P.X = util_dvec_alloc(N, incX);
+  P.ZX = util_zvec_alloc(N, incX);
+  P.SX = util_svec_alloc(N, incX);
+  P.CX = util_cvec_alloc(N, incX);
+  P.Y = util_dvec_alloc(N, incY);
+  P.ZY = util_zvec_alloc(N, incY);
+  P.SY = util_svec_alloc(N, incY);
+  P.CY = util_cvec_alloc(N, incY);
+
+  util_dvec_fill(N * incX, P.X, 1, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(N * incX, P.ZX, 1, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N * incX, P.SX, 1, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(N * incX, P.CX, 1, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N * incY, P.Y, 1, FillY, RealScaleY, ImagScaleY);
+  util_zvec_fill(N * incY, P.ZY, 1, FillY, RealScaleY, ImagScaleY);
+  util_svec_fill(N * incY, P.SY, 1, FillY, RealScaleY, ImagScaleY);
+  util_cvec_fill(N * incY, P.CY, 1, FillY, RealScaleY, ImagScaleY);
+
+  rc = verify_idxdpool_reproducibility(&P, max_threads._int.value);
+
+  free(P.X);
+  free(P.ZX);
+  free(P.SX);
+  free(P.CX);
+  free(P.Y);
+  free(P.ZY);
+  free(P.SY);
+  free(P.CY);
+
+  return rc;
+}
@@ -0,0 +1,230 @@
+#include <idxdShard.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option max_shards;
+static opt_option block;
+static opt_option fold;
+
+static void verify_idxdshard_options_initialize(void){
+  max_shards._int.header.type       = opt_int;
+  max_shards._int.header.short_name = 'S';
+  max_shards._int.header.long_name  = "shards";
+  max_shards._int.header.help       = "maximum number of shards";
+  max_shards._int.required          = 0;
+  max_shards._int.min               = 1;
+  max_shards._int.max               = INT_MAX;
+  max_shards._int.value             = 16;
+
+  block._int.header.type       = opt_int;
+  block._int.header.short_name = 'B';
+  block._int.header.long_name  = "block";
+  block._int.header.help       = "size of blocks added as indexed partial sums";
+  block._int.required          = 0;
+  block._int.min               = 1;
+  block._int.max               = INT_MAX;
+  block._int.value             = 100;
+
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int check_results(const char *method, int nshards, idxdShard_double_indexed *YD, idxdShard_double_complex_indexed *YZ, idxdShard_float_indexed *YS, idxdShard_float_complex_indexed *YC, double refd, double complex refz, float refs, float complex refc){
+  double resd = idxdShard_ddiconv(YD);
+  double complex resz;
+  float ress = idxdShard_ssiconv(YS);
+  float complex resc;
+
+  idxdShard_zziconv_sub(YZ, &resz);
+  idxdShard_cciconv_sub(YC, &resc);
+
+  if(memcmp(&resd, &refd, sizeof(resd)) != 0){
+    printf("idxdShard_didadd(X)[%s,nshards=%d] = %g != %g\n", method, nshards, resd, refd);
+    return 1;
+  }
+  if(memcmp(&resz, &refz, sizeof(resz)) != 0){
+    printf("idxdShard_zizadd(X)[%s,nshards=%d] = %g + %gi != %g + %gi\n", method, nshards, creal(resz), cimag(resz), creal(refz), cimag(refz));
+    return 1;
+  }
+  if(memcmp(&ress, &refs, sizeof(ress)) != 0){
+    printf("idxdShard_sisadd(X)[%s,nshards=%d] = %g != %g\n", method, nshards, ress, refs);
+    return 1;
+  }
+  if(memcmp(&resc, &refc, sizeof(resc)) != 0){
+    printf("idxdShard_cicadd(X)[%s,nshards=%d] = %g + %gi != %g + %gi\n", method, nshards, crealf(resc), cimagf(resc), crealf(refc), cimagf(refc));
+    return 1;
+  }
+  return 0;
+}
+
+int verify_idxdshard_reproducibility(int fold, int N, double *X, double complex *ZX, float *SX, float complex *CX, int incX, int max_num_shards, int block_N){
+  int rc = 0;
+  int nshards;
+  int shard;
+  int i;
+  int j;
+  int n;
+  double refd = reproBLAS_rdsum(fold, N, X, incX);
+  double complex refz;
+  float refs = reproBLAS_rssum(fold, N, SX, incX);
+  float complex refc;
+  double_indexed *ID = idxd_dialloc(fold);
+  double_complex_indexed *IZ = idxd_zialloc(fold);
+  float_indexed *IS = idxd_sialloc(fold);
+  float_complex_indexed *IC = idxd_cialloc(fold);
+
+  reproBLAS_rzsum_sub(fold, N, ZX, incX, &refz);
+  reproBLAS_rcsum_sub(fold, N, CX, incX, &refc);
+
+  for(nshards = 1; nshards <= max_num_shards && rc == 0; nshards *= 2){
+    idxdShard_double_indexed *YD = idxdShard_dialloc(fold, nshards);
+    idxdShard_double_complex_indexed *YZ = idxdShard_zialloc(fold, nshards);
+    idxdShard_float_indexed *YS = idxdShard_sialloc(fold, nshards);
+    idxdShard_float_complex_indexed *YC = idxdShard_cialloc(fold, nshards);
+
+    //elements to random shards
+    for(i = 0; i < N; i++){
+      shard = rand() % nshards;
+      idxdShard_didadd(YD, shard, X[i * incX]);
+      idxdShard_zizadd(YZ, shard, ZX + i * incX);
+      idxdShard_sisadd(YS, shard, SX[i * incX]);
+      idxdShard_cicadd(YC, shard, CX + i * incX);
+    }
+    rc = check_results("random", nshards, YD, YZ, YS, YC, refd, refz, refs, refc);
+
+    //blocks of elements and indexed partial sums to random shards
+    if(rc == 0){
+      idxdShard_setzero(YD);
+      idxdShard_setzero(YZ);
+      idxdShard_setzero(YS);
+      idxdShard_setzero(YC);
+      for(i = 0; i < N; i += block_N){
+        n = block_N < N - i ? block_N : N - i;
+        shard = rand() % nshards;
+        if(rand() % 2){
+          idxd_disetzero(fold, ID);
+          idxd_zisetzero(fold, IZ);
+          idxd_sisetzero(fold, IS);
+          idxd_cisetzero(fold, IC);
+          idxdBLAS_didsum(fold, n, X + i * incX, incX, ID);
+          idxdBLAS_zizsum(fold, n, ZX + i * incX, incX, IZ);
+          idxdBLAS_sissum(fold, n, SX + i * incX, incX, IS);
+          idxdBLAS_cicsum(fold, n, CX + i * incX, incX, IC);
+          idxdShard_didiadd(YD, shard, ID);
+          idxdShard_ziziadd(YZ, shard, IZ);
+          idxdShard_sisiadd(YS, shard, IS);
+          idxdShard_ciciadd(YC, shard, IC);
+        }else{
+          for(j = i; j < i + n; j++){
+            idxdShard_didadd(YD, shard, X[j * incX]);
+            idxdShard_zizadd(YZ, shard, ZX + j * incX);
+            idxdShard_sisadd(YS, shard, SX[j * incX]);
+            idxdShard_cicadd(YC, shard, CX + j * incX);
+          }
+        }
+      }
+      rc = check_results("blocks", nshards, YD, YZ, YS, YC, refd, refz, refs, refc);
+    }
+
+#ifdef _OPENMP
+    //concurrent threads, one shard each
+    if(rc == 0){
+      idxdShard_setzero(YD);
+      idxdShard_setzero(YZ);
+      idxdShard_setzero(YS);
+      idxdShard_setzero(YC);
+      #pragma omp parallel for num_threads(nshards) schedule(dynamic, 7)
+      for(i = 0; i < N; i++){
+        idxdShard_didadd(YD, omp_get_thread_num(), X[i * incX]);
+        idxdShard_zizadd(YZ, omp_get_thread_num(), ZX + i * incX);
+        idxdShard_sisadd(YS, omp_get_thread_num(), SX[i * incX]);
+        idxdShard_cicadd(YC, omp_get_thread_num(), CX + i * incX);
+      }
+      rc = check_results("threads", nshards, YD, YZ, YS, YC, refd, refz, refs, refc);
+    }
+#endif
+
+    idxdShard_free(YD);
+    idxdShard_free(YZ);
+    idxdShard_free(YS);
+    idxdShard_free(YC);
+  }
+
+  free(ID);
+  free(IZ);
+  free(IS);
+  free(IC);
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_idxdshard_options_initialize();
+
+  opt_show_option(max_shards);
+  opt_show_option(block);
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_idxdshard_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify sharded indexed accumulator reproducibility fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+  int rc = 0;
+
+  verify_idxdshard_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &max_shards);
+  opt_eval_option(argc, argv, &block);
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = util_dvec_alloc(N, incX);
+  double complex *ZX = util_zvec_alloc(N, incX);
+  float *SX = util_svec_alloc(N, incX);
+  float complex *CX = util_cvec_alloc(N, incX);
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(N, ZX, incX, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N, SX, incX, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(N, CX, incX, FillX, RealScaleX, ImagScaleX);
+
+  rc = verify_idxdshard_reproducibility(fold._int.value, N, X, ZX, SX, CX, incX, max_shards._int.value, block._int.value);
+
+  free(X);
+  free(ZX);
+  free(SX);
+  free(CX);
+
+  return rc;
+}
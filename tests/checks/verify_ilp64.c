@@ -0,0 +1,351 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_ilp64_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const void *a, const void *b, size_t size){
+  if(memcmp(a, b, size) != 0){
+    printf("%s_64 differs from %s\n", name, name);
+    return 1;
+  }
+  return 0;
+}
+
+//compare the 64-bit vector routines to the 32-bit ones
+static int check_vector(int fold, int N, const double *X, const double complex *ZX, const float *SX, const float complex *CX, int incX, const double *Y, const double complex *ZY, const float *SY, const float complex *CY, int incY){
+  int rc = 0;
+  double d[2];
+  double d64[2];
+  float s[2];
+  float s64[2];
+
+  d[0] = reproBLAS_rdsum(fold, N, X, incX);
+  d64[0] = reproBLAS_rdsum_64(fold, N, X, incX);
+  rc |= compare("reproBLAS_rdsum", d, d64, sizeof(double));
+  d[0] = reproBLAS_rdasum(fold, N, X, incX);
+  d64[0] = reproBLAS_rdasum_64(fold, N, X, incX);
+  rc |= compare("reproBLAS_rdasum", d, d64, sizeof(double));
+  d[0] = reproBLAS_rdnrm2(fold, N, X, incX);
+  d64[0] = reproBLAS_rdnrm2_64(fold, N, X, incX);
+  rc |= compare("reproBLAS_rdnrm2", d, d64, sizeof(double));
+  d[0] = reproBLAS_rddot(fold, N, X, incX, Y, incY);
+  d64[0] = reproBLAS_rddot_64(fold, N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_rddot", d, d64, sizeof(double));
+  d[0] = reproBLAS_ddot(N, X, incX, Y, incY);
+  d64[0] = reproBLAS_ddot_64(N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_ddot", d, d64, sizeof(double));
+  d[0] = idxdBLAS_damax(N, X, incX);
+  d64[0] = idxdBLAS_damax_64(N, X, incX);
+  rc |= compare("idxdBLAS_damax", d, d64, sizeof(double));
+  d[0] = idxdBLAS_damaxm(N, X, incX, Y, incY);
+  d64[0] = idxdBLAS_damaxm_64(N, X, incX, Y, incY);
+  rc |= compare("idxdBLAS_damaxm", d, d64, sizeof(double));
+
+  reproBLAS_rzsum_sub(fold, N, ZX, incX, d);
+  reproBLAS_rzsum_sub_64(fold, N, ZX, incX, d64);
+  rc |= compare("reproBLAS_rzsum_sub", d, d64, 2 * sizeof(double));
+  d[0] = reproBLAS_rdzasum(fold, N, ZX, incX);
+  d64[0] = reproBLAS_rdzasum_64(fold, N, ZX, incX);
+  rc |= compare("reproBLAS_rdzasum", d, d64, sizeof(double));
+  d[0] = reproBLAS_rdznrm2(fold, N, ZX, incX);
+  d64[0] = reproBLAS_rdznrm2_64(fold, N, ZX, incX);
+  rc |= compare("reproBLAS_rdznrm2", d, d64, sizeof(double));
+  reproBLAS_rzdotu_sub(fold, N, ZX, incX, ZY, incY, d);
+  reproBLAS_rzdotu_sub_64(fold, N, ZX, incX, ZY, incY, d64);
+  rc |= compare("reproBLAS_rzdotu_sub", d, d64, 2 * sizeof(double));
+  reproBLAS_rzdotc_sub(fold, N, ZX, incX, ZY, incY, d);
+  reproBLAS_rzdotc_sub_64(fold, N, ZX, incX, ZY, incY, d64);
+  rc |= compare("reproBLAS_rzdotc_sub", d, d64, 2 * sizeof(double));
+  idxdBLAS_zamax_sub(N, ZX, incX, d);
+  idxdBLAS_zamax_sub_64(N, ZX, incX, d64);
+  rc |= compare("idxdBLAS_zamax_sub", d, d64, 2 * sizeof(double));
+  idxdBLAS_zamaxm_sub(N, ZX, incX, ZY, incY, d);
+  idxdBLAS_zamaxm_sub_64(N, ZX, incX, ZY, incY, d64);
+  rc |= compare("idxdBLAS_zamaxm_sub", d, d64, 2 * sizeof(double));
+
+  s[0] = reproBLAS_rssum(fold, N, SX, incX);
+  s64[0] = reproBLAS_rssum_64(fold, N, SX, incX);
+  rc |= compare("reproBLAS_rssum", s, s64, sizeof(float));
+  s[0] = reproBLAS_rsasum(fold, N, SX, incX);
+  s64[0] = reproBLAS_rsasum_64(fold, N, SX, incX);
+  rc |= compare("reproBLAS_rsasum", s, s64, sizeof(float));
+  s[0] = reproBLAS_rsnrm2(fold, N, SX, incX);
+  s64[0] = reproBLAS_rsnrm2_64(fold, N, SX, incX);
+  rc |= compare("reproBLAS_rsnrm2", s, s64, sizeof(float));
+  s[0] = reproBLAS_rsdot(fold, N, SX, incX, SY, incY);
+  s64[0] = reproBLAS_rsdot_64(fold, N, SX, incX, SY, incY);
+  rc |= compare("reproBLAS_rsdot", s, s64, sizeof(float));
+  s[0] = idxdBLAS_samax(N, SX, incX);
+  s64[0] = idxdBLAS_samax_64(N, SX, incX);
+  rc |= compare("idxdBLAS_samax", s, s64, sizeof(float));
+  s[0] = idxdBLAS_samaxm(N, SX, incX, SY, incY);
+  s64[0] = idxdBLAS_samaxm_64(N, SX, incX, SY, incY);
+  rc |= compare("idxdBLAS_samaxm", s, s64, sizeof(float));
+
+  reproBLAS_rcsum_sub(fold, N, CX, incX, s);
+  reproBLAS_rcsum_sub_64(fold, N, CX, incX, s64);
+  rc |= compare("reproBLAS_rcsum_sub", s, s64, 2 * sizeof(float));
+  s[0] = reproBLAS_rscasum(fold, N, CX, incX);
+  s64[0] = reproBLAS_rscasum_64(fold, N, CX, incX);
+  rc |= compare("reproBLAS_rscasum", s, s64, sizeof(float));
+  s[0] = reproBLAS_rscnrm2(fold, N, CX, incX);
+  s64[0] = reproBLAS_rscnrm2_64(fold, N, CX, incX);
+  rc |= compare("reproBLAS_rscnrm2", s, s64, sizeof(float));
+  reproBLAS_rcdotu_sub(fold, N, CX, incX, CY, incY, s);
+  reproBLAS_rcdotu_sub_64(fold, N, CX, incX, CY, incY, s64);
+  rc |= compare("reproBLAS_rcdotu_sub", s, s64, 2 * sizeof(float));
+  reproBLAS_rcdotc_sub(fold, N, CX, incX, CY, incY, s);
+  reproBLAS_rcdotc_sub_64(fold, N, CX, incX, CY, incY, s64);
+  rc |= compare("reproBLAS_rcdotc_sub", s, s64, 2 * sizeof(float));
+  idxdBLAS_camax_sub(N, CX, incX, s);
+  idxdBLAS_camax_sub_64(N, CX, incX, s64);
+  rc |= compare("idxdBLAS_camax_sub", s, s64, 2 * sizeof(float));
+  idxdBLAS_camaxm_sub(N, CX, incX, CY, incY, s);
+  idxdBLAS_camaxm_sub_64(N, CX, incX, CY, incY, s64);
+  rc |= compare("idxdBLAS_camaxm_sub", s, s64, 2 * sizeof(float));
+
+  return rc;
+}
+
+//compare the 64-bit matrix routines to the 32-bit ones, viewing X as a row-major matrix with 8 columns
+static int check_matrix(int fold, int N, const double *X, const double complex *ZX, const float *SX, const float complex *CX, const double *Y, const double complex *ZY, const float *SY, const float complex *CY){
+  int rc = 0;
+  int M = N / 8;
+  int K = 8;
+  int L = M + K * K;
+  double *D = (double*)calloc(L, sizeof(double));
+  double *D64 = (double*)calloc(L, sizeof(double));
+  double complex *Z = (double complex*)calloc(L, sizeof(double complex));
+  double complex *Z64 = (double complex*)calloc(L, sizeof(double complex));
+  float *S = (float*)calloc(L, sizeof(float));
+  float *S64 = (float*)calloc(L, sizeof(float));
+  float complex *C = (float complex*)calloc(L, sizeof(float complex));
+  float complex *C64 = (float complex*)calloc(L, sizeof(float complex));
+  double complex zalpha = 1.0 + 0.5 * I;
+  double complex zbeta = 0.0;
+  float complex calpha = 1.0f + 0.5f * I;
+  float complex cbeta = 0.0f;
+  const char *TransA;
+
+  for(TransA = "nt"; *TransA != 0; TransA++){
+    reproBLAS_rdgemv(fold, 'r', *TransA, M, K, 0.5, X, K, Y, 1, 0.0, D, 1);
+    reproBLAS_rdgemv_64(fold, 'r', *TransA, M, K, 0.5, X, K, Y, 1, 0.0, D64, 1);
+    rc |= compare("reproBLAS_rdgemv", D, D64, L * sizeof(double));
+    reproBLAS_rzgemv(fold, 'r', *TransA, M, K, &zalpha, ZX, K, ZY, 1, &zbeta, Z, 1);
+    reproBLAS_rzgemv_64(fold, 'r', *TransA, M, K, &zalpha, ZX, K, ZY, 1, &zbeta, Z64, 1);
+    rc |= compare("reproBLAS_rzgemv", Z, Z64, L * sizeof(double complex));
+    reproBLAS_rsgemv(fold, 'r', *TransA, M, K, 0.5, SX, K, SY, 1, 0.0, S, 1);
+    reproBLAS_rsgemv_64(fold, 'r', *TransA, M, K, 0.5, SX, K, SY, 1, 0.0, S64, 1);
+    rc |= compare("reproBLAS_rsgemv", S, S64, L * sizeof(float));
+    reproBLAS_rcgemv(fold, 'r', *TransA, M, K, &calpha, CX, K, CY, 1, &cbeta, C, 1);
+    reproBLAS_rcgemv_64(fold, 'r', *TransA, M, K, &calpha, CX, K, CY, 1, &cbeta, C64, 1);
+    rc |= compare("reproBLAS_rcgemv", C, C64, L * sizeof(float complex));
+  }
+
+  //the K by K product of X with itself, summed over the M rows
+  reproBLAS_rdgemm(fold, 'r', 't', 'n', K, K, M, 0.5, X, K, X, K, 0.0, D, K);
+  reproBLAS_rdgemm_64(fold, 'r', 't', 'n', K, K, M, 0.5, X, K, X, K, 0.0, D64, K);
+  rc |= compare("reproBLAS_rdgemm", D, D64, L * sizeof(double));
+  reproBLAS_rzgemm(fold, 'c', 'n', 't', K, K, M, &zalpha, ZX, K, ZX, K, &zbeta, Z, K);
+  reproBLAS_rzgemm_64(fold, 'c', 'n', 't', K, K, M, &zalpha, ZX, K, ZX, K, &zbeta, Z64, K);
+  rc |= compare("reproBLAS_rzgemm", Z, Z64, L * sizeof(double complex));
+  reproBLAS_rsgemm(fold, 'r', 't', 'n', K, K, M, 0.5, SX, K, SX, K, 0.0, S, K);
+  reproBLAS_rsgemm_64(fold, 'r', 't', 'n', K, K, M, 0.5, SX, K, SX, K, 0.0, S64, K);
+  rc |= compare("reproBLAS_rsgemm", S, S64, L * sizeof(float));
+  reproBLAS_rcgemm(fold, 'c', 'n', 't', K, K, M, &calpha, CX, K, CX, K, &cbeta, C, K);
+  reproBLAS_rcgemm_64(fold, 'c', 'n', 't', K, K, M, &calpha, CX, K, CX, K, &cbeta, C64, K);
+  rc |= compare("reproBLAS_rcgemm", C, C64, L * sizeof(float complex));
+
+  free(D);
+  free(D64);
+  free(Z);
+  free(Z64);
+  free(S);
+  free(S64);
+  free(C);
+  free(C64);
+  return rc;
+}
+
+//vectors with a large stride give the same results as when stored contiguously, and are still passed to the 32-bit routines many elements at a time
+static int check_large_stride(int fold, const double *X, const double complex *ZX, const float *SX, const float complex *CX){
+  int rc = 0;
+  int N = 8;
+  int inc = (1 << 20) + 3;
+  double *BX = (double*)calloc((size_t)(N - 1) * inc + 1, sizeof(double));
+  double complex *BZX = (double complex*)calloc((size_t)(N - 1) * inc + 1, sizeof(double complex));
+  float *BSX = (float*)calloc((size_t)(N - 1) * inc + 1, sizeof(float));
+  float complex *BCX = (float complex*)calloc((size_t)(N - 1) * inc + 1, sizeof(float complex));
+  double d[2];
+  double d1[2];
+  float s[2];
+  float s1[2];
+  int64_t step;
+  int n;
+  int i;
+
+  for(i = 0; i < N; i++){
+    BX[(size_t)i * inc] = X[i];
+    BZX[(size_t)i * inc] = ZX[i];
+    BSX[(size_t)i * inc] = SX[i];
+    BCX[(size_t)i * inc] = CX[i];
+  }
+  d[0] = reproBLAS_rdsum(fold, N, BX, inc);
+  d1[0] = reproBLAS_rdsum(fold, N, X, 1);
+  rc |= compare("reproBLAS_rdsum (large stride)", d, d1, sizeof(double));
+  d[0] = reproBLAS_rdnrm2(fold, N, BX, inc);
+  d1[0] = reproBLAS_rdnrm2(fold, N, X, 1);
+  rc |= compare("reproBLAS_rdnrm2 (large stride)", d, d1, sizeof(double));
+  d[0] = reproBLAS_rddot(fold, N, BX, inc, X, 1);
+  d1[0] = reproBLAS_rddot(fold, N, X, 1, X, 1);
+  rc |= compare("reproBLAS_rddot (large stride)", d, d1, sizeof(double));
+  d[0] = idxdBLAS_damax(N, BX, inc);
+  d1[0] = idxdBLAS_damax(N, X, 1);
+  rc |= compare("idxdBLAS_damax (large stride)", d, d1, sizeof(double));
+  reproBLAS_rzdotc_sub(fold, N, BZX, inc, BZX, inc, d);
+  reproBLAS_rzdotc_sub(fold, N, ZX, 1, ZX, 1, d1);
+  rc |= compare("reproBLAS_rzdotc_sub (large stride)", d, d1, 2 * sizeof(double));
+  s[0] = reproBLAS_rssum(fold, N, BSX, inc);
+  s1[0] = reproBLAS_rssum(fold, N, SX, 1);
+  rc |= compare("reproBLAS_rssum (large stride)", s, s1, sizeof(float));
+  reproBLAS_rcsum_sub(fold, N, BCX, inc, s);
+  reproBLAS_rcsum_sub(fold, N, CX, 1, s1);
+  rc |= compare("reproBLAS_rcsum_sub (large stride)", s, s1, 2 * sizeof(float));
+
+  //the offsets within a chunk, doubled for complex vectors, fit an int
+  for(step = 1; step <= ((int64_t)1 << 40); step *= 8){
+    n = idxdBLAS_chunk_64((int64_t)1 << 40, step, -1);
+    if(n < 1 || (n > 1 && 2 * (int64_t)n * step > INT_MAX) || (step <= (1 << 20) && n < 1024)){
+      printf("idxdBLAS_chunk_64 gives chunks of %d elements for stride %lld\n", n, (long long)step);
+      rc = 1;
+    }
+  }
+
+  free(BX);
+  free(BZX);
+  free(BSX);
+  free(BCX);
+  return rc;
+}
+
+static int check_capacity(int fold, const float *SX){
+  int rc = 0;
+  int64_t over = (int64_t)idxd_SICAPACITY + 1;
+  float_indexed *Y = idxd_sialloc(fold);
+
+  if(idxdBLAS_capacity_64(INT64_MAX, idxd_DICAPACITY) == 0 || idxdBLAS_capacity_64((int64_t)1 << 40, idxd_DICAPACITY) != 0){
+    printf("idxdBLAS_capacity_64 does not check idxd_DICAPACITY\n");
+    rc = 1;
+  }
+  //the elements are never read, since there are too many of them
+  idxd_sisetzero(fold, Y);
+  idxd_sisconv(fold, SX[0], Y);
+  idxdBLAS_sissum_64(fold, over, SX, 0, Y);
+  idxdBLAS_sissum_64(fold, 1, SX, 1, Y);
+  if(!isnan(idxd_ssiconv(fold, Y))){
+    printf("idxdBLAS_sissum_64 did not set Y to NaN beyond idxd_SICAPACITY\n");
+    rc = 1;
+  }
+  if(!isnan(reproBLAS_rssum_64(fold, over, SX, 0))){
+    printf("reproBLAS_rssum_64 did not return NaN beyond idxd_SICAPACITY\n");
+    rc = 1;
+  }
+  if(!isnan(reproBLAS_rsdot_fma_64(fold, over / 2 + 1, SX, 0, SX, 0))){
+    printf("reproBLAS_rsdot_fma_64 did not return NaN beyond idxd_SICAPACITY\n");
+    rc = 1;
+  }
+
+  free(Y);
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_ilp64_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_ilp64_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify 64-bit interface fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  double *X;
+  double complex *ZX;
+  float *SX;
+  float complex *CX;
+  double *Y;
+  double complex *ZY;
+  float *SY;
+  float complex *CY;
+  int NX = N > 8 ? N : 8;
+
+  verify_ilp64_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  X = util_dvec_alloc(NX, incX);
+  ZX = util_zvec_alloc(NX, incX);
+  SX = util_svec_alloc(NX, incX);
+  CX = util_cvec_alloc(NX, incX);
+  Y = util_dvec_alloc(NX, incY);
+  ZY = util_zvec_alloc(NX, incY);
+  SY = util_svec_alloc(NX, incY);
+  CY = util_cvec_alloc(NX, incY);
+
+  util_dvec_fill(NX * incX, X, 1, FillX, RealScaleX, ImagScaleX);
+  util_zvec_fill(NX * incX, ZX, 1, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(NX * incX, SX, 1, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(NX * incX, CX, 1, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(NX * incY, Y, 1, FillY, RealScaleY, ImagScaleY);
+  util_zvec_fill(NX * incY, ZY, 1, FillY, RealScaleY, ImagScaleY);
+  util_svec_fill(NX * incY, SY, 1, FillY, RealScaleY, ImagScaleY);
+  util_cvec_fill(NX * incY, CY, 1, FillY, RealScaleY, ImagScaleY);
+
+  rc |= check_vector(fold._int.value, N, X, ZX, SX, CX, incX, Y, ZY, SY, CY, incY);
+  rc |= check_matrix(fold._int.value, N, X, ZX, SX, CX, Y, ZY, SY, CY);
+  rc |= check_large_stride(fold._int.value, X, ZX, SX, CX);
+  rc |= check_capacity(fold._int.value, SX);
+
+  free(X);
+  free(ZX);
+  free(SX);
+  free(CX);
+  free(Y);
+  free(ZY);
+  free(SY);
+  free(CY);
+
+  return rc;
+}
@@ -0,0 +1,147 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+//the vectors are stored K apart (with some padding), and the pairs repeat vectors, reverse pairs, and include one invalid pair
+#define K 4
+#define NPAIRS 8
+static const int pairs[2 * NPAIRS] = {0, 0, 0, 1, 1, 3, 3, 1, 2, 2, 2, 0, 1, K, 3, 3};
+
+static opt_option fold;
+
+static void verify_mdot_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//results must match bitwise, except that any invalid values are considered equal
+static int dcompare(const char *name, const char *ref, int n, const double *a, const double *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(double)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s[%d] = %a != %s = %a\n", name, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const char *ref, int n, const float *a, const float *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(float)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s[%d] = %a != %s = %a\n", name, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int vecvec_fill_show_help(void){
+  verify_mdot_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_mdot_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify multi-dot fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int p;
+  int a;
+  int b;
+  int ldX = N * incX + 3;
+  double res[NPAIRS];
+  double ref[NPAIRS];
+  float sres[NPAIRS];
+  float sref[NPAIRS];
+  (void)incY;
+
+  verify_mdot_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = (double*)util_dvec_alloc(K * ldX, 1);
+  float *SX = (float*)util_svec_alloc(K * ldX, 1);
+
+  //vectors 0 and 2 are filled like X, vector 1 like Y, and vector 3 at random
+  util_dvec_fill(K * ldX, X, 1, util_Vec_Rand, 1.0, 1.0);
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(N, X + ldX, incX, FillY, RealScaleY, ImagScaleY);
+  util_dvec_fill(N, X + 2 * ldX, incX, FillX, RealScaleX, ImagScaleX);
+  for(i = 0; i < K * ldX; i++){
+    SX[i] = X[i];
+  }
+
+  for(p = 0; p < NPAIRS; p++){
+    a = pairs[2 * p];
+    b = pairs[2 * p + 1];
+    if(a < K && b < K){
+      ref[p] = reproBLAS_rddot(fold._int.value, N, X + a * ldX, incX, X + b * ldX, incX);
+      sref[p] = reproBLAS_rsdot(fold._int.value, N, SX + a * ldX, incX, SX + b * ldX, incX);
+    }else{
+      ref[p] = 0.0;
+      sref[p] = 0.0;
+    }
+  }
+
+  reproBLAS_rdmdot(fold._int.value, N, K, X, ldX, incX, NPAIRS, pairs, res);
+  rc |= dcompare("reproBLAS_rdmdot", "reproBLAS_rddot", NPAIRS, res, ref);
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  reproBLAS_rdmdot_64(fold._int.value, N, K, X, ldX, incX, NPAIRS, pairs, res);
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  rc |= dcompare("reproBLAS_rdmdot_64(threaded)", "reproBLAS_rddot", NPAIRS, res, ref);
+  if(fold._int.value == DIDEFAULTFOLD){
+    reproBLAS_dmdot(N, K, X, ldX, incX, NPAIRS, pairs, res);
+    rc |= dcompare("reproBLAS_dmdot", "reproBLAS_rddot", NPAIRS, res, ref);
+  }
+
+  reproBLAS_rsmdot(fold._int.value, N, K, SX, ldX, incX, NPAIRS, pairs, sres);
+  rc |= scompare("reproBLAS_rsmdot", "reproBLAS_rsdot", NPAIRS, sres, sref);
+  idxdPool_set_threshold(0);
+  idxdPool_set_num_threads(4);
+  reproBLAS_rsmdot_64(fold._int.value, N, K, SX, ldX, incX, NPAIRS, pairs, sres);
+  idxdPool_set_num_threads(1);
+  idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+  rc |= scompare("reproBLAS_rsmdot_64(threaded)", "reproBLAS_rsdot", NPAIRS, sres, sref);
+  if(fold._int.value == SIDEFAULTFOLD){
+    reproBLAS_smdot(N, K, SX, ldX, incX, NPAIRS, pairs, sres);
+    rc |= scompare("reproBLAS_smdot", "reproBLAS_rsdot", NPAIRS, sres, sref);
+  }
+
+  free(X);
+  free(SX);
+  return rc;
+}
@@ -0,0 +1,189 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_moments_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//moments that overflow to both infinities are invalid, and any invalid values are considered equal
+static int compare(const char *name, const char *ref, int order, double shift, const double *a, const double *b){
+  int p;
+
+  for(p = 0; p < order; p++){
+    if(memcmp(a + p, b + p, sizeof(double)) != 0 && !(isnan(a[p]) && isnan(b[p]))){
+      printf("%s(order=%d, shift=%g)[%d] = %a != %s = %a\n", name, order, shift, p, a[p], ref, b[p]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const char *ref, int order, float shift, const float *a, const float *b){
+  int p;
+
+  for(p = 0; p < order; p++){
+    if(memcmp(a + p, b + p, sizeof(float)) != 0 && !(isnan(a[p]) && isnan(b[p]))){
+      printf("%s(order=%d, shift=%g)[%d] = %a != %s = %a\n", name, order, shift, p, a[p], ref, b[p]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//the means of the powers of X - shift, summing each vector of powers separately
+static void ref_dmoments(int fold, int order, int N, const double *X, int incX, double shift, double *W, double *M){
+  int i;
+  int p;
+  double d;
+
+  for(p = 0; p < order; p++){
+    for(i = 0; i < N; i++){
+      d = X[i * incX] - shift;
+      W[i] = p == 0 ? d : p == 1 ? d * d : p == 2 ? (d * d) * d : (d * d) * (d * d);
+    }
+    M[p] = N == 0 ? 0.0 : reproBLAS_rdsum(fold, N, W, 1) / N;
+  }
+}
+
+static void ref_smoments(int fold, int order, int N, const float *X, int incX, float shift, float *W, float *M){
+  int i;
+  int p;
+  float d;
+
+  for(p = 0; p < order; p++){
+    for(i = 0; i < N; i++){
+      d = X[i * incX] - shift;
+      W[i] = p == 0 ? d : p == 1 ? d * d : p == 2 ? (d * d) * d : (d * d) * (d * d);
+    }
+    M[p] = N == 0 ? 0.0f : reproBLAS_rssum(fold, N, W, 1) / N;
+  }
+}
+
+int vecvec_fill_show_help(void){
+  verify_moments_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_moments_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify moments fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int order;
+  int s;
+  double shift;
+  float sshift;
+  double M[4];
+  double ref[4];
+  float SM[4];
+  float sref[4];
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+
+  verify_moments_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = util_dvec_alloc(N, incX);
+  float *SX = (float*)util_svec_alloc(N, incX);
+  double *W = (double*)malloc(N * sizeof(double));
+  float *SW = (float*)malloc(N * sizeof(float));
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  for(i = 0; i < N * incX; i++){
+    SX[i] = X[i];
+  }
+
+  for(order = 1; order <= 4; order++){
+    for(s = 0; s < 2; s++){
+      //the moments are taken about 0 and about an element of X
+      shift = (s == 0 || N == 0) ? 0.0 : X[(N / 2) * incX];
+      sshift = shift;
+
+      ref_dmoments(fold._int.value, order, N, X, incX, shift, W, ref);
+      reproBLAS_rdmoments(fold._int.value, order, N, X, incX, shift, M);
+      rc |= compare("reproBLAS_rdmoments", "reproBLAS_rdsum", order, shift, M, ref);
+      reproBLAS_rdmoments_64(fold._int.value, order, N, X, incX, shift, M);
+      rc |= compare("reproBLAS_rdmoments_64", "reproBLAS_rdsum", order, shift, M, ref);
+      idxdPool_set_threshold(0);
+      idxdPool_set_num_threads(4);
+      reproBLAS_rdmoments(fold._int.value, order, N, X, incX, shift, M);
+      idxdPool_set_num_threads(1);
+      idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+      rc |= compare("reproBLAS_rdmoments(threaded)", "reproBLAS_rdsum", order, shift, M, ref);
+      if(fold._int.value == DIDEFAULTFOLD){
+        reproBLAS_dmoments(order, N, X, incX, shift, M);
+        rc |= compare("reproBLAS_dmoments", "reproBLAS_rdsum", order, shift, M, ref);
+      }
+
+      ref_smoments(fold._int.value, order, N, SX, incX, sshift, SW, sref);
+      reproBLAS_rsmoments(fold._int.value, order, N, SX, incX, sshift, SM);
+      rc |= scompare("reproBLAS_rsmoments", "reproBLAS_rssum", order, sshift, SM, sref);
+      idxdPool_set_threshold(0);
+      idxdPool_set_num_threads(4);
+      reproBLAS_rsmoments_64(fold._int.value, order, N, SX, incX, sshift, SM);
+      idxdPool_set_num_threads(1);
+      idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+      rc |= scompare("reproBLAS_rsmoments_64(threaded)", "reproBLAS_rssum", order, sshift, SM, sref);
+      if(fold._int.value == SIDEFAULTFOLD){
+        reproBLAS_smoments(order, N, SX, incX, sshift, SM);
+        rc |= scompare("reproBLAS_smoments", "reproBLAS_rssum", order, sshift, SM, sref);
+      }
+    }
+
+    //the central moments are taken about the mean
+    shift = N == 0 ? 0.0 : reproBLAS_rdsum(fold._int.value, N, X, incX) / N;
+    ref_dmoments(fold._int.value, order, N, X, incX, shift, W, ref);
+    ref[0] = shift;
+    reproBLAS_rdcmoments(fold._int.value, order, N, X, incX, M);
+    rc |= compare("reproBLAS_rdcmoments", "reproBLAS_rdsum", order, shift, M, ref);
+    if(fold._int.value == DIDEFAULTFOLD){
+      reproBLAS_dcmoments_64(order, N, X, incX, M);
+      rc |= compare("reproBLAS_dcmoments_64", "reproBLAS_rdsum", order, shift, M, ref);
+    }
+    sshift = N == 0 ? 0.0f : reproBLAS_rssum(fold._int.value, N, SX, incX) / N;
+    ref_smoments(fold._int.value, order, N, SX, incX, sshift, SW, sref);
+    sref[0] = sshift;
+    reproBLAS_rscmoments(fold._int.value, order, N, SX, incX, SM);
+    rc |= scompare("reproBLAS_rscmoments", "reproBLAS_rssum", order, sshift, SM, sref);
+  }
+
+  free(X);
+  free(SX);
+  free(W);
+  free(SW);
+  return rc;
+}
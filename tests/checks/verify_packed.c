@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_matvec_fill_header.h"
+
+//the number of columns of op(B) in the matrix-matrix products (more than one block of columns)
+#define NB 37
+
+static opt_option fold;
+
+static void verify_packed_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//the indexed outputs must match bitwise
+static int compare(const char *name, const char *ref, const void *Y, const void *Yref, size_t size){
+  if(memcmp(Y, Yref, size) != 0){
+    printf("%s != %s\n", name, ref);
+    return 1;
+  }
+  return 0;
+}
+
+int matvec_fill_show_help(void){
+  verify_packed_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_packed_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify packed gemv and gemm fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matvec_fill_test(int argc, char** argv, char Order, char TransA, int M, int N, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillX, double RealScaleX, double ImagScaleX, int incX, double RealBeta, double ImagBeta, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int j;
+  int t;
+  int trans = !(TransA == 'n' || TransA == 'N');
+  int row = Order == 'r' || Order == 'R';
+  int NX = trans ? M : N;
+  int NY = trans ? N : M;
+  int NM = row ? M * lda : lda * N;
+  int ldb;
+  int ldc = row ? NB : NY;
+  char TransB;
+  idxdBLAS_dpacked *PA;
+  idxdBLAS_spacked *SPA;
+  (void)ImagAlpha;
+  (void)RealBeta;
+  (void)ImagBeta;
+
+  verify_packed_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  double *A = util_dmat_alloc(Order, M, N, lda);
+  double *X = util_dvec_alloc(NX, incX);
+  double *Y = util_dvec_alloc(NY, incY);
+  double *L = util_dvec_alloc(NX * NB, 1);
+  double *B = util_dvec_alloc(NX * NB, 1);
+  double_indexed *YI = (double_indexed*)malloc(NY * idxd_disize(fold._int.value));
+  double_indexed *YIref = (double_indexed*)malloc(NY * idxd_disize(fold._int.value));
+  double_indexed *CI = (double_indexed*)calloc(NY * NB, idxd_disize(fold._int.value));
+  double_indexed *CIref = (double_indexed*)calloc(NY * NB, idxd_disize(fold._int.value));
+  float *SA = (float*)malloc(NM * sizeof(float));
+  float *SX = (float*)malloc(NX * incX * sizeof(float));
+  float *SB = (float*)malloc(NX * NB * sizeof(float));
+  float_indexed *SYI = (float_indexed*)malloc(NY * idxd_sisize(fold._int.value));
+  float_indexed *SYIref = (float_indexed*)malloc(NY * idxd_sisize(fold._int.value));
+  float_indexed *SCI = (float_indexed*)calloc(NY * NB, idxd_sisize(fold._int.value));
+  float_indexed *SCIref = (float_indexed*)calloc(NY * NB, idxd_sisize(fold._int.value));
+
+  util_dmat_fill(Order, 'n', M, N, A, lda, FillA, RealScaleA, ImagScaleA);
+  util_dvec_fill(NX, X, incX, FillX, RealScaleX, ImagScaleX);
+  util_dvec_fill(NY, Y, incY, FillY, RealScaleY, ImagScaleY);
+  //op(B) is NX by NB, with X as its first column
+  util_dvec_fill(NX * NB, L, 1, FillX, RealScaleX, ImagScaleX);
+  for(i = 0; i < NX; i++){
+    L[i * NB] = X[i * incX];
+  }
+  for(i = 0; i < NM; i++){
+    SA[i] = A[i];
+  }
+  for(i = 0; i < NX * incX; i++){
+    SX[i] = X[i];
+  }
+
+  PA = idxdBLAS_dpack(Order, TransA, NY, NX, A, lda);
+  SPA = idxdBLAS_spack(Order, TransA, NY, NX, SA, lda);
+
+  //the packed matrix is used twice, accumulating into the same output
+  for(i = 0; i < NY; i++){
+    idxd_didconv(fold._int.value, Y[i * incY], YIref + i * idxd_dinum(fold._int.value));
+    idxd_sisconv(fold._int.value, Y[i * incY], SYIref + i * idxd_sinum(fold._int.value));
+  }
+  memcpy(YI, YIref, NY * idxd_disize(fold._int.value));
+  memcpy(SYI, SYIref, NY * idxd_sisize(fold._int.value));
+  for(t = 0; t < 2; t++){
+    idxdBLAS_didgemv(fold._int.value, Order, TransA, M, N, RealAlpha, A, lda, X, incX, YIref, 1);
+    idxdBLAS_didgemv_packed(fold._int.value, RealAlpha, PA, X, incX, YI, 1);
+    rc |= compare("idxdBLAS_didgemv_packed", "idxdBLAS_didgemv", YI, YIref, NY * idxd_disize(fold._int.value));
+    idxdBLAS_sisgemv(fold._int.value, Order, TransA, M, N, RealAlpha, SA, lda, SX, incX, SYIref, 1);
+    idxdBLAS_sisgemv_packed_64(fold._int.value, RealAlpha, SPA, SX, incX, SYI, 1);
+    rc |= compare("idxdBLAS_sisgemv_packed_64", "idxdBLAS_sisgemv", SYI, SYIref, NY * idxd_sisize(fold._int.value));
+  }
+
+  for(t = 0; t < 2; t++){
+    TransB = t ? 't' : 'n';
+    //store op(B) (or its transpose) in the ordering of A
+    for(i = 0; i < NX; i++){
+      for(j = 0; j < NB; j++){
+        if(row == !t){
+          B[i * NB + j] = L[i * NB + j];
+        }else{
+          B[j * NX + i] = L[i * NB + j];
+        }
+      }
+    }
+    ldb = row == !t ? NB : NX;
+    for(i = 0; i < NX * NB; i++){
+      SB[i] = B[i];
+    }
+    idxdBLAS_didgemm(fold._int.value, Order, TransA, TransB, NY, NB, NX, RealAlpha, A, lda, B, ldb, CIref, ldc);
+    idxdBLAS_didgemm_packed(fold._int.value, Order, TransB, NB, RealAlpha, PA, B, ldb, CI, ldc);
+    rc |= compare("idxdBLAS_didgemm_packed", "idxdBLAS_didgemm", CI, CIref, NY * NB * idxd_disize(fold._int.value));
+    idxdBLAS_sisgemm(fold._int.value, Order, TransA, TransB, NY, NB, NX, RealAlpha, SA, lda, SB, ldb, SCIref, ldc);
+    idxdBLAS_sisgemm_packed_64(fold._int.value, Order, TransB, NB, RealAlpha, SPA, SB, ldb, SCI, ldc);
+    rc |= compare("idxdBLAS_sisgemm_packed_64", "idxdBLAS_sisgemm", SCI, SCIref, NY * NB * idxd_sisize(fold._int.value));
+  }
+
+  idxdBLAS_dpacked_free(PA);
+  idxdBLAS_spacked_free(SPA);
+  free(A);
+  free(X);
+  free(Y);
+  free(L);
+  free(B);
+  free(YI);
+  free(YIref);
+  free(CI);
+  free(CIref);
+  free(SA);
+  free(SX);
+  free(SB);
+  free(SYI);
+  free(SYIref);
+  free(SCI);
+  free(SCIref);
+
+  return rc;
+}
@@ -0,0 +1,185 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+//the number of prefixes checked against reproBLAS_rdsum() (the others are checked against the serial scan)
+#define NCHECKS 256
+
+static opt_option fold;
+
+static void verify_scan_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//sums that overflow to both infinities are invalid, and any invalid values are considered equal
+static int compare(const char *name, const char *ref, int i, double a, double b){
+  if(memcmp(&a, &b, sizeof(double)) != 0 && !(isnan(a) && isnan(b))){
+    printf("%s[%d] = %a != %s = %a\n", name, i, a, ref, b);
+    return 1;
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const char *ref, int i, float a, float b){
+  if(memcmp(&a, &b, sizeof(float)) != 0 && !(isnan(a) && isnan(b))){
+    printf("%s[%d] = %a != %s = %a\n", name, i, a, ref, b);
+    return 1;
+  }
+  return 0;
+}
+
+//the i'th prefix checked against reproBLAS_rdsum(), covering the first and last elements
+static int check_index(int N, int j){
+  if(j < NCHECKS / 4){
+    return j % N;
+  }
+  if(j < NCHECKS / 2){
+    return N - 1 - (j - NCHECKS / 4) % N;
+  }
+  return (int)(((int64_t)j * 7919) % N);
+}
+
+int vecvec_fill_show_help(void){
+  verify_scan_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_scan_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify scan fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int j;
+  int ex;
+  double ref;
+  float sref;
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+
+  verify_scan_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  double_indexed *SI = idxd_dialloc(fold._int.value);
+  double *X = util_dvec_alloc(N, incX);
+  float *SX = (float*)util_svec_alloc(N, incX);
+  double *Y = util_dvec_alloc(N, incY);
+  double *YT = util_dvec_alloc(N, incY);
+  float *SY = (float*)util_svec_alloc(N, incY);
+  float *SYT = (float*)util_svec_alloc(N, incY);
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  for(i = 0; i < N * incX; i++){
+    SX[i] = X[i];
+  }
+
+  for(ex = 0; ex < 2; ex++){
+    if(ex){
+      reproBLAS_rdexscan(fold._int.value, N, X, incX, Y, incY);
+      reproBLAS_rsexscan_64(fold._int.value, N, SX, incX, SY, incY);
+    }else{
+      reproBLAS_rdscan(fold._int.value, N, X, incX, Y, incY);
+      reproBLAS_rsscan_64(fold._int.value, N, SX, incX, SY, incY);
+    }
+    for(j = 0; j < NCHECKS && N > 0; j++){
+      i = check_index(N, j);
+      ref = reproBLAS_rdsum(fold._int.value, i + 1 - ex, X, incX);
+      rc |= compare(ex ? "reproBLAS_rdexscan" : "reproBLAS_rdscan", "reproBLAS_rdsum", i, Y[i * incY], ref);
+      sref = reproBLAS_rssum(fold._int.value, i + 1 - ex, SX, incX);
+      rc |= scompare(ex ? "reproBLAS_rsexscan_64" : "reproBLAS_rsscan_64", "reproBLAS_rssum", i, SY[i * incY], sref);
+    }
+
+    //every prefix of the threaded scan is the same as that of the serial scan
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    if(ex){
+      reproBLAS_rdexscan_64(fold._int.value, N, X, incX, YT, incY);
+      reproBLAS_rsexscan(fold._int.value, N, SX, incX, SYT, incY);
+    }else{
+      reproBLAS_rdscan_64(fold._int.value, N, X, incX, YT, incY);
+      reproBLAS_rsscan(fold._int.value, N, SX, incX, SYT, incY);
+    }
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    for(i = 0; i < N; i++){
+      rc |= compare(ex ? "reproBLAS_rdexscan_64(threaded)" : "reproBLAS_rdscan_64(threaded)", "serial", i, YT[i * incY], Y[i * incY]);
+      rc |= scompare(ex ? "reproBLAS_rsexscan(threaded)" : "reproBLAS_rsscan(threaded)", "serial", i, SYT[i * incY], SY[i * incY]);
+    }
+
+    //the scan of the two halves of X from the same indexed scalar is the scan of X
+    idxd_disetzero(fold._int.value, SI);
+    if(ex){
+      idxdBLAS_didexscan(fold._int.value, N / 2, X, incX, SI, YT, incY);
+      idxdBLAS_didexscan(fold._int.value, N - N / 2, X + (N / 2) * incX, incX, SI, YT + (N / 2) * incY, incY);
+    }else{
+      idxdBLAS_didscan(fold._int.value, N / 2, X, incX, SI, YT, incY);
+      idxdBLAS_didscan(fold._int.value, N - N / 2, X + (N / 2) * incX, incX, SI, YT + (N / 2) * incY, incY);
+    }
+    for(i = 0; i < N; i++){
+      rc |= compare(ex ? "idxdBLAS_didexscan(halves)" : "idxdBLAS_didscan(halves)", "serial", i, YT[i * incY], Y[i * incY]);
+    }
+    rc |= compare("idxdBLAS_didscan(total)", "reproBLAS_rdsum", N, idxd_ddiconv(fold._int.value, SI), reproBLAS_rdsum(fold._int.value, N, X, incX));
+
+    if(fold._int.value == DIDEFAULTFOLD){
+      if(ex){
+        reproBLAS_dexscan(N, X, incX, YT, incY);
+      }else{
+        reproBLAS_dscan_64(N, X, incX, YT, incY);
+      }
+      for(i = 0; i < N; i++){
+        rc |= compare(ex ? "reproBLAS_dexscan" : "reproBLAS_dscan_64", "serial", i, YT[i * incY], Y[i * incY]);
+      }
+    }
+    if(fold._int.value == SIDEFAULTFOLD){
+      if(ex){
+        reproBLAS_sexscan_64(N, SX, incX, SYT, incY);
+      }else{
+        reproBLAS_sscan(N, SX, incX, SYT, incY);
+      }
+      for(i = 0; i < N; i++){
+        rc |= scompare(ex ? "reproBLAS_sexscan_64" : "reproBLAS_sscan", "serial", i, SYT[i * incY], SY[i * incY]);
+      }
+    }
+    if(rc){
+      break;
+    }
+  }
+
+  free(SI);
+  free(X);
+  free(SX);
+  free(Y);
+  free(YT);
+  free(SY);
+  free(SYT);
+  return rc;
+}
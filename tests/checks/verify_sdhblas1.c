@@ -0,0 +1,182 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_sdhblas1_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//truncate a float to the bit pattern of a half precision float, saturating large values
+static uint16_t htrunc(float x){
+  uint32_t b;
+  uint16_t s;
+  int e;
+
+  memcpy(&b, &x, sizeof(float));
+  s = (b >> 16) & 0x8000;
+  e = (int)((b >> 23) & 0xFF) - 127 + 15;
+  if(e < -10){
+    return s;
+  }
+  if(e <= 0){
+    return s | (((b & 0x7FFFFF) | 0x800000) >> (14 - e));
+  }
+  if(e >= 31){
+    return s | 0x7BFF;
+  }
+  return s | (e << 10) | ((b >> 13) & 0x3FF);
+}
+
+static double hwiden(uint16_t h){
+  int e = (h >> 10) & 0x1F;
+  int m = h & 0x3FF;
+  double x = e ? ldexp(m + 1024, e - 25) : ldexp(m, -24);
+  return (h & 0x8000) ? -x : x;
+}
+
+//truncate a float to the bit pattern of a bfloat16
+static uint16_t btrunc(float x){
+  uint32_t b;
+
+  memcpy(&b, &x, sizeof(float));
+  return b >> 16;
+}
+
+static double bwiden(uint16_t h){
+  uint32_t b = (uint32_t)h << 16;
+  float x;
+
+  memcpy(&x, &b, sizeof(float));
+  return x;
+}
+
+static int compare(const char *name, const char *ref, float a, float b){
+  if(memcmp(&a, &b, sizeof(float)) != 0){
+    printf("%s(X) = %a != %s(double(X)) = %a\n", name, a, ref, b);
+    return 1;
+  }
+  return 0;
+}
+
+//compare the half precision routines to the double precision ones on exactly converted inputs
+static int check_half(int fold, int N, const uint16_t *HX, int incX, const uint16_t *HY, int incY, const double *X, const double *Y){
+  int rc = 0;
+
+  rc |= compare("reproBLAS_rsdhsum", "reproBLAS_rdsum", reproBLAS_rsdhsum(fold, N, HX, incX), (float)reproBLAS_rdsum(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdhasum", "reproBLAS_rdasum", reproBLAS_rsdhasum(fold, N, HX, incX), (float)reproBLAS_rdasum(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdhnrm2", "reproBLAS_rdnrm2", reproBLAS_rsdhnrm2(fold, N, HX, incX), (float)reproBLAS_rdnrm2(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdhdot", "reproBLAS_rddot", reproBLAS_rsdhdot(fold, N, HX, incX, HY, incY), (float)reproBLAS_rddot(fold, N, X, incX, Y, incY));
+  rc |= compare("reproBLAS_rsdhsum_64", "reproBLAS_rsdhsum", reproBLAS_rsdhsum_64(fold, N, HX, incX), reproBLAS_rsdhsum(fold, N, HX, incX));
+  rc |= compare("reproBLAS_rsdhdot_64", "reproBLAS_rsdhdot", reproBLAS_rsdhdot_64(fold, N, HX, incX, HY, incY), reproBLAS_rsdhdot(fold, N, HX, incX, HY, incY));
+  rc |= compare("reproBLAS_sdhsum", "reproBLAS_rsdhsum", reproBLAS_sdhsum(N, HX, incX), reproBLAS_rsdhsum(DIDEFAULTFOLD, N, HX, incX));
+  rc |= compare("reproBLAS_sdhnrm2_64", "reproBLAS_rsdhnrm2", reproBLAS_sdhnrm2_64(N, HX, incX), reproBLAS_rsdhnrm2(DIDEFAULTFOLD, N, HX, incX));
+
+  return rc;
+}
+
+//compare the bfloat16 routines to the double precision ones on exactly converted inputs
+static int check_bfloat(int fold, int N, const uint16_t *BX, int incX, const uint16_t *BY, int incY, const double *X, const double *Y){
+  int rc = 0;
+
+  rc |= compare("reproBLAS_rsdbsum", "reproBLAS_rdsum", reproBLAS_rsdbsum(fold, N, BX, incX), (float)reproBLAS_rdsum(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdbasum", "reproBLAS_rdasum", reproBLAS_rsdbasum(fold, N, BX, incX), (float)reproBLAS_rdasum(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdbnrm2", "reproBLAS_rdnrm2", reproBLAS_rsdbnrm2(fold, N, BX, incX), (float)reproBLAS_rdnrm2(fold, N, X, incX));
+  rc |= compare("reproBLAS_rsdbdot", "reproBLAS_rddot", reproBLAS_rsdbdot(fold, N, BX, incX, BY, incY), (float)reproBLAS_rddot(fold, N, X, incX, Y, incY));
+  rc |= compare("reproBLAS_rsdbasum_64", "reproBLAS_rsdbasum", reproBLAS_rsdbasum_64(fold, N, BX, incX), reproBLAS_rsdbasum(fold, N, BX, incX));
+  rc |= compare("reproBLAS_rsdbnrm2_64", "reproBLAS_rsdbnrm2", reproBLAS_rsdbnrm2_64(fold, N, BX, incX), reproBLAS_rsdbnrm2(fold, N, BX, incX));
+  rc |= compare("reproBLAS_sdbdot", "reproBLAS_rsdbdot", reproBLAS_sdbdot(N, BX, incX, BY, incY), reproBLAS_rsdbdot(DIDEFAULTFOLD, N, BX, incX, BY, incY));
+  rc |= compare("reproBLAS_sdbasum_64", "reproBLAS_rsdbasum", reproBLAS_sdbasum_64(N, BX, incX), reproBLAS_rsdbasum(DIDEFAULTFOLD, N, BX, incX));
+
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_sdhblas1_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_sdhblas1_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify half precision and bfloat16 input with double precision accumulation fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  float *SX;
+  float *SY;
+  uint16_t *HX;
+  uint16_t *HY;
+  double *X;
+  double *Y;
+
+  verify_sdhblas1_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  SX = util_svec_alloc(N, incX);
+  SY = util_svec_alloc(N, incY);
+  HX = (uint16_t*)malloc(N * incX * sizeof(uint16_t));
+  HY = (uint16_t*)malloc(N * incY * sizeof(uint16_t));
+  X = util_dvec_alloc(N, incX);
+  Y = util_dvec_alloc(N, incY);
+
+  util_svec_fill(N, SX, incX, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N, SY, incY, FillY, RealScaleY, ImagScaleY);
+
+  for(i = 0; i < N * incX; i++){
+    HX[i] = htrunc(SX[i]);
+    X[i] = hwiden(HX[i]);
+  }
+  for(i = 0; i < N * incY; i++){
+    HY[i] = htrunc(SY[i]);
+    Y[i] = hwiden(HY[i]);
+  }
+  rc |= check_half(fold._int.value, N, HX, incX, HY, incY, X, Y);
+
+  for(i = 0; i < N * incX; i++){
+    HX[i] = btrunc(SX[i]);
+    X[i] = bwiden(HX[i]);
+  }
+  for(i = 0; i < N * incY; i++){
+    HY[i] = btrunc(SY[i]);
+    Y[i] = bwiden(HY[i]);
+  }
+  rc |= check_bfloat(fold._int.value, N, HX, incX, HY, incY, X, Y);
+
+  free(SX);
+  free(SY);
+  free(HX);
+  free(HY);
+  free(X);
+  free(Y);
+
+  return rc;
+}
@@ -0,0 +1,190 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_sdsblas1_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const char *ref, const float *a, const float *b, int n){
+  if(memcmp(a, b, n * sizeof(float)) != 0){
+    if(n == 1){
+      printf("%s(X) = %a != %s(double(X)) = %a\n", name, a[0], ref, b[0]);
+    }else{
+      printf("%s(X) = %a + %ai != %s(double(X)) = %a + %ai\n", name, a[0], a[1], ref, b[0], b[1]);
+    }
+    return 1;
+  }
+  return 0;
+}
+
+//compare the single precision routines to the double precision ones on exactly converted inputs
+static int check_double(int fold, int N, const float *SX, const float complex *CX, int incX, const float *SY, const float complex *CY, int incY, const double *X, const double complex *ZX, const double *Y, const double complex *ZY){
+  int rc = 0;
+  float s[2];
+  float ref[2];
+  double d[2];
+
+  s[0] = reproBLAS_rsdssum(fold, N, SX, incX);
+  ref[0] = (float)reproBLAS_rdsum(fold, N, X, incX);
+  rc |= compare("reproBLAS_rsdssum", "reproBLAS_rdsum", s, ref, 1);
+  s[0] = reproBLAS_rsdsasum(fold, N, SX, incX);
+  ref[0] = (float)reproBLAS_rdasum(fold, N, X, incX);
+  rc |= compare("reproBLAS_rsdsasum", "reproBLAS_rdasum", s, ref, 1);
+  s[0] = reproBLAS_rsdsnrm2(fold, N, SX, incX);
+  ref[0] = (float)reproBLAS_rdnrm2(fold, N, X, incX);
+  rc |= compare("reproBLAS_rsdsnrm2", "reproBLAS_rdnrm2", s, ref, 1);
+  s[0] = reproBLAS_rsdsdot(fold, N, SX, incX, SY, incY);
+  ref[0] = (float)reproBLAS_rddot(fold, N, X, incX, Y, incY);
+  rc |= compare("reproBLAS_rsdsdot", "reproBLAS_rddot", s, ref, 1);
+
+  reproBLAS_rcdcsum_sub(fold, N, CX, incX, s);
+  reproBLAS_rzsum_sub(fold, N, ZX, incX, d);
+  ref[0] = (float)d[0];
+  ref[1] = (float)d[1];
+  rc |= compare("reproBLAS_rcdcsum_sub", "reproBLAS_rzsum_sub", s, ref, 2);
+  s[0] = reproBLAS_rscdcasum(fold, N, CX, incX);
+  ref[0] = (float)reproBLAS_rdzasum(fold, N, ZX, incX);
+  rc |= compare("reproBLAS_rscdcasum", "reproBLAS_rdzasum", s, ref, 1);
+  s[0] = reproBLAS_rscdcnrm2(fold, N, CX, incX);
+  ref[0] = (float)reproBLAS_rdznrm2(fold, N, ZX, incX);
+  rc |= compare("reproBLAS_rscdcnrm2", "reproBLAS_rdznrm2", s, ref, 1);
+  reproBLAS_rcdcdotu_sub(fold, N, CX, incX, CY, incY, s);
+  reproBLAS_rzdotu_sub(fold, N, ZX, incX, ZY, incY, d);
+  ref[0] = (float)d[0];
+  ref[1] = (float)d[1];
+  rc |= compare("reproBLAS_rcdcdotu_sub", "reproBLAS_rzdotu_sub", s, ref, 2);
+  reproBLAS_rcdcdotc_sub(fold, N, CX, incX, CY, incY, s);
+  reproBLAS_rzdotc_sub(fold, N, ZX, incX, ZY, incY, d);
+  ref[0] = (float)d[0];
+  ref[1] = (float)d[1];
+  rc |= compare("reproBLAS_rcdcdotc_sub", "reproBLAS_rzdotc_sub", s, ref, 2);
+
+  return rc;
+}
+
+//compare the default fold and 64-bit routines to the routines above
+static int check_variants(int N, const float *SX, const float complex *CX, int incX, const float *SY, const float complex *CY, int incY){
+  int rc = 0;
+  float s[2];
+  float ref[2];
+
+  ref[0] = reproBLAS_rsdssum(DIDEFAULTFOLD, N, SX, incX);
+  s[0] = reproBLAS_sdssum(N, SX, incX);
+  rc |= compare("reproBLAS_sdssum", "reproBLAS_rsdssum", s, ref, 1);
+  s[0] = reproBLAS_sdssum_64(N, SX, incX);
+  rc |= compare("reproBLAS_sdssum_64", "reproBLAS_rsdssum", s, ref, 1);
+  ref[0] = reproBLAS_rsdsnrm2(DIDEFAULTFOLD, N, SX, incX);
+  s[0] = reproBLAS_sdsnrm2(N, SX, incX);
+  rc |= compare("reproBLAS_sdsnrm2", "reproBLAS_rsdsnrm2", s, ref, 1);
+  s[0] = reproBLAS_rsdsnrm2_64(DIDEFAULTFOLD, N, SX, incX);
+  rc |= compare("reproBLAS_rsdsnrm2_64", "reproBLAS_rsdsnrm2", s, ref, 1);
+  ref[0] = reproBLAS_rsdsdot(DIDEFAULTFOLD, N, SX, incX, SY, incY);
+  s[0] = reproBLAS_sdsdot(N, SX, incX, SY, incY);
+  rc |= compare("reproBLAS_sdsdot", "reproBLAS_rsdsdot", s, ref, 1);
+  s[0] = reproBLAS_sdsdot_64(N, SX, incX, SY, incY);
+  rc |= compare("reproBLAS_sdsdot_64", "reproBLAS_rsdsdot", s, ref, 1);
+
+  ref[0] = reproBLAS_rscdcasum(DIDEFAULTFOLD, N, CX, incX);
+  s[0] = reproBLAS_scdcasum(N, CX, incX);
+  rc |= compare("reproBLAS_scdcasum", "reproBLAS_rscdcasum", s, ref, 1);
+  s[0] = reproBLAS_scdcasum_64(N, CX, incX);
+  rc |= compare("reproBLAS_scdcasum_64", "reproBLAS_rscdcasum", s, ref, 1);
+  reproBLAS_rcdcdotc_sub(DIDEFAULTFOLD, N, CX, incX, CY, incY, ref);
+  reproBLAS_cdcdotc_sub(N, CX, incX, CY, incY, s);
+  rc |= compare("reproBLAS_cdcdotc_sub", "reproBLAS_rcdcdotc_sub", s, ref, 2);
+  reproBLAS_rcdcdotc_sub_64(DIDEFAULTFOLD, N, CX, incX, CY, incY, s);
+  rc |= compare("reproBLAS_rcdcdotc_sub_64", "reproBLAS_rcdcdotc_sub", s, ref, 2);
+
+  return rc;
+}
+
+int vecvec_fill_show_help(void){
+  verify_sdsblas1_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_sdsblas1_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify single precision input with double precision accumulation fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  float *SX;
+  float complex *CX;
+  float *SY;
+  float complex *CY;
+  double *X;
+  double complex *ZX;
+  double *Y;
+  double complex *ZY;
+
+  verify_sdsblas1_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  SX = util_svec_alloc(N, incX);
+  CX = util_cvec_alloc(N, incX);
+  SY = util_svec_alloc(N, incY);
+  CY = util_cvec_alloc(N, incY);
+  X = util_dvec_alloc(N, incX);
+  ZX = util_zvec_alloc(N, incX);
+  Y = util_dvec_alloc(N, incY);
+  ZY = util_zvec_alloc(N, incY);
+
+  util_svec_fill(N, SX, incX, FillX, RealScaleX, ImagScaleX);
+  util_cvec_fill(N, CX, incX, FillX, RealScaleX, ImagScaleX);
+  util_svec_fill(N, SY, incY, FillY, RealScaleY, ImagScaleY);
+  util_cvec_fill(N, CY, incY, FillY, RealScaleY, ImagScaleY);
+  for(i = 0; i < N * incX; i++){
+    X[i] = SX[i];
+    ZX[i] = CX[i];
+  }
+  for(i = 0; i < N * incY; i++){
+    Y[i] = SY[i];
+    ZY[i] = CY[i];
+  }
+
+  rc |= check_double(fold._int.value, N, SX, CX, incX, SY, CY, incY, X, ZX, Y, ZY);
+  rc |= check_variants(N, SX, CX, incX, SY, CY, incY);
+
+  free(SX);
+  free(CX);
+  free(SY);
+  free(CY);
+  free(X);
+  free(ZX);
+  free(Y);
+  free(ZY);
+
+  return rc;
+}
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_BLAS.h"
+#include "../../config.h"
+
+#include "../common/test_matmat_fill_header.h"
+
+static opt_option fold;
+
+static void verify_sdsblas2_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+static int compare(const char *name, const char *ref, const double *a, const double *b, int n){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(double)) != 0){
+      printf("%s(A, B)[%d] = %a != %s(double(A), double(B))[%d] = %a\n", name, i, a[i], ref, i, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int matmat_fill_show_help(void){
+  verify_sdsblas2_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matmat_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_sdsblas2_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify single precision matrix input with double precision accumulation fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB, int M, int N, int K, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double RealBeta, double ImagBeta, int FillC, double RealScaleC, double ImagScaleC, int ldc){
+  (void)ImagAlpha;
+  (void)ImagBeta;
+  int rc = 0;
+  int i;
+  int opAM;
+  int opAK;
+  int opBK;
+  int opBN;
+  int ANM;
+  int BNM;
+  int CNM;
+  int row = (Order == 'r' || Order == 'R');
+
+  verify_sdsblas2_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opAM = M;
+      opAK = K;
+      break;
+    default:
+      opAM = K;
+      opAK = M;
+      break;
+  }
+
+  switch(TransB){
+    case 'n':
+    case 'N':
+      opBK = K;
+      opBN = N;
+      break;
+    default:
+      opBK = N;
+      opBN = K;
+      break;
+  }
+
+  ANM = row ? opAM * lda : lda * opAK;
+  BNM = row ? opBK * ldb : ldb * opBN;
+  CNM = row ? M * ldc : ldc * N;
+
+  float *SA = util_smat_alloc(Order, opAM, opAK, lda);
+  float *SB = util_smat_alloc(Order, opBK, opBN, ldb);
+  double *A = util_dmat_alloc(Order, opAM, opAK, lda);
+  double *B = util_dmat_alloc(Order, opBK, opBN, ldb);
+  double *C = util_dmat_alloc(Order, M, N, ldc);
+  double *res = (double*)malloc(CNM * sizeof(double));
+  double *ref = (double*)malloc(CNM * sizeof(double));
+
+  util_smat_fill(Order, TransA, opAM, opAK, SA, lda, FillA, RealScaleA, ImagScaleA);
+  util_smat_fill(Order, TransB, opBK, opBN, SB, ldb, FillB, RealScaleB, ImagScaleB);
+  util_dmat_fill(Order, 'n', M, N, C, ldc, FillC, RealScaleC, ImagScaleC);
+  for(i = 0; i < ANM; i++){
+    A[i] = SA[i];
+  }
+  for(i = 0; i < BNM; i++){
+    B[i] = SB[i];
+  }
+
+  memcpy(ref, C, CNM * sizeof(double));
+  reproBLAS_rdgemm(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, A, lda, B, ldb, RealBeta, ref, ldc);
+  memcpy(res, C, CNM * sizeof(double));
+  reproBLAS_rdsgemm(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, SA, lda, SB, ldb, RealBeta, res, ldc);
+  rc |= compare("reproBLAS_rdsgemm", "reproBLAS_rdgemm", res, ref, CNM);
+  memcpy(res, C, CNM * sizeof(double));
+  reproBLAS_rdsgemm_64(fold._int.value, Order, TransA, TransB, M, N, K, RealAlpha, SA, lda, SB, ldb, RealBeta, res, ldc);
+  rc |= compare("reproBLAS_rdsgemm_64", "reproBLAS_rdgemm", res, ref, CNM);
+
+  //the first K elements of B and the first M elements of C serve as the vectors of the matrix-vector product
+  memcpy(ref, C, CNM * sizeof(double));
+  reproBLAS_rdgemv(fold._int.value, Order, TransA, opAM, opAK, RealAlpha, A, lda, B, 1, RealBeta, ref, 1);
+  memcpy(res, C, CNM * sizeof(double));
+  reproBLAS_rdsgemv(fold._int.value, Order, TransA, opAM, opAK, RealAlpha, SA, lda, SB, 1, RealBeta, res, 1);
+  rc |= compare("reproBLAS_rdsgemv", "reproBLAS_rdgemv", res, ref, CNM);
+  memcpy(res, C, CNM * sizeof(double));
+  reproBLAS_rdsgemv_64(fold._int.value, Order, TransA, opAM, opAK, RealAlpha, SA, lda, SB, 1, RealBeta, res, 1);
+  rc |= compare("reproBLAS_rdsgemv_64", "reproBLAS_rdgemv", res, ref, CNM);
+
+  if(fold._int.value == DIDEFAULTFOLD){
+    memcpy(ref, C, CNM * sizeof(double));
+    reproBLAS_dgemm(Order, TransA, TransB, M, N, K, RealAlpha, A, lda, B, ldb, RealBeta, ref, ldc);
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_dsgemm(Order, TransA, TransB, M, N, K, RealAlpha, SA, lda, SB, ldb, RealBeta, res, ldc);
+    rc |= compare("reproBLAS_dsgemm", "reproBLAS_dgemm", res, ref, CNM);
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_dsgemm_64(Order, TransA, TransB, M, N, K, RealAlpha, SA, lda, SB, ldb, RealBeta, res, ldc);
+    rc |= compare("reproBLAS_dsgemm_64", "reproBLAS_dgemm", res, ref, CNM);
+
+    memcpy(ref, C, CNM * sizeof(double));
+    reproBLAS_dgemv(Order, TransA, opAM, opAK, RealAlpha, A, lda, B, 1, RealBeta, ref, 1);
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_dsgemv(Order, TransA, opAM, opAK, RealAlpha, SA, lda, SB, 1, RealBeta, res, 1);
+    rc |= compare("reproBLAS_dsgemv", "reproBLAS_dgemv", res, ref, CNM);
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_dsgemv_64(Order, TransA, opAM, opAK, RealAlpha, SA, lda, SB, 1, RealBeta, res, 1);
+    rc |= compare("reproBLAS_dsgemv_64", "reproBLAS_dgemv", res, ref, CNM);
+  }
+
+  free(SA);
+  free(SB);
+  free(A);
+  free(B);
+  free(C);
+  free(res);
+  free(ref);
+
+  return rc;
+}
@@ -0,0 +1,207 @@
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../common/test_opt.h"
+#include "../../config.h"
+
+#include "../common/test_vecvec_fill_header.h"
+
+static opt_option fold;
+
+static void verify_segsum_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_SIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//sums that overflow to both infinities are invalid, and any invalid values are considered equal
+static int compare(const char *name, const char *ref, int n, const double *a, const double *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(double)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s[%d] = %a != %s = %a\n", name, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int scompare(const char *name, const char *ref, int n, const float *a, const float *b){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(a + i, b + i, sizeof(float)) != 0 && !(isnan(a[i]) && isnan(b[i]))){
+      printf("%s[%d] = %a != %s = %a\n", name, i, a[i], ref, b[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int vecvec_fill_show_help(void){
+  verify_segsum_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* vecvec_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_segsum_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify segsum fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int vecvec_fill_test(int argc, char** argv, int N, int FillX, double RealScaleX, double ImagScaleX, int incX, int FillY, double RealScaleY, double ImagScaleY, int incY){
+  int rc = 0;
+  int i;
+  int s;
+  int k;
+  int n;
+  int t;
+  int nseg;
+  int nkeys;
+  static const int counts[] = {1, 7, 300};
+  (void)FillY;
+  (void)RealScaleY;
+  (void)ImagScaleY;
+  (void)incY;
+
+  verify_segsum_options_initialize();
+
+  util_random_seed();
+
+  opt_eval_option(argc, argv, &fold);
+
+  double *X = util_dvec_alloc(N, incX);
+  float *SX = (float*)util_svec_alloc(N, incX);
+  double *W = (double*)malloc(N * sizeof(double));
+  float *SW = (float*)malloc(N * sizeof(float));
+  int *segptr = (int*)malloc((counts[2] + 1) * sizeof(int));
+  int64_t *segptr_64 = (int64_t*)malloc((counts[2] + 1) * sizeof(int64_t));
+  int *keys = (int*)malloc(N * sizeof(int));
+  int64_t *keys_64 = (int64_t*)malloc(N * sizeof(int64_t));
+  double *Y = (double*)malloc(counts[2] * sizeof(double));
+  double *ref = (double*)malloc(counts[2] * sizeof(double));
+  float *SY = (float*)malloc(counts[2] * sizeof(float));
+  float *sref = (float*)malloc(counts[2] * sizeof(float));
+
+  util_dvec_fill(N, X, incX, FillX, RealScaleX, ImagScaleX);
+  for(i = 0; i < N * incX; i++){
+    SX[i] = X[i];
+  }
+
+  for(t = 0; t < 3; t++){
+    //segments of uneven lengths, some of them empty
+    nseg = counts[t];
+    for(s = 0; s <= nseg; s++){
+      segptr[s] = (int)(((double)N * s * s) / ((double)nseg * nseg));
+      segptr_64[s] = segptr[s];
+    }
+    for(s = 0; s < nseg; s++){
+      ref[s] = reproBLAS_rdsum(fold._int.value, segptr[s + 1] - segptr[s], X + segptr[s] * incX, incX);
+      sref[s] = reproBLAS_rssum(fold._int.value, segptr[s + 1] - segptr[s], SX + segptr[s] * incX, incX);
+    }
+
+    reproBLAS_rdsegsum(fold._int.value, nseg, segptr, X, incX, Y, 1);
+    rc |= compare("reproBLAS_rdsegsum", "reproBLAS_rdsum", nseg, Y, ref);
+    reproBLAS_rdsegsum_64(fold._int.value, nseg, segptr_64, X, incX, Y, 1);
+    rc |= compare("reproBLAS_rdsegsum_64", "reproBLAS_rdsum", nseg, Y, ref);
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rdsegsum(fold._int.value, nseg, segptr, X, incX, Y, 1);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= compare("reproBLAS_rdsegsum(threaded)", "reproBLAS_rdsum", nseg, Y, ref);
+    reproBLAS_rssegsum(fold._int.value, nseg, segptr, SX, incX, SY, 1);
+    rc |= scompare("reproBLAS_rssegsum", "reproBLAS_rssum", nseg, SY, sref);
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rssegsum_64(fold._int.value, nseg, segptr_64, SX, incX, SY, 1);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= scompare("reproBLAS_rssegsum_64(threaded)", "reproBLAS_rssum", nseg, SY, sref);
+    if(fold._int.value == DIDEFAULTFOLD){
+      reproBLAS_dsegsum(nseg, segptr, X, incX, Y, 1);
+      rc |= compare("reproBLAS_dsegsum", "reproBLAS_rdsum", nseg, Y, ref);
+    }
+    if(fold._int.value == SIDEFAULTFOLD){
+      reproBLAS_ssegsum_64(nseg, segptr_64, SX, incX, SY, 1);
+      rc |= scompare("reproBLAS_ssegsum_64", "reproBLAS_rssum", nseg, SY, sref);
+    }
+
+    //keys scattered over X, with some elements left out of every key
+    nkeys = counts[t];
+    for(i = 0; i < N; i++){
+      keys[i] = i % 13 == 12 ? -1 : (int)(((int64_t)i * 7919) % nkeys);
+      keys_64[i] = keys[i];
+    }
+    for(k = 0; k < nkeys; k++){
+      n = 0;
+      for(i = 0; i < N; i++){
+        if(keys[i] == k){
+          W[n] = X[i * incX];
+          SW[n] = SX[i * incX];
+          n++;
+        }
+      }
+      ref[k] = reproBLAS_rdsum(fold._int.value, n, W, 1);
+      sref[k] = reproBLAS_rssum(fold._int.value, n, SW, 1);
+    }
+
+    reproBLAS_rdkeysum(fold._int.value, N, keys, X, incX, nkeys, Y, 1);
+    rc |= compare("reproBLAS_rdkeysum", "reproBLAS_rdsum", nkeys, Y, ref);
+    reproBLAS_rdkeysum_64(fold._int.value, N, keys_64, X, incX, nkeys, Y, 1);
+    rc |= compare("reproBLAS_rdkeysum_64", "reproBLAS_rdsum", nkeys, Y, ref);
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rdkeysum(fold._int.value, N, keys, X, incX, nkeys, Y, 1);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= compare("reproBLAS_rdkeysum(threaded)", "reproBLAS_rdsum", nkeys, Y, ref);
+    reproBLAS_rskeysum(fold._int.value, N, keys, SX, incX, nkeys, SY, 1);
+    rc |= scompare("reproBLAS_rskeysum", "reproBLAS_rssum", nkeys, SY, sref);
+    idxdPool_set_threshold(0);
+    idxdPool_set_num_threads(4);
+    reproBLAS_rskeysum_64(fold._int.value, N, keys_64, SX, incX, nkeys, SY, 1);
+    idxdPool_set_num_threads(1);
+    idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+    rc |= scompare("reproBLAS_rskeysum_64(threaded)", "reproBLAS_rssum", nkeys, SY, sref);
+    if(fold._int.value == DIDEFAULTFOLD){
+      reproBLAS_dkeysum(N, keys, X, incX, nkeys, Y, 1);
+      rc |= compare("reproBLAS_dkeysum", "reproBLAS_rdsum", nkeys, Y, ref);
+    }
+    if(fold._int.value == SIDEFAULTFOLD){
+      reproBLAS_skeysum_64(N, keys_64, SX, incX, nkeys, SY, 1);
+      rc |= scompare("reproBLAS_skeysum_64", "reproBLAS_rssum", nkeys, SY, sref);
+    }
+  }
+
+  free(X);
+  free(SX);
+  free(W);
+  free(SW);
+  free(segptr);
+  free(segptr_64);
+  free(keys);
+  free(keys_64);
+  free(Y);
+  free(ref);
+  free(SY);
+  free(sref);
+  return rc;
+}
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_BLAS.h"
+#include "../../config.h"
+
+#include "../common/test_matmat_fill_header.h"
+
+static opt_option fold;
+
+static void verify_syrk_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//compare the N by N rank-k update res (of elements of size bytes) to the matrix-matrix product ref. Elements in the triangle must match ref, elements across the diagonal must match the (conjugated) triangle if Uplo is 'a' and be untouched (equal to C) otherwise.
+static int compare(const char *name, const char *ref_name, char Order, char Uplo, int N, const void *res, const void *ref, const void *C, int ldc, size_t size, int herk){
+  int i;
+  int j;
+  int row = (Order == 'r' || Order == 'R');
+  int upper = (Uplo == 'u' || Uplo == 'U');
+  const char *res_ = (const char*)res;
+  const char *ref_ = (const char*)ref;
+  const char *C_ = (const char*)C;
+  const char *other;
+  size_t idx;
+  size_t tidx;
+  double z;
+
+  for(i = 0; i < N; i++){
+    for(j = 0; j < N; j++){
+      idx = (row ? (size_t)i * ldc + j : (size_t)j * ldc + i) * size;
+      tidx = (row ? (size_t)j * ldc + i : (size_t)i * ldc + j) * size;
+      if(i == j && herk){
+        //the diagonal of a hermitian matrix is real
+        z = 0.0;
+        if(memcmp(res_ + idx, ref_ + idx, size / 2) != 0 || memcmp(res_ + idx + size / 2, &z, size / 2) != 0){
+          printf("%s(%c)[%d, %d] != %s[%d, %d] (real diagonal)\n", name, Uplo, i, j, ref_name, i, j);
+          return 1;
+        }
+      }else if(i == j || (upper ? i < j : i > j)){
+        if(memcmp(res_ + idx, ref_ + idx, size) != 0){
+          printf("%s(%c)[%d, %d] != %s[%d, %d]\n", name, Uplo, i, j, ref_name, i, j);
+          return 1;
+        }
+      }else if(Uplo == 'a' || Uplo == 'A'){
+        other = res_ + tidx;
+        if(herk){
+          z = -((const double*)other)[1];
+          if(memcmp(res_ + idx, other, size / 2) != 0 || memcmp(res_ + idx + size / 2, &z, size / 2) != 0){
+            printf("%s(%c)[%d, %d] is not the conjugate of [%d, %d]\n", name, Uplo, i, j, j, i);
+            return 1;
+          }
+        }else if(memcmp(res_ + idx, other, size) != 0){
+          printf("%s(%c)[%d, %d] != [%d, %d]\n", name, Uplo, i, j, j, i);
+          return 1;
+        }
+      }else if(memcmp(res_ + idx, C_ + idx, size) != 0){
+        printf("%s(%c)[%d, %d] was modified outside of the triangle\n", name, Uplo, i, j);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int matmat_fill_show_help(void){
+  verify_syrk_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matmat_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_syrk_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify symmetric rank-k update fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB, int M, int N, int K, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double RealBeta, double ImagBeta, int FillC, double RealScaleC, double ImagScaleC, int ldc){
+  int rc = 0;
+  int i;
+  int u;
+  int opAM;
+  int opAK;
+  int ANM;
+  int CNM;
+  int row = (Order == 'r' || Order == 'R');
+  int trans = !(TransA == 'n' || TransA == 'N');
+  char Uplos[3] = {'u', 'l', 'a'};
+  char TransB_ = trans ? 'n' : 't';
+  double alpha[2] = {RealAlpha, 0.0};
+  double beta[2] = {RealBeta, 0.0};
+
+  verify_syrk_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  //C is M by M, with the padding of ldc kept
+  ldc = M + ldc - (row ? N : M);
+  opAM = trans ? K : M;
+  opAK = trans ? M : K;
+  ANM = row ? opAM * lda : lda * opAK;
+  CNM = M * ldc;
+
+  double *A = util_dmat_alloc(Order, opAM, opAK, lda);
+  double *C = util_dmat_alloc(Order, M, M, ldc);
+  double *res = (double*)malloc(CNM * sizeof(double));
+  double *ref = (double*)malloc(CNM * sizeof(double));
+  float *SA = (float*)malloc(ANM * sizeof(float));
+  float *SC = (float*)malloc(CNM * sizeof(float));
+  float *sres = (float*)malloc(CNM * sizeof(float));
+  float *sref = (float*)malloc(CNM * sizeof(float));
+  double *ZA = (double*)util_zmat_alloc(Order, opAM, opAK, lda);
+  double *ZC = (double*)util_zmat_alloc(Order, M, M, ldc);
+  double *zres = (double*)malloc(2 * CNM * sizeof(double));
+  double *zref = (double*)malloc(2 * CNM * sizeof(double));
+
+  util_dmat_fill(Order, TransA, opAM, opAK, A, lda, FillA, RealScaleA, ImagScaleA);
+  util_dmat_fill(Order, 'n', M, M, C, ldc, FillC, RealScaleC, ImagScaleC);
+  util_zmat_fill(Order, TransA, opAM, opAK, (double complex*)ZA, lda, FillA, RealScaleA, ImagScaleA);
+  util_zmat_fill(Order, 'n', M, M, (double complex*)ZC, ldc, FillC, RealScaleC, ImagScaleC);
+  for(i = 0; i < ANM; i++){
+    SA[i] = A[i];
+  }
+  for(i = 0; i < CNM; i++){
+    SC[i] = C[i];
+  }
+
+  memcpy(ref, C, CNM * sizeof(double));
+  reproBLAS_rdgemm(fold._int.value, Order, TransA, TransB_, M, M, K, RealAlpha, A, lda, A, lda, RealBeta, ref, ldc);
+  memcpy(sref, SC, CNM * sizeof(float));
+  reproBLAS_rsgemm(fold._int.value, Order, TransA, TransB_, M, M, K, RealAlpha, SA, lda, SA, lda, RealBeta, sref, ldc);
+  memcpy(zref, ZC, 2 * CNM * sizeof(double));
+  reproBLAS_rzgemm(fold._int.value, Order, trans ? 'c' : 'n', trans ? 'n' : 'c', M, M, K, alpha, ZA, lda, ZA, lda, beta, zref, ldc);
+
+  for(u = 0; u < 3; u++){
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_rdsyrk(fold._int.value, Order, Uplos[u], TransA, M, K, RealAlpha, A, lda, RealBeta, res, ldc);
+    rc |= compare("reproBLAS_rdsyrk", "reproBLAS_rdgemm", Order, Uplos[u], M, res, ref, C, ldc, sizeof(double), 0);
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_rdsyrk_64(fold._int.value, Order, Uplos[u], TransA, M, K, RealAlpha, A, lda, RealBeta, res, ldc);
+    rc |= compare("reproBLAS_rdsyrk_64", "reproBLAS_rdgemm", Order, Uplos[u], M, res, ref, C, ldc, sizeof(double), 0);
+
+    memcpy(sres, SC, CNM * sizeof(float));
+    reproBLAS_rssyrk(fold._int.value, Order, Uplos[u], TransA, M, K, RealAlpha, SA, lda, RealBeta, sres, ldc);
+    rc |= compare("reproBLAS_rssyrk", "reproBLAS_rsgemm", Order, Uplos[u], M, sres, sref, SC, ldc, sizeof(float), 0);
+
+    memcpy(zres, ZC, 2 * CNM * sizeof(double));
+    reproBLAS_rzherk(fold._int.value, Order, Uplos[u], trans ? 'c' : 'n', M, K, RealAlpha, ZA, lda, RealBeta, zres, ldc);
+    rc |= compare("reproBLAS_rzherk", "reproBLAS_rzgemm", Order, Uplos[u], M, zres, zref, ZC, ldc, 2 * sizeof(double), 1);
+    memcpy(zres, ZC, 2 * CNM * sizeof(double));
+    reproBLAS_rzherk_64(fold._int.value, Order, Uplos[u], trans ? 'c' : 'n', M, K, RealAlpha, ZA, lda, RealBeta, zres, ldc);
+    rc |= compare("reproBLAS_rzherk_64", "reproBLAS_rzgemm", Order, Uplos[u], M, zres, zref, ZC, ldc, 2 * sizeof(double), 1);
+  }
+
+  if(fold._int.value == DIDEFAULTFOLD){
+    memcpy(res, C, CNM * sizeof(double));
+    reproBLAS_dsyrk(Order, 'l', TransA, M, K, RealAlpha, A, lda, RealBeta, res, ldc);
+    rc |= compare("reproBLAS_dsyrk", "reproBLAS_rdgemm", Order, 'l', M, res, ref, C, ldc, sizeof(double), 0);
+    memcpy(zres, ZC, 2 * CNM * sizeof(double));
+    reproBLAS_zherk_64(Order, 'u', trans ? 'c' : 'n', M, K, RealAlpha, ZA, lda, RealBeta, zres, ldc);
+    rc |= compare("reproBLAS_zherk_64", "reproBLAS_rzgemm", Order, 'u', M, zres, zref, ZC, ldc, 2 * sizeof(double), 1);
+  }
+  if(fold._int.value == SIDEFAULTFOLD){
+    memcpy(sres, SC, CNM * sizeof(float));
+    reproBLAS_ssyrk_64(Order, 'a', TransA, M, K, RealAlpha, SA, lda, RealBeta, sres, ldc);
+    rc |= compare("reproBLAS_ssyrk_64", "reproBLAS_rsgemm", Order, 'a', M, sres, sref, SC, ldc, sizeof(float), 0);
+  }
+
+  free(A);
+  free(C);
+  free(res);
+  free(ref);
+  free(SA);
+  free(SC);
+  free(sres);
+  free(sref);
+  free(ZA);
+  free(ZC);
+  free(zres);
+  free(zref);
+
+  return rc;
+}
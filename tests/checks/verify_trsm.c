@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <idxdPool.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_BLAS.h"
+#include "../../config.h"
+
+#include "../common/test_matmat_fill_header.h"
+
+static opt_option fold;
+
+static void verify_trsm_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//element (p, q) of the matrix A
+static double *elem(char Order, double *A, int lda, int p, int q){
+  return (Order == 'r' || Order == 'R') ? A + (size_t)p * lda + q : A + (size_t)q * lda + p;
+}
+
+//unblocked triangular solve. Each element of the solution is accumulated with a single indexed dot product over all of the elements it depends on.
+static void ref_trsm(int fold, char Order, char Side, char Uplo, char TransA, char Diag, int M, int N, double alpha, double *A, int lda, double *B, int ldb){
+  int left = (Side == 'l' || Side == 'L');
+  int trans = !(TransA == 'n' || TransA == 'N');
+  int unit = (Diag == 'u' || Diag == 'U');
+  //the system is T*x = alpha*b, where T is op(A) if A is on the left and op(A)**T otherwise
+  int tt = (trans != !left);
+  int lower = ((Uplo == 'l' || Uplo == 'L') != tt);
+  int L = left ? M : N;
+  int R = left ? N : M;
+  int i;
+  int j;
+  int k;
+  int n;
+  int r;
+  double *T = (double*)malloc(L * sizeof(double));
+  double *NX = (double*)malloc(L * sizeof(double));
+  double *b;
+  double x;
+  double_indexed *YI = idxd_dialloc(fold);
+
+  for(r = 0; r < R; r++){
+    for(k = 0; k < L; k++){
+      i = lower ? k : L - 1 - k;
+      b = left ? elem(Order, B, ldb, i, r) : elem(Order, B, ldb, r, i);
+      idxd_didconv(fold, *b * alpha, YI);
+      n = 0;
+      for(j = lower ? 0 : i + 1; j < (lower ? i : L); j++){
+        T[n] = tt ? *elem(Order, A, lda, j, i) : *elem(Order, A, lda, i, j);
+        NX[n] = -*(left ? elem(Order, B, ldb, j, r) : elem(Order, B, ldb, r, j));
+        n++;
+      }
+      idxdBLAS_diddot(fold, n, T, 1, NX, 1, YI);
+      x = idxd_ddiconv(fold, YI);
+      if(!unit){
+        x /= *elem(Order, A, lda, i, i);
+      }
+      *b = x;
+    }
+  }
+  free(T);
+  free(NX);
+  free(YI);
+}
+
+static int compare(const char *name, char Side, char Uplo, char TransA, char Diag, int NM, const double *res, const double *ref){
+  if(memcmp(res, ref, NM * sizeof(double)) != 0){
+    printf("%s(Side=%c Uplo=%c TransA=%c Diag=%c) != unblocked solve\n", name, Side, Uplo, TransA, Diag);
+    return 1;
+  }
+  return 0;
+}
+
+int matmat_fill_show_help(void){
+  verify_trsm_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matmat_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_trsm_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify triangular solve fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB, int M, int N, int K, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double RealBeta, double ImagBeta, int FillC, double RealScaleC, double ImagScaleC, int ldc){
+  int rc = 0;
+  int i;
+  int j;
+  int s;
+  int u;
+  int d;
+  int ka;
+  int BNM;
+  int row = (Order == 'r' || Order == 'R');
+  int incX;
+  double amax;
+  char Sides[2] = {'l', 'r'};
+  char Uplos[2] = {'u', 'l'};
+  char Diags[2] = {'n', 'u'};
+
+  verify_trsm_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  //B is M by N, with the padding of ldc kept for A and B
+  ldb = ldc;
+  BNM = row ? M * ldb : ldb * N;
+
+  double *B = util_dmat_alloc(Order, M, N, ldb);
+  double *res = (double*)malloc(BNM * sizeof(double));
+  double *ref = (double*)malloc(BNM * sizeof(double));
+
+  util_dmat_fill(Order, 'n', M, N, B, ldb, FillB, RealScaleB, ImagScaleB);
+
+  for(s = 0; s < 2; s++){
+    ka = Sides[s] == 'l' ? M : N;
+    lda = ka + ldc - (row ? N : M);
+    double *A = util_dmat_alloc(Order, ka, ka, lda);
+    util_dmat_fill(Order, 'n', ka, ka, A, lda, FillA, RealScaleA, ImagScaleA);
+    //keep the solution from growing (or overflowing) by making the off-diagonal elements of each row sum to at most 1 in absolute value
+    amax = 0.0;
+    for(i = 0; i < ka; i++){
+      for(j = 0; j < ka; j++){
+        if(i != j && fabs(*elem(Order, A, lda, i, j)) > amax){
+          amax = fabs(*elem(Order, A, lda, i, j));
+        }
+      }
+    }
+    for(i = 0; i < ka; i++){
+      for(j = 0; j < ka; j++){
+        if(i == j){
+          *elem(Order, A, lda, i, j) = 1.0 + fabs(*elem(Order, A, lda, i, j));
+        }else{
+          *elem(Order, A, lda, i, j) /= amax * ka;
+        }
+      }
+    }
+
+    for(u = 0; u < 2; u++){
+      for(d = 0; d < 2; d++){
+        memcpy(ref, B, BNM * sizeof(double));
+        ref_trsm(fold._int.value, Order, Sides[s], Uplos[u], TransA, Diags[d], M, N, RealAlpha, A, lda, ref, ldb);
+
+        memcpy(res, B, BNM * sizeof(double));
+        reproBLAS_rdtrsm(fold._int.value, Order, Sides[s], Uplos[u], TransA, Diags[d], M, N, RealAlpha, A, lda, res, ldb);
+        rc |= compare("reproBLAS_rdtrsm", Sides[s], Uplos[u], TransA, Diags[d], BNM, res, ref);
+        memcpy(res, B, BNM * sizeof(double));
+        reproBLAS_rdtrsm_64(fold._int.value, Order, Sides[s], Uplos[u], TransA, Diags[d], M, N, RealAlpha, A, lda, res, ldb);
+        rc |= compare("reproBLAS_rdtrsm_64", Sides[s], Uplos[u], TransA, Diags[d], BNM, res, ref);
+
+        //the updates of the trailing rows are split among threads
+        idxdPool_set_threshold(0);
+        idxdPool_set_num_threads(4);
+        memcpy(res, B, BNM * sizeof(double));
+        reproBLAS_rdtrsm(fold._int.value, Order, Sides[s], Uplos[u], TransA, Diags[d], M, N, RealAlpha, A, lda, res, ldb);
+        idxdPool_set_num_threads(1);
+        idxdPool_set_threshold(idxdPool_DEFAULT_THRESHOLD);
+        rc |= compare("reproBLAS_rdtrsm (threaded)", Sides[s], Uplos[u], TransA, Diags[d], BNM, res, ref);
+
+        if(fold._int.value == DIDEFAULTFOLD){
+          memcpy(res, B, BNM * sizeof(double));
+          reproBLAS_dtrsm(Order, Sides[s], Uplos[u], TransA, Diags[d], M, N, RealAlpha, A, lda, res, ldb);
+          rc |= compare("reproBLAS_dtrsm", Sides[s], Uplos[u], TransA, Diags[d], BNM, res, ref);
+        }
+
+        if(Sides[s] == 'l'){
+          //the first column of B is solved as a vector
+          incX = row ? ldb : 1;
+          memcpy(ref, B, BNM * sizeof(double));
+          ref_trsm(fold._int.value, Order, 'l', Uplos[u], TransA, Diags[d], M, 1, 1.0, A, lda, ref, ldb);
+          memcpy(res, B, BNM * sizeof(double));
+          reproBLAS_rdtrsv(fold._int.value, Order, Uplos[u], TransA, Diags[d], M, A, lda, res, incX);
+          rc |= compare("reproBLAS_rdtrsv", 'l', Uplos[u], TransA, Diags[d], BNM, res, ref);
+          memcpy(res, B, BNM * sizeof(double));
+          reproBLAS_rdtrsv_64(fold._int.value, Order, Uplos[u], TransA, Diags[d], M, A, lda, res, incX);
+          rc |= compare("reproBLAS_rdtrsv_64", 'l', Uplos[u], TransA, Diags[d], BNM, res, ref);
+          if(fold._int.value == DIDEFAULTFOLD){
+            memcpy(res, B, BNM * sizeof(double));
+            reproBLAS_dtrsv_64(Order, Uplos[u], TransA, Diags[d], M, A, lda, res, incX);
+            rc |= compare("reproBLAS_dtrsv_64", 'l', Uplos[u], TransA, Diags[d], BNM, res, ref);
+          }
+        }
+      }
+    }
+    free(A);
+  }
+
+  free(B);
+  free(res);
+  free(ref);
+
+  return rc;
+}
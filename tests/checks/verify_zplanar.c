@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include <idxd.h>
+#include <idxdBLAS.h>
+#include <reproBLAS.h>
+
+#include "../common/test_opt.h"
+#include "../common/test_BLAS.h"
+#include "../../config.h"
+
+#include "../common/test_matmat_fill_header.h"
+
+static opt_option fold;
+
+static void verify_zplanar_options_initialize(void){
+  fold._int.header.type       = opt_int;
+  fold._int.header.short_name = 'k';
+  fold._int.header.long_name  = "fold";
+  fold._int.header.help       = "fold";
+  fold._int.required          = 0;
+  fold._int.min               = 2;
+  fold._int.max               = idxd_DIMAXFOLD;
+  fold._int.value             = DIDEFAULTFOLD;
+}
+
+//compare the planar result (resR, resI) to the interleaved result ref
+static int compare(const char *name, const char *ref_name, const double *resR, const double *resI, const double *ref, int n){
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(memcmp(resR + i, ref + 2 * i, sizeof(double)) != 0 || memcmp(resI + i, ref + 2 * i + 1, sizeof(double)) != 0){
+      printf("%s(planar)[%d] = %a + %ai != %s(interleaved)[%d] = %a + %ai\n", name, i, resR[i], resI[i], ref_name, i, ref[2 * i], ref[2 * i + 1]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int matmat_fill_show_help(void){
+  verify_zplanar_options_initialize();
+
+  opt_show_option(fold);
+  return 0;
+}
+
+const char* matmat_fill_name(int argc, char** argv){
+  static char name_buffer[MAX_LINE];
+
+  verify_zplanar_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+  snprintf(name_buffer, MAX_LINE * sizeof(char), "Verify planar complex matrix input fold=%d", fold._int.value);
+  return name_buffer;
+}
+
+int matmat_fill_test(int argc, char** argv, char Order, char TransA, char TransB, int M, int N, int K, double RealAlpha, double ImagAlpha, int FillA, double RealScaleA, double ImagScaleA, int lda, int FillB, double RealScaleB, double ImagScaleB, int ldb, double RealBeta, double ImagBeta, int FillC, double RealScaleC, double ImagScaleC, int ldc){
+  int rc = 0;
+  int opAM;
+  int opAK;
+  int opBK;
+  int opBN;
+  int ANM;
+  int BNM;
+  int CNM;
+  int row = (Order == 'r' || Order == 'R');
+  double alpha[2] = {RealAlpha, ImagAlpha};
+  double beta[2] = {RealBeta, ImagBeta};
+
+  verify_zplanar_options_initialize();
+
+  opt_eval_option(argc, argv, &fold);
+
+  util_random_seed();
+
+  switch(TransA){
+    case 'n':
+    case 'N':
+      opAM = M;
+      opAK = K;
+      break;
+    default:
+      opAM = K;
+      opAK = M;
+      break;
+  }
+
+  switch(TransB){
+    case 'n':
+    case 'N':
+      opBK = K;
+      opBN = N;
+      break;
+    default:
+      opBK = N;
+      opBN = K;
+      break;
+  }
+
+  ANM = row ? opAM * lda : lda * opAK;
+  BNM = row ? opBK * ldb : ldb * opBN;
+  CNM = row ? M * ldc : ldc * N;
+
+  double *A = (double*)util_zmat_alloc(Order, opAM, opAK, lda);
+  double *B = (double*)util_zmat_alloc(Order, opBK, opBN, ldb);
+  double *C = (double*)util_zmat_alloc(Order, M, N, ldc);
+  double *AR = (double*)malloc(ANM * sizeof(double));
+  double *AI = (double*)malloc(ANM * sizeof(double));
+  double *BR = (double*)malloc(BNM * sizeof(double));
+  double *BI = (double*)malloc(BNM * sizeof(double));
+  double *CR = (double*)malloc(CNM * sizeof(double));
+  double *CI = (double*)malloc(CNM * sizeof(double));
+  double *X = (double*)util_zvec_alloc(K, 1);
+  double *Y = (double*)util_zvec_alloc(M, 1);
+  double *XR = (double*)malloc(K * sizeof(double));
+  double *XI = (double*)malloc(K * sizeof(double));
+  double *YR = (double*)malloc(M * sizeof(double));
+  double *YI = (double*)malloc(M * sizeof(double));
+  double *ref = (double*)malloc(2 * CNM * sizeof(double));
+
+  util_zmat_fill(Order, TransA, opAM, opAK, (double complex*)A, lda, FillA, RealScaleA, ImagScaleA);
+  util_zmat_fill(Order, TransB, opBK, opBN, (double complex*)B, ldb, FillB, RealScaleB, ImagScaleB);
+  util_zmat_fill(Order, 'n', M, N, (double complex*)C, ldc, FillC, RealScaleC, ImagScaleC);
+  util_zvec_fill(K, (double complex*)X, 1, FillB, RealScaleB, ImagScaleB);
+  util_zvec_fill(M, (double complex*)Y, 1, FillC, RealScaleC, ImagScaleC);
+
+  //the whole storage of each matrix is split at once, as a vector
+  idxdBLAS_zdeinterleave(ANM, A, 1, AR, AI);
+  idxdBLAS_zdeinterleave(BNM, B, 1, BR, BI);
+  idxdBLAS_zdeinterleave(K, X, 1, XR, XI);
+
+  memcpy(ref, C, 2 * CNM * sizeof(double));
+  reproBLAS_rzgemm(fold._int.value, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, ref, ldc);
+  idxdBLAS_zdeinterleave(CNM, C, 1, CR, CI);
+  reproBLAS_rzgemm_planar(fold._int.value, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+  rc |= compare("reproBLAS_rzgemm_planar", "reproBLAS_rzgemm", CR, CI, ref, CNM);
+  idxdBLAS_zdeinterleave(CNM, C, 1, CR, CI);
+  reproBLAS_rzgemm_planar_64(fold._int.value, Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+  rc |= compare("reproBLAS_rzgemm_planar_64", "reproBLAS_rzgemm", CR, CI, ref, CNM);
+
+  //op(A) is M by K, so X is of length K and Y of length M
+  memcpy(ref, Y, 2 * M * sizeof(double));
+  reproBLAS_rzgemv(fold._int.value, Order, TransA, opAM, opAK, alpha, A, lda, X, 1, beta, ref, 1);
+  idxdBLAS_zdeinterleave(M, Y, 1, YR, YI);
+  reproBLAS_rzgemv_planar(fold._int.value, Order, TransA, opAM, opAK, alpha, AR, AI, lda, XR, XI, 1, beta, YR, YI, 1);
+  rc |= compare("reproBLAS_rzgemv_planar", "reproBLAS_rzgemv", YR, YI, ref, M);
+  idxdBLAS_zdeinterleave(M, Y, 1, YR, YI);
+  reproBLAS_rzgemv_planar_64(fold._int.value, Order, TransA, opAM, opAK, alpha, AR, AI, lda, XR, XI, 1, beta, YR, YI, 1);
+  rc |= compare("reproBLAS_rzgemv_planar_64", "reproBLAS_rzgemv", YR, YI, ref, M);
+
+  if(fold._int.value == DIDEFAULTFOLD){
+    memcpy(ref, C, 2 * CNM * sizeof(double));
+    reproBLAS_zgemm(Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, ref, ldc);
+    idxdBLAS_zdeinterleave(CNM, C, 1, CR, CI);
+    reproBLAS_zgemm_planar(Order, TransA, TransB, M, N, K, alpha, AR, AI, lda, BR, BI, ldb, beta, CR, CI, ldc);
+    rc |= compare("reproBLAS_zgemm_planar", "reproBLAS_zgemm", CR, CI, ref, CNM);
+
+    memcpy(ref, Y, 2 * M * sizeof(double));
+    reproBLAS_zgemv(Order, TransA, opAM, opAK, alpha, A, lda, X, 1, beta, ref, 1);
+    idxdBLAS_zdeinterleave(M, Y, 1, YR, YI);
+    reproBLAS_zgemv_planar_64(Order, TransA, opAM, opAK, alpha, AR, AI, lda, XR, XI, 1, beta, YR, YI, 1);
+    rc |= compare("reproBLAS_zgemv_planar_64", "reproBLAS_zgemv", YR, YI, ref, M);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(AR);
+  free(AI);
+  free(BR);
+  free(BI);
+  free(CR);
+  free(CI);
+  free(X);
+  free(Y);
+  free(XR);
+  free(XI);
+  free(YR);
+  free(YI);
+  free(ref);
+
+  return rc;
+}
@@ -4,6 +4,7 @@
 #include <reproBLAS.h>
 #include <idxdBLAS.h>
 #include <idxd.h>
+#include <idxdInline.h>
 #include "../../config.h"
 
 #include "../common/test_util.h"
@@ -15,26 +16,29 @@ typedef enum wrap_daugsum_func {
   wrap_daugsum_RDDOT,
   wrap_daugsum_DIDIADD,
   wrap_daugsum_DIDADD,
-  wrap_daugsum_DIDDEPOSIT
+  wrap_daugsum_DIDDEPOSIT,
+  wrap_daugsum_DIDDEPOSITINLINE
 } wrap_daugsum_func_t;
 
 typedef double (*wrap_daugsum)(int, int, double*, int, double*, int);
 typedef void (*wrap_diaugsum)(int, int, double*, int, double*, int, double_indexed*);
-static const int wrap_daugsum_func_n_names = 7;
+static const int wrap_daugsum_func_n_names = 8;
 static const char* wrap_daugsum_func_names[] = {"rdsum",
                                                 "rdasum",
                                                 "rdnrm2",
                                                 "rddot",
                                                 "didiadd",
                                                 "didadd",
-                                                "diddeposit"};
+                                                "diddeposit",
+                                                "diddepositinline"};
 static const char* wrap_daugsum_func_descs[] = {"rdsum",
                                                 "rdasum",
                                                 "rdnrm2",
                                                 "rddot",
                                                 "didiadd",
                                                 "didadd",
-                                                "diddeposit"};
+                                                "diddeposit",
+                                                "diddepositinline"};
 
 double wrap_rdsum(int fold, int N, double *x, int incx, double *y, int incy) {
   (void)y;
@@ -189,6 +193,47 @@ void wrap_diddeposit(int fold, int N, double *x, int incx, double *y, int incy,
   idxd_direnorm(fold, z);
 }
 
+double wrap_rdiddepositinline(int fold, int N, double *x, int incx, double *y, int incy) {
+  (void)y;
+  (void)incy;
+  double_indexed *ires = idxd_dialloc(fold);
+  idxd_disetzero(fold, ires);
+  double amax = idxdBLAS_damax(N, x, incx);
+  idxdInline_didupdate(fold, amax, ires);
+  int i;
+  int j = 0;
+  for(i = 0; i < N; i++){
+    if(j >= idxd_DIENDURANCE){
+      idxdInline_direnorm(fold, ires);
+      j = 0;
+    }
+    idxdInline_diddeposit(fold, x[i * incx], ires);
+    j++;
+  }
+  idxdInline_direnorm(fold, ires);
+  double res = idxdInline_ddiconv(fold, ires);
+  free(ires);
+  return res;
+}
+
+void wrap_diddepositinline(int fold, int N, double *x, int incx, double *y, int incy, double_indexed *z) {
+  (void)y;
+  (void)incy;
+  double amax = idxdBLAS_damax(N, x, incx);
+  idxdInline_didupdate(fold, amax, z);
+  int i;
+  int j = 0;
+  for(i = 0; i < N; i++){
+    if(j >= idxd_DIENDURANCE){
+      idxdInline_direnorm(fold, z);
+      j = 0;
+    }
+    idxdInline_diddeposit(fold, x[i * incx], z);
+    j++;
+  }
+  idxdInline_direnorm(fold, z);
+}
+
 wrap_daugsum wrap_daugsum_func(wrap_daugsum_func_t func) {
   switch(func){
     case wrap_daugsum_RDSUM:
@@ -205,6 +250,8 @@ wrap_daugsum wrap_daugsum_func(wrap_daugsum_func_t func) {
       return wrap_rdidadd;
     case wrap_daugsum_DIDDEPOSIT:
       return wrap_rdiddeposit;
+    case wrap_daugsum_DIDDEPOSITINLINE:
+      return wrap_rdiddepositinline;
   }
   return NULL;
 }
@@ -225,6 +272,8 @@ wrap_diaugsum wrap_diaugsum_func(wrap_daugsum_func_t func) {
       return wrap_didadd;
     case wrap_daugsum_DIDDEPOSIT:
       return wrap_diddeposit;
+    case wrap_daugsum_DIDDEPOSITINLINE:
+      return wrap_diddepositinline;
   }
   return NULL;
 }
@@ -237,6 +286,7 @@ double wrap_daugsum_result(int N, wrap_daugsum_func_t func, util_vec_fill_t Fill
     case wrap_daugsum_DIDIADD:
     case wrap_daugsum_DIDADD:
     case wrap_daugsum_DIDDEPOSIT:
+    case wrap_daugsum_DIDDEPOSITINLINE:
       switch(FillX){
         case util_Vec_Constant:
           return N * RealScaleX;
@@ -466,6 +516,7 @@ double wrap_daugsum_bound(int fold, int N, wrap_daugsum_func_t func, double *X,
     case wrap_daugsum_DIDIADD:
     case wrap_daugsum_DIDADD:
     case wrap_daugsum_DIDDEPOSIT:
+    case wrap_daugsum_DIDDEPOSITINLINE:
     case wrap_daugsum_RDASUM:
       return idxd_dibound(fold, N, idxdBLAS_damax(N, X, incX), res);
     case wrap_daugsum_RDNRM2:
@@ -4,6 +4,7 @@
 #include <reproBLAS.h>
 #include <idxdBLAS.h>
 #include <idxd.h>
+#include <idxdInline.h>
 #include "../../config.h"
 
 #include "../common/test_util.h"
@@ -15,26 +16,29 @@ typedef enum wrap_saugsum_func {
   wrap_saugsum_RSDOT,
   wrap_saugsum_SISIADD,
   wrap_saugsum_SISADD,
-  wrap_saugsum_SISDEPOSIT
+  wrap_saugsum_SISDEPOSIT,
+  wrap_saugsum_SISDEPOSITINLINE
 } wrap_saugsum_func_t;
 
 typedef float (*wrap_saugsum)(int, int, float*, int, float*, int);
 typedef void (*wrap_siaugsum)(int, int, float*, int, float*, int, float_indexed*);
-static const int wrap_saugsum_func_n_names = 7;
+static const int wrap_saugsum_func_n_names = 8;
 static const char* wrap_saugsum_func_names[] = {"rssum",
                                                 "rsasum",
                                                 "rsnrm2",
                                                 "rsdot",
                                                 "sisiadd",
                                                 "sisadd",
-                                                "sisdeposit"};
+                                                "sisdeposit",
+                                                "sisdepositinline"};
 static const char* wrap_saugsum_func_descs[] = {"rssum",
                                                 "rsasum",
                                                 "rsnrm2",
                                                 "rsdot",
                                                 "sisiadd",
                                                 "sisadd",
-                                                "sisdeposit"};
+                                                "sisdeposit",
+                                                "sisdepositinline"};
 
 float wrap_rssum(int fold, int N, float *x, int incx, float *y, int incy) {
   (void)y;
@@ -189,6 +193,47 @@ void wrap_sisdeposit(int fold, int N, float *x, int incx, float *y, int incy, fl
   idxd_sirenorm(fold, z);
 }
 
+float wrap_rsisdepositinline(int fold, int N, float *x, int incx, float *y, int incy) {
+  (void)y;
+  (void)incy;
+  float_indexed *ires = idxd_sialloc(fold);
+  idxd_sisetzero(fold, ires);
+  float amax = idxdBLAS_samax(N, x, incx);
+  idxdInline_sisupdate(fold, amax, ires);
+  int i;
+  int j = 0;
+  for(i = 0; i < N; i++){
+    if(j >= idxd_SIENDURANCE){
+      idxdInline_sirenorm(fold, ires);
+      j = 0;
+    }
+    idxdInline_sisdeposit(fold, x[i * incx], ires);
+    j++;
+  }
+  idxdInline_sirenorm(fold, ires);
+  float res = idxdInline_ssiconv(fold, ires);
+  free(ires);
+  return res;
+}
+
+void wrap_sisdepositinline(int fold, int N, float *x, int incx, float *y, int incy, float_indexed *z) {
+  (void)y;
+  (void)incy;
+  float amax = idxdBLAS_samax(N, x, incx);
+  idxdInline_sisupdate(fold, amax, z);
+  int i;
+  int j = 0;
+  for(i = 0; i < N; i++){
+    if(j >= idxd_SIENDURANCE){
+      idxdInline_sirenorm(fold, z);
+      j = 0;
+    }
+    idxdInline_sisdeposit(fold, x[i * incx], z);
+    j++;
+  }
+  idxdInline_sirenorm(fold, z);
+}
+
 wrap_saugsum wrap_saugsum_func(wrap_saugsum_func_t func) {
   switch(func){
     case wrap_saugsum_RSSUM:
@@ -205,6 +250,8 @@ wrap_saugsum wrap_saugsum_func(wrap_saugsum_func_t func) {
       return wrap_rsisadd;
     case wrap_saugsum_SISDEPOSIT:
       return wrap_rsisdeposit;
+    case wrap_saugsum_SISDEPOSITINLINE:
+      return wrap_rsisdepositinline;
   }
   return NULL;
 }
@@ -225,6 +272,8 @@ wrap_siaugsum wrap_siaugsum_func(wrap_saugsum_func_t func) {
       return wrap_sisadd;
     case wrap_saugsum_SISDEPOSIT:
       return wrap_sisdeposit;
+    case wrap_saugsum_SISDEPOSITINLINE:
+      return wrap_sisdepositinline;
   }
   return NULL;
 }
@@ -237,6 +286,7 @@ float wrap_saugsum_result(int N, wrap_saugsum_func_t func, util_vec_fill_t FillX
     case wrap_saugsum_SISIADD:
     case wrap_saugsum_SISADD:
     case wrap_saugsum_SISDEPOSIT:
+    case wrap_saugsum_SISDEPOSITINLINE:
       switch(FillX){
         case util_Vec_Constant:
           return N * RealScaleX;
@@ -466,6 +516,7 @@ float wrap_saugsum_bound(int fold, int N, wrap_saugsum_func_t func, float *X, in
     case wrap_saugsum_SISIADD:
     case wrap_saugsum_SISADD:
     case wrap_saugsum_SISDEPOSIT:
+    case wrap_saugsum_SISDEPOSITINLINE:
     case wrap_saugsum_RSASUM:
       return idxd_sibound(fold, N, idxdBLAS_samax(N, X, incX), res);
     case wrap_saugsum_RSNRM2: